@@ -666,6 +666,8 @@ bool SaPCollisionManager<S>::distance_(CollisionObject<S>* obj, void* cdata, Dis
 
   EndPoint* start_pos = elist[axis];
 
+  const bool use_tested_set = this->isTestedSetEnabled();
+
   while(1)
   {
     old_min_distance = min_dist;
@@ -699,7 +701,7 @@ bool SaPCollisionManager<S>::distance_(CollisionObject<S>* obj, void* cdata, Dis
         CollisionObject<S>* curr_obj = pos->aabb->obj;
         if(curr_obj != obj)
         {
-          if(!this->enable_tested_set_)
+          if(!use_tested_set)
           {
             if(pos->aabb->cached.distance(obj->getAABB()) < min_dist)
             {
@@ -709,15 +711,13 @@ bool SaPCollisionManager<S>::distance_(CollisionObject<S>* obj, void* cdata, Dis
           }
           else
           {
-            if(!this->inTestedSet(curr_obj, obj))
+            if(this->insertTestedSet(curr_obj, obj))
             {
               if(pos->aabb->cached.distance(obj->getAABB()) < min_dist)
               {
                 if(callback(curr_obj, obj, cdata, min_dist))
                   return true;
               }
-
-              this->insertTestedSet(curr_obj, obj);
             }
           }
         }
@@ -787,8 +787,7 @@ void SaPCollisionManager<S>::distance(void* cdata, DistanceCallBack<S> callback)
 {
   if(size() == 0) return;
 
-  this->enable_tested_set_ = true;
-  this->tested_set.clear();
+  this->enableTestedSet();
 
   S min_dist = std::numeric_limits<S>::max();
 
@@ -798,8 +797,7 @@ void SaPCollisionManager<S>::distance(void* cdata, DistanceCallBack<S> callback)
       break;
   }
 
-  this->enable_tested_set_ = false;
-  this->tested_set.clear();
+  this->disableTestedSet();
 }
 
 //==============================================================================
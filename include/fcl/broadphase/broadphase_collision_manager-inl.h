@@ -40,7 +40,10 @@
 
 #include "fcl/broadphase/broadphase_collision_manager.h"
 
+#include <cassert>
+
 #include "fcl/common/unused.h"
+#include "fcl/common/detail/parallel.h"
 
 namespace fcl {
 
@@ -51,7 +54,6 @@ class FCL_EXPORT BroadPhaseCollisionManager<double>;
 //==============================================================================
 template <typename S>
 BroadPhaseCollisionManager<S>::BroadPhaseCollisionManager()
-  : enable_tested_set_(false)
 {
   // Do nothing
 }
@@ -91,22 +93,116 @@ void BroadPhaseCollisionManager<S>::update(
   update();
 }
 
+//==============================================================================
+template <typename S>
+void BroadPhaseCollisionManager<S>::collideMany(
+    const std::vector<CollisionObject<S>*>& queries,
+    const std::vector<void*>& cdata,
+    CollisionCallBack<S> callback,
+    const BroadPhaseParallelOptions& options) const
+{
+  assert(cdata.size() == queries.size());
+
+  detail::parallelForChunks(queries.size(), options.num_threads, 16,
+                            [&](unsigned int, size_t begin, size_t end)
+  {
+    for(size_t i = begin; i < end; ++i)
+      collide(queries[i], cdata[i], callback);
+  });
+}
+
+//==============================================================================
+template <typename S>
+void BroadPhaseCollisionManager<S>::distanceMany(
+    const std::vector<CollisionObject<S>*>& queries,
+    const std::vector<void*>& cdata,
+    DistanceCallBack<S> callback,
+    const BroadPhaseParallelOptions& options) const
+{
+  assert(cdata.size() == queries.size());
+
+  detail::parallelForChunks(queries.size(), options.num_threads, 16,
+                            [&](unsigned int, size_t begin, size_t end)
+  {
+    for(size_t i = begin; i < end; ++i)
+      distance(queries[i], cdata[i], callback);
+  });
+}
+
+//==============================================================================
+template <typename S>
+void BroadPhaseCollisionManager<S>::enableTestedSet() const
+{
+  TestedSetStack& stack = testedSetStack();
+  if(stack.depth == stack.frames.size())
+    stack.frames.emplace_back(new TestedSetFrame);
+
+  stack.frames[stack.depth]->owner = this;
+  ++stack.depth;
+}
+
+//==============================================================================
+template <typename S>
+void BroadPhaseCollisionManager<S>::disableTestedSet() const
+{
+  TestedSetStack& stack = testedSetStack();
+  assert(stack.depth > 0);
+  assert(stack.frames[stack.depth - 1]->owner == this);
+
+  --stack.depth;
+  TestedSetFrame& frame = *stack.frames[stack.depth];
+  frame.owner = nullptr;
+  frame.pairs.clear();
+}
+
+//==============================================================================
+template <typename S>
+bool BroadPhaseCollisionManager<S>::isTestedSetEnabled() const
+{
+  return findTestedSet() != nullptr;
+}
+
 //==============================================================================
 template <typename S>
 bool BroadPhaseCollisionManager<S>::inTestedSet(
     CollisionObject<S>* a, CollisionObject<S>* b) const
 {
-  if(a < b) return tested_set.find(std::make_pair(a, b)) != tested_set.end();
-  else return tested_set.find(std::make_pair(b, a)) != tested_set.end();
+  const TestedSet* pairs = findTestedSet();
+  return pairs && pairs->contains(a, b);
 }
 
 //==============================================================================
 template <typename S>
-void BroadPhaseCollisionManager<S>::insertTestedSet(
+bool BroadPhaseCollisionManager<S>::insertTestedSet(
     CollisionObject<S>* a, CollisionObject<S>* b) const
 {
-  if(a < b) tested_set.insert(std::make_pair(a, b));
-  else tested_set.insert(std::make_pair(b, a));
+  TestedSet* pairs = findTestedSet();
+  assert(pairs);
+  return pairs->insert(a, b);
+}
+
+//==============================================================================
+template <typename S>
+typename BroadPhaseCollisionManager<S>::TestedSetStack&
+BroadPhaseCollisionManager<S>::testedSetStack()
+{
+  static thread_local TestedSetStack stack;
+  return stack;
+}
+
+//==============================================================================
+template <typename S>
+typename BroadPhaseCollisionManager<S>::TestedSet*
+BroadPhaseCollisionManager<S>::findTestedSet() const
+{
+  TestedSetStack& stack = testedSetStack();
+  for(size_t i = stack.depth; i > 0; --i)
+  {
+    if(stack.frames[i - 1]->owner == this)
+      return &stack.frames[i - 1]->pairs;
+  }
+
+  return nullptr;
 }
 
 } // namespace fcl
@@ -38,10 +38,12 @@
 #ifndef FCL_BROADPHASE_BROADPHASECOLLISIONMANAGER_H
 #define FCL_BROADPHASE_BROADPHASECOLLISIONMANAGER_H
 
-#include <set>
+#include <memory>
 #include <vector>
 
 #include "fcl/narrowphase/collision_object.h"
+#include "fcl/broadphase/broadphase_parallel_options.h"
+#include "fcl/broadphase/detail/pointer_pair_set.h"
 
 namespace fcl
 {
@@ -103,6 +105,20 @@ public:
   /// @brief perform distance computation between one object and all the objects belonging to the manager
   virtual void distance(CollisionObject<S>* obj, void* cdata, DistanceCallBack<S> callback) const = 0;
 
+  /// @brief perform collision test between each query object and all the
+  /// objects belonging to the manager. This gives the same results as calling
+  /// collide(queries[i], cdata[i], callback) for every i, and the callback
+  /// returning true only stops the query it was called for. Queries run on
+  /// options.num_threads threads (one unless requested otherwise), but all the
+  /// callbacks of one query are called on the same thread, so the user data of
+  /// each query needs no locking.
+  virtual void collideMany(const std::vector<CollisionObject<S>*>& queries, const std::vector<void*>& cdata, CollisionCallBack<S> callback, const BroadPhaseParallelOptions& options = BroadPhaseParallelOptions()) const;
+
+  /// @brief perform distance computation between each query object and all
+  /// the objects belonging to the manager, with the same guarantees as
+  /// collideMany()
+  virtual void distanceMany(const std::vector<CollisionObject<S>*>& queries, const std::vector<void*>& cdata, DistanceCallBack<S> callback, const BroadPhaseParallelOptions& options = BroadPhaseParallelOptions()) const;
+
   /// @brief perform collision test for the objects belonging to the manager (i.e., N^2 self collision)
   virtual void collide(void* cdata, CollisionCallBack<S> callback) const = 0;
 
@@ -123,13 +139,49 @@ public:
 
 protected:
 
-  /// @brief tools help to avoid repeating collision or distance callback for the pairs of objects tested before. It can be useful for some of the broadphase algorithms.
-  mutable std::set<std::pair<CollisionObject<S>*, CollisionObject<S>*> > tested_set;
-  mutable bool enable_tested_set_;
+  /// @brief tools help to avoid repeating collision or distance callback for
+  /// the pairs of objects tested before. It can be useful for some of the
+  /// broadphase algorithms.
+  ///
+  /// The tested pairs are stored per thread, so that the const query methods
+  /// of one manager can be called concurrently. enableTestedSet() and
+  /// disableTestedSet() must be called in pairs on the same thread; queries on
+  /// other managers may be nested in between (e.g., from a callback).
+  void enableTestedSet() const;
+
+  void disableTestedSet() const;
+
+  bool isTestedSetEnabled() const;
 
   bool inTestedSet(CollisionObject<S>* a, CollisionObject<S>* b) const;
 
-  void insertTestedSet(CollisionObject<S>* a, CollisionObject<S>* b) const;
+  /// @brief Record the pair (a, b) as tested. Return true if the pair was not
+  /// tested before.
+  bool insertTestedSet(CollisionObject<S>* a, CollisionObject<S>* b) const;
+
+private:
+
+  using TestedSet = detail::PointerPairSet<CollisionObject<S>>;
+
+  struct TestedSetFrame
+  {
+    const BroadPhaseCollisionManager<S>* owner;
+    TestedSet pairs;
+  };
+
+  /// @brief The tested sets of the calling thread, one per enabled query. The
+  /// frames are kept after the queries end so that their storage is reused.
+  struct TestedSetStack
+  {
+    std::vector<std::unique_ptr<TestedSetFrame>> frames;
+    size_t depth = 0;
+  };
+
+  static TestedSetStack& testedSetStack();
+
+  /// @brief The tested set of this manager on the calling thread, or nullptr
+  /// if it is not enabled
+  TestedSet* findTestedSet() const;
 
 };
 
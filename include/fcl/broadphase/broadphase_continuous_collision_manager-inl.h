@@ -40,7 +40,12 @@
 
 #include "fcl/broadphase/broadphase_continuous_collision_manager.h"
 
+#include <algorithm>
+
 #include "fcl/common/unused.h"
+#include "fcl/common/detail/parallel.h"
+#include "fcl/math/motion/translation_motion.h"
+#include "fcl/narrowphase/continuous_collision.h"
 
 namespace fcl {
 
@@ -91,6 +96,191 @@ void BroadPhaseContinuousCollisionManager<S>::update(
   update();
 }
 
+namespace detail {
+
+//==============================================================================
+template <typename S>
+using ContinuousCollisionPairs = std::vector<std::pair<
+    ContinuousCollisionObject<S>*, ContinuousCollisionObject<S>*>>;
+
+//==============================================================================
+template <typename S>
+bool collectContinuousCollisionPair(
+    ContinuousCollisionObject<S>* o1, ContinuousCollisionObject<S>* o2,
+    void* cdata)
+{
+  static_cast<ContinuousCollisionPairs<S>*>(cdata)->emplace_back(o1, o2);
+  return false;
+}
+
+//==============================================================================
+/// @brief Lower bound of the time of contact of two objects: the time at which
+/// their AABBs start to overlap. It is only computed for translation motions,
+/// whose AABB at time t is the AABB at time 0 moved by t times the
+/// displacement; other motions get 0.
+template <typename S>
+S computeSweptAABBEntryTime(
+    const ContinuousCollisionObject<S>& o1,
+    const ContinuousCollisionObject<S>& o2)
+{
+  const auto* motion1 = dynamic_cast<const TranslationMotion<S>*>(o1.getMotion());
+  const auto* motion2 = dynamic_cast<const TranslationMotion<S>*>(o2.getMotion());
+  if(!motion1 || !motion2)
+    return 0;
+
+  const Vector3<S> d1 = motion1->getVelocity();
+  const Vector3<S> d2 = motion2->getVelocity();
+  const AABB<S>& swept1 = o1.getAABB();
+  const AABB<S>& swept2 = o2.getAABB();
+
+  // The swept AABB is the union of the AABBs at times 0 and 1
+  const Vector3<S> min1 = swept1.min_ - d1.cwiseMin(Vector3<S>::Zero());
+  const Vector3<S> max1 = swept1.max_ - d1.cwiseMax(Vector3<S>::Zero());
+  const Vector3<S> min2 = swept2.min_ - d2.cwiseMin(Vector3<S>::Zero());
+  const Vector3<S> max2 = swept2.max_ - d2.cwiseMax(Vector3<S>::Zero());
+  const Vector3<S> v = d1 - d2;
+
+  S entry = 0;
+  for(int i = 0; i < 3; ++i)
+  {
+    // Time at which the boxes start to overlap along axis i
+    if(max1[i] < min2[i])
+    {
+      if(v[i] <= 0) return 1;
+      entry = std::max(entry, (min2[i] - max1[i]) / v[i]);
+    }
+    else if(max2[i] < min1[i])
+    {
+      if(v[i] >= 0) return 1;
+      entry = std::max(entry, (max2[i] - min1[i]) / v[i]);
+    }
+  }
+
+  return std::min<S>(entry, 1);
+}
+
+//==============================================================================
+/// @brief Report the candidate pairs in contact by increasing time of
+/// contact, running the continuous collision queries on demand.
+///
+/// The candidates are queried by increasing lower bound of their time of
+/// contact, in waves of one pair per thread. A contact found so far is
+/// reported as soon as every candidate not queried yet has a larger lower
+/// bound, so the queries stop shortly after the callback returns true.
+template <typename S>
+void collideEarliestFirst(
+    const ContinuousCollisionPairs<S>& pairs,
+    const ContinuousCollisionRequest<S>& request,
+    void* cdata,
+    ContinuousCollisionResultCallBack<S> callback,
+    const BroadPhaseParallelOptions& options)
+{
+  const std::size_t n = pairs.size();
+  const unsigned int num_threads = resolveNumThreads(options.num_threads);
+
+  // The times of contact returned by the queries may undershoot the true
+  // ones by up to toc_err, so the bounds are lowered as much
+  std::vector<S> bounds(n);
+  parallelForChunks(n, num_threads, 1024,
+                    [&](unsigned int, std::size_t begin, std::size_t end)
+  {
+    for(std::size_t i = begin; i < end; ++i)
+    {
+      bounds[i] = computeSweptAABBEntryTime(*pairs[i].first, *pairs[i].second)
+          - request.toc_err;
+    }
+  });
+
+  std::vector<std::size_t> order(n);
+  for(std::size_t i = 0; i < n; ++i)
+    order[i] = i;
+  std::stable_sort(order.begin(), order.end(),
+                   [&bounds](std::size_t a, std::size_t b)
+  {
+    return bounds[a] < bounds[b];
+  });
+
+  aligned_vector<ContinuousCollisionResult<S>> results(n);
+
+  // Contacts found but not reported yet, as a heap whose top is the earliest
+  // contact; ties are reported in the order of the pairs
+  std::vector<std::size_t> contacts;
+  auto later = [&results](std::size_t a, std::size_t b)
+  {
+    if(results[a].time_of_contact != results[b].time_of_contact)
+      return results[a].time_of_contact > results[b].time_of_contact;
+    return a > b;
+  };
+
+  std::size_t next = 0;
+  while(true)
+  {
+    while(!contacts.empty()
+          && (next == n
+              || results[contacts.front()].time_of_contact < bounds[order[next]]))
+    {
+      const std::size_t i = contacts.front();
+      std::pop_heap(contacts.begin(), contacts.end(), later);
+      contacts.pop_back();
+
+      if(callback(pairs[i].first, pairs[i].second, results[i], cdata))
+        return;
+    }
+
+    if(next == n)
+      return;
+
+    const std::size_t wave_end = std::min<std::size_t>(next + num_threads, n);
+    parallelForChunks(wave_end - next, num_threads, 1,
+                      [&](unsigned int, std::size_t begin, std::size_t end)
+    {
+      for(std::size_t k = next + begin; k < next + end; ++k)
+      {
+        const std::size_t i = order[k];
+        fcl::collide(pairs[i].first, pairs[i].second, request, results[i]);
+      }
+    });
+
+    for(; next < wave_end; ++next)
+    {
+      if(results[order[next]].is_collide)
+      {
+        contacts.push_back(order[next]);
+        std::push_heap(contacts.begin(), contacts.end(), later);
+      }
+    }
+  }
+}
+
+} // namespace detail
+
+//==============================================================================
+template <typename S>
+void BroadPhaseContinuousCollisionManager<S>::collideEarliestFirst(
+    const ContinuousCollisionRequest<S>& request,
+    void* cdata,
+    ContinuousCollisionResultCallBack<S> callback,
+    const BroadPhaseParallelOptions& options) const
+{
+  detail::ContinuousCollisionPairs<S> pairs;
+  collide(&pairs, detail::collectContinuousCollisionPair<S>);
+  detail::collideEarliestFirst(pairs, request, cdata, callback, options);
+}
+
+//==============================================================================
+template <typename S>
+void BroadPhaseContinuousCollisionManager<S>::collideEarliestFirst(
+    BroadPhaseContinuousCollisionManager<S>* other_manager,
+    const ContinuousCollisionRequest<S>& request,
+    void* cdata,
+    ContinuousCollisionResultCallBack<S> callback,
+    const BroadPhaseParallelOptions& options) const
+{
+  detail::ContinuousCollisionPairs<S> pairs;
+  collide(other_manager, &pairs, detail::collectContinuousCollisionPair<S>);
+  detail::collideEarliestFirst(pairs, request, cdata, callback, options);
+}
+
 } // namespace fcl
 
 #endif
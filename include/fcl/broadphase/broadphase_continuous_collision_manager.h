@@ -39,8 +39,11 @@
 #define FCL_BROADPHASE_BROADPHASECONTINUOUSCOLLISIONMANAGER_H
 
 #include "fcl/broadphase/broadphase_collision_manager.h"
+#include "fcl/broadphase/broadphase_parallel_options.h"
 #include "fcl/narrowphase/collision_object.h"
 #include "fcl/narrowphase/continuous_collision_object.h"
+#include "fcl/narrowphase/continuous_collision_request.h"
+#include "fcl/narrowphase/continuous_collision_result.h"
 
 namespace fcl
 {
@@ -59,6 +62,15 @@ using ContinuousDistanceCallBack = bool (*)(
     ContinuousCollisionObject<S>* o1,
     ContinuousCollisionObject<S>* o2, void* cdata, S& dist);
 
+/// @brief Callback for a pair of objects found in contact by a time-ordered
+/// continuous collision query, with the result of their continuous collision.
+/// Return value is whether can stop now.
+template <typename S>
+using ContinuousCollisionResultCallBack = bool (*)(
+    ContinuousCollisionObject<S>* o1,
+    ContinuousCollisionObject<S>* o2,
+    const ContinuousCollisionResult<S>& result, void* cdata);
+
 /// @brief Base class for broad phase continuous collision. It helps to
 /// accelerate the continuous collision/distance between N objects. Also support
 /// self collision, self distance and collision/distance with another M objects.
@@ -98,22 +110,37 @@ public:
   virtual void getObjects(std::vector<ContinuousCollisionObject<S>*>& objs) const = 0;
 
   /// @brief perform collision test between one object and all the objects belonging to the manager
-  virtual void collide(ContinuousCollisionObject<S>* obj, void* cdata, CollisionCallBack<S> callback) const = 0;
+  virtual void collide(ContinuousCollisionObject<S>* obj, void* cdata, ContinuousCollisionCallBack<S> callback) const = 0;
 
   /// @brief perform distance computation between one object and all the objects belonging to the manager
-  virtual void distance(ContinuousCollisionObject<S>* obj, void* cdata, DistanceCallBack<S> callback) const = 0;
+  virtual void distance(ContinuousCollisionObject<S>* obj, void* cdata, ContinuousDistanceCallBack<S> callback) const = 0;
 
   /// @brief perform collision test for the objects belonging to the manager (i.e., N^2 self collision)
-  virtual void collide(void* cdata, CollisionCallBack<S> callback) const = 0;
+  virtual void collide(void* cdata, ContinuousCollisionCallBack<S> callback) const = 0;
 
   /// @brief perform distance test for the objects belonging to the manager (i.e., N^2 self distance)
-  virtual void distance(void* cdata, DistanceCallBack<S> callback) const = 0;
+  virtual void distance(void* cdata, ContinuousDistanceCallBack<S> callback) const = 0;
 
   /// @brief perform collision test with objects belonging to another manager
-  virtual void collide(BroadPhaseContinuousCollisionManager<S>* other_manager, void* cdata, CollisionCallBack<S> callback) const = 0;
+  virtual void collide(BroadPhaseContinuousCollisionManager<S>* other_manager, void* cdata, ContinuousCollisionCallBack<S> callback) const = 0;
 
   /// @brief perform distance test with objects belonging to another manager
-  virtual void distance(BroadPhaseContinuousCollisionManager<S>* other_manager, void* cdata, DistanceCallBack<S> callback) const = 0;
+  virtual void distance(BroadPhaseContinuousCollisionManager<S>* other_manager, void* cdata, ContinuousDistanceCallBack<S> callback) const = 0;
+
+  /// @brief perform continuous collision between the objects belonging to
+  /// the manager whose swept AABBs overlap. The pairs in contact are passed to
+  /// the callback on the calling thread, in order of increasing time of
+  /// contact, until the callback returns true. The pairs are queried on
+  /// options.num_threads threads by increasing entry time of their swept
+  /// AABBs (exact for translation motions, 0 otherwise), so that once the
+  /// callback returns true, the pairs whose entry time is after the last
+  /// reported contact are not queried, apart from one last batch of
+  /// options.num_threads pairs.
+  virtual void collideEarliestFirst(const ContinuousCollisionRequest<S>& request, void* cdata, ContinuousCollisionResultCallBack<S> callback, const BroadPhaseParallelOptions& options = BroadPhaseParallelOptions()) const;
+
+  /// @brief perform continuous collision with the objects belonging to
+  /// another manager, with the same ordering as collideEarliestFirst()
+  virtual void collideEarliestFirst(BroadPhaseContinuousCollisionManager<S>* other_manager, const ContinuousCollisionRequest<S>& request, void* cdata, ContinuousCollisionResultCallBack<S> callback, const BroadPhaseParallelOptions& options = BroadPhaseParallelOptions()) const;
 
   /// @brief whether the manager is empty
   virtual bool empty() const = 0;
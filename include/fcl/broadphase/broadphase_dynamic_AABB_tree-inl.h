@@ -42,6 +42,10 @@
 
 #include <limits>
 
+#include "fcl/broadphase/detail/packet_tree_query.h"
+#include "fcl/broadphase/detail/parallel_tree_collision.h"
+#include "fcl/common/profiler.h"
+
 #if FCL_HAVE_OCTOMAP
 #include "fcl/geometry/octree/octree.h"
 #endif
@@ -499,7 +503,9 @@ bool collisionRecurse(
 {
   if(root1->isLeaf() && root2->isLeaf())
   {
+    FCL_PROFILE_COUNT(BroadphasePairsTested, 1);
     if(!root1->bv.overlap(root2->bv)) return false;
+    FCL_PROFILE_COUNT(BroadphasePairsPassed, 1);
     return callback(static_cast<CollisionObject<S>*>(root1->data), static_cast<CollisionObject<S>*>(root2->data), cdata);
   }
 
@@ -529,7 +535,9 @@ bool collisionRecurse(typename DynamicAABBTreeCollisionManager<S>::DynamicAABBNo
 {
   if(root->isLeaf())
   {
+    FCL_PROFILE_COUNT(BroadphasePairsTested, 1);
     if(!root->bv.overlap(query->getAABB())) return false;
+    FCL_PROFILE_COUNT(BroadphasePairsPassed, 1);
     return callback(static_cast<CollisionObject<S>*>(root->data), query, cdata);
   }
 
@@ -895,6 +903,8 @@ template <typename S>
 FCL_EXPORT
 void DynamicAABBTreeCollisionManager<S>::collide(CollisionObject<S>* obj, void* cdata, CollisionCallBack<S> callback) const
 {
+  FCL_PROFILE_TIMER(BroadphaseCollide);
+
   if(size() == 0) return;
   switch(obj->collisionGeometry()->getNodeType())
   {
@@ -921,6 +931,8 @@ template <typename S>
 FCL_EXPORT
 void DynamicAABBTreeCollisionManager<S>::distance(CollisionObject<S>* obj, void* cdata, DistanceCallBack<S> callback) const
 {
+  FCL_PROFILE_TIMER(BroadphaseDistance);
+
   if(size() == 0) return;
   S min_dist = std::numeric_limits<S>::max();
   switch(obj->collisionGeometry()->getNodeType())
@@ -943,11 +955,63 @@ void DynamicAABBTreeCollisionManager<S>::distance(CollisionObject<S>* obj, void*
   }
 }
 
+//==============================================================================
+template <typename S>
+FCL_EXPORT
+void DynamicAABBTreeCollisionManager<S>::collideMany(const std::vector<CollisionObject<S>*>& queries, const std::vector<void*>& cdata, CollisionCallBack<S> callback, const BroadPhaseParallelOptions& options) const
+{
+  if(size() == 0) return;
+#if FCL_HAVE_OCTOMAP
+  if(!octree_as_geometry_collide)
+  {
+    for(auto* query : queries)
+    {
+      // Octree queries are traversed cell by cell, one query at a time
+      if(query->collisionGeometry()->getNodeType() == GEOM_OCTREE)
+      {
+        BroadPhaseCollisionManager<S>::collideMany(queries, cdata, callback, options);
+        return;
+      }
+    }
+  }
+#endif
+  using Access = detail::PointerTreeAccess<DynamicAABBNode>;
+  detail::PacketTreeQuery<S, DynamicAABBNode, Access> query(Access(), options);
+  query.collide(dtree.getRoot(), queries, cdata, callback);
+}
+
+//==============================================================================
+template <typename S>
+FCL_EXPORT
+void DynamicAABBTreeCollisionManager<S>::distanceMany(const std::vector<CollisionObject<S>*>& queries, const std::vector<void*>& cdata, DistanceCallBack<S> callback, const BroadPhaseParallelOptions& options) const
+{
+  if(size() == 0) return;
+#if FCL_HAVE_OCTOMAP
+  if(!octree_as_geometry_distance)
+  {
+    for(auto* query : queries)
+    {
+      // Octree queries are traversed cell by cell, one query at a time
+      if(query->collisionGeometry()->getNodeType() == GEOM_OCTREE)
+      {
+        BroadPhaseCollisionManager<S>::distanceMany(queries, cdata, callback, options);
+        return;
+      }
+    }
+  }
+#endif
+  using Access = detail::PointerTreeAccess<DynamicAABBNode>;
+  detail::PacketTreeQuery<S, DynamicAABBNode, Access> query(Access(), options);
+  query.distance(dtree.getRoot(), queries, cdata, callback);
+}
+
 //==============================================================================
 template <typename S>
 FCL_EXPORT
 void DynamicAABBTreeCollisionManager<S>::collide(void* cdata, CollisionCallBack<S> callback) const
 {
+  FCL_PROFILE_TIMER(BroadphaseCollide);
+
   if(size() == 0) return;
   detail::dynamic_AABB_tree::selfCollisionRecurse(dtree.getRoot(), cdata, callback);
 }
@@ -957,6 +1021,8 @@ template <typename S>
 FCL_EXPORT
 void DynamicAABBTreeCollisionManager<S>::distance(void* cdata, DistanceCallBack<S> callback) const
 {
+  FCL_PROFILE_TIMER(BroadphaseDistance);
+
   if(size() == 0) return;
   S min_dist = std::numeric_limits<S>::max();
   detail::dynamic_AABB_tree::selfDistanceRecurse(dtree.getRoot(), cdata, callback, min_dist);
@@ -967,16 +1033,32 @@ template <typename S>
 FCL_EXPORT
 void DynamicAABBTreeCollisionManager<S>::collide(BroadPhaseCollisionManager<S>* other_manager_, void* cdata, CollisionCallBack<S> callback) const
 {
+  FCL_PROFILE_TIMER(BroadphaseCollide);
+
   DynamicAABBTreeCollisionManager* other_manager = static_cast<DynamicAABBTreeCollisionManager*>(other_manager_);
   if((size() == 0) || (other_manager->size() == 0)) return;
   detail::dynamic_AABB_tree::collisionRecurse(dtree.getRoot(), other_manager->dtree.getRoot(), cdata, callback);
 }
 
+//==============================================================================
+template <typename S>
+FCL_EXPORT
+void DynamicAABBTreeCollisionManager<S>::collide(BroadPhaseCollisionManager<S>* other_manager_, void* cdata, CollisionCallBack<S> callback, const BroadPhaseParallelOptions& options) const
+{
+  DynamicAABBTreeCollisionManager* other_manager = static_cast<DynamicAABBTreeCollisionManager*>(other_manager_);
+  if((size() == 0) || (other_manager->size() == 0)) return;
+  using Access = detail::PointerTreeAccess<DynamicAABBNode>;
+  detail::ParallelTreeCollision<S, DynamicAABBNode, Access> traversal(Access(), Access(), options);
+  traversal.run(dtree.getRoot(), other_manager->dtree.getRoot(), cdata, callback);
+}
+
 //==============================================================================
 template <typename S>
 FCL_EXPORT
 void DynamicAABBTreeCollisionManager<S>::distance(BroadPhaseCollisionManager<S>* other_manager_, void* cdata, DistanceCallBack<S> callback) const
 {
+  FCL_PROFILE_TIMER(BroadphaseDistance);
+
   DynamicAABBTreeCollisionManager* other_manager = static_cast<DynamicAABBTreeCollisionManager*>(other_manager_);
   if((size() == 0) || (other_manager->size() == 0)) return;
   S min_dist = std::numeric_limits<S>::max();
@@ -45,6 +45,7 @@
 #include "fcl/geometry/shape/box.h"
 #include "fcl/geometry/shape/utility.h"
 #include "fcl/broadphase/broadphase_collision_manager.h"
+#include "fcl/broadphase/broadphase_parallel_options.h"
 #include "fcl/broadphase/detail/hierarchy_tree.h"
 
 namespace fcl
@@ -102,6 +103,15 @@ public:
   /// @brief perform distance computation between one object and all the objects belonging to the manager
   void distance(CollisionObject<S>* obj, void* cdata, DistanceCallBack<S> callback) const;
 
+  /// @brief perform collision test between each query object and all the
+  /// objects belonging to the manager. The queries are sorted along a Morton
+  /// curve and walk the tree in packets of neighboring queries.
+  void collideMany(const std::vector<CollisionObject<S>*>& queries, const std::vector<void*>& cdata, CollisionCallBack<S> callback, const BroadPhaseParallelOptions& options = BroadPhaseParallelOptions()) const;
+
+  /// @brief perform distance computation between each query object and all
+  /// the objects belonging to the manager, in packets of queries
+  void distanceMany(const std::vector<CollisionObject<S>*>& queries, const std::vector<void*>& cdata, DistanceCallBack<S> callback, const BroadPhaseParallelOptions& options = BroadPhaseParallelOptions()) const;
+
   /// @brief perform collision test for the objects belonging to the manager (i.e., N^2 self collision)
   void collide(void* cdata, CollisionCallBack<S> callback) const;
 
@@ -111,6 +121,11 @@ public:
   /// @brief perform collision test with objects belonging to another manager
   void collide(BroadPhaseCollisionManager<S>* other_manager_, void* cdata, CollisionCallBack<S> callback) const;
 
+  /// @brief perform collision test with objects belonging to another manager,
+  /// splitting the traversal of the two trees over several threads. See
+  /// BroadPhaseParallelOptions for the guarantees given to the callback.
+  void collide(BroadPhaseCollisionManager<S>* other_manager_, void* cdata, CollisionCallBack<S> callback, const BroadPhaseParallelOptions& options) const;
+
   /// @brief perform distance test with objects belonging to another manager
   void distance(BroadPhaseCollisionManager<S>* other_manager_, void* cdata, DistanceCallBack<S> callback) const;
   
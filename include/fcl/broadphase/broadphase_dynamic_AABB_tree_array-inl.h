@@ -40,6 +40,10 @@
 
 #include "fcl/broadphase/broadphase_dynamic_AABB_tree_array.h"
 
+#include "fcl/broadphase/detail/packet_tree_query.h"
+#include "fcl/broadphase/detail/parallel_tree_collision.h"
+#include "fcl/common/profiler.h"
+
 #if FCL_HAVE_OCTOMAP
 #include "fcl/geometry/octree/octree.h"
 #endif
@@ -473,7 +477,9 @@ bool collisionRecurse(typename DynamicAABBTreeCollisionManager_Array<S>::Dynamic
   typename DynamicAABBTreeCollisionManager_Array<S>::DynamicAABBNode* root2 = nodes2 + root2_id;
   if(root1->isLeaf() && root2->isLeaf())
   {
+    FCL_PROFILE_COUNT(BroadphasePairsTested, 1);
     if(!root1->bv.overlap(root2->bv)) return false;
+    FCL_PROFILE_COUNT(BroadphasePairsPassed, 1);
     return callback(static_cast<CollisionObject<S>*>(root1->data), static_cast<CollisionObject<S>*>(root2->data), cdata);
   }
 
@@ -504,7 +510,9 @@ bool collisionRecurse(typename DynamicAABBTreeCollisionManager_Array<S>::Dynamic
   typename DynamicAABBTreeCollisionManager_Array<S>::DynamicAABBNode* root = nodes + root_id;
   if(root->isLeaf())
   {
+    FCL_PROFILE_COUNT(BroadphasePairsTested, 1);
     if(!root->bv.overlap(query->getAABB())) return false;
+    FCL_PROFILE_COUNT(BroadphasePairsPassed, 1);
     return callback(static_cast<CollisionObject<S>*>(root->data), query, cdata);
   }
 
@@ -899,6 +907,8 @@ template <typename S>
 FCL_EXPORT
 void DynamicAABBTreeCollisionManager_Array<S>::collide(CollisionObject<S>* obj, void* cdata, CollisionCallBack<S> callback) const
 {
+  FCL_PROFILE_TIMER(BroadphaseCollide);
+
   if(size() == 0) return;
   switch(obj->collisionGeometry()->getNodeType())
   {
@@ -925,6 +935,8 @@ template <typename S>
 FCL_EXPORT
 void DynamicAABBTreeCollisionManager_Array<S>::distance(CollisionObject<S>* obj, void* cdata, DistanceCallBack<S> callback) const
 {
+  FCL_PROFILE_TIMER(BroadphaseDistance);
+
   if(size() == 0) return;
   S min_dist = std::numeric_limits<S>::max();
   switch(obj->collisionGeometry()->getNodeType())
@@ -947,11 +959,65 @@ void DynamicAABBTreeCollisionManager_Array<S>::distance(CollisionObject<S>* obj,
   }
 }
 
+//==============================================================================
+template <typename S>
+FCL_EXPORT
+void DynamicAABBTreeCollisionManager_Array<S>::collideMany(const std::vector<CollisionObject<S>*>& queries, const std::vector<void*>& cdata, CollisionCallBack<S> callback, const BroadPhaseParallelOptions& options) const
+{
+  if(size() == 0) return;
+#if FCL_HAVE_OCTOMAP
+  if(!octree_as_geometry_collide)
+  {
+    for(auto* query : queries)
+    {
+      // Octree queries are traversed cell by cell, one query at a time
+      if(query->collisionGeometry()->getNodeType() == GEOM_OCTREE)
+      {
+        BroadPhaseCollisionManager<S>::collideMany(queries, cdata, callback, options);
+        return;
+      }
+    }
+  }
+#endif
+  using Access = detail::ArrayTreeAccess<DynamicAABBNode>;
+  const Access access = {dtree.getNodes()};
+  detail::PacketTreeQuery<S, DynamicAABBNode, Access> query(access, options);
+  query.collide(dtree.getNodes() + dtree.getRoot(), queries, cdata, callback);
+}
+
+//==============================================================================
+template <typename S>
+FCL_EXPORT
+void DynamicAABBTreeCollisionManager_Array<S>::distanceMany(const std::vector<CollisionObject<S>*>& queries, const std::vector<void*>& cdata, DistanceCallBack<S> callback, const BroadPhaseParallelOptions& options) const
+{
+  if(size() == 0) return;
+#if FCL_HAVE_OCTOMAP
+  if(!octree_as_geometry_distance)
+  {
+    for(auto* query : queries)
+    {
+      // Octree queries are traversed cell by cell, one query at a time
+      if(query->collisionGeometry()->getNodeType() == GEOM_OCTREE)
+      {
+        BroadPhaseCollisionManager<S>::distanceMany(queries, cdata, callback, options);
+        return;
+      }
+    }
+  }
+#endif
+  using Access = detail::ArrayTreeAccess<DynamicAABBNode>;
+  const Access access = {dtree.getNodes()};
+  detail::PacketTreeQuery<S, DynamicAABBNode, Access> query(access, options);
+  query.distance(dtree.getNodes() + dtree.getRoot(), queries, cdata, callback);
+}
+
 //==============================================================================
 template <typename S>
 FCL_EXPORT
 void DynamicAABBTreeCollisionManager_Array<S>::collide(void* cdata, CollisionCallBack<S> callback) const
 {
+  FCL_PROFILE_TIMER(BroadphaseCollide);
+
   if(size() == 0) return;
   detail::dynamic_AABB_tree_array::selfCollisionRecurse(dtree.getNodes(), dtree.getRoot(), cdata, callback);
 }
@@ -961,6 +1027,8 @@ template <typename S>
 FCL_EXPORT
 void DynamicAABBTreeCollisionManager_Array<S>::distance(void* cdata, DistanceCallBack<S> callback) const
 {
+  FCL_PROFILE_TIMER(BroadphaseDistance);
+
   if(size() == 0) return;
   S min_dist = std::numeric_limits<S>::max();
   detail::dynamic_AABB_tree_array::selfDistanceRecurse(dtree.getNodes(), dtree.getRoot(), cdata, callback, min_dist);
@@ -971,16 +1039,34 @@ template <typename S>
 FCL_EXPORT
 void DynamicAABBTreeCollisionManager_Array<S>::collide(BroadPhaseCollisionManager<S>* other_manager_, void* cdata, CollisionCallBack<S> callback) const
 {
+  FCL_PROFILE_TIMER(BroadphaseCollide);
+
   DynamicAABBTreeCollisionManager_Array* other_manager = static_cast<DynamicAABBTreeCollisionManager_Array*>(other_manager_);
   if((size() == 0) || (other_manager->size() == 0)) return;
   detail::dynamic_AABB_tree_array::collisionRecurse(dtree.getNodes(), dtree.getRoot(), other_manager->dtree.getNodes(), other_manager->dtree.getRoot(), cdata, callback);
 }
 
+//==============================================================================
+template <typename S>
+FCL_EXPORT
+void DynamicAABBTreeCollisionManager_Array<S>::collide(BroadPhaseCollisionManager<S>* other_manager_, void* cdata, CollisionCallBack<S> callback, const BroadPhaseParallelOptions& options) const
+{
+  DynamicAABBTreeCollisionManager_Array* other_manager = static_cast<DynamicAABBTreeCollisionManager_Array*>(other_manager_);
+  if((size() == 0) || (other_manager->size() == 0)) return;
+  using Access = detail::ArrayTreeAccess<DynamicAABBNode>;
+  const Access access1 = {dtree.getNodes()};
+  const Access access2 = {other_manager->dtree.getNodes()};
+  detail::ParallelTreeCollision<S, DynamicAABBNode, Access> traversal(access1, access2, options);
+  traversal.run(dtree.getNodes() + dtree.getRoot(), other_manager->dtree.getNodes() + other_manager->dtree.getRoot(), cdata, callback);
+}
+
 //==============================================================================
 template <typename S>
 FCL_EXPORT
 void DynamicAABBTreeCollisionManager_Array<S>::distance(BroadPhaseCollisionManager<S>* other_manager_, void* cdata, DistanceCallBack<S> callback) const
 {
+  FCL_PROFILE_TIMER(BroadphaseDistance);
+
   DynamicAABBTreeCollisionManager_Array* other_manager = static_cast<DynamicAABBTreeCollisionManager_Array*>(other_manager_);
   if((size() == 0) || (other_manager->size() == 0)) return;
   S min_dist = std::numeric_limits<S>::max();
@@ -0,0 +1,529 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */ 
+
+/** @author Jia Pan */
+
+#ifndef FCL_BROADPHASE_BROADPHASEDYNAMICAABBTREECONTINUOUS_INL_H
+#define FCL_BROADPHASE_BROADPHASEDYNAMICAABBTREECONTINUOUS_INL_H
+
+#include "fcl/broadphase/broadphase_dynamic_AABB_tree_continuous.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+
+namespace fcl {
+
+//==============================================================================
+extern template
+class FCL_EXPORT DynamicAABBTreeContinuousCollisionManager<double>;
+
+namespace detail {
+
+namespace dynamic_AABB_tree_continuous {
+
+//==============================================================================
+template <typename S>
+FCL_EXPORT
+bool collisionRecurse(
+    typename DynamicAABBTreeContinuousCollisionManager<S>::DynamicAABBNode* root1,
+    typename DynamicAABBTreeContinuousCollisionManager<S>::DynamicAABBNode* root2,
+    void* cdata,
+    ContinuousCollisionCallBack<S> callback)
+{
+  if(!root1->bv.overlap(root2->bv)) return false;
+
+  if(root1->isLeaf() && root2->isLeaf())
+  {
+    return callback(static_cast<ContinuousCollisionObject<S>*>(root1->data),
+                    static_cast<ContinuousCollisionObject<S>*>(root2->data),
+                    cdata);
+  }
+
+  if(root2->isLeaf() || (!root1->isLeaf() && (root1->bv.size() > root2->bv.size())))
+  {
+    if(collisionRecurse<S>(root1->children[0], root2, cdata, callback))
+      return true;
+    if(collisionRecurse<S>(root1->children[1], root2, cdata, callback))
+      return true;
+  }
+  else
+  {
+    if(collisionRecurse<S>(root1, root2->children[0], cdata, callback))
+      return true;
+    if(collisionRecurse<S>(root1, root2->children[1], cdata, callback))
+      return true;
+  }
+  return false;
+}
+
+//==============================================================================
+template <typename S>
+FCL_EXPORT
+bool collisionRecurse(
+    typename DynamicAABBTreeContinuousCollisionManager<S>::DynamicAABBNode* root,
+    ContinuousCollisionObject<S>* query,
+    void* cdata,
+    ContinuousCollisionCallBack<S> callback)
+{
+  if(!root->bv.overlap(query->getAABB())) return false;
+
+  if(root->isLeaf())
+    return callback(static_cast<ContinuousCollisionObject<S>*>(root->data), query, cdata);
+
+  int select_res = select(query->getAABB(), *(root->children[0]), *(root->children[1]));
+
+  if(collisionRecurse<S>(root->children[select_res], query, cdata, callback))
+    return true;
+
+  if(collisionRecurse<S>(root->children[1-select_res], query, cdata, callback))
+    return true;
+
+  return false;
+}
+
+//==============================================================================
+template <typename S>
+FCL_EXPORT
+bool selfCollisionRecurse(
+    typename DynamicAABBTreeContinuousCollisionManager<S>::DynamicAABBNode* root,
+    void* cdata,
+    ContinuousCollisionCallBack<S> callback)
+{
+  if(root->isLeaf()) return false;
+
+  if(selfCollisionRecurse<S>(root->children[0], cdata, callback))
+    return true;
+
+  if(selfCollisionRecurse<S>(root->children[1], cdata, callback))
+    return true;
+
+  if(collisionRecurse<S>(root->children[0], root->children[1], cdata, callback))
+    return true;
+
+  return false;
+}
+
+//==============================================================================
+template <typename S>
+FCL_EXPORT
+bool distanceRecurse(
+    typename DynamicAABBTreeContinuousCollisionManager<S>::DynamicAABBNode* root1,
+    typename DynamicAABBTreeContinuousCollisionManager<S>::DynamicAABBNode* root2,
+    void* cdata,
+    ContinuousDistanceCallBack<S> callback,
+    S& min_dist)
+{
+  if(root1->isLeaf() && root2->isLeaf())
+  {
+    return callback(static_cast<ContinuousCollisionObject<S>*>(root1->data),
+                    static_cast<ContinuousCollisionObject<S>*>(root2->data),
+                    cdata, min_dist);
+  }
+
+  // Visit the closer child first, and skip the children farther than the
+  // current minimum distance
+  const bool split1 = root2->isLeaf() || (!root1->isLeaf() && (root1->bv.size() > root2->bv.size()));
+  auto* a1 = split1 ? root1->children[0] : root1;
+  auto* b1 = split1 ? root1->children[1] : root1;
+  auto* a2 = split1 ? root2 : root2->children[0];
+  auto* b2 = split1 ? root2 : root2->children[1];
+
+  S d1 = a1->bv.distance(a2->bv);
+  S d2 = b1->bv.distance(b2->bv);
+
+  if(d2 < d1)
+  {
+    std::swap(d1, d2);
+    std::swap(a1, b1);
+    std::swap(a2, b2);
+  }
+
+  if(d1 < min_dist)
+  {
+    if(distanceRecurse<S>(a1, a2, cdata, callback, min_dist))
+      return true;
+  }
+
+  if(d2 < min_dist)
+  {
+    if(distanceRecurse<S>(b1, b2, cdata, callback, min_dist))
+      return true;
+  }
+
+  return false;
+}
+
+//==============================================================================
+template <typename S>
+FCL_EXPORT
+bool distanceRecurse(
+    typename DynamicAABBTreeContinuousCollisionManager<S>::DynamicAABBNode* root,
+    ContinuousCollisionObject<S>* query,
+    void* cdata,
+    ContinuousDistanceCallBack<S> callback,
+    S& min_dist)
+{
+  if(root->isLeaf())
+  {
+    return callback(static_cast<ContinuousCollisionObject<S>*>(root->data),
+                    query, cdata, min_dist);
+  }
+
+  S d1 = query->getAABB().distance(root->children[0]->bv);
+  S d2 = query->getAABB().distance(root->children[1]->bv);
+  int first = 0;
+
+  if(d2 < d1)
+  {
+    std::swap(d1, d2);
+    first = 1;
+  }
+
+  if(d1 < min_dist)
+  {
+    if(distanceRecurse<S>(root->children[first], query, cdata, callback, min_dist))
+      return true;
+  }
+
+  if(d2 < min_dist)
+  {
+    if(distanceRecurse<S>(root->children[1 - first], query, cdata, callback, min_dist))
+      return true;
+  }
+
+  return false;
+}
+
+//==============================================================================
+template <typename S>
+FCL_EXPORT
+bool selfDistanceRecurse(
+    typename DynamicAABBTreeContinuousCollisionManager<S>::DynamicAABBNode* root,
+    void* cdata,
+    ContinuousDistanceCallBack<S> callback,
+    S& min_dist)
+{
+  if(root->isLeaf()) return false;
+
+  if(selfDistanceRecurse<S>(root->children[0], cdata, callback, min_dist))
+    return true;
+
+  if(selfDistanceRecurse<S>(root->children[1], cdata, callback, min_dist))
+    return true;
+
+  if(distanceRecurse<S>(root->children[0], root->children[1], cdata, callback, min_dist))
+    return true;
+
+  return false;
+}
+
+} // namespace dynamic_AABB_tree_continuous
+
+} // namespace detail
+
+//==============================================================================
+template <typename S>
+DynamicAABBTreeContinuousCollisionManager<S>::DynamicAABBTreeContinuousCollisionManager()
+  : tree_topdown_balance_threshold(dtree.bu_threshold),
+    tree_topdown_level(dtree.topdown_level)
+{
+  max_tree_nonbalanced_level = 10;
+  tree_incremental_balance_pass = 10;
+  tree_topdown_balance_threshold = 2;
+  tree_topdown_level = 0;
+  tree_init_level = 0;
+  setup_ = false;
+}
+
+//==============================================================================
+template <typename S>
+void DynamicAABBTreeContinuousCollisionManager<S>::registerObjects(
+    const std::vector<ContinuousCollisionObject<S>*>& other_objs)
+{
+  if(other_objs.empty()) return;
+
+  if(size() > 0)
+  {
+    BroadPhaseContinuousCollisionManager<S>::registerObjects(other_objs);
+  }
+  else
+  {
+    std::vector<DynamicAABBNode*> leaves(other_objs.size());
+    table.rehash(other_objs.size());
+    for(size_t i = 0, size = other_objs.size(); i < size; ++i)
+    {
+      DynamicAABBNode* node = new DynamicAABBNode; // node will be managed by the dtree
+      node->bv = other_objs[i]->getAABB();
+      node->parent = nullptr;
+      node->children[1] = nullptr;
+      node->data = other_objs[i];
+      table[other_objs[i]] = node;
+      leaves[i] = node;
+    }
+
+    dtree.init(leaves, tree_init_level);
+
+    setup_ = true;
+  }
+}
+
+//==============================================================================
+template <typename S>
+void DynamicAABBTreeContinuousCollisionManager<S>::registerObject(
+    ContinuousCollisionObject<S>* obj)
+{
+  DynamicAABBNode* node = dtree.insert(obj->getAABB(), obj);
+  table[obj] = node;
+}
+
+//==============================================================================
+template <typename S>
+void DynamicAABBTreeContinuousCollisionManager<S>::unregisterObject(
+    ContinuousCollisionObject<S>* obj)
+{
+  DynamicAABBNode* node = table[obj];
+  table.erase(obj);
+  dtree.remove(node);
+}
+
+//==============================================================================
+template <typename S>
+void DynamicAABBTreeContinuousCollisionManager<S>::setup()
+{
+  if(!setup_)
+  {
+    int num = dtree.size();
+    if(num == 0)
+    {
+      setup_ = true;
+      return;
+    }
+
+    int height = dtree.getMaxHeight();
+
+    if(height - std::log((S)num) / std::log(2.0) < max_tree_nonbalanced_level)
+      dtree.balanceIncremental(tree_incremental_balance_pass);
+    else
+      dtree.balanceTopdown();
+
+    setup_ = true;
+  }
+}
+
+//==============================================================================
+template <typename S>
+void DynamicAABBTreeContinuousCollisionManager<S>::update()
+{
+  for(auto it = table.cbegin(); it != table.cend(); ++it)
+  {
+    ContinuousCollisionObject<S>* obj = it->first;
+    DynamicAABBNode* node = it->second;
+    node->bv = obj->getAABB();
+  }
+
+  dtree.refit();
+  setup_ = false;
+
+  setup();
+}
+
+//==============================================================================
+template <typename S>
+void DynamicAABBTreeContinuousCollisionManager<S>::update_(
+    ContinuousCollisionObject<S>* updated_obj)
+{
+  const auto it = table.find(updated_obj);
+  if(it != table.end())
+  {
+    DynamicAABBNode* node = it->second;
+    if(!node->bv.equal(updated_obj->getAABB()))
+      dtree.update(node, updated_obj->getAABB());
+  }
+  setup_ = false;
+}
+
+//==============================================================================
+template <typename S>
+void DynamicAABBTreeContinuousCollisionManager<S>::update(
+    ContinuousCollisionObject<S>* updated_obj)
+{
+  update_(updated_obj);
+  setup();
+}
+
+//==============================================================================
+template <typename S>
+void DynamicAABBTreeContinuousCollisionManager<S>::update(
+    const std::vector<ContinuousCollisionObject<S>*>& updated_objs)
+{
+  for(size_t i = 0, size = updated_objs.size(); i < size; ++i)
+    update_(updated_objs[i]);
+  setup();
+}
+
+//==============================================================================
+template <typename S>
+void DynamicAABBTreeContinuousCollisionManager<S>::clear()
+{
+  dtree.clear();
+  table.clear();
+}
+
+//==============================================================================
+template <typename S>
+void DynamicAABBTreeContinuousCollisionManager<S>::getObjects(
+    std::vector<ContinuousCollisionObject<S>*>& objs) const
+{
+  objs.resize(this->size());
+  std::transform(table.begin(), table.end(), objs.begin(), std::bind(&DynamicAABBTable::value_type::first, std::placeholders::_1));
+}
+
+//==============================================================================
+template <typename S>
+void DynamicAABBTreeContinuousCollisionManager<S>::collide(
+    ContinuousCollisionObject<S>* obj, void* cdata,
+    ContinuousCollisionCallBack<S> callback) const
+{
+  if(size() == 0) return;
+  detail::dynamic_AABB_tree_continuous::collisionRecurse<S>(dtree.getRoot(), obj, cdata, callback);
+}
+
+//==============================================================================
+template <typename S>
+void DynamicAABBTreeContinuousCollisionManager<S>::distance(
+    ContinuousCollisionObject<S>* obj, void* cdata,
+    ContinuousDistanceCallBack<S> callback) const
+{
+  if(size() == 0) return;
+  S min_dist = std::numeric_limits<S>::max();
+  detail::dynamic_AABB_tree_continuous::distanceRecurse<S>(dtree.getRoot(), obj, cdata, callback, min_dist);
+}
+
+//==============================================================================
+template <typename S>
+void DynamicAABBTreeContinuousCollisionManager<S>::collide(
+    void* cdata, ContinuousCollisionCallBack<S> callback) const
+{
+  if(size() == 0) return;
+  detail::dynamic_AABB_tree_continuous::selfCollisionRecurse<S>(dtree.getRoot(), cdata, callback);
+}
+
+//==============================================================================
+template <typename S>
+void DynamicAABBTreeContinuousCollisionManager<S>::distance(
+    void* cdata, ContinuousDistanceCallBack<S> callback) const
+{
+  if(size() == 0) return;
+  S min_dist = std::numeric_limits<S>::max();
+  detail::dynamic_AABB_tree_continuous::selfDistanceRecurse<S>(dtree.getRoot(), cdata, callback, min_dist);
+}
+
+//==============================================================================
+template <typename S>
+void DynamicAABBTreeContinuousCollisionManager<S>::collide(
+    BroadPhaseContinuousCollisionManager<S>* other_manager_, void* cdata,
+    ContinuousCollisionCallBack<S> callback) const
+{
+  if((size() == 0) || (other_manager_->size() == 0)) return;
+
+  auto* other_manager = dynamic_cast<DynamicAABBTreeContinuousCollisionManager*>(other_manager_);
+  if(other_manager)
+  {
+    detail::dynamic_AABB_tree_continuous::collisionRecurse<S>(dtree.getRoot(), other_manager->dtree.getRoot(), cdata, callback);
+    return;
+  }
+
+  std::vector<ContinuousCollisionObject<S>*> objs;
+  other_manager_->getObjects(objs);
+  for(auto* obj : objs)
+  {
+    if(detail::dynamic_AABB_tree_continuous::collisionRecurse<S>(dtree.getRoot(), obj, cdata, callback))
+      return;
+  }
+}
+
+//==============================================================================
+template <typename S>
+void DynamicAABBTreeContinuousCollisionManager<S>::distance(
+    BroadPhaseContinuousCollisionManager<S>* other_manager_, void* cdata,
+    ContinuousDistanceCallBack<S> callback) const
+{
+  if((size() == 0) || (other_manager_->size() == 0)) return;
+
+  S min_dist = std::numeric_limits<S>::max();
+
+  auto* other_manager = dynamic_cast<DynamicAABBTreeContinuousCollisionManager*>(other_manager_);
+  if(other_manager)
+  {
+    detail::dynamic_AABB_tree_continuous::distanceRecurse<S>(dtree.getRoot(), other_manager->dtree.getRoot(), cdata, callback, min_dist);
+    return;
+  }
+
+  std::vector<ContinuousCollisionObject<S>*> objs;
+  other_manager_->getObjects(objs);
+  for(auto* obj : objs)
+  {
+    if(detail::dynamic_AABB_tree_continuous::distanceRecurse<S>(dtree.getRoot(), obj, cdata, callback, min_dist))
+      return;
+  }
+}
+
+//==============================================================================
+template <typename S>
+bool DynamicAABBTreeContinuousCollisionManager<S>::empty() const
+{
+  return dtree.empty();
+}
+
+//==============================================================================
+template <typename S>
+size_t DynamicAABBTreeContinuousCollisionManager<S>::size() const
+{
+  return dtree.size();
+}
+
+//==============================================================================
+template <typename S>
+const detail::HierarchyTree<AABB<S>>&
+DynamicAABBTreeContinuousCollisionManager<S>::getTree() const
+{
+  return dtree;
+}
+
+} // namespace fcl
+
+#endif
@@ -0,0 +1,669 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */ 
+
+
+#ifndef FCL_BROADPHASE_BROADPHASEHASHGRID_INL_H
+#define FCL_BROADPHASE_BROADPHASEHASHGRID_INL_H
+
+#include "fcl/broadphase/broadphase_hash_grid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "fcl/common/detail/parallel.h"
+
+namespace fcl
+{
+
+//==============================================================================
+extern template
+class FCL_EXPORT HashGridCollisionManager<double>;
+
+//==============================================================================
+template <typename S>
+HashGridCollisionManager<S>::HashGridCollisionManager(
+    S cell_size, unsigned int num_levels, unsigned int num_threads)
+  : num_threads_(num_threads),
+    num_removed_(0),
+    bucket_mask_(0)
+{
+  num_levels = std::max(num_levels, 1u);
+  cell_sizes_.resize(num_levels);
+  inv_cell_sizes_.resize(num_levels);
+  level_objs_.resize(num_levels);
+  for(unsigned int i = 0; i < num_levels; ++i)
+  {
+    cell_sizes_[i] = std::ldexp(cell_size, static_cast<int>(i));
+    inv_cell_sizes_[i] = 1 / cell_sizes_[i];
+  }
+
+  bucket_begin_.assign(2, 0);
+}
+
+//==============================================================================
+template <typename S>
+void HashGridCollisionManager<S>::registerObjects(
+    const std::vector<CollisionObject<S>*>& other_objs)
+{
+  for(auto* obj : other_objs)
+    registerObject(obj);
+}
+
+//==============================================================================
+template <typename S>
+void HashGridCollisionManager<S>::registerObject(CollisionObject<S>* obj)
+{
+  // Until the next rebuild, the new object is tested against everything
+  oversized_objs_.push_back(objs_.size());
+  objs_.push_back(obj);
+  aabbs_.push_back(obj->getAABB());
+  levels_.push_back(-1);
+}
+
+//==============================================================================
+template <typename S>
+void HashGridCollisionManager<S>::unregisterObject(CollisionObject<S>* obj)
+{
+  auto it = std::find(objs_.begin(), objs_.end(), obj);
+  if(it == objs_.end()) return;
+
+  // Leave a hole that the next rebuild compacts away. Bucket entries of the
+  // object are skipped because they no longer match its level.
+  const std::size_t i = static_cast<std::size_t>(it - objs_.begin());
+  std::vector<std::size_t>& objs
+      = (levels_[i] >= 0) ? level_objs_[levels_[i]] : oversized_objs_;
+  objs.erase(std::find(objs.begin(), objs.end(), i));
+
+  objs_[i] = nullptr;
+  levels_[i] = -1;
+  ++num_removed_;
+}
+
+//==============================================================================
+template <typename S>
+void HashGridCollisionManager<S>::setup()
+{
+  rebuild();
+}
+
+//==============================================================================
+template <typename S>
+void HashGridCollisionManager<S>::update()
+{
+  rebuild();
+}
+
+//==============================================================================
+template <typename S>
+void HashGridCollisionManager<S>::clear()
+{
+  objs_.clear();
+  num_removed_ = 0;
+  rebuild();
+}
+
+//==============================================================================
+template <typename S>
+void HashGridCollisionManager<S>::getObjects(
+    std::vector<CollisionObject<S>*>& objs) const
+{
+  objs.clear();
+  objs.reserve(size());
+  for(auto* obj : objs_)
+  {
+    if(obj)
+      objs.push_back(obj);
+  }
+}
+
+//==============================================================================
+template <typename S>
+void HashGridCollisionManager<S>::collide(
+    CollisionObject<S>* obj, void* cdata, CollisionCallBack<S> callback) const
+{
+  if(size() == 0) return;
+
+  collide_(obj, obj->getAABB(), cdata, callback);
+}
+
+//==============================================================================
+template <typename S>
+void HashGridCollisionManager<S>::distance(
+    CollisionObject<S>* obj, void* cdata, DistanceCallBack<S> callback) const
+{
+  if(size() == 0) return;
+
+  const AABB<S>& aabb = obj->getAABB();
+  S min_dist = std::numeric_limits<S>::max();
+  for(std::size_t i = 0; i < objs_.size(); ++i)
+  {
+    if(objs_[i] && aabbs_[i].distance(aabb) < min_dist)
+    {
+      if(callback(obj, objs_[i], cdata, min_dist))
+        return;
+    }
+  }
+}
+
+//==============================================================================
+template <typename S>
+void HashGridCollisionManager<S>::collide(
+    void* cdata, CollisionCallBack<S> callback) const
+{
+  if(size() == 0) return;
+
+  const std::size_t n = objs_.size();
+
+  // Objects outside the grid are tested against all the other objects; pairs
+  // of such objects are reported by the one with the smaller index
+  for(std::size_t i : oversized_objs_)
+  {
+    for(std::size_t j = 0; j < n; ++j)
+    {
+      if(!objs_[j] || (levels_[j] < 0 && j <= i)) continue;
+
+      if(aabbs_[i].overlap(aabbs_[j]))
+      {
+        if(callback(objs_[i], objs_[j], cdata))
+          return;
+      }
+    }
+  }
+
+  // Every pair of gridded objects is reported by the object with the finer
+  // level, or with the smaller index if both have the same level
+  for(std::size_t i = 0; i < n; ++i)
+  {
+    const int level = levels_[i];
+    if(level < 0) continue;
+
+    const bool stop = visitOverlaps(aabbs_[i], level, [&](std::size_t j)
+    {
+      if(levels_[j] == level && j <= i) return false;
+      return callback(objs_[i], objs_[j], cdata);
+    });
+
+    if(stop) return;
+  }
+}
+
+//==============================================================================
+template <typename S>
+void HashGridCollisionManager<S>::distance(
+    void* cdata, DistanceCallBack<S> callback) const
+{
+  if(size() == 0) return;
+
+  S min_dist = std::numeric_limits<S>::max();
+  for(std::size_t i = 0; i < objs_.size(); ++i)
+  {
+    if(!objs_[i]) continue;
+
+    for(std::size_t j = i + 1; j < objs_.size(); ++j)
+    {
+      if(objs_[j] && aabbs_[i].distance(aabbs_[j]) < min_dist)
+      {
+        if(callback(objs_[i], objs_[j], cdata, min_dist))
+          return;
+      }
+    }
+  }
+}
+
+//==============================================================================
+template <typename S>
+void HashGridCollisionManager<S>::collide(
+    BroadPhaseCollisionManager<S>* other_manager_,
+    void* cdata,
+    CollisionCallBack<S> callback) const
+{
+  HashGridCollisionManager* other_manager
+      = static_cast<HashGridCollisionManager*>(other_manager_);
+
+  if((size() == 0) || (other_manager->size() == 0)) return;
+
+  if(this == other_manager)
+  {
+    collide(cdata, callback);
+    return;
+  }
+
+  // Query the grid of the larger manager with the objects of the smaller one
+  if(size() <= other_manager->size())
+  {
+    for(std::size_t i = 0; i < objs_.size(); ++i)
+    {
+      if(objs_[i]
+         && other_manager->collide_(objs_[i], aabbs_[i], cdata, callback))
+        return;
+    }
+  }
+  else
+  {
+    for(std::size_t i = 0; i < other_manager->objs_.size(); ++i)
+    {
+      if(other_manager->objs_[i]
+         && collide_(other_manager->objs_[i], other_manager->aabbs_[i], cdata, callback))
+        return;
+    }
+  }
+}
+
+//==============================================================================
+template <typename S>
+void HashGridCollisionManager<S>::distance(
+    BroadPhaseCollisionManager<S>* other_manager_,
+    void* cdata,
+    DistanceCallBack<S> callback) const
+{
+  HashGridCollisionManager* other_manager
+      = static_cast<HashGridCollisionManager*>(other_manager_);
+
+  if((size() == 0) || (other_manager->size() == 0)) return;
+
+  if(this == other_manager)
+  {
+    distance(cdata, callback);
+    return;
+  }
+
+  S min_dist = std::numeric_limits<S>::max();
+  for(std::size_t i = 0; i < objs_.size(); ++i)
+  {
+    if(!objs_[i]) continue;
+
+    for(std::size_t j = 0; j < other_manager->objs_.size(); ++j)
+    {
+      if(other_manager->objs_[j]
+         && aabbs_[i].distance(other_manager->aabbs_[j]) < min_dist)
+      {
+        if(callback(objs_[i], other_manager->objs_[j], cdata, min_dist))
+          return;
+      }
+    }
+  }
+}
+
+//==============================================================================
+template <typename S>
+bool HashGridCollisionManager<S>::empty() const
+{
+  return size() == 0;
+}
+
+//==============================================================================
+template <typename S>
+size_t HashGridCollisionManager<S>::size() const
+{
+  return objs_.size() - num_removed_;
+}
+
+//==============================================================================
+template <typename S>
+S HashGridCollisionManager<S>::getCellSize() const
+{
+  return cell_sizes_[0];
+}
+
+//==============================================================================
+template <typename S>
+unsigned int HashGridCollisionManager<S>::getNumLevels() const
+{
+  return static_cast<unsigned int>(cell_sizes_.size());
+}
+
+//==============================================================================
+template <typename S>
+void HashGridCollisionManager<S>::setNumThreads(unsigned int num_threads)
+{
+  num_threads_ = num_threads;
+}
+
+//==============================================================================
+template <typename S>
+unsigned int HashGridCollisionManager<S>::getNumThreads() const
+{
+  return num_threads_;
+}
+
+//==============================================================================
+template <typename S>
+size_t HashGridCollisionManager<S>::getNumOversizedObjects() const
+{
+  return oversized_objs_.size();
+}
+
+//==============================================================================
+template <typename S>
+void HashGridCollisionManager<S>::rebuild()
+{
+  const std::size_t grain_size = 1024;
+  const std::size_t min_entries_per_block = 4096;
+
+  if(num_removed_ > 0)
+  {
+    objs_.erase(std::remove(objs_.begin(), objs_.end(), nullptr), objs_.end());
+    num_removed_ = 0;
+  }
+
+  const std::size_t n = objs_.size();
+  const unsigned int num_threads = detail::resolveNumThreads(num_threads_);
+
+  aabbs_.resize(n);
+  levels_.resize(n);
+  entry_begin_.resize(n + 1);
+  entry_begin_[0] = 0;
+
+  // Pass 1: cache the AABBs, choose the level and count the cells of each
+  // object
+  detail::parallelForChunks(n, num_threads, grain_size,
+                            [&](unsigned int, std::size_t begin, std::size_t end)
+  {
+    std::int64_t lo[3] = {0, 0, 0}, hi[3] = {0, 0, 0};
+    for(std::size_t i = begin; i < end; ++i)
+    {
+      aabbs_[i] = objs_[i]->getAABB();
+      const int level = computeLevel(aabbs_[i]);
+      levels_[i] = level;
+
+      std::size_t num_cells = 0;
+      if(level >= 0)
+      {
+        computeCellRange(aabbs_[i], level, lo, hi);
+        num_cells = static_cast<std::size_t>(
+              (hi[0] - lo[0] + 1) * (hi[1] - lo[1] + 1) * (hi[2] - lo[2] + 1));
+      }
+      entry_begin_[i + 1] = num_cells;
+    }
+  });
+
+  for(std::size_t i = 0; i < n; ++i)
+    entry_begin_[i + 1] += entry_begin_[i];
+
+  for(auto& objs : level_objs_)
+    objs.clear();
+  oversized_objs_.clear();
+  for(std::size_t i = 0; i < n; ++i)
+  {
+    if(levels_[i] >= 0)
+      level_objs_[levels_[i]].push_back(i);
+    else
+      oversized_objs_.push_back(i);
+  }
+
+  const std::size_t num_entries = entry_begin_[n];
+  std::size_t table_size = 64;
+  while(table_size < num_entries)
+    table_size <<= 1;
+  bucket_mask_ = table_size - 1;
+
+  entry_buckets_.resize(num_entries);
+  entry_objs_.resize(num_entries);
+
+  // Pass 2: hash the cells covered by each object
+  detail::parallelForChunks(n, num_threads, grain_size,
+                            [&](unsigned int, std::size_t begin, std::size_t end)
+  {
+    std::int64_t lo[3] = {0, 0, 0}, hi[3] = {0, 0, 0};
+    for(std::size_t i = begin; i < end; ++i)
+    {
+      const int level = levels_[i];
+      if(level < 0) continue;
+
+      computeCellRange(aabbs_[i], level, lo, hi);
+      std::size_t k = entry_begin_[i];
+      for(std::int64_t z = lo[2]; z <= hi[2]; ++z)
+      {
+        for(std::int64_t y = lo[1]; y <= hi[1]; ++y)
+        {
+          for(std::int64_t x = lo[0]; x <= hi[0]; ++x)
+          {
+            entry_buckets_[k] = computeBucket(level, x, y, z);
+            entry_objs_[k] = i;
+            ++k;
+          }
+        }
+      }
+    }
+  });
+
+  // Pass 3: counting sort of the entries by bucket. The entries are split in
+  // fixed blocks, and each bucket receives the entries of the first block
+  // first, so that objects appear in increasing order within every bucket
+  // whatever the number of threads.
+  const unsigned int num_blocks = static_cast<unsigned int>(
+        std::max<std::size_t>(
+          1, std::min<std::size_t>(num_threads, num_entries / min_entries_per_block)));
+
+  block_counts_.assign(num_blocks * table_size, 0);
+  detail::parallelForBlocks(num_entries, num_blocks,
+                            [&](unsigned int block, std::size_t begin, std::size_t end)
+  {
+    std::size_t* counts = block_counts_.data() + block * table_size;
+    for(std::size_t k = begin; k < end; ++k)
+      ++counts[entry_buckets_[k]];
+  });
+
+  bucket_begin_.resize(table_size + 1);
+  std::size_t offset = 0;
+  for(std::size_t bucket = 0; bucket < table_size; ++bucket)
+  {
+    bucket_begin_[bucket] = offset;
+    for(unsigned int block = 0; block < num_blocks; ++block)
+    {
+      std::size_t& count = block_counts_[block * table_size + bucket];
+      const std::size_t block_count = count;
+      count = offset;
+      offset += block_count;
+    }
+  }
+  bucket_begin_[table_size] = offset;
+
+  bucket_objs_.resize(num_entries);
+  detail::parallelForBlocks(num_entries, num_blocks,
+                            [&](unsigned int block, std::size_t begin, std::size_t end)
+  {
+    std::size_t* next = block_counts_.data() + block * table_size;
+    for(std::size_t k = begin; k < end; ++k)
+      bucket_objs_[next[entry_buckets_[k]]++] = entry_objs_[k];
+  });
+}
+
+//==============================================================================
+template <typename S>
+int HashGridCollisionManager<S>::computeLevel(const AABB<S>& aabb) const
+{
+  const std::int64_t max_cells_per_object = 64;
+
+  const S extent = std::max(aabb.width(), std::max(aabb.height(), aabb.depth()));
+  const int num_levels = static_cast<int>(cell_sizes_.size());
+
+  std::int64_t lo[3] = {0, 0, 0}, hi[3] = {0, 0, 0};
+  for(int level = 0; level < num_levels; ++level)
+  {
+    if(extent <= cell_sizes_[level] || level + 1 == num_levels)
+    {
+      if(!computeCellRange(aabb, level, lo, hi))
+        return -1;
+
+      std::int64_t num_cells = 1;
+      for(int i = 0; i < 3 && num_cells <= max_cells_per_object; ++i)
+        num_cells *= hi[i] - lo[i] + 1;
+      return (num_cells <= max_cells_per_object) ? level : -1;
+    }
+  }
+
+  return -1;
+}
+
+//==============================================================================
+template <typename S>
+std::int64_t HashGridCollisionManager<S>::computeCellCoord(S x, int level) const
+{
+  return static_cast<std::int64_t>(std::floor(x * inv_cell_sizes_[level]));
+}
+
+//==============================================================================
+template <typename S>
+bool HashGridCollisionManager<S>::computeCellRange(
+    const AABB<S>& aabb, int level, std::int64_t lo[3], std::int64_t hi[3]) const
+{
+  // Keep the coordinates far enough from the int64 limits that cell counts
+  // cannot overflow
+  const S limit = static_cast<S>(std::int64_t(1) << 40);
+
+  for(int i = 0; i < 3; ++i)
+  {
+    const S min = std::floor(aabb.min_[i] * inv_cell_sizes_[level]);
+    const S max = std::floor(aabb.max_[i] * inv_cell_sizes_[level]);
+    if(!(min >= -limit && max <= limit && min <= max))
+      return false;
+
+    lo[i] = static_cast<std::int64_t>(min);
+    hi[i] = static_cast<std::int64_t>(max);
+  }
+
+  return true;
+}
+
+//==============================================================================
+template <typename S>
+std::size_t HashGridCollisionManager<S>::computeBucket(
+    int level, std::int64_t x, std::int64_t y, std::int64_t z) const
+{
+  std::uint64_t h = static_cast<std::uint64_t>(x) * 73856093u
+      ^ static_cast<std::uint64_t>(y) * 19349663u
+      ^ static_cast<std::uint64_t>(z) * 83492791u
+      ^ static_cast<std::uint64_t>(level) * 2654435761u;
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdull;
+  h ^= h >> 33;
+
+  return static_cast<std::size_t>(h) & bucket_mask_;
+}
+
+//==============================================================================
+template <typename S>
+template <typename Visitor>
+bool HashGridCollisionManager<S>::visitOverlaps(
+    const AABB<S>& aabb, int min_level, Visitor visit) const
+{
+  const int num_levels = static_cast<int>(level_objs_.size());
+  std::int64_t lo[3] = {0, 0, 0}, hi[3] = {0, 0, 0};
+
+  for(int level = std::max(min_level, 0); level < num_levels; ++level)
+  {
+    const std::vector<std::size_t>& level_objs = level_objs_[level];
+    if(level_objs.empty()) continue;
+
+    // Scanning the whole level is cheaper than enumerating the cells of a
+    // query that covers more cells than the level has objects
+    if(!computeCellRange(aabb, level, lo, hi)
+       || S(hi[0] - lo[0] + 1) * S(hi[1] - lo[1] + 1) * S(hi[2] - lo[2] + 1)
+          > S(level_objs.size()))
+    {
+      for(std::size_t j : level_objs)
+      {
+        if(aabbs_[j].overlap(aabb) && visit(j))
+          return true;
+      }
+      continue;
+    }
+
+    for(std::int64_t z = lo[2]; z <= hi[2]; ++z)
+    {
+      for(std::int64_t y = lo[1]; y <= hi[1]; ++y)
+      {
+        for(std::int64_t x = lo[0]; x <= hi[0]; ++x)
+        {
+          const std::size_t bucket = computeBucket(level, x, y, z);
+          const std::size_t end = bucket_begin_[bucket + 1];
+          std::size_t last = std::numeric_limits<std::size_t>::max();
+
+          for(std::size_t k = bucket_begin_[bucket]; k < end; ++k)
+          {
+            // Objects are sorted within a bucket, so several cells of the
+            // same object hashed to this bucket are adjacent
+            const std::size_t j = bucket_objs_[k];
+            if(j == last) continue;
+            last = j;
+
+            if(levels_[j] != level) continue;
+
+            const AABB<S>& other = aabbs_[j];
+            if(!other.overlap(aabb)) continue;
+
+            // Report the pair only from the cell holding the lower corner of
+            // the intersection of the two boxes
+            if(computeCellCoord(std::max(aabb.min_[0], other.min_[0]), level) != x
+               || computeCellCoord(std::max(aabb.min_[1], other.min_[1]), level) != y
+               || computeCellCoord(std::max(aabb.min_[2], other.min_[2]), level) != z)
+              continue;
+
+            if(visit(j))
+              return true;
+          }
+        }
+      }
+    }
+  }
+
+  return false;
+}
+
+//==============================================================================
+template <typename S>
+bool HashGridCollisionManager<S>::collide_(
+    CollisionObject<S>* obj, const AABB<S>& aabb,
+    void* cdata, CollisionCallBack<S> callback) const
+{
+  for(std::size_t j : oversized_objs_)
+  {
+    if(aabbs_[j].overlap(aabb))
+    {
+      if(callback(obj, objs_[j], cdata))
+        return true;
+    }
+  }
+
+  return visitOverlaps(aabb, 0, [&](std::size_t j)
+  {
+    return callback(obj, objs_[j], cdata);
+  });
+}
+
+} // namespace fcl
+
+#endif
@@ -0,0 +1,217 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */ 
+
+
+#ifndef FCL_BROADPHASE_BROADPHASEHASHGRID_H
+#define FCL_BROADPHASE_BROADPHASEHASHGRID_H
+
+#include <cstdint>
+#include <vector>
+
+#include "fcl/math/bv/AABB.h"
+#include "fcl/broadphase/broadphase_collision_manager.h"
+
+namespace fcl
+{
+
+/// @brief Multi-level uniform grid collision manager.
+///
+/// The grid is stored in flat arrays and is rebuilt from scratch by setup()
+/// and update(): every object is assigned to the coarsest-enough level of the
+/// grid (the cell size doubles from one level to the next), the (cell, object)
+/// pairs are counted and then distributed into the buckets of a hash table by
+/// a counting sort. Both passes can run on several threads, and the resulting
+/// layout does not depend on the number of threads. Queries only read the flat
+/// arrays and never allocate.
+///
+/// This suits large swarms of small objects that all move every frame, where
+/// rebuilding is cheaper than updating an incremental structure. Objects that
+/// are much larger than the coarsest cell are kept in a separate list and
+/// tested against everything. Distance queries do not use the grid and scan
+/// the cached AABBs instead.
+///
+/// Like the tree-based managers, the grid only reflects the state of the
+/// objects at the last call of setup() or update(). Objects registered since
+/// then are tested against everything until the next rebuild.
+template <typename S>
+class FCL_EXPORT HashGridCollisionManager : public BroadPhaseCollisionManager<S>
+{
+public:
+
+  /// @brief Create a grid whose finest cells have edge length cell_size, with
+  /// num_levels levels. num_threads is the number of threads used to rebuild
+  /// the grid, 0 meaning one thread per hardware core.
+  HashGridCollisionManager(S cell_size = 1,
+                           unsigned int num_levels = 4,
+                           unsigned int num_threads = 1);
+
+  /// @brief add objects to the manager
+  void registerObjects(const std::vector<CollisionObject<S>*>& other_objs);
+
+  /// @brief add one object to the manager
+  void registerObject(CollisionObject<S>* obj);
+
+  /// @brief remove one object from the manager. The object is dropped from
+  /// queries right away; its slot is reclaimed by the next setup() or update()
+  void unregisterObject(CollisionObject<S>* obj);
+
+  /// @brief initialize the manager, related with the specific type of manager
+  void setup();
+
+  /// @brief update the condition of manager
+  void update();
+
+  /// @brief clear the manager
+  void clear();
+
+  /// @brief return the objects managed by the manager
+  void getObjects(std::vector<CollisionObject<S>*>& objs) const;
+
+  /// @brief perform collision test between one object and all the objects belonging to the manager
+  void collide(CollisionObject<S>* obj, void* cdata, CollisionCallBack<S> callback) const;
+
+  /// @brief perform distance computation between one object and all the objects belonging to the manager
+  void distance(CollisionObject<S>* obj, void* cdata, DistanceCallBack<S> callback) const;
+
+  /// @brief perform collision test for the objects belonging to the manager (i.e., N^2 self collision)
+  void collide(void* cdata, CollisionCallBack<S> callback) const;
+
+  /// @brief perform distance test for the objects belonging to the manager (i.e., N^2 self distance)
+  void distance(void* cdata, DistanceCallBack<S> callback) const;
+
+  /// @brief perform collision test with objects belonging to another manager
+  void collide(BroadPhaseCollisionManager<S>* other_manager, void* cdata, CollisionCallBack<S> callback) const;
+
+  /// @brief perform distance test with objects belonging to another manager
+  void distance(BroadPhaseCollisionManager<S>* other_manager, void* cdata, DistanceCallBack<S> callback) const;
+
+  /// @brief whether the manager is empty
+  bool empty() const;
+
+  /// @brief the number of objects managed by the manager
+  size_t size() const;
+
+  /// @brief edge length of the cells of the finest level
+  S getCellSize() const;
+
+  /// @brief number of levels of the grid
+  unsigned int getNumLevels() const;
+
+  /// @brief set the number of threads used to rebuild the grid (0 means one
+  /// thread per hardware core)
+  void setNumThreads(unsigned int num_threads);
+
+  /// @brief number of threads used to rebuild the grid
+  unsigned int getNumThreads() const;
+
+  /// @brief number of objects that are too large for the grid and are tested
+  /// against all the other objects
+  size_t getNumOversizedObjects() const;
+
+protected:
+
+  /// @brief Rebuild the flat grid from the current AABBs of the objects
+  void rebuild();
+
+  /// @brief Level whose cells are at least as large as the AABB, or -1 when
+  /// the AABB covers too many cells even at the coarsest level
+  int computeLevel(const AABB<S>& aabb) const;
+
+  /// @brief Integer coordinate of the cell containing x at level
+  std::int64_t computeCellCoord(S x, int level) const;
+
+  /// @brief Integer coordinates of the cells covering the AABB at level.
+  /// Returns false when the AABB is not finite or too far from the origin to
+  /// be represented.
+  bool computeCellRange(const AABB<S>& aabb, int level,
+                        std::int64_t lo[3], std::int64_t hi[3]) const;
+
+  /// @brief Bucket of the hash table holding the given cell
+  std::size_t computeBucket(int level, std::int64_t x, std::int64_t y,
+                            std::int64_t z) const;
+
+  /// @brief Call visit(j) once for every gridded object j of level at least
+  /// min_level whose AABB overlaps aabb. Stops as soon as visit returns true,
+  /// and returns whether it did.
+  template <typename Visitor>
+  bool visitOverlaps(const AABB<S>& aabb, int min_level, Visitor visit) const;
+
+  /// @brief collide one object, whose AABB is aabb, with the objects of the
+  /// manager. Returns true if the callback asked to stop.
+  bool collide_(CollisionObject<S>* obj, const AABB<S>& aabb,
+                void* cdata, CollisionCallBack<S> callback) const;
+
+  /// @brief edge length of the cells of each level, and its inverse
+  std::vector<S> cell_sizes_;
+  std::vector<S> inv_cell_sizes_;
+
+  unsigned int num_threads_;
+
+  /// @brief managed objects, and their AABB and level at the last rebuild
+  std::vector<CollisionObject<S>*> objs_;
+  std::vector<AABB<S>> aabbs_;
+  std::vector<int> levels_;
+
+  /// @brief number of null slots left in objs_ by unregisterObject()
+  std::size_t num_removed_;
+
+  /// @brief objects of each level, and objects that are not in the grid
+  std::vector<std::vector<std::size_t>> level_objs_;
+  std::vector<std::size_t> oversized_objs_;
+
+  /// @brief (bucket, object) entries of each object are stored in
+  /// [entry_begin_[i], entry_begin_[i + 1])
+  std::vector<std::size_t> entry_begin_;
+  std::vector<std::size_t> entry_buckets_;
+  std::vector<std::size_t> entry_objs_;
+
+  /// @brief objects of bucket b are bucket_objs_[bucket_begin_[b]] to
+  /// bucket_objs_[bucket_begin_[b + 1] - 1]
+  std::vector<std::size_t> bucket_begin_;
+  std::vector<std::size_t> bucket_objs_;
+  std::size_t bucket_mask_;
+
+  /// @brief per-block bucket histograms of the counting sort
+  std::vector<std::size_t> block_counts_;
+};
+
+using HashGridCollisionManagerf = HashGridCollisionManager<float>;
+using HashGridCollisionManagerd = HashGridCollisionManager<double>;
+
+} // namespace fcl
+
+#include "fcl/broadphase/broadphase_hash_grid-inl.h"
+
+#endif
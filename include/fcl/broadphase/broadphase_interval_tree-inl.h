@@ -40,6 +40,8 @@
 
 #include "fcl/broadphase/broadphase_interval_tree.h"
 
+#include <set>
+
 namespace fcl
 {
 
@@ -576,15 +578,13 @@ void IntervalTreeCollisionManager<S>::distance(void* cdata, DistanceCallBack<S>
 {
   if(size() == 0) return;
 
-  this->enable_tested_set_ = true;
-  this->tested_set.clear();
+  this->enableTestedSet();
   S min_dist = std::numeric_limits<S>::max();
 
   for(size_t i = 0; i < endpoints[0].size(); ++i)
     if(distance_(endpoints[0][i].obj, cdata, callback, min_dist)) break;
 
-  this->enable_tested_set_ = false;
-  this->tested_set.clear();
+  this->disableTestedSet();
 }
 
 //==============================================================================
@@ -692,12 +692,14 @@ bool IntervalTreeCollisionManager<S>::checkDist(
     DistanceCallBack<S> callback,
     S& min_dist) const
 {
+  const bool use_tested_set = this->isTestedSetEnabled();
+
   while(pos_start < pos_end)
   {
     SAPInterval* ivl = static_cast<SAPInterval*>(*pos_start);
     if(ivl->obj != obj)
     {
-      if(!this->enable_tested_set_)
+      if(!use_tested_set)
       {
         if(ivl->obj->getAABB().distance(obj->getAABB()) < min_dist)
         {
@@ -707,15 +709,13 @@ bool IntervalTreeCollisionManager<S>::checkDist(
       }
       else
       {
-        if(!this->inTestedSet(ivl->obj, obj))
+        if(this->insertTestedSet(ivl->obj, obj))
         {
           if(ivl->obj->getAABB().distance(obj->getAABB()) < min_dist)
           {
             if(callback(ivl->obj, obj, cdata, min_dist))
               return true;
           }
-
-          this->insertTestedSet(ivl->obj, obj);
         }
       }
     }
@@ -0,0 +1,296 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */ 
+
+
+#ifndef FCL_BROADPHASE_BROADPHASEPAIRCACHE_INL_H
+#define FCL_BROADPHASE_BROADPHASEPAIRCACHE_INL_H
+
+#include "fcl/broadphase/broadphase_pair_cache.h"
+
+#include <algorithm>
+#include <functional>
+
+namespace fcl {
+
+//==============================================================================
+extern template
+struct FCL_EXPORT BroadPhasePair<double>;
+
+//==============================================================================
+extern template
+class FCL_EXPORT BroadPhasePairCache<double>;
+
+//==============================================================================
+template <typename S>
+BroadPhasePair<S>::BroadPhasePair(CollisionObject<S>* o1, CollisionObject<S>* o2)
+  : o1(o1), o2(o2), user_data(nullptr)
+{
+  // Do nothing
+}
+
+//==============================================================================
+template <typename S>
+std::size_t BroadPhasePairCache<S>::ObjectPairHash::operator()(
+    const ObjectPair& p) const
+{
+  const std::size_t h1 = std::hash<CollisionObject<S>*>()(p.first);
+  const std::size_t h2 = std::hash<CollisionObject<S>*>()(p.second);
+  return h1 ^ (h2 + 0x9e3779b9 + (h1 << 6) + (h1 >> 2));
+}
+
+//==============================================================================
+template <typename S>
+BroadPhasePairCache<S>::Entry::Entry(
+    CollisionObject<S>* o1, CollisionObject<S>* o2, std::size_t stamp)
+  : pair(o1, o2), first_stamp(stamp), last_stamp(stamp)
+{
+  // Do nothing
+}
+
+//==============================================================================
+template <typename S>
+BroadPhasePairCache<S>::BroadPhasePairCache(
+    BroadPhaseCollisionManager<S>* manager)
+  : manager_(manager), stamp_(0)
+{
+  // Do nothing
+}
+
+//==============================================================================
+template <typename S>
+void BroadPhasePairCache<S>::setManager(BroadPhaseCollisionManager<S>* manager)
+{
+  manager_ = manager;
+  pairs_.clear();
+  begin_pairs_.clear();
+  end_pairs_.clear();
+}
+
+//==============================================================================
+template <typename S>
+BroadPhaseCollisionManager<S>* BroadPhasePairCache<S>::getManager() const
+{
+  return manager_;
+}
+
+//==============================================================================
+template <typename S>
+void BroadPhasePairCache<S>::update(
+    void* cdata, BroadPhasePairCallBack<S> callback, bool report_persist)
+{
+  ++stamp_;
+  begin_pairs_.clear();
+  end_pairs_.clear();
+
+  if(manager_)
+    manager_->collide(this, collectCallback);
+
+  // the pairs not found by this search are no longer overlapping
+  for(auto it = pairs_.begin(); it != pairs_.end();)
+  {
+    if(it->second.last_stamp != stamp_)
+    {
+      end_pairs_.push_back(it->second.pair);
+      it = pairs_.erase(it);
+    }
+    else
+    {
+      ++it;
+    }
+  }
+
+  if(!callback) return;
+
+  for(auto* pair : begin_pairs_)
+    callback(*pair, BPE_BEGIN, cdata);
+
+  if(report_persist)
+  {
+    for(auto& item : pairs_)
+    {
+      if(item.second.first_stamp != stamp_)
+        callback(item.second.pair, BPE_PERSIST, cdata);
+    }
+  }
+
+  for(auto& pair : end_pairs_)
+    callback(pair, BPE_END, cdata);
+}
+
+//==============================================================================
+template <typename S>
+void BroadPhasePairCache<S>::removeObject(
+    CollisionObject<S>* obj, void* cdata, BroadPhasePairCallBack<S> callback)
+{
+  end_pairs_.clear();
+
+  for(auto it = pairs_.begin(); it != pairs_.end();)
+  {
+    if(it->first.first == obj || it->first.second == obj)
+    {
+      end_pairs_.push_back(it->second.pair);
+      it = pairs_.erase(it);
+    }
+    else
+    {
+      ++it;
+    }
+  }
+
+  // the removed pairs may still be referred by the result of the last update
+  begin_pairs_.erase(
+        std::remove_if(begin_pairs_.begin(), begin_pairs_.end(),
+                       [obj](const BroadPhasePair<S>* pair)
+  { return pair->o1 == obj || pair->o2 == obj; }),
+        begin_pairs_.end());
+
+  if(!callback) return;
+
+  for(auto& pair : end_pairs_)
+    callback(pair, BPE_END, cdata);
+}
+
+//==============================================================================
+template <typename S>
+void BroadPhasePairCache<S>::clear(
+    void* cdata, BroadPhasePairCallBack<S> callback)
+{
+  end_pairs_.clear();
+  end_pairs_.reserve(pairs_.size());
+  for(auto& item : pairs_)
+    end_pairs_.push_back(item.second.pair);
+
+  pairs_.clear();
+  begin_pairs_.clear();
+
+  if(!callback) return;
+
+  for(auto& pair : end_pairs_)
+    callback(pair, BPE_END, cdata);
+}
+
+//==============================================================================
+template <typename S>
+const std::vector<BroadPhasePair<S>*>&
+BroadPhasePairCache<S>::getBeginPairs() const
+{
+  return begin_pairs_;
+}
+
+//==============================================================================
+template <typename S>
+const std::vector<BroadPhasePair<S>>&
+BroadPhasePairCache<S>::getEndPairs() const
+{
+  return end_pairs_;
+}
+
+//==============================================================================
+template <typename S>
+void BroadPhasePairCache<S>::getPairs(std::vector<BroadPhasePair<S>*>& pairs)
+{
+  pairs.resize(pairs_.size());
+  size_t i = 0;
+  for(auto& item : pairs_)
+    pairs[i++] = &item.second.pair;
+}
+
+//==============================================================================
+template <typename S>
+BroadPhasePair<S>* BroadPhasePairCache<S>::findPair(
+    CollisionObject<S>* a, CollisionObject<S>* b)
+{
+  auto it = pairs_.find(makeKey(a, b));
+  if(it == pairs_.end()) return nullptr;
+  return &it->second.pair;
+}
+
+//==============================================================================
+template <typename S>
+size_t BroadPhasePairCache<S>::size() const
+{
+  return pairs_.size();
+}
+
+//==============================================================================
+template <typename S>
+bool BroadPhasePairCache<S>::empty() const
+{
+  return pairs_.empty();
+}
+
+//==============================================================================
+template <typename S>
+typename BroadPhasePairCache<S>::ObjectPair BroadPhasePairCache<S>::makeKey(
+    CollisionObject<S>* a, CollisionObject<S>* b)
+{
+  if(a < b) return std::make_pair(a, b);
+  else return std::make_pair(b, a);
+}
+
+//==============================================================================
+template <typename S>
+bool BroadPhasePairCache<S>::collectCallback(
+    CollisionObject<S>* o1, CollisionObject<S>* o2, void* cdata)
+{
+  // Some managers report candidate pairs that are only close in their spatial
+  // structure; keep the cache strictly about overlapping AABBs.
+  if(o1->getAABB().overlap(o2->getAABB()))
+    static_cast<BroadPhasePairCache<S>*>(cdata)->addOverlap(o1, o2);
+
+  return false;
+}
+
+//==============================================================================
+template <typename S>
+void BroadPhasePairCache<S>::addOverlap(
+    CollisionObject<S>* a, CollisionObject<S>* b)
+{
+  const ObjectPair key = makeKey(a, b);
+  auto it = pairs_.find(key);
+  if(it == pairs_.end())
+  {
+    auto res = pairs_.emplace(key, Entry(key.first, key.second, stamp_));
+    begin_pairs_.push_back(&res.first->second.pair);
+  }
+  else
+  {
+    it->second.last_stamp = stamp_;
+  }
+}
+
+} // namespace fcl
+
+#endif
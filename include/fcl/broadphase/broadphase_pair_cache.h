@@ -0,0 +1,200 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */ 
+
+
+#ifndef FCL_BROADPHASE_BROADPHASEPAIRCACHE_H
+#define FCL_BROADPHASE_BROADPHASEPAIRCACHE_H
+
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "fcl/broadphase/broadphase_collision_manager.h"
+
+namespace fcl
+{
+
+/// @brief Kind of change reported for a cached broadphase pair
+enum BroadPhasePairEvent
+{
+  /// @brief the AABBs of the pair started to overlap in this update
+  BPE_BEGIN,
+  /// @brief the AABBs of the pair were overlapping in the previous update and
+  /// still overlap
+  BPE_PERSIST,
+  /// @brief the AABBs of the pair stopped overlapping in this update (or one of
+  /// the objects was removed from the cache)
+  BPE_END
+};
+
+/// @brief A pair of objects whose AABBs overlap, as stored in a
+/// BroadPhasePairCache. The objects are ordered such that o1 < o2.
+template <typename S>
+struct FCL_EXPORT BroadPhasePair
+{
+  CollisionObject<S>* o1;
+
+  CollisionObject<S>* o2;
+
+  /// @brief User slot for narrowphase state cached across updates (e.g.,
+  /// contact manifolds or GJK warm-start data). The cache never touches it;
+  /// it is the user's responsibility to release it on BPE_END.
+  void* user_data;
+
+  BroadPhasePair(CollisionObject<S>* o1, CollisionObject<S>* o2);
+};
+
+/// @brief Callback for a change of a cached broadphase pair.
+template <typename S>
+using BroadPhasePairCallBack = void (*)(
+    BroadPhasePair<S>& pair, BroadPhasePairEvent event, void* cdata);
+
+/// @brief Persistent cache of the overlapping AABB pairs of a broadphase
+/// manager.
+///
+/// Every call to update() runs the self collision query of the managed
+/// broadphase manager and compares the resulting overlapping pairs against the
+/// ones found by the previous update. Only the pairs that started overlapping
+/// (BPE_BEGIN) and stopped overlapping (BPE_END) are reported by default, so
+/// narrowphase work can be limited to the pairs whose state changed; pairs that
+/// keep overlapping are kept with their user slot intact.
+///
+/// The cache does not own the manager. The manager has to be updated (i.e.,
+/// BroadPhaseCollisionManager::update()) before the cache is updated.
+template <typename S>
+class FCL_EXPORT BroadPhasePairCache
+{
+public:
+
+  explicit BroadPhasePairCache(BroadPhaseCollisionManager<S>* manager);
+
+  /// @brief set the manager whose overlapping pairs are cached. All the cached
+  /// pairs are dropped without being reported.
+  void setManager(BroadPhaseCollisionManager<S>* manager);
+
+  /// @brief get the manager whose overlapping pairs are cached
+  BroadPhaseCollisionManager<S>* getManager() const;
+
+  /// @brief recompute the overlapping pairs of the manager. If callback is not
+  /// null, it is called for each new pair (BPE_BEGIN), for each pair that
+  /// survived the update when report_persist is true (BPE_PERSIST) and for each
+  /// removed pair (BPE_END), in this order.
+  void update(void* cdata = nullptr,
+              BroadPhasePairCallBack<S> callback = nullptr,
+              bool report_persist = false);
+
+  /// @brief remove all the pairs involving obj, e.g., before the object is
+  /// unregistered from the manager and destroyed. The removed pairs are
+  /// reported as BPE_END.
+  void removeObject(CollisionObject<S>* obj,
+                    void* cdata = nullptr,
+                    BroadPhasePairCallBack<S> callback = nullptr);
+
+  /// @brief remove all the cached pairs. The removed pairs are reported as
+  /// BPE_END.
+  void clear(void* cdata = nullptr,
+             BroadPhasePairCallBack<S> callback = nullptr);
+
+  /// @brief the pairs that started overlapping in the last update. The pointers
+  /// stay valid until the pair is removed from the cache.
+  const std::vector<BroadPhasePair<S>*>& getBeginPairs() const;
+
+  /// @brief the pairs that were removed by the last update(), removeObject() or
+  /// clear() call
+  const std::vector<BroadPhasePair<S>>& getEndPairs() const;
+
+  /// @brief return all the cached pairs
+  void getPairs(std::vector<BroadPhasePair<S>*>& pairs);
+
+  /// @brief return the cached pair of objects a and b, or nullptr if their
+  /// AABBs did not overlap in the last update
+  BroadPhasePair<S>* findPair(CollisionObject<S>* a, CollisionObject<S>* b);
+
+  /// @brief the number of cached pairs
+  size_t size() const;
+
+  /// @brief whether there is no cached pair
+  bool empty() const;
+
+protected:
+
+  using ObjectPair = std::pair<CollisionObject<S>*, CollisionObject<S>*>;
+
+  struct ObjectPairHash
+  {
+    std::size_t operator()(const ObjectPair& p) const;
+  };
+
+  struct Entry
+  {
+    BroadPhasePair<S> pair;
+
+    /// @brief the update in which the pair started overlapping
+    std::size_t first_stamp;
+
+    /// @brief the last update in which the pair was found overlapping
+    std::size_t last_stamp;
+
+    Entry(CollisionObject<S>* o1, CollisionObject<S>* o2, std::size_t stamp);
+  };
+
+  static ObjectPair makeKey(CollisionObject<S>* a, CollisionObject<S>* b);
+
+  static bool collectCallback(
+      CollisionObject<S>* o1, CollisionObject<S>* o2, void* cdata);
+
+  void addOverlap(CollisionObject<S>* a, CollisionObject<S>* b);
+
+  BroadPhaseCollisionManager<S>* manager_;
+
+  std::unordered_map<ObjectPair, Entry, ObjectPairHash> pairs_;
+
+  std::vector<BroadPhasePair<S>*> begin_pairs_;
+
+  std::vector<BroadPhasePair<S>> end_pairs_;
+
+  /// @brief counter of the updates, used to detect pairs that were not found by
+  /// the last update
+  std::size_t stamp_;
+};
+
+using BroadPhasePairCachef = BroadPhasePairCache<float>;
+using BroadPhasePairCached = BroadPhasePairCache<double>;
+
+} // namespace fcl
+
+#include "fcl/broadphase/broadphase_pair_cache-inl.h"
+
+#endif
@@ -0,0 +1,76 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */ 
+
+
+#ifndef FCL_BROADPHASE_BROADPHASEPARALLELOPTIONS_H
+#define FCL_BROADPHASE_BROADPHASEPARALLELOPTIONS_H
+
+#include "fcl/export.h"
+
+namespace fcl
+{
+
+/// @brief Options of the parallel broadphase queries
+struct FCL_EXPORT BroadPhaseParallelOptions
+{
+  /// @brief Number of threads. The default of 1 runs the query on the calling
+  /// thread; 0 opts in to one thread per hardware core.
+  unsigned int num_threads;
+
+  /// @brief If true, the callback is only called on the calling thread, in
+  /// the same order as the serial query, and the user data does not need to be
+  /// thread-safe; only the traversal runs in parallel. Otherwise the callback
+  /// is called concurrently from all the threads with the same user data.
+  /// In both cases, the query stops on all the threads once the callback
+  /// returns true.
+  bool deterministic;
+
+  /// @brief Number of tasks per thread the query is split into; more tasks
+  /// balance the load better, at the price of more scheduling
+  unsigned int tasks_per_thread;
+
+  BroadPhaseParallelOptions(unsigned int num_threads_ = 1,
+                            bool deterministic_ = false,
+                            unsigned int tasks_per_thread_ = 8)
+    : num_threads(num_threads_),
+      deterministic(deterministic_),
+      tasks_per_thread(tasks_per_thread_)
+  {
+  }
+};
+
+} // namespace fcl
+
+#endif
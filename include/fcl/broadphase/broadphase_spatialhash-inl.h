@@ -523,8 +523,7 @@ void SpatialHashingCollisionManager<S, HashTable>::distance(
   if(size() == 0)
     return;
 
-  this->enable_tested_set_ = true;
-  this->tested_set.clear();
+  this->enableTestedSet();
 
   S min_dist = std::numeric_limits<S>::max();
 
@@ -534,8 +533,7 @@ void SpatialHashingCollisionManager<S, HashTable>::distance(
       break;
   }
 
-  this->enable_tested_set_ = false;
-  this->tested_set.clear();
+  this->disableTestedSet();
 }
 
 //==============================================================================
@@ -637,12 +635,14 @@ bool SpatialHashingCollisionManager<S, HashTable>::distanceObjectToObjects(
     DistanceCallBack<S> callback,
     S& min_dist) const
 {
+  const bool use_tested_set = this->isTestedSetEnabled();
+
   for(auto& obj2 : objs)
   {
     if(obj == obj2)
       continue;
 
-    if(!this->enable_tested_set_)
+    if(!use_tested_set)
     {
       if(obj->getAABB().distance(obj2->getAABB()) < min_dist)
       {
@@ -652,15 +652,13 @@ bool SpatialHashingCollisionManager<S, HashTable>::distanceObjectToObjects(
     }
     else
     {
-      if(!this->inTestedSet(obj, obj2))
+      if(this->insertTestedSet(obj, obj2))
       {
         if(obj->getAABB().distance(obj2->getAABB()) < min_dist)
         {
           if(callback(obj, obj2, cdata, min_dist))
             return true;
         }
-
-        this->insertTestedSet(obj, obj2);
       }
     }
   }
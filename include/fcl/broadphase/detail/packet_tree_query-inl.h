@@ -0,0 +1,256 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */ 
+
+
+#ifndef FCL_BROADPHASE_DETAIL_PACKETTREEQUERY_INL_H
+#define FCL_BROADPHASE_DETAIL_PACKETTREEQUERY_INL_H
+
+#include "fcl/broadphase/detail/packet_tree_query.h"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include "fcl/common/detail/parallel.h"
+#include "fcl/broadphase/detail/morton.h"
+
+namespace fcl
+{
+
+namespace detail
+{
+
+//==============================================================================
+template <typename S, typename Node, typename Access>
+constexpr std::size_t PacketTreeQuery<S, Node, Access>::max_packet_size;
+
+//==============================================================================
+template <typename S, typename Node, typename Access>
+PacketTreeQuery<S, Node, Access>::PacketTreeQuery(
+    const Access& access, const BroadPhaseParallelOptions& options)
+  : access_(access),
+    options_(options)
+{
+  // Do nothing
+}
+
+//==============================================================================
+template <typename S, typename Node, typename Access>
+void PacketTreeQuery<S, Node, Access>::collide(
+    const Node* root,
+    const std::vector<CollisionObject<S>*>& queries,
+    const std::vector<void*>& cdata,
+    CollisionCallBack<S> callback)
+{
+  assert(cdata.size() == queries.size());
+
+  sortQueries(queries);
+
+  const std::size_t num_packets
+      = (queries.size() + max_packet_size - 1) / max_packet_size;
+  parallelForChunks(num_packets, options_.num_threads, 1,
+                    [&](unsigned int, std::size_t begin, std::size_t end)
+  {
+    Packet packet;
+    for(std::size_t i = begin; i < end; ++i)
+    {
+      makePacket(i * max_packet_size,
+                 std::min((i + 1) * max_packet_size, queries.size()),
+                 queries, cdata, packet);
+      collideRecurse(root, packet.alive, packet, callback);
+    }
+  });
+}
+
+//==============================================================================
+template <typename S, typename Node, typename Access>
+void PacketTreeQuery<S, Node, Access>::distance(
+    const Node* root,
+    const std::vector<CollisionObject<S>*>& queries,
+    const std::vector<void*>& cdata,
+    DistanceCallBack<S> callback)
+{
+  assert(cdata.size() == queries.size());
+
+  sortQueries(queries);
+
+  const std::size_t num_packets
+      = (queries.size() + max_packet_size - 1) / max_packet_size;
+  parallelForChunks(num_packets, options_.num_threads, 1,
+                    [&](unsigned int, std::size_t begin, std::size_t end)
+  {
+    Packet packet;
+    for(std::size_t i = begin; i < end; ++i)
+    {
+      makePacket(i * max_packet_size,
+                 std::min((i + 1) * max_packet_size, queries.size()),
+                 queries, cdata, packet);
+      distanceRecurse(root, packet.alive, packet, callback);
+    }
+  });
+}
+
+//==============================================================================
+template <typename S, typename Node, typename Access>
+void PacketTreeQuery<S, Node, Access>::sortQueries(
+    const std::vector<CollisionObject<S>*>& queries)
+{
+  const std::size_t n = queries.size();
+  order_.resize(n);
+  if(n == 0) return;
+
+  AABB<S> bound(queries[0]->getAABB().center());
+  for(std::size_t i = 1; i < n; ++i)
+    bound += queries[i]->getAABB().center();
+
+  // Avoid dividing by zero when all the queries are aligned
+  for(int i = 0; i < 3; ++i)
+  {
+    if(!(bound.max_[i] > bound.min_[i]))
+      bound.max_[i] = bound.min_[i] + 1;
+  }
+
+  morton_functor<S, uint32> coder(bound);
+  std::vector<std::pair<uint32, std::size_t>> codes(n);
+  for(std::size_t i = 0; i < n; ++i)
+    codes[i] = std::make_pair(coder(queries[i]->getAABB().center()), i);
+
+  std::sort(codes.begin(), codes.end());
+
+  for(std::size_t i = 0; i < n; ++i)
+    order_[i] = codes[i].second;
+}
+
+//==============================================================================
+template <typename S, typename Node, typename Access>
+void PacketTreeQuery<S, Node, Access>::makePacket(
+    std::size_t begin, std::size_t end,
+    const std::vector<CollisionObject<S>*>& queries,
+    const std::vector<void*>& cdata,
+    Packet& packet) const
+{
+  packet.size = end - begin;
+  packet.alive = (packet.size == max_packet_size)
+      ? ~Mask(0) : ((Mask(1) << packet.size) - 1);
+
+  for(std::size_t k = 0; k < packet.size; ++k)
+  {
+    const std::size_t i = order_[begin + k];
+    packet.objs[k] = queries[i];
+    packet.aabbs[k] = &queries[i]->getAABB();
+    packet.cdata[k] = cdata[i];
+    packet.min_dist[k] = std::numeric_limits<S>::max();
+
+    if(k == 0)
+      packet.bv = *packet.aabbs[k];
+    else
+      packet.bv += *packet.aabbs[k];
+  }
+}
+
+//==============================================================================
+template <typename S, typename Node, typename Access>
+void PacketTreeQuery<S, Node, Access>::collideRecurse(
+    const Node* node, Mask active, Packet& packet,
+    CollisionCallBack<S> callback) const
+{
+  if(!node->bv.overlap(packet.bv)) return;
+
+  Mask overlapping = 0;
+  active &= packet.alive;
+  for(std::size_t k = 0; active; ++k, active >>= 1)
+  {
+    if((active & 1) && node->bv.overlap(*packet.aabbs[k]))
+      overlapping |= Mask(1) << k;
+  }
+
+  if(!overlapping) return;
+
+  if(node->isLeaf())
+  {
+    CollisionObject<S>* obj = static_cast<CollisionObject<S>*>(node->data);
+    Mask remaining = overlapping;
+    for(std::size_t k = 0; remaining; ++k, remaining >>= 1)
+    {
+      if((remaining & 1) && callback(obj, packet.objs[k], packet.cdata[k]))
+        packet.alive &= ~(Mask(1) << k);
+    }
+    return;
+  }
+
+  collideRecurse(access_.child(node, 0), overlapping, packet, callback);
+  collideRecurse(access_.child(node, 1), overlapping, packet, callback);
+}
+
+//==============================================================================
+template <typename S, typename Node, typename Access>
+void PacketTreeQuery<S, Node, Access>::distanceRecurse(
+    const Node* node, Mask active, Packet& packet,
+    DistanceCallBack<S> callback) const
+{
+  Mask closer = 0;
+  active &= packet.alive;
+  for(std::size_t k = 0; active; ++k, active >>= 1)
+  {
+    if((active & 1) && node->bv.distance(*packet.aabbs[k]) < packet.min_dist[k])
+      closer |= Mask(1) << k;
+  }
+
+  if(!closer) return;
+
+  if(node->isLeaf())
+  {
+    CollisionObject<S>* obj = static_cast<CollisionObject<S>*>(node->data);
+    for(std::size_t k = 0; closer; ++k, closer >>= 1)
+    {
+      if((closer & 1) && callback(obj, packet.objs[k], packet.cdata[k], packet.min_dist[k]))
+        packet.alive &= ~(Mask(1) << k);
+    }
+    return;
+  }
+
+  // Visit first the child closer to the packet, which usually shrinks the
+  // minimum distances faster
+  const Node* children[2] = {access_.child(node, 0), access_.child(node, 1)};
+  if(children[1]->bv.distance(packet.bv) < children[0]->bv.distance(packet.bv))
+    std::swap(children[0], children[1]);
+
+  distanceRecurse(children[0], closer, packet, callback);
+  distanceRecurse(children[1], closer, packet, callback);
+}
+
+} // namespace detail
+} // namespace fcl
+
+#endif
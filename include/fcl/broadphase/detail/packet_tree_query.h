@@ -0,0 +1,133 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */ 
+
+
+#ifndef FCL_BROADPHASE_DETAIL_PACKETTREEQUERY_H
+#define FCL_BROADPHASE_DETAIL_PACKETTREEQUERY_H
+
+#include <cstdint>
+#include <vector>
+
+#include "fcl/broadphase/broadphase_collision_manager.h"
+#include "fcl/broadphase/broadphase_parallel_options.h"
+
+namespace fcl
+{
+
+namespace detail
+{
+
+/// @brief Batched queries of many objects against one hierarchy tree.
+///
+/// The queries are sorted along a Morton curve of their AABB centers and
+/// grouped into packets of neighboring queries. Each packet walks the tree
+/// once, carrying the mask of its queries that still overlap the current
+/// node (or, for distance, that can still improve their minimum distance),
+/// so that the top levels of the tree are loaded once per packet instead of
+/// once per query. The packets are distributed over several threads. The
+/// callbacks of one query are all called on the same thread, in an order that
+/// does not depend on the number of threads.
+///
+/// Access gives the children of a node, see PointerTreeAccess and
+/// ArrayTreeAccess.
+template <typename S, typename Node, typename Access>
+class FCL_EXPORT PacketTreeQuery
+{
+public:
+  /// @brief maximum number of queries in a packet
+  static constexpr std::size_t max_packet_size = 32;
+
+  PacketTreeQuery(const Access& access, const BroadPhaseParallelOptions& options);
+
+  /// @brief Same as calling the serial collision traversal of the tree rooted
+  /// at root with every query, with callback(tree_object, queries[i], cdata[i])
+  void collide(const Node* root,
+               const std::vector<CollisionObject<S>*>& queries,
+               const std::vector<void*>& cdata,
+               CollisionCallBack<S> callback);
+
+  /// @brief Same as calling the serial distance traversal of the tree rooted
+  /// at root with every query, with callback(tree_object, queries[i],
+  /// cdata[i], min_dist[i])
+  void distance(const Node* root,
+                const std::vector<CollisionObject<S>*>& queries,
+                const std::vector<void*>& cdata,
+                DistanceCallBack<S> callback);
+
+private:
+  using Mask = std::uint32_t;
+
+  /// @brief Queries of one packet, in Morton order
+  struct Packet
+  {
+    std::size_t size;
+    AABB<S> bv;
+    const AABB<S>* aabbs[max_packet_size];
+    CollisionObject<S>* objs[max_packet_size];
+    void* cdata[max_packet_size];
+    S min_dist[max_packet_size];
+
+    /// @brief queries whose callback did not ask to stop yet
+    Mask alive;
+  };
+
+  /// @brief Sort the queries along a Morton curve
+  void sortQueries(const std::vector<CollisionObject<S>*>& queries);
+
+  /// @brief Fill the packet with the sorted queries [begin, end)
+  void makePacket(std::size_t begin, std::size_t end,
+                  const std::vector<CollisionObject<S>*>& queries,
+                  const std::vector<void*>& cdata,
+                  Packet& packet) const;
+
+  void collideRecurse(const Node* node, Mask active, Packet& packet,
+                      CollisionCallBack<S> callback) const;
+
+  void distanceRecurse(const Node* node, Mask active, Packet& packet,
+                       DistanceCallBack<S> callback) const;
+
+  Access access_;
+  BroadPhaseParallelOptions options_;
+
+  /// @brief query indices in Morton order
+  std::vector<std::size_t> order_;
+};
+
+} // namespace detail
+} // namespace fcl
+
+#include "fcl/broadphase/detail/packet_tree_query-inl.h"
+
+#endif
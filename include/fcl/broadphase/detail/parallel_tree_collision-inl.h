@@ -0,0 +1,229 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */ 
+
+
+#ifndef FCL_BROADPHASE_DETAIL_PARALLELTREECOLLISION_INL_H
+#define FCL_BROADPHASE_DETAIL_PARALLELTREECOLLISION_INL_H
+
+#include "fcl/broadphase/detail/parallel_tree_collision.h"
+
+#include "fcl/common/detail/parallel.h"
+
+namespace fcl
+{
+
+namespace detail
+{
+
+//==============================================================================
+template <typename Node>
+const Node* PointerTreeAccess<Node>::child(const Node* node, int i) const
+{
+  return node->children[i];
+}
+
+//==============================================================================
+template <typename Node>
+const Node* ArrayTreeAccess<Node>::child(const Node* node, int i) const
+{
+  return nodes + node->children[i];
+}
+
+//==============================================================================
+template <typename S, typename Node, typename Access>
+ParallelTreeCollision<S, Node, Access>::ParallelTreeCollision(
+    const Access& access1,
+    const Access& access2,
+    const BroadPhaseParallelOptions& options)
+  : access1_(access1),
+    access2_(access2),
+    options_(options),
+    num_threads_(resolveNumThreads(options.num_threads)),
+    stop_(false)
+{
+  // Do nothing
+}
+
+//==============================================================================
+template <typename S, typename Node, typename Access>
+void ParallelTreeCollision<S, Node, Access>::run(
+    const Node* root1, const Node* root2,
+    void* cdata, CollisionCallBack<S> callback)
+{
+  const std::size_t num_tasks
+      = std::size_t(num_threads_) * std::max(options_.tasks_per_thread, 1u);
+  int depth = 0;
+  while(num_threads_ > 1 && (std::size_t(1) << depth) < num_tasks)
+    ++depth;
+
+  tasks_.clear();
+  stop_ = false;
+  split(root1, root2, depth);
+
+  if(options_.deterministic)
+    runDeterministic(cdata, callback);
+  else
+    runConcurrent(cdata, callback);
+}
+
+//==============================================================================
+template <typename S, typename Node, typename Access>
+void ParallelTreeCollision<S, Node, Access>::split(
+    const Node* node1, const Node* node2, int depth)
+{
+  if(!node1->bv.overlap(node2->bv)) return;
+
+  if(depth == 0 || (node1->isLeaf() && node2->isLeaf()))
+  {
+    tasks_.emplace_back(node1, node2);
+    return;
+  }
+
+  if(node2->isLeaf() || (!node1->isLeaf() && (node1->bv.size() > node2->bv.size())))
+  {
+    split(access1_.child(node1, 0), node2, depth - 1);
+    split(access1_.child(node1, 1), node2, depth - 1);
+  }
+  else
+  {
+    split(node1, access2_.child(node2, 0), depth - 1);
+    split(node1, access2_.child(node2, 1), depth - 1);
+  }
+}
+
+//==============================================================================
+template <typename S, typename Node, typename Access>
+template <typename Visitor>
+bool ParallelTreeCollision<S, Node, Access>::recurse(
+    const Node* node1, const Node* node2, Visitor& visit) const
+{
+  if(stop_.load(std::memory_order_relaxed)) return true;
+
+  if(!node1->bv.overlap(node2->bv)) return false;
+
+  if(node1->isLeaf() && node2->isLeaf())
+    return visit(node1, node2);
+
+  if(node2->isLeaf() || (!node1->isLeaf() && (node1->bv.size() > node2->bv.size())))
+  {
+    if(recurse(access1_.child(node1, 0), node2, visit))
+      return true;
+    if(recurse(access1_.child(node1, 1), node2, visit))
+      return true;
+  }
+  else
+  {
+    if(recurse(node1, access2_.child(node2, 0), visit))
+      return true;
+    if(recurse(node1, access2_.child(node2, 1), visit))
+      return true;
+  }
+
+  return false;
+}
+
+//==============================================================================
+template <typename S, typename Node, typename Access>
+void ParallelTreeCollision<S, Node, Access>::runConcurrent(
+    void* cdata, CollisionCallBack<S> callback)
+{
+  auto visit = [&](const Node* leaf1, const Node* leaf2)
+  {
+    if(callback(static_cast<CollisionObject<S>*>(leaf1->data),
+                static_cast<CollisionObject<S>*>(leaf2->data), cdata))
+    {
+      stop_ = true;
+      return true;
+    }
+    return false;
+  };
+
+  parallelForChunks(tasks_.size(), num_threads_, 1,
+                    [&](unsigned int, std::size_t begin, std::size_t end)
+  {
+    for(std::size_t i = begin; i < end; ++i)
+    {
+      if(recurse(tasks_[i].first, tasks_[i].second, visit))
+        return;
+    }
+  });
+}
+
+//==============================================================================
+template <typename S, typename Node, typename Access>
+void ParallelTreeCollision<S, Node, Access>::runDeterministic(
+    void* cdata, CollisionCallBack<S> callback)
+{
+  // With a single thread the traversal runs inline on the calling thread and
+  // already reports the pairs in order, so there is nothing to buffer
+  if(num_threads_ <= 1)
+  {
+    runConcurrent(cdata, callback);
+    return;
+  }
+
+  // The workers buffer the overlapping leaves of each task, then the calling
+  // thread hands them to the callback in task order
+  std::vector<std::vector<ObjectPair>> pairs(tasks_.size());
+  parallelForChunks(tasks_.size(), num_threads_, 1,
+                    [&](unsigned int, std::size_t begin, std::size_t end)
+  {
+    for(std::size_t i = begin; i < end; ++i)
+    {
+      std::vector<ObjectPair>& task_pairs = pairs[i];
+      auto visit = [&](const Node* leaf1, const Node* leaf2)
+      {
+        task_pairs.emplace_back(static_cast<CollisionObject<S>*>(leaf1->data),
+                                static_cast<CollisionObject<S>*>(leaf2->data));
+        return false;
+      };
+      recurse(tasks_[i].first, tasks_[i].second, visit);
+    }
+  });
+
+  for(const auto& task_pairs : pairs)
+  {
+    for(const auto& pair : task_pairs)
+    {
+      if(callback(pair.first, pair.second, cdata))
+        return;
+    }
+  }
+}
+
+} // namespace detail
+} // namespace fcl
+
+#endif
@@ -0,0 +1,124 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */ 
+
+
+#ifndef FCL_BROADPHASE_DETAIL_PARALLELTREECOLLISION_H
+#define FCL_BROADPHASE_DETAIL_PARALLELTREECOLLISION_H
+
+#include <atomic>
+#include <utility>
+#include <vector>
+
+#include "fcl/broadphase/broadphase_collision_manager.h"
+#include "fcl/broadphase/broadphase_parallel_options.h"
+
+namespace fcl
+{
+
+namespace detail
+{
+
+/// @brief Access to the children of the nodes of a pointer-based hierarchy
+/// tree
+template <typename Node>
+struct PointerTreeAccess
+{
+  const Node* child(const Node* node, int i) const;
+};
+
+/// @brief Access to the children of the nodes of an array-based hierarchy
+/// tree
+template <typename Node>
+struct ArrayTreeAccess
+{
+  const Node* nodes;
+
+  const Node* child(const Node* node, int i) const;
+};
+
+/// @brief Collision traversal of two hierarchy trees on several threads.
+///
+/// The top levels of the two trees are first split, serially, into
+/// independent pairs of subtrees, in the order the serial traversal would
+/// visit them. The pairs are then traversed by a pool of threads, using the
+/// same descent rule as the serial traversal. In deterministic mode the
+/// overlapping leaves of each pair are buffered and handed to the callback on
+/// the calling thread, pair after pair, so that the callback sees exactly the
+/// same sequence as with the serial traversal.
+template <typename S, typename Node, typename Access>
+class FCL_EXPORT ParallelTreeCollision
+{
+public:
+  ParallelTreeCollision(const Access& access1,
+                        const Access& access2,
+                        const BroadPhaseParallelOptions& options);
+
+  /// @brief Report the overlapping leaves of the trees rooted at root1 and
+  /// root2 to the callback, until it returns true
+  void run(const Node* root1, const Node* root2,
+           void* cdata, CollisionCallBack<S> callback);
+
+private:
+  using ObjectPair = std::pair<CollisionObject<S>*, CollisionObject<S>*>;
+
+  /// @brief Split the traversal into pairs of subtrees, depth levels down
+  void split(const Node* node1, const Node* node2, int depth);
+
+  /// @brief Serial traversal of a pair of subtrees. Calls visit(leaf1, leaf2)
+  /// for overlapping leaves, and returns true once the traversal is cancelled
+  template <typename Visitor>
+  bool recurse(const Node* node1, const Node* node2, Visitor& visit) const;
+
+  void runConcurrent(void* cdata, CollisionCallBack<S> callback);
+
+  void runDeterministic(void* cdata, CollisionCallBack<S> callback);
+
+  Access access1_;
+  Access access2_;
+  BroadPhaseParallelOptions options_;
+  unsigned int num_threads_;
+
+  std::vector<std::pair<const Node*, const Node*>> tasks_;
+
+  /// @brief set once the callback returned true, checked by all the workers
+  std::atomic<bool> stop_;
+};
+
+} // namespace detail
+} // namespace fcl
+
+#include "fcl/broadphase/detail/parallel_tree_collision-inl.h"
+
+#endif
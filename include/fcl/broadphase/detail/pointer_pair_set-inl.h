@@ -0,0 +1,162 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */ 
+
+
+#ifndef FCL_BROADPHASE_DETAIL_POINTERPAIRSET_INL_H
+#define FCL_BROADPHASE_DETAIL_POINTERPAIRSET_INL_H
+
+#include "fcl/broadphase/detail/pointer_pair_set.h"
+
+#include <cstdint>
+
+namespace fcl
+{
+
+namespace detail
+{
+
+//==============================================================================
+template <typename T>
+PointerPairSet<T>::PointerPairSet()
+  : slots_(64, Pair(nullptr, nullptr)), mask_(63)
+{
+  // Do nothing
+}
+
+//==============================================================================
+template <typename T>
+bool PointerPairSet<T>::insert(T* a, T* b)
+{
+  const Pair p = makePair(a, b);
+  size_t i = find(p);
+  if(slots_[i].first != nullptr)
+    return false;
+
+  // Keep the load factor below 1/2 so that probe sequences stay short
+  if(2 * (filled_.size() + 1) > slots_.size())
+  {
+    grow();
+    i = find(p);
+  }
+
+  slots_[i] = p;
+  filled_.push_back(i);
+  return true;
+}
+
+//==============================================================================
+template <typename T>
+bool PointerPairSet<T>::contains(T* a, T* b) const
+{
+  return slots_[find(makePair(a, b))].first != nullptr;
+}
+
+//==============================================================================
+template <typename T>
+void PointerPairSet<T>::clear()
+{
+  for(const auto i : filled_)
+    slots_[i] = Pair(nullptr, nullptr);
+  filled_.clear();
+}
+
+//==============================================================================
+template <typename T>
+size_t PointerPairSet<T>::size() const
+{
+  return filled_.size();
+}
+
+//==============================================================================
+template <typename T>
+bool PointerPairSet<T>::empty() const
+{
+  return filled_.empty();
+}
+
+//==============================================================================
+template <typename T>
+typename PointerPairSet<T>::Pair PointerPairSet<T>::makePair(T* a, T* b)
+{
+  if(a < b) return Pair(a, b);
+  else return Pair(b, a);
+}
+
+//==============================================================================
+template <typename T>
+size_t PointerPairSet<T>::hash(const Pair& p) const
+{
+  // Mix the two addresses with the 64-bit finalizer of MurmurHash3; the low
+  // bits of pointers are mostly zero because of alignment.
+  std::uint64_t h = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(p.first));
+  h ^= static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(p.second)) * 0x9e3779b97f4a7c15ull;
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdull;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ull;
+  h ^= h >> 33;
+  return static_cast<size_t>(h) & mask_;
+}
+
+//==============================================================================
+template <typename T>
+size_t PointerPairSet<T>::find(const Pair& p) const
+{
+  size_t i = hash(p);
+  while(slots_[i].first != nullptr && slots_[i] != p)
+    i = (i + 1) & mask_;
+  return i;
+}
+
+//==============================================================================
+template <typename T>
+void PointerPairSet<T>::grow()
+{
+  std::vector<Pair> old_slots(2 * slots_.size(), Pair(nullptr, nullptr));
+  old_slots.swap(slots_);
+  mask_ = slots_.size() - 1;
+
+  for(auto& i : filled_)
+  {
+    const Pair& p = old_slots[i];
+    i = find(p);
+    slots_[i] = p;
+  }
+}
+
+} // namespace detail
+} // namespace fcl
+
+#endif
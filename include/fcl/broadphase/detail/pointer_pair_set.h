@@ -0,0 +1,106 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */ 
+
+
+#ifndef FCL_BROADPHASE_DETAIL_POINTERPAIRSET_H
+#define FCL_BROADPHASE_DETAIL_POINTERPAIRSET_H
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "fcl/export.h"
+
+namespace fcl
+{
+
+namespace detail
+{
+
+/// @brief A set of unordered pairs of pointers, implemented as a flat
+/// open-addressing hash table with linear probing. The storage is kept between
+/// clear() calls and clear() only resets the slots that were filled, so the set
+/// can be reused by every query at a cost proportional to the number of
+/// inserted pairs.
+template <typename T>
+class FCL_EXPORT PointerPairSet
+{
+public:
+  PointerPairSet();
+
+  /// @brief Insert the unordered pair (a, b). Return true if the pair was not
+  /// in the set.
+  bool insert(T* a, T* b);
+
+  /// @brief Whether the unordered pair (a, b) is in the set
+  bool contains(T* a, T* b) const;
+
+  /// @brief Remove all the pairs, keeping the allocated storage
+  void clear();
+
+  /// @brief The number of pairs in the set
+  size_t size() const;
+
+  /// @brief Whether the set is empty
+  bool empty() const;
+
+private:
+  using Pair = std::pair<T*, T*>;
+
+  static Pair makePair(T* a, T* b);
+
+  size_t hash(const Pair& p) const;
+
+  /// @brief Return the slot holding p, or the empty slot where p would be
+  /// inserted
+  size_t find(const Pair& p) const;
+
+  void grow();
+
+  /// @brief The hash table; a slot with a null first pointer is empty
+  std::vector<Pair> slots_;
+
+  /// @brief The indices of the filled slots, used by clear() and grow()
+  std::vector<size_t> filled_;
+
+  size_t mask_;
+};
+
+} // namespace detail
+} // namespace fcl
+
+#include "fcl/broadphase/detail/pointer_pair_set-inl.h"
+
+#endif
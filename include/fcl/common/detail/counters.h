@@ -0,0 +1,298 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @author Jia Pan */
+
+#ifndef FCL_COMMON_DETAIL_COUNTERS_H
+#define FCL_COMMON_DETAIL_COUNTERS_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+  #include <intrin.h>
+  #define FCL_COUNTERS_HAVE_RDTSC 1
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+  #include <x86intrin.h>
+  #define FCL_COUNTERS_HAVE_RDTSC 1
+#else
+  #define FCL_COUNTERS_HAVE_RDTSC 0
+#endif
+
+#include "fcl/export.h"
+
+namespace fcl {
+namespace detail {
+
+/// @brief Statically registered event counters. Every counter is a fixed slot
+/// in the per-thread storage of Counters, so counting never looks up a name.
+enum class Counter : unsigned int
+{
+  BVTests,                 ///< BV overlap/distance tests in BVH traversal
+  LeafTests,               ///< primitive tests in BVH traversal
+  GJKIterations,           ///< GJK iterations (libccd and built-in solver)
+  EPAFaces,                ///< faces created while expanding EPA polytopes
+  EPAIterations,           ///< EPA polytope expansions (libccd and built-in solver)
+  BroadphasePairsTested,   ///< object pairs whose AABBs were tested
+  BroadphasePairsPassed,   ///< object pairs handed to the broadphase callback
+  NumCounters
+};
+
+/// @brief Statically registered timers; see Counter.
+enum class Timer : unsigned int
+{
+  Collide,                 ///< fcl::collide()
+  Distance,                ///< fcl::distance()
+  BroadphaseCollide,       ///< dynamic AABB tree manager collide()
+  BroadphaseDistance,      ///< dynamic AABB tree manager distance()
+  NumTimers
+};
+
+/// @brief Totals of all counters and timers at one point in time. Snapshots
+/// of different runs, processes or machines can be merged with operator+=,
+/// and the work done between two snapshots is their difference.
+struct FCL_EXPORT CountersSnapshot
+{
+  static constexpr std::size_t kNumCounters
+      = static_cast<std::size_t>(Counter::NumCounters);
+  static constexpr std::size_t kNumTimers
+      = static_cast<std::size_t>(Timer::NumTimers);
+
+  /// @brief Value of each counter
+  std::array<std::uint64_t, kNumCounters> counts;
+
+  /// @brief Number of timed scopes for each timer
+  std::array<std::uint64_t, kNumTimers> timer_calls;
+
+  /// @brief Ticks (see Counters::ticks()) spent in each timer
+  std::array<std::uint64_t, kNumTimers> timer_ticks;
+
+  /// @brief Tick rate used to convert timer_ticks to seconds
+  double ticks_per_second;
+
+  CountersSnapshot();
+
+  std::uint64_t count(Counter id) const;
+
+  std::uint64_t calls(Timer id) const;
+
+  /// @brief Time spent in the timer, in seconds
+  double seconds(Timer id) const;
+
+  /// @brief Merge the totals of another snapshot into this one
+  CountersSnapshot& operator+=(const CountersSnapshot& other);
+
+  /// @brief Totals of this snapshot minus those of an earlier one
+  CountersSnapshot operator-(const CountersSnapshot& earlier) const;
+
+  /// @brief Print all counters and timers, one per line
+  void print(std::ostream& out = std::cout) const;
+};
+
+/// @brief Low-overhead counters and timers for hot paths.
+///
+/// Each thread owns a block of relaxed atomics that only it writes, so
+/// counting is a plain load/add/store without locks or contended cache lines.
+/// Blocks are linked into a lock-free list the first time a thread counts and
+/// are recycled when the thread exits (their totals are kept), which makes
+/// snapshot() a lock-free walk over at most one block per thread ever alive at
+/// the same time. Counting is off by default; while disabled every call costs
+/// one relaxed load and a branch. Instrumented library code only calls in here
+/// when FCL_ENABLE_PROFILING is set (see fcl/common/profiler.h).
+class FCL_EXPORT Counters
+{
+public:
+  /// @brief Turn counting on or off for all threads
+  static void enable(bool enable = true);
+
+  /// @brief Whether counting is on
+  static bool enabled();
+
+  /// @brief Add n to a counter of the calling thread
+  static void add(Counter id, std::uint64_t n = 1);
+
+  /// @brief Add one timed scope of the given number of ticks to a timer of
+  /// the calling thread
+  static void addTime(Timer id, std::uint64_t ticks);
+
+  /// @brief Current time in ticks: the time stamp counter on x86, steady
+  /// clock nanoseconds elsewhere
+  static std::uint64_t ticks();
+
+  /// @brief Rate of ticks(), calibrated against the steady clock
+  static double ticksPerSecond();
+
+  /// @brief Sum of the counters and timers of all threads
+  static CountersSnapshot snapshot();
+
+  static const char* name(Counter id);
+
+  static const char* name(Timer id);
+
+private:
+  /// @brief Storage of one thread
+  struct Block
+  {
+    std::atomic<std::uint64_t> counts[CountersSnapshot::kNumCounters];
+    std::atomic<std::uint64_t> timer_calls[CountersSnapshot::kNumTimers];
+    std::atomic<std::uint64_t> timer_ticks[CountersSnapshot::kNumTimers];
+
+    /// @brief Whether a live thread owns this block
+    std::atomic<bool> in_use;
+
+    /// @brief Next block in the list; immutable once the block is published
+    Block* next;
+
+    Block();
+
+    void addTo(CountersSnapshot& snapshot) const;
+  };
+
+  /// @brief Owns the block of a thread and recycles it when the thread exits
+  struct ThreadHandle;
+
+  /// @brief Block of the calling thread, claimed on first use
+  static Block& localBlock();
+
+  static Block* claimBlock();
+
+  static void releaseBlock(Block* block);
+
+  static std::atomic<Block*> blocks_;
+
+  static std::atomic<bool> enabled_;
+};
+
+/// @brief Adds the time between its construction and destruction to a timer,
+/// if counting was on at construction.
+class FCL_EXPORT ScopedTimer
+{
+public:
+  explicit ScopedTimer(Timer id);
+
+  ~ScopedTimer();
+
+  ScopedTimer(const ScopedTimer&) = delete;
+  ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+  Timer id_;
+  bool active_;
+  std::uint64_t start_;
+};
+
+/// @brief Adds the value of a variable to a counter when it goes out of scope;
+/// meant for loop counters of functions with several exits.
+template <typename T>
+class ScopedCount
+{
+public:
+  ScopedCount(Counter id, const T& value);
+
+  ~ScopedCount();
+
+  ScopedCount(const ScopedCount&) = delete;
+  ScopedCount& operator=(const ScopedCount&) = delete;
+
+private:
+  Counter id_;
+  const T& value_;
+};
+
+//==============================================================================
+inline bool Counters::enabled()
+{
+  return enabled_.load(std::memory_order_relaxed);
+}
+
+//==============================================================================
+inline void Counters::add(Counter id, std::uint64_t n)
+{
+  if(!enabled())
+    return;
+
+  std::atomic<std::uint64_t>& slot = localBlock().counts[static_cast<std::size_t>(id)];
+  slot.store(slot.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+}
+
+//==============================================================================
+inline std::uint64_t Counters::ticks()
+{
+#if FCL_COUNTERS_HAVE_RDTSC
+  return __rdtsc();
+#else
+  return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+//==============================================================================
+inline ScopedTimer::ScopedTimer(Timer id)
+  : id_(id), active_(Counters::enabled()), start_(0)
+{
+  if(active_)
+    start_ = Counters::ticks();
+}
+
+//==============================================================================
+inline ScopedTimer::~ScopedTimer()
+{
+  if(active_)
+    Counters::addTime(id_, Counters::ticks() - start_);
+}
+
+//==============================================================================
+template <typename T>
+ScopedCount<T>::ScopedCount(Counter id, const T& value)
+  : id_(id), value_(value)
+{
+  // Do nothing
+}
+
+//==============================================================================
+template <typename T>
+ScopedCount<T>::~ScopedCount()
+{
+  Counters::add(id_, static_cast<std::uint64_t>(value_));
+}
+
+} // namespace detail
+} // namespace fcl
+
+#endif
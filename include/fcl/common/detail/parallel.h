@@ -0,0 +1,128 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */ 
+
+
+#ifndef FCL_COMMON_DETAIL_PARALLEL_H
+#define FCL_COMMON_DETAIL_PARALLEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <thread>
+
+#include "fcl/export.h"
+
+namespace fcl {
+namespace detail {
+
+/// @brief Resolve a requested number of threads: 0 means one thread per
+/// hardware core.
+FCL_EXPORT
+unsigned int resolveNumThreads(unsigned int num_threads);
+
+/// @brief Call task(i) once for every i in [0, num_tasks), concurrently on
+/// the calling thread and a process-wide pool of worker threads that is
+/// created on first use and kept afterwards. Returns once all the tasks are
+/// done. Tasks run inline on the calling thread when they are issued from
+/// inside another parallel region, or while the pool is busy with one.
+FCL_EXPORT
+void runParallelTasks(unsigned int num_tasks,
+                      const std::function<void(unsigned int)>& task);
+
+/// @brief Call f(thread_index, begin, end) on num_threads threads for
+/// consecutive, non-overlapping chunks that cover [0, n). The chunks handed to
+/// one thread are increasing, and at most grain_size items long. Runs inline
+/// on the calling thread when a single thread is enough, and on the shared
+/// worker pool otherwise, so that no thread is created per call.
+template <typename Function>
+void parallelForChunks(
+    std::size_t n, unsigned int num_threads, std::size_t grain_size, Function f)
+{
+  if(n == 0) return;
+
+  grain_size = std::max<std::size_t>(grain_size, 1);
+  const std::size_t num_chunks = (n + grain_size - 1) / grain_size;
+  const std::size_t num_workers = std::min<std::size_t>(
+        resolveNumThreads(num_threads), num_chunks);
+
+  if(num_workers <= 1)
+  {
+    f(0u, std::size_t(0), n);
+    return;
+  }
+
+  std::atomic<std::size_t> next_chunk(0);
+  auto worker = [&](unsigned int thread_index)
+  {
+    for(std::size_t chunk = next_chunk++; chunk < num_chunks; chunk = next_chunk++)
+    {
+      const std::size_t begin = chunk * grain_size;
+      f(thread_index, begin, std::min(begin + grain_size, n));
+    }
+  };
+
+  runParallelTasks(static_cast<unsigned int>(num_workers), worker);
+}
+
+/// @brief Split [0, n) into num_blocks contiguous blocks of (almost) equal
+/// size and call f(block, begin, end) for each block, in parallel.
+/// Unlike parallelForChunks(), the partition only depends on n and
+/// num_blocks, which is what deterministic multi-pass algorithms (e.g.,
+/// counting sorts) need.
+template <typename Function>
+void parallelForBlocks(std::size_t n, unsigned int num_blocks, Function f)
+{
+  if(num_blocks <= 1)
+  {
+    f(0u, std::size_t(0), n);
+    return;
+  }
+
+  auto block_begin = [n, num_blocks](std::size_t block)
+  {
+    return n * block / num_blocks;
+  };
+
+  runParallelTasks(num_blocks, [&](unsigned int block)
+  {
+    f(block, block_begin(block), block_begin(block + 1));
+  });
+}
+
+} // namespace detail
+} // namespace fcl
+
+#endif
@@ -47,6 +47,9 @@
   #define FCL_PROFILE_BLOCK_BEGIN(name)    ::fcl::detail::Profiler::Begin(name);
   #define FCL_PROFILE_BLOCK_END(name)      ::fcl::detail::Profiler::End(name);
   #define FCL_PROFILE_STATUS(stream)       ::fcl::detail::Profiler::Status(stream);
+  #define FCL_PROFILE_COUNT(id, n)         ::fcl::detail::Counters::add(::fcl::detail::Counter::id, n)
+  #define FCL_PROFILE_COUNT_ON_EXIT(id, v) ::fcl::detail::ScopedCount<decltype(v)> fcl_profile_count_##id(::fcl::detail::Counter::id, v)
+  #define FCL_PROFILE_TIMER(id)            ::fcl::detail::ScopedTimer fcl_profile_timer_##id(::fcl::detail::Timer::id)
 
 #else
 
@@ -55,9 +58,13 @@
   #define FCL_PROFILE_BLOCK_BEGIN(name)
   #define FCL_PROFILE_BLOCK_END(name)
   #define FCL_PROFILE_STATUS(stream)
+  #define FCL_PROFILE_COUNT(id, n)
+  #define FCL_PROFILE_COUNT_ON_EXIT(id, v)
+  #define FCL_PROFILE_TIMER(id)
 
 #endif // #if FCL_ENABLE_PROFILING
 
+#include "fcl/common/detail/counters.h"
 #include "fcl/common/detail/profiler.h"
 
 #endif // #ifndef FCL_COMMON_PROFILER_H
@@ -79,6 +79,9 @@ using VectorN = Eigen::Matrix<S, N, 1>;
 template <typename S>
 using VectorX = Eigen::Matrix<S, Eigen::Dynamic, 1>;
 
+template <typename S>
+using MatrixX = Eigen::Matrix<S, Eigen::Dynamic, Eigen::Dynamic>;
+
 template <typename S>
 using Matrix3 = Eigen::Matrix<S, 3, 3>;
 
@@ -99,6 +102,7 @@ using Vector3f = Vector3<float>;
 template <int N>
 using VectorNf = VectorN<float, N>;
 using VectorXf = VectorX<float>;
+using MatrixXf = MatrixX<float>;
 using Matrix3f = Matrix3<float>;
 using Quaternionf = Quaternion<float>;
 using Transform3f = Transform3<float>;
@@ -110,6 +114,7 @@ using Vector3d = Vector3<double>;
 template <int N>
 using VectorNd = VectorN<double, N>;
 using VectorXd = VectorX<double>;
+using MatrixXd = MatrixX<double>;
 using Matrix3d = Matrix3<double>;
 using Quaterniond = Quaternion<double>;
 using Transform3d = Transform3<double>;
@@ -177,6 +177,13 @@ int BVHModel<BV>::getNumBVs() const
   return num_bvs;
 }
 
+//==============================================================================
+template <typename BV>
+int BVHModel<BV>::getPrimitiveId(int i) const
+{
+  return primitive_indices[i];
+}
+
 //==============================================================================
 template <typename BV>
 OBJECT_TYPE BVHModel<BV>::getObjectType() const
@@ -508,6 +515,7 @@ int BVHModel<BV>::endModel()
   num_bvs = 0;
 
   buildTree();
+  computeLocalAABB();
 
   // finish constructing
   build_state = BVH_BUILD_STATE_PROCESSED;
@@ -613,6 +621,8 @@ int BVHModel<BV>::endReplaceModel(bool refit, bool bottomup)
     buildTree();
   }
 
+  computeLocalAABB();
+
   build_state = BVH_BUILD_STATE_PROCESSED;
 
   return BVH_OK;
@@ -726,6 +736,7 @@ int BVHModel<BV>::endUpdateModel(bool refit, bool bottomup)
     refitTree(bottomup);
   }
 
+  computeLocalAABB();
 
   build_state = BVH_BUILD_STATE_UPDATED;
 
@@ -1227,6 +1238,16 @@ struct GetNodeTypeImpl<OBBRSS<S>>
   }
 };
 
+//==============================================================================
+template <typename S>
+struct GetNodeTypeImpl<FloatOBBRSS<S>>
+{
+  static NODE_TYPE run()
+  {
+    return BV_FLOAT_OBBRSS;
+  }
+};
+
 //==============================================================================
 template <typename S>
 struct GetNodeTypeImpl<KDOP<S, 16>>
@@ -84,6 +84,11 @@ public:
   /// @brief Get the number of bv in the BVH
   int getNumBVs() const;
 
+  /// @brief Access the primitive at position i of the BVH ordering. The
+  /// primitives under a BV node are the positions [first_primitive,
+  /// first_primitive + num_primitives) of this ordering.
+  int getPrimitiveId(int i) const;
+
   /// @brief Get the object type: it is a BVH
   OBJECT_TYPE getObjectType() const override;
 
@@ -109,6 +114,8 @@ public:
   int addSubModel(const std::vector<Vector3<S>>& ps);
 
   /// @brief End BVH model construction, will build the bounding volume hierarchy
+  /// and the local AABB. From then on, queries only read the model, which can
+  /// be shared by any number of collision objects and threads.
   int endModel();
 
 
@@ -112,6 +112,16 @@ struct GetOrientationImpl<S, OBBRSS<S>>
   }
 };
 
+//==============================================================================
+template <typename S>
+struct GetOrientationImpl<S, FloatOBBRSS<S>>
+{
+  static Matrix3<S> run(const FloatOBBRSS<S>& bv)
+  {
+    return bv.axis();
+  }
+};
+
 } // namespace fcl
 
 #endif
@@ -42,6 +42,7 @@
 #include "fcl/math/bv/OBB.h"
 #include "fcl/math/bv/RSS.h"
 #include "fcl/math/bv/OBBRSS.h"
+#include "fcl/math/bv/FloatOBBRSS.h"
 #include "fcl/geometry/bvh/BV_node_base.h"
 
 namespace fcl
@@ -477,6 +477,24 @@ struct FitImpl<S, OBBRSS<S>>
   }
 };
 
+//==============================================================================
+template <typename S>
+struct FitImpl<S, FloatOBBRSS<S>>
+{
+  static FloatOBBRSS<S> run(
+      const BVFitter<FloatOBBRSS<S>>& fitter,
+      unsigned int* primitive_indices,
+      int num_primitives)
+  {
+    BVFitter<OBBRSS<S>> obbrss_fitter;
+    obbrss_fitter.set(fitter.vertices, fitter.prev_vertices, fitter.tri_indices,
+                      fitter.type);
+
+    return FloatOBBRSS<S>(
+          obbrss_fitter.fit(primitive_indices, num_primitives));
+  }
+};
+
 } // namespace detail
 } // namespace fcl
 
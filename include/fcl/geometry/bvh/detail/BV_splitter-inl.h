@@ -451,6 +451,55 @@ struct ComputeRuleMedianImpl<S, OBBRSS<S>>
   }
 };
 
+//==============================================================================
+template <typename S>
+struct ComputeRuleCenterImpl<S, FloatOBBRSS<S>>
+{
+  static void run(
+      BVSplitter<FloatOBBRSS<S>>& splitter,
+      const FloatOBBRSS<S>& bv,
+      unsigned int* /*primitive_indices*/,
+      int /*num_primitives*/)
+  {
+    computeSplitVector<S, FloatOBBRSS<S>>(bv, splitter.split_vector);
+    computeSplitValue_bvcenter<S, FloatOBBRSS<S>>(bv, splitter.split_value);
+  }
+};
+
+//==============================================================================
+template <typename S>
+struct ComputeRuleMeanImpl<S, FloatOBBRSS<S>>
+{
+  static void run(
+      BVSplitter<FloatOBBRSS<S>>& splitter,
+      const FloatOBBRSS<S>& bv,
+      unsigned int* primitive_indices,
+      int num_primitives)
+  {
+    computeSplitVector<S, FloatOBBRSS<S>>(bv, splitter.split_vector);
+    computeSplitValue_mean<S, FloatOBBRSS<S>>(
+          bv, splitter.vertices, splitter.tri_indices, primitive_indices,
+          num_primitives, splitter.type, splitter.split_vector, splitter.split_value);
+  }
+};
+
+//==============================================================================
+template <typename S>
+struct ComputeRuleMedianImpl<S, FloatOBBRSS<S>>
+{
+  static void run(
+      BVSplitter<FloatOBBRSS<S>>& splitter,
+      const FloatOBBRSS<S>& bv,
+      unsigned int* primitive_indices,
+      int num_primitives)
+  {
+    computeSplitVector<S, FloatOBBRSS<S>>(bv, splitter.split_vector);
+    computeSplitValue_median<S, FloatOBBRSS<S>>(
+          bv, splitter.vertices, splitter.tri_indices, primitive_indices,
+          num_primitives, splitter.type, splitter.split_vector, splitter.split_value);
+  }
+};
+
 //==============================================================================
 template <typename S>
 struct ApplyImpl<S, OBB<S>>
@@ -499,6 +548,18 @@ struct ApplyImpl<S, OBBRSS<S>>
   }
 };
 
+//==============================================================================
+template <typename S>
+struct ApplyImpl<S, FloatOBBRSS<S>>
+{
+  static bool run(
+      const BVSplitter<FloatOBBRSS<S>>& splitter,
+      const Vector3<S>& q)
+  {
+    return splitter.split_vector.dot(q) > splitter.split_value;
+  }
+};
+
 //==============================================================================
 template <typename BV>
 void BVSplitter<BV>::clear()
@@ -573,6 +634,16 @@ struct ComputeSplitVectorImpl<S, OBBRSS<S>>
   }
 };
 
+//==============================================================================
+template <typename S>
+struct ComputeSplitVectorImpl<S, FloatOBBRSS<S>>
+{
+  static void run(const FloatOBBRSS<S>& bv, Vector3<S>& split_vector)
+  {
+    split_vector = bv.axis().col(0);
+  }
+};
+
 //==============================================================================
 template <typename S, typename BV>
 void computeSplitValue_bvcenter(const BV& bv, S& split_value)
@@ -43,6 +43,7 @@
 #include "fcl/math/triangle.h"
 #include "fcl/math/bv/kIOS.h"
 #include "fcl/math/bv/OBBRSS.h"
+#include "fcl/math/bv/FloatOBBRSS.h"
 #include "fcl/geometry/bvh/BVH_internal.h"
 #include "fcl/geometry/bvh/detail/BV_splitter_base.h"
 
@@ -0,0 +1,209 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/** @author Jia Pan */
+
+#ifndef FCL_QUANTIZED_BVH_MODEL_INL_H
+#define FCL_QUANTIZED_BVH_MODEL_INL_H
+
+#include "fcl/geometry/bvh/quantized_BVH_model.h"
+
+#include <iostream>
+
+namespace fcl
+{
+
+//==============================================================================
+extern template
+class QuantizedBVHModel<double, std::uint8_t>;
+
+//==============================================================================
+extern template
+class QuantizedBVHModel<double, std::uint16_t>;
+
+//==============================================================================
+template <typename S, typename Q>
+QuantizedBVHModel<S, Q>::QuantizedBVHModel()
+{
+  // Do nothing
+}
+
+//==============================================================================
+template <typename S, typename Q>
+template <typename BV>
+int QuantizedBVHModel<S, Q>::build(const BVHModel<BV>& model)
+{
+  static_assert(std::is_same<typename BV::S, S>::value,
+                "The source model must use the same scalar type");
+
+  if(model.build_state != BVH_BUILD_STATE_PROCESSED
+     && model.build_state != BVH_BUILD_STATE_UPDATED)
+  {
+    std::cerr << "BVH Error! Call build() on a QuantizedBVHModel with a model whose hierarchy is not built." << std::endl;
+    return BVH_ERR_BUILD_OUT_OF_SEQUENCE;
+  }
+
+  if(model.getModelType() != BVH_MODEL_TRIANGLES)
+  {
+    std::cerr << "BVH Error! QuantizedBVHModel only supports triangle models." << std::endl;
+    return BVH_ERR_UNSUPPORTED_FUNCTION;
+  }
+
+  vertices.assign(model.vertices, model.vertices + model.num_vertices);
+  tri_indices.assign(model.tri_indices, model.tri_indices + model.num_tris);
+
+  const int num_bvs = model.getNumBVs();
+
+  // Exact AABBs of the triangles under every node, bottom up. Children are
+  // always stored after their parent.
+  std::vector<AABB<S>> exact_bvs(num_bvs);
+  for(int i = num_bvs - 1; i >= 0; --i)
+  {
+    const BVNode<BV>& node = model.getBV(i);
+    if(node.isLeaf())
+    {
+      const Triangle& t = tri_indices[node.primitiveId()];
+      exact_bvs[i]
+          = AABB<S>(vertices[t[0]], vertices[t[1]], vertices[t[2]]);
+    }
+    else
+    {
+      exact_bvs[i]
+          = exact_bvs[node.leftChild()] + exact_bvs[node.rightChild()];
+    }
+  }
+
+  // Quantize top down, each node on the grid of its decoded parent
+  root_bv = exact_bvs[0];
+  bvs.resize(num_bvs);
+  bvs[0].setAABB(root_bv, exact_bvs[0]);
+
+  std::vector<AABB<S>> decoded_bvs(num_bvs);
+  decoded_bvs[0] = bvs[0].getAABB(root_bv);
+
+  std::vector<Vector3<S>> points;
+  for(int i = 0; i < num_bvs; ++i)
+  {
+    const BVNode<BV>& node = model.getBV(i);
+    QuantizedBVNode<S, Q>& qnode = bvs[i];
+    qnode.first_child = node.first_child;
+
+    points.clear();
+    for(int j = 0; j < node.num_primitives; ++j)
+    {
+      const Triangle& t
+          = tri_indices[model.getPrimitiveId(node.first_primitive + j)];
+      points.push_back(vertices[t[0]]);
+      points.push_back(vertices[t[1]]);
+      points.push_back(vertices[t[2]]);
+    }
+    qnode.setOBB(decoded_bvs[i], node.getOrientation(), points);
+
+    if(!node.isLeaf())
+    {
+      for(int c : {node.leftChild(), node.rightChild()})
+      {
+        bvs[c].setAABB(decoded_bvs[i], exact_bvs[c]);
+        decoded_bvs[c] = bvs[c].getAABB(decoded_bvs[i]);
+      }
+    }
+  }
+
+  computeLocalAABB();
+
+  return BVH_OK;
+}
+
+//==============================================================================
+template <typename S, typename Q>
+const QuantizedBVNode<S, Q>& QuantizedBVHModel<S, Q>::getBV(int id) const
+{
+  return bvs[id];
+}
+
+//==============================================================================
+template <typename S, typename Q>
+int QuantizedBVHModel<S, Q>::getNumBVs() const
+{
+  return static_cast<int>(bvs.size());
+}
+
+//==============================================================================
+template <typename S, typename Q>
+const AABB<S>& QuantizedBVHModel<S, Q>::getRootBV() const
+{
+  return root_bv;
+}
+
+//==============================================================================
+template <typename S, typename Q>
+OBJECT_TYPE QuantizedBVHModel<S, Q>::getObjectType() const
+{
+  return OT_BVH;
+}
+
+//==============================================================================
+template <typename S, typename Q>
+NODE_TYPE QuantizedBVHModel<S, Q>::getNodeType() const
+{
+  return sizeof(Q) == 1 ? BV_QUANTIZED8 : BV_QUANTIZED16;
+}
+
+//==============================================================================
+template <typename S, typename Q>
+void QuantizedBVHModel<S, Q>::computeLocalAABB()
+{
+  AABB<S> aabb_;
+  for(const auto& v : vertices)
+    aabb_ += v;
+
+  this->aabb_center = aabb_.center();
+
+  this->aabb_radius = 0;
+  for(const auto& v : vertices)
+  {
+    S r = (this->aabb_center - v).squaredNorm();
+    if(r > this->aabb_radius) this->aabb_radius = r;
+  }
+
+  this->aabb_radius = sqrt(this->aabb_radius);
+
+  this->aabb_local = aabb_;
+}
+
+} // namespace fcl
+
+#endif
@@ -0,0 +1,125 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/** @author Jia Pan */
+
+#ifndef FCL_QUANTIZED_BVH_MODEL_H
+#define FCL_QUANTIZED_BVH_MODEL_H
+
+#include <vector>
+
+#include "fcl/geometry/bvh/BVH_model.h"
+#include "fcl/geometry/bvh/quantized_BV_node.h"
+
+namespace fcl
+{
+
+/// @brief A compressed, static copy of the bounding volume hierarchy of a
+/// triangle BVHModel.
+///
+/// Every node keeps the topology of the source hierarchy but stores its AABB
+/// quantized to Q relative to the AABB of its parent, together with an OBB
+/// quantized relative to its own AABB in the frame of the source node (see
+/// QuantizedBVNode). A node takes 36 bytes with 16 bit grids and 24 bytes
+/// with 8 bit grids, against about 250 bytes for BVNode<OBBRSS<double>>.
+/// Queries decode the volumes on the fly while descending the tree. The model
+/// can not be updated; build a new one from the updated BVHModel instead.
+///
+/// Only collision and distance queries against the primitive shapes are
+/// supported. There is no dispatch entry for mesh-mesh or octree queries
+/// with a quantized model, so collide() and distance() report them as not
+/// supported and return no result.
+template <typename S_, typename Q>
+class FCL_EXPORT QuantizedBVHModel : public CollisionGeometry<S_>
+{
+public:
+
+  using S = S_;
+
+  /// @brief Constructing an empty model
+  QuantizedBVHModel();
+
+  /// @brief Build the compressed hierarchy from a triangle model whose
+  /// hierarchy has been built. Vertices and triangles are copied, so model
+  /// can be released afterwards.
+  template <typename BV>
+  int build(const BVHModel<BV>& model);
+
+  /// @brief Access the bv giving the its index
+  const QuantizedBVNode<S, Q>& getBV(int id) const;
+
+  /// @brief Get the number of bv in the BVH
+  int getNumBVs() const;
+
+  /// @brief The grid the root node is quantized on, i.e. the AABB of the
+  /// model in full precision
+  const AABB<S>& getRootBV() const;
+
+  /// @brief Get the object type: it is a BVH
+  OBJECT_TYPE getObjectType() const override;
+
+  /// @brief Get the BV type: BV_QUANTIZED8 or BV_QUANTIZED16
+  NODE_TYPE getNodeType() const override;
+
+  /// @brief Compute the AABB for the BVH, used for broad-phase collision
+  void computeLocalAABB() override;
+
+  /// @brief Geometry point data
+  std::vector<Vector3<S>> vertices;
+
+  /// @brief Geometry triangle index data
+  std::vector<Triangle> tri_indices;
+
+private:
+
+  /// @brief The grid of the root node
+  AABB<S> root_bv;
+
+  /// @brief Bounding volume hierarchy, in the order of the source model
+  std::vector<QuantizedBVNode<S, Q>> bvs;
+};
+
+template <typename S>
+using QuantizedBVHModel8 = QuantizedBVHModel<S, std::uint8_t>;
+
+template <typename S>
+using QuantizedBVHModel16 = QuantizedBVHModel<S, std::uint16_t>;
+
+} // namespace fcl
+
+#include "fcl/geometry/bvh/quantized_BVH_model-inl.h"
+
+#endif
@@ -0,0 +1,283 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/** @author Jia Pan */
+
+#ifndef FCL_BV_QUANTIZEDBVNODE_INL_H
+#define FCL_BV_QUANTIZEDBVNODE_INL_H
+
+#include "fcl/geometry/bvh/quantized_BV_node.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace fcl
+{
+
+//==============================================================================
+extern template
+struct QuantizedBVNode<double, std::uint8_t>;
+
+//==============================================================================
+extern template
+struct QuantizedBVNode<double, std::uint16_t>;
+
+namespace detail
+{
+
+//==============================================================================
+/// @brief Coordinate of grid point q on the grid spanning [lower, upper].
+/// Encoding and decoding must both go through this function so that they
+/// round identically; the end points of the grid are exact.
+template <typename S, typename Q>
+S quantizedCoordinate(S lower, S upper, Q q)
+{
+  const Q n = std::numeric_limits<Q>::max();
+  if(q == n)
+    return upper;
+
+  return lower + (upper - lower) / n * q;
+}
+
+} // namespace detail
+
+//==============================================================================
+template <typename S, typename Q>
+bool QuantizedBVNode<S, Q>::isLeaf() const
+{
+  return first_child < 0;
+}
+
+//==============================================================================
+template <typename S, typename Q>
+int QuantizedBVNode<S, Q>::primitiveId() const
+{
+  return -(first_child + 1);
+}
+
+//==============================================================================
+template <typename S, typename Q>
+int QuantizedBVNode<S, Q>::leftChild() const
+{
+  return first_child;
+}
+
+//==============================================================================
+template <typename S, typename Q>
+int QuantizedBVNode<S, Q>::rightChild() const
+{
+  return first_child + 1;
+}
+
+//==============================================================================
+template <typename S, typename Q>
+void QuantizedBVNode<S, Q>::setAABB(const AABB<S>& parent, const AABB<S>& bv)
+{
+  const int n = std::numeric_limits<Q>::max();
+
+  for(int i = 0; i < 3; ++i)
+  {
+    const S lower = parent.min_[i];
+    const S upper = parent.max_[i];
+    const S cell = (upper - lower) / n;
+
+    int lo = 0;
+    int hi = n;
+    if(cell > 0)
+    {
+      lo = static_cast<int>(std::floor((bv.min_[i] - lower) / cell));
+      hi = static_cast<int>(std::ceil((bv.max_[i] - lower) / cell));
+      lo = std::min(std::max(lo, 0), n);
+      hi = std::min(std::max(hi, 0), n);
+    }
+
+    // The division above may round either way, so settle on the grid points
+    // that actually decode outside of bv
+    while(lo > 0 && detail::quantizedCoordinate(
+            lower, upper, static_cast<Q>(lo)) > bv.min_[i])
+      --lo;
+    while(hi < n && detail::quantizedCoordinate(
+            lower, upper, static_cast<Q>(hi)) < bv.max_[i])
+      ++hi;
+
+    aabb_min[i] = static_cast<Q>(lo);
+    aabb_max[i] = static_cast<Q>(hi);
+  }
+}
+
+//==============================================================================
+template <typename S, typename Q>
+AABB<S> QuantizedBVNode<S, Q>::getAABB(const AABB<S>& parent) const
+{
+  AABB<S> bv;
+  for(int i = 0; i < 3; ++i)
+  {
+    bv.min_[i] = detail::quantizedCoordinate(
+          parent.min_[i], parent.max_[i], aabb_min[i]);
+    bv.max_[i] = detail::quantizedCoordinate(
+          parent.min_[i], parent.max_[i], aabb_max[i]);
+  }
+
+  return bv;
+}
+
+//==============================================================================
+template <typename S, typename Q>
+void QuantizedBVNode<S, Q>::setOBB(
+    const AABB<S>& bv, const Matrix3<S>& axis,
+    const std::vector<Vector3<S>>& points)
+{
+  if(setOBBImpl(bv, axis, points) && getOBB(bv).volume() < bv.volume())
+    return;
+
+  // The axis aligned frame always fits on the grid of bv
+  setOBBImpl(bv, Matrix3<S>::Identity(), points);
+}
+
+//==============================================================================
+template <typename S, typename Q>
+OBB<S> QuantizedBVNode<S, Q>::getOBB(const AABB<S>& bv) const
+{
+  const S unit = (bv.max_ - bv.min_).norm() / std::numeric_limits<Q>::max();
+
+  OBB<S> obb;
+  obb.axis = getOBBAxis();
+  for(int i = 0; i < 3; ++i)
+  {
+    obb.To[i] = detail::quantizedCoordinate(
+          bv.min_[i], bv.max_[i], obb_center[i]);
+    obb.extent[i] = unit * obb_extent[i];
+  }
+
+  return obb;
+}
+
+//==============================================================================
+template <typename S, typename Q>
+Matrix3<S> QuantizedBVNode<S, Q>::getOBBAxis() const
+{
+  return Quaternion<S>(obb_rotation[0], obb_rotation[1],
+                       obb_rotation[2], obb_rotation[3])
+      .normalized().toRotationMatrix();
+}
+
+//==============================================================================
+template <typename S, typename Q>
+bool QuantizedBVNode<S, Q>::setOBBImpl(
+    const AABB<S>& bv, const Matrix3<S>& axis,
+    const std::vector<Vector3<S>>& points)
+{
+  const int n = std::numeric_limits<Q>::max();
+
+  // Fitted frames may be reflections, which have no quaternion
+  Matrix3<S> frame = axis;
+  if(frame.determinant() < 0)
+    frame.col(2) = -frame.col(2);
+
+  Quaternion<S> q(frame);
+  q.normalize();
+  if(q.w() < 0)
+    q.coeffs() = -q.coeffs();
+
+  const S scale = std::numeric_limits<std::int16_t>::max();
+  obb_rotation[0] = static_cast<std::int16_t>(std::round(q.w() * scale));
+  obb_rotation[1] = static_cast<std::int16_t>(std::round(q.x() * scale));
+  obb_rotation[2] = static_cast<std::int16_t>(std::round(q.y() * scale));
+  obb_rotation[3] = static_cast<std::int16_t>(std::round(q.z() * scale));
+
+  // Everything below is measured in the frame the queries will decode
+  const Matrix3<S> R = getOBBAxis();
+
+  Vector3<S> lower = Vector3<S>::Constant(std::numeric_limits<S>::max());
+  Vector3<S> upper = -lower;
+  for(const auto& p : points)
+  {
+    const Vector3<S> u = R.transpose() * p;
+    lower = lower.cwiseMin(u);
+    upper = upper.cwiseMax(u);
+  }
+  const Vector3<S> center = R * (lower + upper) / 2;
+
+  Vector3<S> c;
+  for(int i = 0; i < 3; ++i)
+  {
+    const S cell = (bv.max_[i] - bv.min_[i]) / n;
+    int k = 0;
+    if(cell > 0)
+    {
+      k = static_cast<int>(std::round((center[i] - bv.min_[i]) / cell));
+      k = std::min(std::max(k, 0), n);
+    }
+    obb_center[i] = static_cast<Q>(k);
+    c[i] = detail::quantizedCoordinate(bv.min_[i], bv.max_[i], obb_center[i]);
+  }
+
+  // Grow the extents by the rounding of the center and a few ulps for the
+  // projections done by the overlap tests
+  Vector3<S> extent
+      = (upper - lower) / 2 + (R.transpose() * (center - c)).cwiseAbs();
+  extent.array() += 8 * std::numeric_limits<S>::epsilon()
+      * (c.template lpNorm<1>() + extent.sum());
+
+  const S unit = (bv.max_ - bv.min_).norm() / n;
+  for(int i = 0; i < 3; ++i)
+  {
+    if(unit <= 0)
+    {
+      obb_extent[i] = 0;
+      continue;
+    }
+
+    const S k_min = std::ceil(extent[i] / unit);
+    if(k_min > n)
+      return false;
+
+    int k = static_cast<int>(k_min);
+    while(k <= n && unit * k < extent[i])
+      ++k;
+    if(k > n)
+      return false;
+
+    obb_extent[i] = static_cast<Q>(k);
+  }
+
+  return true;
+}
+
+} // namespace fcl
+
+#endif
@@ -0,0 +1,135 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/** @author Jia Pan */
+
+#ifndef FCL_BV_QUANTIZEDBVNODE_H
+#define FCL_BV_QUANTIZEDBVNODE_H
+
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+#include "fcl/math/bv/AABB.h"
+#include "fcl/math/bv/OBB.h"
+
+namespace fcl
+{
+
+/// @brief A bounding volume node of QuantizedBVHModel. The AABB is stored on
+/// an integer grid spanning the AABB of the parent node, and the OBB on a grid
+/// spanning the AABB of the node itself, so a node only takes a few bytes of
+/// geometry and has to be decoded top-down during traversal. Decoding is
+/// conservative: the decoded volumes always contain the primitives below the
+/// node.
+template <typename S_, typename Q>
+struct FCL_EXPORT QuantizedBVNode
+{
+  static_assert(std::is_unsigned<Q>::value && sizeof(Q) <= 2,
+                "QuantizedBVNode only supports 8 or 16 bit grids");
+
+  using S = S_;
+
+  /// @brief Lower corner of the AABB, on the grid of the parent AABB
+  Q aabb_min[3];
+
+  /// @brief Upper corner of the AABB, on the grid of the parent AABB
+  Q aabb_max[3];
+
+  /// @brief Center of the OBB, on the grid of this node's AABB
+  Q obb_center[3];
+
+  /// @brief Half dimensions of the OBB, in units of the diagonal of this
+  /// node's AABB divided by the grid resolution
+  Q obb_extent[3];
+
+  /// @brief Frame of the OBB as a unit quaternion (w, x, y, z) scaled by
+  /// the int16 range
+  std::int16_t obb_rotation[4];
+
+  /// @brief An index for the left child node (the right child follows it) or,
+  /// if negative, -(primitive id + 1) of the triangle under a leaf
+  int first_child;
+
+  /// @brief Whether current node is a leaf node (i.e. contains a primitive)
+  bool isLeaf() const;
+
+  /// @brief Return the primitive id of a leaf node
+  int primitiveId() const;
+
+  /// @brief Return the index of the left child
+  int leftChild() const;
+
+  /// @brief Return the index of the right child
+  int rightChild() const;
+
+  /// @brief Store the smallest grid box of parent that contains bv. bv must
+  /// lie inside parent.
+  void setAABB(const AABB<S>& parent, const AABB<S>& bv);
+
+  /// @brief Decode the AABB given the decoded AABB of the parent
+  AABB<S> getAABB(const AABB<S>& parent) const;
+
+  /// @brief Store an OBB with the given frame containing points. bv is the
+  /// decoded AABB of this node; if the OBB would not be tighter than bv, bv
+  /// itself is stored.
+  void setOBB(const AABB<S>& bv, const Matrix3<S>& axis,
+              const std::vector<Vector3<S>>& points);
+
+  /// @brief Decode the OBB given the decoded AABB of this node
+  OBB<S> getOBB(const AABB<S>& bv) const;
+
+private:
+
+  /// @brief Decode the frame of the OBB
+  Matrix3<S> getOBBAxis() const;
+
+  /// @brief Store the OBB with frame axis; returns false if it does not fit
+  /// on the grid of bv
+  bool setOBBImpl(const AABB<S>& bv, const Matrix3<S>& axis,
+                  const std::vector<Vector3<S>>& points);
+};
+
+template <typename S>
+using QuantizedBVNode8 = QuantizedBVNode<S, std::uint8_t>;
+
+template <typename S>
+using QuantizedBVNode16 = QuantizedBVNode<S, std::uint16_t>;
+
+} // namespace fcl
+
+#include "fcl/geometry/bvh/quantized_BV_node-inl.h"
+
+#endif
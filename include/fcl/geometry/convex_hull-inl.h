@@ -0,0 +1,732 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @author Jia Pan */
+
+#ifndef FCL_GEOMETRY_CONVEXHULL_INL_H
+#define FCL_GEOMETRY_CONVEXHULL_INL_H
+
+#include "fcl/geometry/convex_hull.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <queue>
+#include <unordered_map>
+#include <utility>
+
+#include "fcl/common/detail/parallel.h"
+#include "fcl/math/bv/OBBRSS.h"
+
+namespace fcl
+{
+
+//==============================================================================
+extern template
+struct ConvexHullOptions<double>;
+
+//==============================================================================
+extern template
+struct ConvexDecompositionOptions<double>;
+
+//==============================================================================
+extern template
+std::shared_ptr<Convex<double>> convexHull(
+    const std::vector<Vector3<double>>& points,
+    const ConvexHullOptions<double>& options);
+
+//==============================================================================
+extern template
+std::shared_ptr<Convex<double>> convexHull(
+    const BVHModel<OBBRSS<double>>& model,
+    const ConvexHullOptions<double>& options);
+
+//==============================================================================
+extern template
+std::vector<std::shared_ptr<Convex<double>>> convexDecomposition(
+    const BVHModel<OBBRSS<double>>& model,
+    const ConvexDecompositionOptions<double>& options);
+
+//==============================================================================
+template <typename S>
+ConvexHullOptions<S>::ConvexHullOptions(
+    S tolerance_, unsigned int max_vertices_, unsigned int num_threads_)
+  : tolerance(tolerance_),
+    max_vertices(max_vertices_),
+    num_threads(num_threads_)
+{
+  // Do nothing
+}
+
+//==============================================================================
+template <typename S>
+ConvexDecompositionOptions<S>::ConvexDecompositionOptions(
+    S concavity_,
+    unsigned int max_pieces_,
+    const ConvexHullOptions<S>& hull_options_)
+  : concavity(concavity_),
+    max_pieces(max_pieces_),
+    hull_options(hull_options_)
+{
+  // Do nothing
+}
+
+namespace detail
+{
+
+//==============================================================================
+/// @brief A triangle of the hull under construction, with the points that lie
+/// outside of it
+template <typename S>
+struct QuickHullFace
+{
+  /// @brief Vertices, counter-clockwise seen from outside
+  int v[3];
+
+  /// @brief neighbors[i] is the face across edge (v[i], v[(i + 1) % 3])
+  int neighbors[3];
+
+  Vector3<S> normal;
+  S offset;
+
+  /// @brief The points outside of this face (and of no other face)
+  std::vector<int> outside;
+  int furthest;
+  S furthest_distance;
+
+  bool alive;
+
+  S distance(const Vector3<S>& p) const { return normal.dot(p) - offset; }
+};
+
+//==============================================================================
+/// @brief Key of the directed edge (a, b)
+inline std::uint64_t quickHullEdgeKey(int a, int b)
+{
+  return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(a)) << 32)
+      | static_cast<std::uint32_t>(b);
+}
+
+//==============================================================================
+/// @brief The hull of coplanar points, as a polygon with two faces. Points
+/// within eps of an edge of the polygon are left out.
+template <typename S>
+int computeFlatConvexHull(
+    const std::vector<Vector3<S>>& points,
+    const Vector3<S>& origin,
+    const Vector3<S>& u,
+    const Vector3<S>& normal,
+    S eps,
+    std::vector<Vector3<S>>& hull_vertices,
+    std::vector<int>& hull_faces)
+{
+  const Vector3<S> w = normal.cross(u);
+
+  std::vector<std::pair<std::pair<S, S>, int>> projected(points.size());
+  for(std::size_t i = 0; i < points.size(); ++i)
+  {
+    const Vector3<S> p = points[i] - origin;
+    projected[i] = std::make_pair(std::make_pair(u.dot(p), w.dot(p)),
+                                  static_cast<int>(i));
+  }
+  std::sort(projected.begin(), projected.end());
+
+  // Andrew's monotone chain, counter-clockwise about the normal. isLeft()
+  // tells whether b is strictly left of the line from o to a.
+  auto isLeft = [&](int o, int a, int b)
+  {
+    const auto& po = projected[o].first;
+    const auto& pa = projected[a].first;
+    const auto& pb = projected[b].first;
+    const S dx = pa.first - po.first;
+    const S dy = pa.second - po.second;
+    const S cross = dx * (pb.second - po.second) - dy * (pb.first - po.first);
+    return cross > eps * std::sqrt(dx * dx + dy * dy);
+  };
+
+  const int n = static_cast<int>(projected.size());
+  std::vector<int> chain(2 * n);
+  int k = 0;
+  for(int i = 0; i < n; ++i)
+  {
+    while(k >= 2 && !isLeft(chain[k - 2], chain[k - 1], i)) --k;
+    chain[k++] = i;
+  }
+  for(int i = n - 2, lower = k + 1; i >= 0; --i)
+  {
+    while(k >= lower && !isLeft(chain[k - 2], chain[k - 1], i)) --k;
+    chain[k++] = i;
+  }
+  const int num_vertices = k - 1;
+  if(num_vertices < 3)
+    return 0;
+
+  for(int i = 0; i < num_vertices; ++i)
+    hull_vertices.push_back(points[projected[chain[i]].second]);
+
+  hull_faces.push_back(num_vertices);
+  for(int i = 0; i < num_vertices; ++i)
+    hull_faces.push_back(i);
+  hull_faces.push_back(num_vertices);
+  for(int i = num_vertices - 1; i >= 0; --i)
+    hull_faces.push_back(i);
+
+  return 2;
+}
+
+//==============================================================================
+template <typename S>
+FCL_EXPORT
+int computeConvexHull(
+    const std::vector<Vector3<S>>& points,
+    const ConvexHullOptions<S>& options,
+    std::vector<Vector3<S>>& hull_vertices,
+    std::vector<int>& hull_faces)
+{
+  hull_vertices.clear();
+  hull_faces.clear();
+
+  const int n = static_cast<int>(points.size());
+  if(n < 3)
+    return 0;
+
+  // Thickness of the faces, below which a point cannot be told apart from
+  // them in floating point
+  Vector3<S> max_coords = Vector3<S>::Zero();
+  for(const auto& p : points)
+    max_coords = max_coords.cwiseMax(p.cwiseAbs());
+  const S eps = 3 * std::numeric_limits<S>::epsilon() * max_coords.sum();
+  const S threshold = std::max(eps, options.tolerance);
+
+  // Initial simplex: the two most distant axis extremes, the point furthest
+  // from their line, and the point furthest from the plane of the three
+  int extremes[6] = {0, 0, 0, 0, 0, 0};
+  for(int i = 1; i < n; ++i)
+  {
+    for(int j = 0; j < 3; ++j)
+    {
+      if(points[i][j] < points[extremes[2 * j]][j]) extremes[2 * j] = i;
+      if(points[i][j] > points[extremes[2 * j + 1]][j]) extremes[2 * j + 1] = i;
+    }
+  }
+
+  int i0 = extremes[0];
+  int i1 = extremes[1];
+  S max_distance = -1;
+  for(int a = 0; a < 6; ++a)
+  {
+    for(int b = a + 1; b < 6; ++b)
+    {
+      const S d = (points[extremes[a]] - points[extremes[b]]).squaredNorm();
+      if(d > max_distance)
+      {
+        max_distance = d;
+        i0 = extremes[a];
+        i1 = extremes[b];
+      }
+    }
+  }
+  if(std::sqrt(max_distance) <= eps)
+    return 0;
+
+  const Vector3<S> u = (points[i1] - points[i0]).normalized();
+  int i2 = -1;
+  max_distance = eps;
+  for(int i = 0; i < n; ++i)
+  {
+    const S d = u.cross(points[i] - points[i0]).norm();
+    if(d > max_distance)
+    {
+      max_distance = d;
+      i2 = i;
+    }
+  }
+  if(i2 < 0)
+    return 0;
+
+  const Vector3<S> base_normal
+      = (points[i1] - points[i0]).cross(points[i2] - points[i0]).normalized();
+  int i3 = -1;
+  max_distance = eps;
+  for(int i = 0; i < n; ++i)
+  {
+    const S d = std::abs(base_normal.dot(points[i] - points[i0]));
+    if(d > max_distance)
+    {
+      max_distance = d;
+      i3 = i;
+    }
+  }
+  if(i3 < 0)
+  {
+    return computeFlatConvexHull(
+          points, points[i0], u, base_normal, eps, hull_vertices, hull_faces);
+  }
+
+  std::vector<QuickHullFace<S>> faces;
+  std::priority_queue<std::pair<S, int>> queue;
+
+  auto addFace = [&](int a, int b, int c)
+  {
+    QuickHullFace<S> face;
+    face.v[0] = a;
+    face.v[1] = b;
+    face.v[2] = c;
+    face.neighbors[0] = face.neighbors[1] = face.neighbors[2] = -1;
+    face.normal = (points[b] - points[a]).cross(points[c] - points[a]);
+    face.normal.normalize();
+    face.offset = face.normal.dot(points[a]);
+    face.furthest = -1;
+    face.furthest_distance = 0;
+    face.alive = true;
+    faces.push_back(face);
+    return static_cast<int>(faces.size()) - 1;
+  };
+
+  // Connects the given faces to each other through their shared edges
+  auto linkFaces = [&](const std::vector<int>& new_faces)
+  {
+    std::unordered_map<std::uint64_t, std::pair<int, int>> edges;
+    for(int f : new_faces)
+      for(int i = 0; i < 3; ++i)
+        edges[quickHullEdgeKey(faces[f].v[i], faces[f].v[(i + 1) % 3])]
+            = std::make_pair(f, i);
+
+    for(int f : new_faces)
+    {
+      for(int i = 0; i < 3; ++i)
+      {
+        if(faces[f].neighbors[i] >= 0)
+          continue;
+        const auto it = edges.find(
+              quickHullEdgeKey(faces[f].v[(i + 1) % 3], faces[f].v[i]));
+        if(it != edges.end())
+          faces[f].neighbors[i] = it->second.first;
+      }
+    }
+  };
+
+  // Moves each candidate point to the outside set of the new face it is
+  // furthest outside of; the others are inside the hull now. The distances
+  // are computed in parallel, the sets are filled in point order so that the
+  // hull does not depend on the number of threads.
+  const std::size_t grain_size = 4096;
+  auto assignPoints = [&](const std::vector<int>& candidates,
+                          const std::vector<int>& new_faces)
+  {
+    std::vector<int> face_of(candidates.size(), -1);
+    std::vector<S> distance_of(candidates.size());
+    parallelForChunks(
+          candidates.size(), options.num_threads, grain_size,
+          [&](unsigned int /*thread*/, std::size_t begin, std::size_t end)
+    {
+      for(std::size_t i = begin; i < end; ++i)
+      {
+        S best = threshold;
+        for(int f : new_faces)
+        {
+          const S d = faces[f].distance(points[candidates[i]]);
+          if(d > best)
+          {
+            best = d;
+            face_of[i] = f;
+          }
+        }
+        distance_of[i] = best;
+      }
+    });
+
+    for(std::size_t i = 0; i < candidates.size(); ++i)
+    {
+      if(face_of[i] < 0)
+        continue;
+      QuickHullFace<S>& face = faces[face_of[i]];
+      face.outside.push_back(candidates[i]);
+      if(distance_of[i] > face.furthest_distance)
+      {
+        face.furthest_distance = distance_of[i];
+        face.furthest = candidates[i];
+      }
+    }
+
+    for(int f : new_faces)
+    {
+      if(!faces[f].outside.empty())
+        queue.push(std::make_pair(faces[f].furthest_distance, f));
+    }
+  };
+
+  // Orient the tetrahedron outwards
+  std::vector<int> new_faces;
+  if(base_normal.dot(points[i3] - points[i0]) > 0)
+    std::swap(i1, i2);
+  new_faces.push_back(addFace(i0, i1, i2));
+  new_faces.push_back(addFace(i0, i3, i1));
+  new_faces.push_back(addFace(i1, i3, i2));
+  new_faces.push_back(addFace(i2, i3, i0));
+  linkFaces(new_faces);
+
+  std::vector<int> candidates;
+  candidates.reserve(n);
+  for(int i = 0; i < n; ++i)
+  {
+    if(i != i0 && i != i1 && i != i2 && i != i3)
+      candidates.push_back(i);
+  }
+  assignPoints(candidates, new_faces);
+
+  unsigned int num_hull_vertices = 4;
+  std::vector<int> visible;
+  std::vector<int> stack;
+  std::vector<char> is_visible;
+  while(!queue.empty())
+  {
+    if(options.max_vertices > 0 && num_hull_vertices >= options.max_vertices)
+      break;
+
+    const int start = queue.top().second;
+    queue.pop();
+    if(!faces[start].alive)
+      continue;
+
+    const int eye = faces[start].furthest;
+    const Vector3<S>& p = points[eye];
+
+    // Flood the faces that see the eye point from the start face; the edges
+    // between visible and hidden faces form the horizon
+    is_visible.resize(faces.size(), 0);
+    visible.clear();
+    stack.assign(1, start);
+    is_visible[start] = 1;
+    std::vector<std::pair<int, int>> horizon;
+    while(!stack.empty())
+    {
+      const int f = stack.back();
+      stack.pop_back();
+      visible.push_back(f);
+      for(int i = 0; i < 3; ++i)
+      {
+        const int g = faces[f].neighbors[i];
+        if(is_visible[g])
+          continue;
+        if(faces[g].distance(p) > eps)
+        {
+          is_visible[g] = 1;
+          stack.push_back(g);
+        }
+        else
+        {
+          horizon.push_back(std::make_pair(f, i));
+        }
+      }
+    }
+
+    // Replace the visible faces by a cone from the horizon to the eye point
+    new_faces.clear();
+    for(const auto& edge : horizon)
+    {
+      const int a = faces[edge.first].v[edge.second];
+      const int b = faces[edge.first].v[(edge.second + 1) % 3];
+      const int hidden = faces[edge.first].neighbors[edge.second];
+      const int f = addFace(a, b, eye);
+      faces[f].neighbors[0] = hidden;
+      for(int i = 0; i < 3; ++i)
+      {
+        if(faces[hidden].neighbors[i] == edge.first)
+          faces[hidden].neighbors[i] = f;
+      }
+      new_faces.push_back(f);
+    }
+    linkFaces(new_faces);
+    ++num_hull_vertices;
+
+    candidates.clear();
+    for(int f : visible)
+    {
+      faces[f].alive = false;
+      is_visible[f] = 0;
+      for(int i : faces[f].outside)
+      {
+        if(i != eye)
+          candidates.push_back(i);
+      }
+      std::vector<int>().swap(faces[f].outside);
+    }
+    assignPoints(candidates, new_faces);
+  }
+
+  // Gather the vertices of the remaining faces
+  std::vector<int> vertex_map(n, -1);
+  int num_faces = 0;
+  for(const auto& face : faces)
+  {
+    if(!face.alive)
+      continue;
+    hull_faces.push_back(3);
+    for(int i = 0; i < 3; ++i)
+    {
+      int& index = vertex_map[face.v[i]];
+      if(index < 0)
+      {
+        index = static_cast<int>(hull_vertices.size());
+        hull_vertices.push_back(points[face.v[i]]);
+      }
+      hull_faces.push_back(index);
+    }
+    ++num_faces;
+  }
+
+  return num_faces;
+}
+
+//==============================================================================
+/// @brief The concavity of mesh triangles with respect to their convex hull:
+/// the largest distance from a triangle centroid to the hull surface, along
+/// the triangle normal. Both sides of the triangle are tried, so that the
+/// orientation of the mesh does not matter; triangles on the hull surface
+/// measure zero.
+template <typename BV>
+typename BV::S computeConcavity(
+    const BVHModel<BV>& model,
+    const std::vector<int>& triangles,
+    const std::vector<Vector3<typename BV::S>>& hull_vertices,
+    const std::vector<int>& hull_faces,
+    int num_faces)
+{
+  using S = typename BV::S;
+
+  std::vector<std::pair<Vector3<S>, S>> planes;
+  planes.reserve(num_faces);
+  for(int i = 0, index = 0; i < num_faces; ++i)
+  {
+    const Vector3<S>& a = hull_vertices[hull_faces[index + 1]];
+    const Vector3<S>& b = hull_vertices[hull_faces[index + 2]];
+    const Vector3<S>& c = hull_vertices[hull_faces[index + 3]];
+    const Vector3<S> normal = (b - a).cross(c - a).normalized();
+    planes.push_back(std::make_pair(normal, normal.dot(a)));
+    index += hull_faces[index] + 1;
+  }
+
+  S concavity = 0;
+  for(int t : triangles)
+  {
+    const Triangle& tri = model.tri_indices[t];
+    const Vector3<S>& a = model.vertices[tri[0]];
+    const Vector3<S>& b = model.vertices[tri[1]];
+    const Vector3<S>& c = model.vertices[tri[2]];
+    Vector3<S> normal = (b - a).cross(c - a);
+    const S norm = normal.norm();
+    if(norm == 0)
+      continue;
+    normal /= norm;
+    const Vector3<S> centroid = (a + b + c) / 3;
+
+    // Distances to the exit points of the rays along +/-normal
+    S front = std::numeric_limits<S>::max();
+    S back = std::numeric_limits<S>::max();
+    for(const auto& plane : planes)
+    {
+      const S cos_angle = plane.first.dot(normal);
+      const S depth = std::max<S>(plane.second - plane.first.dot(centroid), 0);
+      if(cos_angle > 0)
+        front = std::min(front, depth / cos_angle);
+      else if(cos_angle < 0)
+        back = std::min(back, -depth / cos_angle);
+    }
+    concavity = std::max(concavity, std::min(front, back));
+  }
+
+  return concavity;
+}
+
+} // namespace detail
+
+//==============================================================================
+template <typename S>
+FCL_EXPORT
+std::shared_ptr<Convex<S>> convexHull(
+    const std::vector<Vector3<S>>& points,
+    const ConvexHullOptions<S>& options)
+{
+  auto vertices = std::make_shared<std::vector<Vector3<S>>>();
+  auto faces = std::make_shared<std::vector<int>>();
+  const int num_faces
+      = detail::computeConvexHull(points, options, *vertices, *faces);
+  if(num_faces == 0)
+    return nullptr;
+
+  return std::make_shared<Convex<S>>(vertices, num_faces, faces);
+}
+
+//==============================================================================
+template <typename BV>
+FCL_EXPORT
+std::shared_ptr<Convex<typename BV::S>> convexHull(
+    const BVHModel<BV>& model,
+    const ConvexHullOptions<typename BV::S>& options)
+{
+  using S = typename BV::S;
+
+  const std::vector<Vector3<S>> points(
+        model.vertices, model.vertices + model.num_vertices);
+
+  return convexHull(points, options);
+}
+
+//==============================================================================
+template <typename BV>
+FCL_EXPORT
+std::vector<std::shared_ptr<Convex<typename BV::S>>> convexDecomposition(
+    const BVHModel<BV>& model,
+    const ConvexDecompositionOptions<typename BV::S>& options)
+{
+  using S = typename BV::S;
+
+  struct Part
+  {
+    std::vector<int> triangles;
+    std::vector<Vector3<S>> hull_vertices;
+    std::vector<int> hull_faces;
+    int num_faces;
+    S concavity;
+  };
+
+  std::vector<int> vertex_map(model.num_vertices, -1);
+  auto makePart = [&](std::vector<int>&& triangles)
+  {
+    Part part;
+    part.triangles = std::move(triangles);
+
+    std::vector<Vector3<S>> points;
+    for(int t : part.triangles)
+    {
+      for(int i = 0; i < 3; ++i)
+      {
+        const int v = static_cast<int>(model.tri_indices[t][i]);
+        if(vertex_map[v] < 0)
+        {
+          vertex_map[v] = static_cast<int>(points.size());
+          points.push_back(model.vertices[v]);
+        }
+      }
+    }
+    for(int t : part.triangles)
+      for(int i = 0; i < 3; ++i)
+        vertex_map[model.tri_indices[t][i]] = -1;
+
+    part.num_faces = detail::computeConvexHull(
+          points, options.hull_options, part.hull_vertices, part.hull_faces);
+    part.concavity = (part.num_faces > 0)
+        ? detail::computeConcavity(model, part.triangles, part.hull_vertices,
+                                   part.hull_faces, part.num_faces)
+        : S(0);
+    return part;
+  };
+
+  std::vector<Part> parts;
+  if(model.getModelType() != BVH_MODEL_TRIANGLES || model.num_tris == 0)
+  {
+    std::cerr << "Warning: convex decomposition needs a triangle mesh."
+              << std::endl;
+    return std::vector<std::shared_ptr<Convex<S>>>();
+  }
+
+  std::vector<int> all_triangles(model.num_tris);
+  for(int i = 0; i < model.num_tris; ++i)
+    all_triangles[i] = i;
+  parts.push_back(makePart(std::move(all_triangles)));
+
+  // Split the most concave part until all of them are convex enough
+  while(options.max_pieces == 0 || parts.size() < options.max_pieces)
+  {
+    int worst = -1;
+    for(std::size_t i = 0; i < parts.size(); ++i)
+    {
+      if(parts[i].triangles.size() > 1
+         && parts[i].concavity > options.concavity
+         && (worst < 0 || parts[i].concavity > parts[worst].concavity))
+        worst = static_cast<int>(i);
+    }
+    if(worst < 0)
+      break;
+
+    // Halve the triangles at the median of their centroids along the longest
+    // extent
+    std::vector<int>& triangles = parts[worst].triangles;
+    std::vector<Vector3<S>> centroids(model.num_tris);
+    AABB<S> box;
+    for(int t : triangles)
+    {
+      const Triangle& tri = model.tri_indices[t];
+      centroids[t] = (model.vertices[tri[0]] + model.vertices[tri[1]]
+          + model.vertices[tri[2]]) / 3;
+      box += centroids[t];
+    }
+    int axis = 0;
+    if(box.width() < box.height()) axis = 1;
+    if((axis == 0 ? box.width() : box.height()) < box.depth()) axis = 2;
+
+    const auto middle = triangles.begin() + triangles.size() / 2;
+    std::nth_element(triangles.begin(), middle, triangles.end(),
+                     [&](int a, int b)
+    {
+      return centroids[a][axis] < centroids[b][axis];
+    });
+
+    std::vector<int> first(triangles.begin(), middle);
+    std::vector<int> second(middle, triangles.end());
+    parts[worst] = makePart(std::move(first));
+    parts.push_back(makePart(std::move(second)));
+  }
+
+  std::vector<std::shared_ptr<Convex<S>>> pieces;
+  for(auto& part : parts)
+  {
+    if(part.num_faces == 0)
+      continue;
+    pieces.push_back(std::make_shared<Convex<S>>(
+          std::make_shared<std::vector<Vector3<S>>>(
+            std::move(part.hull_vertices)),
+          part.num_faces,
+          std::make_shared<std::vector<int>>(std::move(part.hull_faces))));
+  }
+
+  return pieces;
+}
+
+} // namespace fcl
+
+#endif
@@ -0,0 +1,151 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @author Jia Pan */
+
+#ifndef FCL_GEOMETRY_CONVEXHULL_H
+#define FCL_GEOMETRY_CONVEXHULL_H
+
+#include <memory>
+#include <vector>
+
+#include "fcl/geometry/bvh/BVH_model.h"
+#include "fcl/geometry/shape/convex.h"
+
+namespace fcl
+{
+
+/// @brief Parameters of the convex hull construction
+template <typename S>
+struct FCL_EXPORT ConvexHullOptions
+{
+  /// @brief Points that lie within this distance outside of the hull are not
+  /// added to it. Zero keeps every point that numerically extends the hull; a
+  /// positive tolerance drops the nearly coplanar points that otherwise
+  /// produce many small faces, at the price of a hull that may miss points by
+  /// up to the tolerance
+  S tolerance;
+
+  /// @brief Maximum number of hull vertices, at least 4 (0 means no limit).
+  /// Points are added furthest first, so a capped hull is the best
+  /// approximation QuickHull reaches with that many vertices; the points left
+  /// outside may exceed the tolerance
+  unsigned int max_vertices;
+
+  /// @brief Number of threads used to sort the points into the outside sets
+  /// of the faces (0 means one per hardware core)
+  unsigned int num_threads;
+
+  ConvexHullOptions(S tolerance_ = 0,
+                    unsigned int max_vertices_ = 0,
+                    unsigned int num_threads_ = 1);
+};
+
+/// @brief Parameters of the convex decomposition of a mesh
+template <typename S>
+struct FCL_EXPORT ConvexDecompositionOptions
+{
+  /// @brief A piece of the mesh is split further while one of its triangles
+  /// lies deeper than this below the surface of the piece's convex hull,
+  /// measured along the triangle normal
+  S concavity;
+
+  /// @brief Maximum number of pieces (0 means no limit)
+  unsigned int max_pieces;
+
+  /// @brief Options of the convex hull of each piece
+  ConvexHullOptions<S> hull_options;
+
+  ConvexDecompositionOptions(
+      S concavity_ = 0,
+      unsigned int max_pieces_ = 0,
+      const ConvexHullOptions<S>& hull_options_ = ConvexHullOptions<S>());
+};
+
+/// @brief Computes the convex hull of a point cloud with QuickHull. The faces
+/// of the hull are triangles, except when all the points are coplanar: the
+/// hull is then a flat polygon, given as two faces of opposite orientations.
+/// Returns nullptr if the points are collinear.
+template <typename S>
+FCL_EXPORT
+std::shared_ptr<Convex<S>> convexHull(
+    const std::vector<Vector3<S>>& points,
+    const ConvexHullOptions<S>& options = ConvexHullOptions<S>());
+
+/// @brief Computes the convex hull of the vertices of a mesh
+template <typename BV>
+FCL_EXPORT
+std::shared_ptr<Convex<typename BV::S>> convexHull(
+    const BVHModel<BV>& model,
+    const ConvexHullOptions<typename BV::S>& options
+      = ConvexHullOptions<typename BV::S>());
+
+/// @brief Decomposes a triangle mesh into convex pieces.
+///
+/// The triangles are split recursively, in halves along the longest extent of
+/// their centroids, until the hull of every piece is within
+/// options.concavity of the piece's triangles (or options.max_pieces is
+/// reached, the most concave pieces being split first). The pieces are the
+/// convex hulls of the triangles of each part, so together they cover the
+/// surface of the mesh; the interior of a closed mesh is only covered where
+/// the pieces happen to fill it.
+template <typename BV>
+FCL_EXPORT
+std::vector<std::shared_ptr<Convex<typename BV::S>>> convexDecomposition(
+    const BVHModel<BV>& model,
+    const ConvexDecompositionOptions<typename BV::S>& options
+      = ConvexDecompositionOptions<typename BV::S>());
+
+namespace detail
+{
+
+/// @brief Computes the convex hull of points into hull_vertices and
+/// hull_faces, with the face encoding of Convex. Returns the number of faces,
+/// 0 if the points are collinear.
+template <typename S>
+FCL_EXPORT
+int computeConvexHull(
+    const std::vector<Vector3<S>>& points,
+    const ConvexHullOptions<S>& options,
+    std::vector<Vector3<S>>& hull_vertices,
+    std::vector<int>& hull_faces);
+
+} // namespace detail
+
+} // namespace fcl
+
+#include "fcl/geometry/convex_hull-inl.h"
+
+#endif
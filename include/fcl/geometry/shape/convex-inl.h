@@ -41,6 +41,8 @@
 
 #include "fcl/geometry/shape/convex.h"
 
+#include <algorithm>
+
 namespace fcl
 {
 
@@ -66,6 +68,8 @@ Convex<S>::Convex(
     sum += vertex;
   }
   interior_point_ = sum * (S)(1.0 / vertices_->size());
+
+  buildNeighbors();
 }
 
 //==============================================================================
@@ -88,6 +92,57 @@ NODE_TYPE Convex<S>::getNodeType() const {
   return GEOM_CONVEX;
 }
 
+//==============================================================================
+template <typename S>
+int Convex<S>::findExtremeVertexIndex(const Vector3<S>& dir, int start) const {
+  const std::vector<Vector3<S>>& vertices = *vertices_;
+  const int num_vertices = static_cast<int>(vertices.size());
+
+  if (neighbors_.empty()) {
+    int extreme = 0;
+    S max_dot = dir.dot(vertices[0]);
+    for (int i = 1; i < num_vertices; ++i) {
+      const S dot = dir.dot(vertices[i]);
+      if (dot > max_dot) {
+        max_dot = dot;
+        extreme = i;
+      }
+    }
+    return extreme;
+  }
+
+  // A vertex that no face references has no edge to climb along; start from
+  // the first vertex of the first face instead.
+  if (start < 0 || start >= num_vertices ||
+      neighbor_offsets_[start] == neighbor_offsets_[start + 1]) {
+    start = (*faces_)[1];
+  }
+
+  // Move to the best neighbor until none improves. On a convex polytope, a
+  // vertex without a better neighbor is a global maximum.
+  int extreme = start;
+  S max_dot = dir.dot(vertices[extreme]);
+  while (true) {
+    const int current = extreme;
+    for (int i = neighbor_offsets_[current]; i < neighbor_offsets_[current + 1];
+         ++i) {
+      const int neighbor = neighbors_[i];
+      const S dot = dir.dot(vertices[neighbor]);
+      if (dot > max_dot) {
+        max_dot = dot;
+        extreme = neighbor;
+      }
+    }
+    if (extreme == current) return extreme;
+  }
+}
+
+//==============================================================================
+template <typename S>
+const Vector3<S>& Convex<S>::findExtremeVertex(const Vector3<S>& dir) const {
+  return (*vertices_)[findExtremeVertexIndex(dir)];
+}
+
 //==============================================================================
 // TODO(SeanCurtis-TRI): When revisiting these, consider the following
 // resources:
@@ -248,6 +303,43 @@ std::vector<Vector3<S>> Convex<S>::getBoundVertices(
   return result;
 }
 
+//==============================================================================
+template <typename S>
+void Convex<S>::buildNeighbors() {
+  const int num_vertices = static_cast<int>(vertices_->size());
+  if (num_vertices < kMinVertexCountForEdgeWalking) return;
+
+  // Both directions of every face edge; edges shared by two faces show up
+  // twice and are deduplicated below.
+  std::vector<std::vector<int>> adjacency(num_vertices);
+  const std::vector<int>& faces = *faces_;
+  int face_index = 0;
+  for (int i = 0; i < num_faces_; ++i) {
+    const int vertex_count = faces[face_index];
+    for (int j = 0; j < vertex_count; ++j) {
+      const int a = faces[face_index + 1 + j];
+      const int b = faces[face_index + 1 + (j + 1) % vertex_count];
+      adjacency[a].push_back(b);
+      adjacency[b].push_back(a);
+    }
+    face_index += vertex_count + 1;
+  }
+
+  neighbor_offsets_.reserve(num_vertices + 1);
+  neighbor_offsets_.push_back(0);
+  for (auto& vertex_neighbors : adjacency) {
+    std::sort(vertex_neighbors.begin(), vertex_neighbors.end());
+    vertex_neighbors.erase(
+        std::unique(vertex_neighbors.begin(), vertex_neighbors.end()),
+        vertex_neighbors.end());
+    neighbors_.insert(neighbors_.end(), vertex_neighbors.begin(),
+                      vertex_neighbors.end());
+    neighbor_offsets_.push_back(static_cast<int>(neighbors_.size()));
+  }
+
+  if (neighbors_.empty()) neighbor_offsets_.clear();
+}
+
 } // namespace fcl
 
 #endif
@@ -145,6 +145,24 @@ public:
   /// used for collision.
   const Vector3<S>& getInteriorPoint() const { return interior_point_; }
 
+  /// @brief Gets the index of a vertex that lies furthest in the direction
+  /// `dir` (the support vertex of the polytope).
+  ///
+  /// Polytopes with many vertices are searched by climbing along the edges of
+  /// the mesh from vertex `start`; because the polytope is convex, the climb
+  /// ends at a global maximum. Passing the support vertex of a previous, close
+  /// direction (as GJK and EPA iterations produce) typically ends the climb
+  /// after a few steps. Small polytopes are scanned exhaustively and ignore
+  /// `start`.
+  ///
+  /// @param dir    The query direction, in the geometry's frame.
+  /// @param start  The index of the vertex to start the search from.
+  int findExtremeVertexIndex(const Vector3<S>& dir, int start = 0) const;
+
+  /// @brief Gets a vertex that lies furthest in the direction `dir`. See
+  /// findExtremeVertexIndex().
+  const Vector3<S>& findExtremeVertex(const Vector3<S>& dir) const;
+
   // Documentation inherited.
   Matrix3<S> computeMomentofInertia() const override;
 
@@ -159,10 +177,23 @@ public:
   std::vector<Vector3<S>> getBoundVertices(const Transform3<S>& tf) const;
 
 private:
+  /// @brief Builds the vertex adjacency used by findExtremeVertexIndex().
+  void buildNeighbors();
+
   const std::shared_ptr<const std::vector<Vector3<S>>> vertices_;
   const int num_faces_;
   const std::shared_ptr<const std::vector<int>> faces_;
   Vector3<S> interior_point_;
+
+  /// @brief The vertices adjacent to vertex i (through a face edge) are
+  /// neighbors_[neighbor_offsets_[i]] ... neighbors_[neighbor_offsets_[i + 1] -
+  /// 1]. Empty when the polytope is small enough to be scanned exhaustively.
+  std::vector<int> neighbor_offsets_;
+  std::vector<int> neighbors_;
+
+  /// @brief Polytopes with fewer vertices are scanned exhaustively, which is
+  /// faster than climbing for them.
+  static constexpr int kMinVertexCountForEdgeWalking = 32;
 };
 
 using Convexf = Convex<float>;
@@ -84,6 +84,10 @@ void constructBox(const KDOP<double, 18>& bv, Box<double>& box, Transform3<doubl
 extern template
 void constructBox(const KDOP<double, 24>& bv, Box<double>& box, Transform3<double>& tf);
 
+//==============================================================================
+extern template
+void constructBox(const FloatOBBRSS<double>& bv, Box<double>& box, Transform3<double>& tf);
+
 //==============================================================================
 extern template
 void constructBox(const AABB<double>& bv, const Transform3<double>& tf_bv, Box<double>& box, Transform3<double>& tf);
@@ -116,6 +120,10 @@ void constructBox(const KDOP<double, 18>& bv, const Transform3<double>& tf_bv, B
 extern template
 void constructBox(const KDOP<double, 24>& bv, const Transform3<double>& tf_bv, Box<double>& box, Transform3<double>& tf);
 
+//==============================================================================
+extern template
+void constructBox(const FloatOBBRSS<double>& bv, const Transform3<double>& tf_bv, Box<double>& box, Transform3<double>& tf);
+
 //==============================================================================
 namespace detail {
 //==============================================================================
@@ -399,6 +407,24 @@ struct FCL_EXPORT ComputeBVImpl<S, OBBRSS<S>, Halfspace<S>>
   }
 };
 
+//==============================================================================
+template <typename S>
+struct FCL_EXPORT ComputeBVImpl<S, FloatOBBRSS<S>, Halfspace<S>>
+{
+  static void run(const Halfspace<S>& s, const Transform3<S>& tf, FloatOBBRSS<S>& bv)
+  {
+    FCL_UNUSED(s);
+    FCL_UNUSED(tf);
+
+    /// Half space can only have very rough FloatOBBRSS
+    bv = FloatOBBRSS<S>();
+    for(int i = 0; i < 3; ++i)
+      bv.obb_extent[i] = std::numeric_limits<float>::max();
+    bv.rss_length[0] = bv.rss_length[1] = bv.rss_radius
+        = std::numeric_limits<float>::max();
+  }
+};
+
 //==============================================================================
 template <typename S>
 struct FCL_EXPORT ComputeBVImpl<S, kIOS<S>, Halfspace<S>>
@@ -701,6 +727,24 @@ struct FCL_EXPORT ComputeBVImpl<S, OBBRSS<S>, Plane<S>>
   }
 };
 
+//==============================================================================
+template <typename S>
+struct FCL_EXPORT ComputeBVImpl<S, FloatOBBRSS<S>, Plane<S>>
+{
+  static void run(const Plane<S>& s, const Transform3<S>& tf, FloatOBBRSS<S>& bv)
+  {
+    FCL_UNUSED(s);
+    FCL_UNUSED(tf);
+
+    /// Plane can only have very rough FloatOBBRSS
+    bv = FloatOBBRSS<S>();
+    for(int i = 0; i < 3; ++i)
+      bv.obb_extent[i] = std::numeric_limits<float>::max();
+    bv.rss_length[0] = bv.rss_length[1] = bv.rss_radius
+        = std::numeric_limits<float>::max();
+  }
+};
+
 //==============================================================================
 template <typename S>
 struct FCL_EXPORT ComputeBVImpl<S, kIOS<S>, Plane<S>>
@@ -989,6 +1033,10 @@ struct ComputeBVImpl<double, RSS<double>, Halfspace<double>>;
 extern template
 struct ComputeBVImpl<double, OBBRSS<double>, Halfspace<double>>;
 
+//==============================================================================
+extern template
+struct ComputeBVImpl<double, FloatOBBRSS<double>, Halfspace<double>>;
+
 //==============================================================================
 extern template
 struct ComputeBVImpl<double, kIOS<double>, Halfspace<double>>;
@@ -1021,6 +1069,10 @@ struct ComputeBVImpl<double, RSS<double>, Plane<double>>;
 extern template
 struct ComputeBVImpl<double, OBBRSS<double>, Plane<double>>;
 
+//==============================================================================
+extern template
+struct ComputeBVImpl<double, FloatOBBRSS<double>, Plane<double>>;
+
 //==============================================================================
 extern template
 struct ComputeBVImpl<double, kIOS<double>, Plane<double>>;
@@ -1135,6 +1187,13 @@ void constructBox(const KDOP<S, 24>& bv, Box<S>& box, Transform3<S>& tf)
   tf.translation() = bv.center();
 }
 
+//==============================================================================
+template <typename S>
+void constructBox(const FloatOBBRSS<S>& bv, Box<S>& box, Transform3<S>& tf)
+{
+  constructBox(bv.toOBB(), box, tf);
+}
+
 //==============================================================================
 template <typename S>
 void constructBox(const AABB<S>& bv, const Transform3<S>& tf_bv, Box<S>& box, Transform3<S>& tf)
@@ -1209,6 +1268,13 @@ void constructBox(const KDOP<S, 24>& bv, const Transform3<S>& tf_bv, Box<S>& box
   tf = tf_bv * Translation3<S>(bv.center());
 }
 
+//==============================================================================
+template <typename S>
+void constructBox(const FloatOBBRSS<S>& bv, const Transform3<S>& tf_bv, Box<S>& box, Transform3<S>& tf)
+{
+  constructBox(bv.toOBB(), tf_bv, box, tf);
+}
+
 } // namespace fcl
 
 #endif
@@ -44,6 +44,7 @@
 #include "fcl/common/types.h"
 
 #include "fcl/math/bv/AABB.h"
+#include "fcl/math/bv/FloatOBBRSS.h"
 #include "fcl/math/bv/kDOP.h"
 #include "fcl/math/bv/kIOS.h"
 #include "fcl/math/bv/OBB.h"
@@ -93,6 +94,10 @@ template <typename S>
 FCL_EXPORT
 void constructBox(const KDOP<S, 24>& bv, Box<S>& box, Transform3<S>& tf);
 
+template <typename S>
+FCL_EXPORT
+void constructBox(const FloatOBBRSS<S>& bv, Box<S>& box, Transform3<S>& tf);
+
 template <typename S>
 FCL_EXPORT
 void constructBox(const AABB<S>& bv, const Transform3<S>& tf_bv, Box<S>& box, Transform3<S>& tf);
@@ -125,6 +130,10 @@ template <typename S>
 FCL_EXPORT
 void constructBox(const KDOP<S, 24>& bv, const Transform3<S>& tf_bv, Box<S>& box, Transform3<S>& tf);
 
+template <typename S>
+FCL_EXPORT
+void constructBox(const FloatOBBRSS<S>& bv, const Transform3<S>& tf_bv, Box<S>& box, Transform3<S>& tf);
+
 } // namespace fcl
 
 #include "fcl/geometry/shape/utility-inl.h"
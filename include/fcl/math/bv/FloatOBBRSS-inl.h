@@ -0,0 +1,323 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/** @author Jia Pan */
+
+#ifndef FCL_BV_FLOATOBBRSS_INL_H
+#define FCL_BV_FLOATOBBRSS_INL_H
+
+#include "fcl/math/bv/FloatOBBRSS.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace fcl
+{
+
+//==============================================================================
+extern template
+class FCL_EXPORT FloatOBBRSS<double>;
+
+//==============================================================================
+extern template
+FloatOBBRSS<double> translate(
+    const FloatOBBRSS<double>& bv, const Vector3<double>& t);
+
+namespace detail
+{
+
+//==============================================================================
+/// @brief Smallest float that is not less than x
+template <typename S>
+float floatUpperBound(S x)
+{
+  float f = static_cast<float>(x);
+  if(static_cast<S>(f) < x)
+    f = std::nextafter(f, std::numeric_limits<float>::infinity());
+  return f;
+}
+
+} // namespace detail
+
+//==============================================================================
+template <typename S>
+FloatOBBRSS<S>::FloatOBBRSS()
+{
+  rotation[0] = 1;
+  rotation[1] = rotation[2] = rotation[3] = 0;
+  for(int i = 0; i < 3; ++i)
+  {
+    obb_center[i] = 0;
+    obb_extent[i] = 0;
+    rss_origin[i] = 0;
+  }
+  rss_length[0] = rss_length[1] = 0;
+  rss_radius = 0;
+}
+
+//==============================================================================
+template <typename S>
+FloatOBBRSS<S>::FloatOBBRSS(const OBBRSS<S>& bv)
+{
+  Quaternion<S> q(bv.obb.axis);
+  q.normalize();
+  rotation[0] = static_cast<float>(q.w());
+  rotation[1] = static_cast<float>(q.x());
+  rotation[2] = static_cast<float>(q.y());
+  rotation[3] = static_cast<float>(q.z());
+
+  // Everything below is measured in the frame the queries will decode, so the
+  // rounding of the rotation only grows the volume.
+  const Matrix3<S> R = axis();
+  const S eps = std::numeric_limits<S>::epsilon();
+
+  // OBB: the rounded center moves by at most half a float ulp, which is added
+  // to the extents together with the projection of the original box.
+  const OBB<S>& obb = bv.obb;
+  Vector3<S> c;
+  for(int i = 0; i < 3; ++i)
+  {
+    obb_center[i] = static_cast<float>(obb.To[i]);
+    c[i] = obb_center[i];
+  }
+  const Matrix3<S> B = R.transpose() * obb.axis;
+  const Vector3<S> extent
+      = B.cwiseAbs() * obb.extent + (R.transpose() * (obb.To - c)).cwiseAbs();
+  const S obb_margin = 8 * eps * (obb.To.template lpNorm<1>() + obb.extent.sum());
+  for(int i = 0; i < 3; ++i)
+    obb_extent[i] = detail::floatUpperBound(extent[i] + obb_margin);
+
+  // RSS: bound the original rectangle by a rectangle in the new frame, and
+  // move the out-of-plane part and the rounding of the origin into the radius.
+  const RSS<S>& rss = bv.rss;
+  const Vector3<S> corners[4] = {
+    Vector3<S>::Zero(),
+    rss.axis.col(0) * rss.l[0],
+    rss.axis.col(1) * rss.l[1],
+    rss.axis.col(0) * rss.l[0] + rss.axis.col(1) * rss.l[1]
+  };
+  Vector3<S> lower = R.transpose() * corners[0];
+  Vector3<S> upper = lower;
+  for(int k = 1; k < 4; ++k)
+  {
+    const Vector3<S> u = R.transpose() * corners[k];
+    lower = lower.cwiseMin(u);
+    upper = upper.cwiseMax(u);
+  }
+  const S out_of_plane = std::max(std::abs(lower[2]), std::abs(upper[2]));
+
+  const Vector3<S> origin
+      = rss.To + R.col(0) * lower[0] + R.col(1) * lower[1];
+  Vector3<S> o;
+  for(int i = 0; i < 3; ++i)
+  {
+    rss_origin[i] = static_cast<float>(origin[i]);
+    o[i] = rss_origin[i];
+  }
+  const S rss_margin
+      = 8 * eps * (rss.To.template lpNorm<1>() + rss.l[0] + rss.l[1] + rss.r);
+  rss_length[0] = detail::floatUpperBound(upper[0] - lower[0] + rss_margin);
+  rss_length[1] = detail::floatUpperBound(upper[1] - lower[1] + rss_margin);
+  rss_radius = detail::floatUpperBound(
+        rss.r + out_of_plane + (origin - o).norm() + rss_margin);
+}
+
+//==============================================================================
+template <typename S>
+Matrix3<S> FloatOBBRSS<S>::axis() const
+{
+  return Quaternion<S>(rotation[0], rotation[1], rotation[2], rotation[3])
+      .normalized().toRotationMatrix();
+}
+
+//==============================================================================
+template <typename S>
+OBB<S> FloatOBBRSS<S>::toOBB() const
+{
+  OBB<S> obb;
+  obb.axis = axis();
+  obb.To << obb_center[0], obb_center[1], obb_center[2];
+  obb.extent << obb_extent[0], obb_extent[1], obb_extent[2];
+  return obb;
+}
+
+//==============================================================================
+template <typename S>
+RSS<S> FloatOBBRSS<S>::toRSS() const
+{
+  RSS<S> rss;
+  rss.axis = axis();
+  rss.To << rss_origin[0], rss_origin[1], rss_origin[2];
+  rss.l[0] = rss_length[0];
+  rss.l[1] = rss_length[1];
+  rss.r = rss_radius;
+  return rss;
+}
+
+//==============================================================================
+template <typename S>
+OBBRSS<S> FloatOBBRSS<S>::toOBBRSS() const
+{
+  OBBRSS<S> bv;
+  bv.obb = toOBB();
+  bv.rss.axis = bv.obb.axis;
+  bv.rss.To << rss_origin[0], rss_origin[1], rss_origin[2];
+  bv.rss.l[0] = rss_length[0];
+  bv.rss.l[1] = rss_length[1];
+  bv.rss.r = rss_radius;
+  return bv;
+}
+
+//==============================================================================
+template <typename S>
+bool FloatOBBRSS<S>::overlap(const FloatOBBRSS<S>& other) const
+{
+  return toOBB().overlap(other.toOBB());
+}
+
+//==============================================================================
+template <typename S>
+bool FloatOBBRSS<S>::contain(const Vector3<S>& p) const
+{
+  return toOBB().contain(p);
+}
+
+//==============================================================================
+template <typename S>
+FloatOBBRSS<S>& FloatOBBRSS<S>::operator +=(const Vector3<S>& p)
+{
+  OBBRSS<S> bv = toOBBRSS();
+  bv += p;
+  *this = FloatOBBRSS<S>(bv);
+  return *this;
+}
+
+//==============================================================================
+template <typename S>
+FloatOBBRSS<S>& FloatOBBRSS<S>::operator +=(const FloatOBBRSS<S>& other)
+{
+  *this = *this + other;
+  return *this;
+}
+
+//==============================================================================
+template <typename S>
+FloatOBBRSS<S> FloatOBBRSS<S>::operator +(const FloatOBBRSS<S>& other) const
+{
+  return FloatOBBRSS<S>(toOBBRSS() + other.toOBBRSS());
+}
+
+//==============================================================================
+template <typename S>
+S FloatOBBRSS<S>::width() const
+{
+  return 2 * static_cast<S>(obb_extent[0]);
+}
+
+//==============================================================================
+template <typename S>
+S FloatOBBRSS<S>::height() const
+{
+  return 2 * static_cast<S>(obb_extent[1]);
+}
+
+//==============================================================================
+template <typename S>
+S FloatOBBRSS<S>::depth() const
+{
+  return 2 * static_cast<S>(obb_extent[2]);
+}
+
+//==============================================================================
+template <typename S>
+S FloatOBBRSS<S>::volume() const
+{
+  return width() * height() * depth();
+}
+
+//==============================================================================
+template <typename S>
+S FloatOBBRSS<S>::size() const
+{
+  return Vector3<S>(obb_extent[0], obb_extent[1], obb_extent[2]).squaredNorm();
+}
+
+//==============================================================================
+template <typename S>
+const Vector3<S> FloatOBBRSS<S>::center() const
+{
+  return Vector3<S>(obb_center[0], obb_center[1], obb_center[2]);
+}
+
+//==============================================================================
+template <typename S>
+S FloatOBBRSS<S>::distance(const FloatOBBRSS<S>& other,
+                           Vector3<S>* P, Vector3<S>* Q) const
+{
+  return toRSS().distance(other.toRSS(), P, Q);
+}
+
+//==============================================================================
+template <typename S, typename DerivedA, typename DerivedB>
+bool overlap(const Eigen::MatrixBase<DerivedA>& R0,
+             const Eigen::MatrixBase<DerivedB>& T0,
+             const FloatOBBRSS<S>& b1, const FloatOBBRSS<S>& b2)
+{
+  return overlap(R0, T0, b1.toOBB(), b2.toOBB());
+}
+
+//==============================================================================
+template <typename S, typename DerivedA, typename DerivedB>
+S distance(
+    const Eigen::MatrixBase<DerivedA>& R0,
+    const Eigen::MatrixBase<DerivedB>& T0,
+    const FloatOBBRSS<S>& b1, const FloatOBBRSS<S>& b2,
+    Vector3<S>* P, Vector3<S>* Q)
+{
+  return distance(R0, T0, b1.toRSS(), b2.toRSS(), P, Q);
+}
+
+//==============================================================================
+template <typename S>
+FloatOBBRSS<S> translate(const FloatOBBRSS<S>& bv, const Vector3<S>& t)
+{
+  return FloatOBBRSS<S>(translate(bv.toOBBRSS(), t));
+}
+
+} // namespace fcl
+
+#endif
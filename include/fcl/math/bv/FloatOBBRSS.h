@@ -0,0 +1,171 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/** @author Jia Pan */
+
+#ifndef FCL_BV_FLOATOBBRSS_H
+#define FCL_BV_FLOATOBBRSS_H
+
+#include "fcl/math/bv/OBBRSS.h"
+
+namespace fcl
+{
+
+/// @brief OBBRSS stored in single precision and tested in precision S.
+///
+/// The frame shared by the OBB and the RSS is stored as a unit quaternion and
+/// the remaining parameters as floats, so a node takes 64 bytes instead of the
+/// 240 bytes of OBBRSS<double>. Conversion from OBBRSS is conservative: the
+/// rotation is rounded first, the extents are recomputed against the rounded
+/// frame and rounded outward, so the volume always contains the one it was
+/// built from. BV tests decode both volumes to OBB<S> or RSS<S> and run the
+/// usual double precision tests, while BVHModel keeps its vertices, and hence
+/// leaf tests and contacts, in precision S.
+template <typename S_>
+class FCL_EXPORT FloatOBBRSS
+{
+public:
+
+  using S = S_;
+
+  /// @brief Frame of the OBB and the RSS as a unit quaternion (w, x, y, z)
+  float rotation[4];
+
+  /// @brief Center of the OBB
+  float obb_center[3];
+
+  /// @brief Half dimensions of the OBB
+  float obb_extent[3];
+
+  /// @brief Origin of the RSS rectangle
+  float rss_origin[3];
+
+  /// @brief Side lengths of the RSS rectangle
+  float rss_length[2];
+
+  /// @brief Radius of the RSS sphere
+  float rss_radius;
+
+  /// @brief Empty volume at the origin
+  FloatOBBRSS();
+
+  /// @brief Smallest representable volume that contains bv
+  explicit FloatOBBRSS(const OBBRSS<S>& bv);
+
+  /// @brief Frame of the OBB and the RSS
+  Matrix3<S> axis() const;
+
+  /// @brief The stored OBB in precision S
+  OBB<S> toOBB() const;
+
+  /// @brief The stored RSS in precision S
+  RSS<S> toRSS() const;
+
+  /// @brief The stored OBBRSS in precision S
+  OBBRSS<S> toOBBRSS() const;
+
+  /// @brief Check collision between two FloatOBBRSS
+  bool overlap(const FloatOBBRSS<S>& other) const;
+
+  /// @brief Check whether the FloatOBBRSS contains a point
+  bool contain(const Vector3<S>& p) const;
+
+  /// @brief Merge the FloatOBBRSS and a point
+  FloatOBBRSS<S>& operator += (const Vector3<S>& p);
+
+  /// @brief Merge two FloatOBBRSS
+  FloatOBBRSS<S>& operator += (const FloatOBBRSS<S>& other);
+
+  /// @brief Merge two FloatOBBRSS
+  FloatOBBRSS<S> operator + (const FloatOBBRSS<S>& other) const;
+
+  /// @brief Width of the FloatOBBRSS
+  S width() const;
+
+  /// @brief Height of the FloatOBBRSS
+  S height() const;
+
+  /// @brief Depth of the FloatOBBRSS
+  S depth() const;
+
+  /// @brief Volume of the FloatOBBRSS
+  S volume() const;
+
+  /// @brief Size of the FloatOBBRSS (used in BV_Splitter to order two
+  /// FloatOBBRSS)
+  S size() const;
+
+  /// @brief Center of the FloatOBBRSS
+  const Vector3<S> center() const;
+
+  /// @brief Distance between two FloatOBBRSS; P and Q , is not nullptr,
+  /// returns the nearest points
+  S distance(const FloatOBBRSS<S>& other,
+             Vector3<S>* P = nullptr, Vector3<S>* Q = nullptr) const;
+};
+
+using FloatOBBRSSf = FloatOBBRSS<float>;
+using FloatOBBRSSd = FloatOBBRSS<double>;
+
+/// @brief Translate the FloatOBBRSS bv
+template <typename S>
+FCL_EXPORT
+FloatOBBRSS<S> translate(const FloatOBBRSS<S>& bv, const Vector3<S>& t);
+
+/// @brief Check collision between two FloatOBBRSS, b1 is in configuration
+/// (R0, T0) and b2 is in indentity
+template <typename S, typename DerivedA, typename DerivedB>
+FCL_EXPORT
+bool overlap(const Eigen::MatrixBase<DerivedA>& R0,
+             const Eigen::MatrixBase<DerivedB>& T0,
+             const FloatOBBRSS<S>& b1, const FloatOBBRSS<S>& b2);
+
+/// @brief Computate distance between two FloatOBBRSS, b1 is in configuation
+/// (R0, T0) and b2 is in indentity; P and Q, is not nullptr, returns the
+/// nearest points
+template <typename S, typename DerivedA, typename DerivedB>
+FCL_EXPORT
+S distance(
+    const Eigen::MatrixBase<DerivedA>& R0,
+    const Eigen::MatrixBase<DerivedB>& T0,
+    const FloatOBBRSS<S>& b1, const FloatOBBRSS<S>& b2,
+    Vector3<S>* P = nullptr, Vector3<S>* Q = nullptr);
+
+} // namespace fcl
+
+#include "fcl/math/bv/FloatOBBRSS-inl.h"
+
+#endif
@@ -43,6 +43,7 @@
 #include "fcl/common/unused.h"
 
 #include "fcl/math/bv/AABB.h"
+#include "fcl/math/bv/FloatOBBRSS.h"
 #include "fcl/math/bv/kDOP.h"
 #include "fcl/math/bv/kIOS.h"
 #include "fcl/math/bv/OBB.h"
@@ -651,6 +652,18 @@ struct FCL_EXPORT Fitter<S, OBBRSS<S>>
   }
 };
 
+//==============================================================================
+template <typename S>
+struct FCL_EXPORT Fitter<S, FloatOBBRSS<S>>
+{
+  static void fit(const Vector3<S>* const ps, int n, FloatOBBRSS<S>& bv)
+  {
+    OBBRSS<S> obbrss;
+    Fitter<S, OBBRSS<S>>::fit(ps, n, obbrss);
+    bv = FloatOBBRSS<S>(obbrss);
+  }
+};
+
 //==============================================================================
 extern template
 struct Fitter<double, OBB<double>>;
@@ -667,6 +680,10 @@ struct Fitter<double, kIOS<double>>;
 extern template
 struct Fitter<double, OBBRSS<double>>;
 
+//==============================================================================
+extern template
+struct Fitter<double, FloatOBBRSS<double>>;
+
 //==============================================================================
 } // namespace detail
 //==============================================================================
@@ -923,6 +940,142 @@ public:
   }
 };
 
+//==============================================================================
+/// @brief Bound a bounding volume in configuration tf by a bounding volume of
+/// the same type in I configuration.
+template <typename S, typename BV>
+class FCL_EXPORT TransformBVImpl
+{
+private:
+  static void run(const BV& bv, const Transform3<S>& tf, BV& bv2)
+  {
+    FCL_UNUSED(bv);
+    FCL_UNUSED(tf);
+    FCL_UNUSED(bv2);
+
+    // should only use the specialized version, so it is private.
+  }
+};
+
+//==============================================================================
+/// @brief Transform an AABB, tight for the rotated box.
+template <typename S>
+class FCL_EXPORT TransformBVImpl<S, AABB<S>>
+{
+public:
+  static void run(const AABB<S>& bv, const Transform3<S>& tf, AABB<S>& bv2)
+  {
+    const Vector3<S> center = tf * bv.center();
+    const Vector3<S> delta
+        = tf.linear().cwiseAbs() * ((bv.max_ - bv.min_) * 0.5);
+    bv2.min_ = center - delta;
+    bv2.max_ = center + delta;
+  }
+};
+
+//==============================================================================
+/// @brief Transform a KDOP. A translated KDOP is exact; otherwise the KDOP
+/// bounds the rotated box of its three axis-aligned slabs.
+template <typename S, std::size_t N>
+class FCL_EXPORT TransformBVImpl<S, KDOP<S, N>>
+{
+public:
+  static void run(
+      const KDOP<S, N>& bv, const Transform3<S>& tf, KDOP<S, N>& bv2)
+  {
+    if(tf.linear().isIdentity())
+    {
+      bv2 = translate(bv, Vector3<S>(tf.translation()));
+      return;
+    }
+
+    bv2 = KDOP<S, N>();
+    for(std::size_t i = 0; i < 8; ++i)
+    {
+      const Vector3<S> corner(bv.dist((i & 1) ? N / 2 : 0),
+                              bv.dist((i & 2) ? N / 2 + 1 : 1),
+                              bv.dist((i & 4) ? N / 2 + 2 : 2));
+      bv2 += tf * corner;
+    }
+  }
+};
+
+//==============================================================================
+/// @brief Transform an OBB, exact as the frame of the box moves with it.
+template <typename S>
+class FCL_EXPORT TransformBVImpl<S, OBB<S>>
+{
+public:
+  static void run(const OBB<S>& bv, const Transform3<S>& tf, OBB<S>& bv2)
+  {
+    bv2.extent = bv.extent;
+    bv2.To = tf * bv.To;
+    bv2.axis = tf.linear() * bv.axis;
+  }
+};
+
+//==============================================================================
+/// @brief Transform a RSS, exact as the frame of the rectangle moves with it.
+template <typename S>
+class FCL_EXPORT TransformBVImpl<S, RSS<S>>
+{
+public:
+  static void run(const RSS<S>& bv, const Transform3<S>& tf, RSS<S>& bv2)
+  {
+    bv2.l[0] = bv.l[0];
+    bv2.l[1] = bv.l[1];
+    bv2.r = bv.r;
+    bv2.To = tf * bv.To;
+    bv2.axis = tf.linear() * bv.axis;
+  }
+};
+
+//==============================================================================
+template <typename S>
+class FCL_EXPORT TransformBVImpl<S, OBBRSS<S>>
+{
+public:
+  static void run(
+      const OBBRSS<S>& bv, const Transform3<S>& tf, OBBRSS<S>& bv2)
+  {
+    TransformBVImpl<S, OBB<S>>::run(bv.obb, tf, bv2.obb);
+    TransformBVImpl<S, RSS<S>>::run(bv.rss, tf, bv2.rss);
+  }
+};
+
+//==============================================================================
+/// @brief Transform a FloatOBBRSS through its double precision form; the
+/// conversion back to single precision rounds outwards.
+template <typename S>
+class FCL_EXPORT TransformBVImpl<S, FloatOBBRSS<S>>
+{
+public:
+  static void run(
+      const FloatOBBRSS<S>& bv, const Transform3<S>& tf, FloatOBBRSS<S>& bv2)
+  {
+    OBBRSS<S> obbrss;
+    TransformBVImpl<S, OBBRSS<S>>::run(bv.toOBBRSS(), tf, obbrss);
+    bv2 = FloatOBBRSS<S>(obbrss);
+  }
+};
+
+//==============================================================================
+template <typename S>
+class FCL_EXPORT TransformBVImpl<S, kIOS<S>>
+{
+public:
+  static void run(const kIOS<S>& bv, const Transform3<S>& tf, kIOS<S>& bv2)
+  {
+    bv2.num_spheres = bv.num_spheres;
+    for(unsigned int i = 0; i < bv.num_spheres; ++i)
+    {
+      bv2.spheres[i].o = tf * bv.spheres[i].o;
+      bv2.spheres[i].r = bv.spheres[i].r;
+    }
+    TransformBVImpl<S, OBB<S>>::run(bv.obb, tf, bv2.obb);
+  }
+};
+
 //==============================================================================
 extern template
 class FCL_EXPORT ConvertBVImpl<double, AABB<double>, AABB<double>>;
@@ -959,6 +1112,42 @@ class FCL_EXPORT ConvertBVImpl<double, OBBRSS<double>, RSS<double>>;
 extern template
 class FCL_EXPORT ConvertBVImpl<double, AABB<double>, RSS<double>>;
 
+//==============================================================================
+extern template
+class FCL_EXPORT TransformBVImpl<double, AABB<double>>;
+
+//==============================================================================
+extern template
+class FCL_EXPORT TransformBVImpl<double, KDOP<double, 16>>;
+
+//==============================================================================
+extern template
+class FCL_EXPORT TransformBVImpl<double, KDOP<double, 18>>;
+
+//==============================================================================
+extern template
+class FCL_EXPORT TransformBVImpl<double, KDOP<double, 24>>;
+
+//==============================================================================
+extern template
+class FCL_EXPORT TransformBVImpl<double, OBB<double>>;
+
+//==============================================================================
+extern template
+class FCL_EXPORT TransformBVImpl<double, RSS<double>>;
+
+//==============================================================================
+extern template
+class FCL_EXPORT TransformBVImpl<double, OBBRSS<double>>;
+
+//==============================================================================
+extern template
+class FCL_EXPORT TransformBVImpl<double, FloatOBBRSS<double>>;
+
+//==============================================================================
+extern template
+class FCL_EXPORT TransformBVImpl<double, kIOS<double>>;
+
 //==============================================================================
 } // namespace detail
 //==============================================================================
@@ -975,6 +1164,15 @@ void convertBV(
   detail::ConvertBVImpl<typename BV1::S, BV1, BV2>::run(bv1, tf1, bv2);
 }
 
+//==============================================================================
+template <typename BV>
+FCL_EXPORT
+void transformBV(
+    const BV& bv, const Transform3<typename BV::S>& tf, BV& bv2)
+{
+  detail::TransformBVImpl<typename BV::S, BV>::run(bv, tf, bv2);
+}
+
 } // namespace fcl
 
 #endif
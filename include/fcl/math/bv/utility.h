@@ -56,6 +56,15 @@ FCL_EXPORT
 void convertBV(
     const BV1& bv1, const Transform3<typename BV1::S>& tf1, BV2& bv2);
 
+/// @brief Compute a bounding volume in identity configuration that contains
+/// the bounding volume bv in configuration tf, keeping the type of bv. This is
+/// exact for the oriented types, and conservative for AABB and KDOP, whose
+/// bounds are not invariant under rotation.
+template <typename BV>
+FCL_EXPORT
+void transformBV(
+    const BV& bv, const Transform3<typename BV::S>& tf, BV& bv2);
+
 } // namespace fcl
 
 #include "fcl/math/bv/utility-inl.h"
@@ -0,0 +1,96 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2013-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @author Jia Pan */
+
+#ifndef FCL_MATH_DETAIL_LOWDISCREPANCY_H
+#define FCL_MATH_DETAIL_LOWDISCREPANCY_H
+
+#include <cstddef>
+#include <cstdint>
+#include "fcl/export.h"
+
+namespace fcl
+{
+namespace detail
+{
+
+/// @brief Number of dimensions for which Halton points are available
+constexpr std::size_t kHaltonMaxDimension = 16;
+
+/// @brief Coordinate dim of the index-th point of the Halton sequence, i.e.,
+/// the radical inverse of index in the base of the dim-th prime
+FCL_EXPORT
+double haltonPoint(std::uint64_t index, std::size_t dim);
+
+/// @brief Number of dimensions for which Sobol direction numbers are available
+constexpr std::size_t kSobolMaxDimension = 10;
+
+/// @brief Number of bits of the Sobol points
+constexpr std::size_t kSobolBits = 32;
+
+/// @brief The kSobolBits direction numbers of dimension dim, scaled to 32-bit
+/// integers (initial values from Joe and Kuo, "Constructing Sobol sequences
+/// with better two-dimensional projections", 2008)
+FCL_EXPORT
+const std::uint32_t* sobolDirections(std::size_t dim);
+
+/// @brief Coordinate dim of the index-th point of the Sobol sequence, in
+/// 32-bit fixed point. Consecutive points are cheaper to get from the previous
+/// point with sobolNext()
+FCL_EXPORT
+std::uint32_t sobolPoint(std::uint64_t index, std::size_t dim);
+
+/// @brief Coordinate dim of point index + 1 given the coordinate x of point
+/// index (Antonov-Saleev Gray code update)
+inline std::uint32_t sobolNext(
+    std::uint32_t x, std::uint64_t index, std::size_t dim)
+{
+  std::size_t c = 0;
+  for(std::uint64_t i = index + 1; !(i & 1u); i >>= 1)
+    ++c;
+  return c < kSobolBits ? x ^ sobolDirections(dim)[c] : x;
+}
+
+/// @brief Convert a 32-bit fixed point Sobol coordinate to [0, 1)
+inline double sobolToReal(std::uint32_t x)
+{
+  return x * (1.0 / 4294967296.0);
+}
+
+} // namespace detail
+} // namespace fcl
+
+#endif
@@ -38,6 +38,7 @@
 #ifndef FCL_MATH_DETAIL_SEED_H
 #define FCL_MATH_DETAIL_SEED_H
 
+#include <atomic>
 #include <cstdint>
 #include "fcl/export.h"
 
@@ -46,6 +47,12 @@ namespace fcl
 namespace detail
 {
 
+/// @brief Source of the seeds of the random number generators. The seeds are
+/// SplitMix64 hashes of the first seed and of a sequence index, so they can be
+/// drawn concurrently from any number of threads without locking. When the
+/// user sets the seed, the seeds are reproducible: getNextSeed() returns the
+/// same sequence on every run (as long as the generators are constructed in
+/// the same order), and getSeed() always maps the same index to the same seed.
 class FCL_EXPORT Seed
 {
 public:
@@ -56,13 +63,23 @@ public:
 
   static void setUserSetSeed(std::uint_fast32_t seed);
 
+  /// The root of all the seeds: the seed set by the user if any, otherwise the
+  /// number of micro-seconds in the current time. It is computed once.
   static std::uint_fast32_t getFirstSeed();
 
-  /// We use a different random number generator for the seeds of the
-  /// Other random generators. The root seed is from the number of
-  /// nano-seconds in the current time.
+  /// Seed for the next random number generator. Lock-free: consecutive calls
+  /// take consecutive indices of an atomic counter.
   static std::uint_fast32_t getNextSeed();
 
+  /// Seed number index of the sequence derived from the first seed. Unlike
+  /// getNextSeed(), the result does not depend on the order of the calls,
+  /// which makes it suitable for seeding per-task generators (e.g., by task
+  /// id) reproducibly across threads.
+  static std::uint_fast32_t getSeed(std::uint64_t index);
+
+  /// Restart the sequence of getNextSeed() from its first seed
+  static void resetSequence();
+
 protected:
 
   Seed();
@@ -70,13 +87,16 @@ protected:
   static Seed& getInstance();
 
   /// The seed the user asked for (cannot be 0)
-  std::uint_fast32_t userSetSeed;
+  std::atomic<std::uint_fast32_t> userSetSeed;
 
   /// Flag indicating whether the first seed has already been generated or not
-  bool firstSeedGenerated;
+  std::atomic<bool> firstSeedGenerated;
 
   /// The value of the first seed
-  std::uint_fast32_t firstSeedValue;
+  std::atomic<std::uint_fast32_t> firstSeedValue;
+
+  /// Index of the next seed returned by getNextSeed()
+  std::atomic<std::uint64_t> nextSeedIndex;
 };
 
 } // namespace detail
@@ -0,0 +1,352 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2013-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/** @author Jia Pan */
+
+#ifndef FCL_MATH_DETAIL_TAYLOR_KERNELS_H
+#define FCL_MATH_DETAIL_TAYLOR_KERNELS_H
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #define FCL_TAYLOR_KERNELS_SSE2 1
+  #include <emmintrin.h>
+#else
+  #define FCL_TAYLOR_KERNELS_SSE2 0
+#endif
+
+namespace fcl
+{
+namespace detail
+{
+
+/// @brief Arithmetic kernels of TaylorModel and Interval on raw arrays. The
+/// coefficients of a Taylor model are 4 contiguous values c0..c3 and an
+/// interval is 2 contiguous values {lower, upper}. This is the portable
+/// implementation; TaylorKernels selects a packed one where available.
+template <typename S>
+struct ScalarTaylorKernels
+{
+  /// @brief res = a + b for the coefficients of two Taylor models
+  static void add(const S* a, const S* b, S* res);
+
+  /// @brief res = a - b for the coefficients of two Taylor models
+  static void sub(const S* a, const S* b, S* res);
+
+  /// @brief res = a * d for the coefficients of a Taylor model
+  static void scale(const S* a, S d, S* res);
+
+  /// @brief Product of two cubic polynomials: res receives the coefficients of
+  /// degree 0 to 3 and high those of degree 4 to 6
+  static void multiply(const S* a, const S* b, S* res, S* high);
+
+  /// @brief res = a * d for an interval a
+  static void intervalScale(const S* a, S d, S* res);
+
+  /// @brief res = a * b for two intervals
+  static void intervalMultiply(const S* a, const S* b, S* res);
+
+  /// @brief res = t0 * c[0] + t1 * c[1] + t2 * c[2] for intervals t0, t1, t2,
+  /// e.g. the powers of a time interval
+  static void intervalDot3(
+      const S* t0, const S* t1, const S* t2, const S* c, S* res);
+};
+
+#if FCL_TAYLOR_KERNELS_SSE2
+/// @brief SSE2 kernels for double: the 4 coefficients are handled as two
+/// packed pairs and an interval as one pair, and interval products take the
+/// min/max of the packed endpoint products instead of branching on signs.
+/// The results are the same as the ones of ScalarTaylorKernels<double> (up to
+/// floating point contraction by the compiler).
+struct SSE2TaylorKernels
+{
+  static void add(const double* a, const double* b, double* res);
+
+  static void sub(const double* a, const double* b, double* res);
+
+  static void scale(const double* a, double d, double* res);
+
+  static void multiply(
+      const double* a, const double* b, double* res, double* high);
+
+  static void intervalScale(const double* a, double d, double* res);
+
+  static void intervalMultiply(const double* a, const double* b, double* res);
+
+  static void intervalDot3(const double* t0, const double* t1,
+                           const double* t2, const double* c, double* res);
+};
+#endif
+
+/// @brief Kernels used by TaylorModel<S> and Interval<S>
+template <typename S>
+struct TaylorKernels : ScalarTaylorKernels<S>
+{
+};
+
+#if FCL_TAYLOR_KERNELS_SSE2
+template <>
+struct TaylorKernels<double> : SSE2TaylorKernels
+{
+};
+#endif
+
+//==============================================================================
+template <typename S>
+void ScalarTaylorKernels<S>::add(const S* a, const S* b, S* res)
+{
+  res[0] = a[0] + b[0];
+  res[1] = a[1] + b[1];
+  res[2] = a[2] + b[2];
+  res[3] = a[3] + b[3];
+}
+
+//==============================================================================
+template <typename S>
+void ScalarTaylorKernels<S>::sub(const S* a, const S* b, S* res)
+{
+  res[0] = a[0] - b[0];
+  res[1] = a[1] - b[1];
+  res[2] = a[2] - b[2];
+  res[3] = a[3] - b[3];
+}
+
+//==============================================================================
+template <typename S>
+void ScalarTaylorKernels<S>::scale(const S* a, S d, S* res)
+{
+  res[0] = a[0] * d;
+  res[1] = a[1] * d;
+  res[2] = a[2] * d;
+  res[3] = a[3] * d;
+}
+
+//==============================================================================
+template <typename S>
+void ScalarTaylorKernels<S>::multiply(const S* a, const S* b, S* res, S* high)
+{
+  const S c0 = a[0] * b[0];
+  const S c1 = a[0] * b[1] + a[1] * b[0];
+  const S c2 = a[0] * b[2] + a[1] * b[1] + a[2] * b[0];
+  const S c3 = a[0] * b[3] + a[1] * b[2] + a[2] * b[1] + a[3] * b[0];
+
+  high[0] = a[1] * b[3] + a[2] * b[2] + a[3] * b[1];
+  high[1] = a[2] * b[3] + a[3] * b[2];
+  high[2] = a[3] * b[3];
+
+  res[0] = c0;
+  res[1] = c1;
+  res[2] = c2;
+  res[3] = c3;
+}
+
+//==============================================================================
+template <typename S>
+void ScalarTaylorKernels<S>::intervalScale(const S* a, S d, S* res)
+{
+  if(d >= 0)
+  {
+    res[0] = a[0] * d;
+    res[1] = a[1] * d;
+  }
+  else
+  {
+    const S tmp = a[0];
+    res[0] = a[1] * d;
+    res[1] = tmp * d;
+  }
+}
+
+//==============================================================================
+template <typename S>
+void ScalarTaylorKernels<S>::intervalMultiply(const S* a, const S* b, S* res)
+{
+  S lower, upper;
+  if(b[0] >= 0)
+  {
+    if(a[0] >= 0) { lower = a[0] * b[0]; upper = a[1] * b[1]; }
+    else if(a[1] <= 0) { lower = a[0] * b[1]; upper = a[1] * b[0]; }
+    else { lower = a[0] * b[1]; upper = a[1] * b[1]; }
+  }
+  else if(b[1] <= 0)
+  {
+    if(a[0] >= 0) { lower = a[1] * b[0]; upper = a[0] * b[1]; }
+    else if(a[1] <= 0) { lower = a[1] * b[1]; upper = a[0] * b[0]; }
+    else { lower = a[1] * b[0]; upper = a[0] * b[0]; }
+  }
+  else if(a[0] >= 0)
+  {
+    lower = a[1] * b[0];
+    upper = a[1] * b[1];
+  }
+  else if(a[1] <= 0)
+  {
+    lower = a[0] * b[1];
+    upper = a[0] * b[0];
+  }
+  else
+  {
+    const S v00 = a[0] * b[0];
+    const S v11 = a[1] * b[1];
+    const S v01 = a[0] * b[1];
+    const S v10 = a[1] * b[0];
+    lower = (v01 < v10) ? v01 : v10;
+    upper = (v00 <= v11) ? v11 : v00;
+  }
+
+  res[0] = lower;
+  res[1] = upper;
+}
+
+//==============================================================================
+template <typename S>
+void ScalarTaylorKernels<S>::intervalDot3(
+    const S* t0, const S* t1, const S* t2, const S* c, S* res)
+{
+  S r0[2], r1[2], r2[2];
+  intervalScale(t0, c[0], r0);
+  intervalScale(t1, c[1], r1);
+  intervalScale(t2, c[2], r2);
+  res[0] = r0[0] + r1[0] + r2[0];
+  res[1] = r0[1] + r1[1] + r2[1];
+}
+
+#if FCL_TAYLOR_KERNELS_SSE2
+//==============================================================================
+inline void SSE2TaylorKernels::add(
+    const double* a, const double* b, double* res)
+{
+  _mm_storeu_pd(res, _mm_add_pd(_mm_loadu_pd(a), _mm_loadu_pd(b)));
+  _mm_storeu_pd(res + 2, _mm_add_pd(_mm_loadu_pd(a + 2), _mm_loadu_pd(b + 2)));
+}
+
+//==============================================================================
+inline void SSE2TaylorKernels::sub(
+    const double* a, const double* b, double* res)
+{
+  _mm_storeu_pd(res, _mm_sub_pd(_mm_loadu_pd(a), _mm_loadu_pd(b)));
+  _mm_storeu_pd(res + 2, _mm_sub_pd(_mm_loadu_pd(a + 2), _mm_loadu_pd(b + 2)));
+}
+
+//==============================================================================
+inline void SSE2TaylorKernels::scale(const double* a, double d, double* res)
+{
+  const __m128d vd = _mm_set1_pd(d);
+  _mm_storeu_pd(res, _mm_mul_pd(_mm_loadu_pd(a), vd));
+  _mm_storeu_pd(res + 2, _mm_mul_pd(_mm_loadu_pd(a + 2), vd));
+}
+
+//==============================================================================
+inline void SSE2TaylorKernels::multiply(
+    const double* a, const double* b, double* res, double* high)
+{
+  const __m128d b01 = _mm_loadu_pd(b);
+  const __m128d b12 = _mm_loadu_pd(b + 1);
+  const __m128d b23 = _mm_loadu_pd(b + 2);
+  const __m128d a0 = _mm_set1_pd(a[0]);
+  const __m128d a1 = _mm_set1_pd(a[1]);
+  const __m128d a2 = _mm_set1_pd(a[2]);
+
+  // [c0, c1] = a0 * [b0, b1] + [0, a1 * b0]
+  const __m128d c01 = _mm_add_pd(
+      _mm_mul_pd(a0, b01), _mm_unpacklo_pd(_mm_setzero_pd(), _mm_mul_pd(a1, b01)));
+
+  // [c2, c3] = a0 * [b2, b3] + a1 * [b1, b2] + a2 * [b0, b1] + [0, a3 * b0]
+  __m128d c23 = _mm_add_pd(_mm_mul_pd(a0, b23), _mm_mul_pd(a1, b12));
+  c23 = _mm_add_pd(c23, _mm_mul_pd(a2, b01));
+  c23 = _mm_add_pd(c23, _mm_set_pd(a[3] * b[0], 0.0));
+
+  // [c4, c5] = [a1, a2] * b3 + [a2, a3] * b2 + [a3 * b1, 0]
+  __m128d c45 = _mm_add_pd(_mm_mul_pd(_mm_loadu_pd(a + 1), _mm_set1_pd(b[3])),
+                           _mm_mul_pd(_mm_loadu_pd(a + 2), _mm_set1_pd(b[2])));
+  c45 = _mm_add_pd(c45, _mm_set_sd(a[3] * b[1]));
+
+  _mm_storeu_pd(high, c45);
+  high[2] = a[3] * b[3];
+  _mm_storeu_pd(res, c01);
+  _mm_storeu_pd(res + 2, c23);
+}
+
+//==============================================================================
+inline void SSE2TaylorKernels::intervalScale(
+    const double* a, double d, double* res)
+{
+  const __m128d v = _mm_mul_pd(_mm_loadu_pd(a), _mm_set1_pd(d));
+  const __m128d w = _mm_shuffle_pd(v, v, 1);
+  _mm_storeu_pd(res, _mm_unpacklo_pd(_mm_min_pd(v, w), _mm_max_pd(v, w)));
+}
+
+//==============================================================================
+inline void SSE2TaylorKernels::intervalMultiply(
+    const double* a, const double* b, double* res)
+{
+  const __m128d va = _mm_loadu_pd(a);
+  const __m128d vb = _mm_loadu_pd(b);
+
+  // [a0 * b0, a1 * b1] and [a0 * b1, a1 * b0]
+  const __m128d p = _mm_mul_pd(va, vb);
+  const __m128d q = _mm_mul_pd(va, _mm_shuffle_pd(vb, vb, 1));
+
+  __m128d lower = _mm_min_pd(p, q);
+  __m128d upper = _mm_max_pd(p, q);
+  lower = _mm_min_pd(lower, _mm_shuffle_pd(lower, lower, 1));
+  upper = _mm_max_pd(upper, _mm_shuffle_pd(upper, upper, 1));
+  _mm_storeu_pd(res, _mm_unpacklo_pd(lower, upper));
+}
+
+//==============================================================================
+inline void SSE2TaylorKernels::intervalDot3(
+    const double* t0, const double* t1, const double* t2, const double* c,
+    double* res)
+{
+  const __m128d v0 = _mm_mul_pd(_mm_loadu_pd(t0), _mm_set1_pd(c[0]));
+  const __m128d v1 = _mm_mul_pd(_mm_loadu_pd(t1), _mm_set1_pd(c[1]));
+  const __m128d v2 = _mm_mul_pd(_mm_loadu_pd(t2), _mm_set1_pd(c[2]));
+  const __m128d w0 = _mm_shuffle_pd(v0, v0, 1);
+  const __m128d w1 = _mm_shuffle_pd(v1, v1, 1);
+  const __m128d w2 = _mm_shuffle_pd(v2, v2, 1);
+
+  // Both lanes of lower (upper) hold the sum of the lower (upper) endpoints
+  const __m128d lower = _mm_add_pd(
+      _mm_add_pd(_mm_min_pd(v0, w0), _mm_min_pd(v1, w1)), _mm_min_pd(v2, w2));
+  const __m128d upper = _mm_add_pd(
+      _mm_add_pd(_mm_max_pd(v0, w0), _mm_max_pd(v1, w1)), _mm_max_pd(v2, w2));
+  _mm_storeu_pd(res, _mm_unpacklo_pd(lower, upper));
+}
+#endif
+
+} // namespace detail
+} // namespace fcl
+
+#endif
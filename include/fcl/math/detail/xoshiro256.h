@@ -0,0 +1,128 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2013-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @author Jia Pan */
+
+#ifndef FCL_MATH_DETAIL_XOSHIRO256_H
+#define FCL_MATH_DETAIL_XOSHIRO256_H
+
+#include <cstdint>
+#include <limits>
+#include "fcl/export.h"
+
+namespace fcl
+{
+namespace detail
+{
+
+/// @brief SplitMix64 output function applied to x + 0x9e3779b97f4a7c15. Maps
+/// consecutive or otherwise correlated integers to well-mixed 64-bit values;
+/// used to derive generator states from seeds and stream counters.
+FCL_EXPORT
+std::uint64_t splitMix64(std::uint64_t x);
+
+/// @brief xoshiro256++ pseudo random generator (Blackman and Vigna). It has a
+/// 256-bit state, a period of 2^256 - 1 and is several times faster than
+/// std::mt19937, which makes it cheap to create one generator per stream. It
+/// satisfies the UniformRandomBitGenerator requirements, so it can also drive
+/// the standard distributions.
+class FCL_EXPORT Xoshiro256
+{
+public:
+  using result_type = std::uint64_t;
+
+  /// @brief Generator whose state is derived from the seed with SplitMix64
+  explicit Xoshiro256(std::uint64_t seed = 1);
+
+  /// @brief Generator of the stream identified by (seed, stream, substream).
+  /// Different streams are statistically independent, so the blocks of a
+  /// parallel computation can each draw from their own stream and produce the
+  /// same numbers whatever the number of threads.
+  Xoshiro256(std::uint64_t seed, std::uint64_t stream, std::uint64_t substream);
+
+  /// @brief Next 64 random bits
+  result_type operator()();
+
+  /// @brief Random real uniformly distributed in [0, 1), with 53 random bits
+  double uniform01();
+
+  /// @brief Advance the generator by 2^128 steps. Calling it repeatedly gives
+  /// 2^128 non-overlapping subsequences of length 2^128
+  void jump();
+
+  static constexpr result_type min()
+  {
+    return std::numeric_limits<result_type>::min();
+  }
+
+  static constexpr result_type max()
+  {
+    return std::numeric_limits<result_type>::max();
+  }
+
+private:
+  void setState(std::uint64_t seed);
+
+  std::uint64_t state_[4];
+};
+
+//==============================================================================
+inline Xoshiro256::result_type Xoshiro256::operator()()
+{
+  const std::uint64_t sum = state_[0] + state_[3];
+  const std::uint64_t result = ((sum << 23) | (sum >> 41)) + state_[0];
+  const std::uint64_t t = state_[1] << 17;
+
+  state_[2] ^= state_[0];
+  state_[3] ^= state_[1];
+  state_[1] ^= state_[2];
+  state_[0] ^= state_[3];
+
+  state_[2] ^= t;
+  state_[3] = (state_[3] << 45) | (state_[3] >> 19);
+
+  return result;
+}
+
+//==============================================================================
+inline double Xoshiro256::uniform01()
+{
+  return static_cast<double>((*this)() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+} // namespace detail
+} // namespace fcl
+
+#endif
@@ -129,14 +129,27 @@ InterpMotion<S>::InterpMotion(
 template <typename S>
 bool InterpMotion<S>::integrate(double dt) const
 {
-  if(dt > 1) dt = 1;
-
-  tf.linear() = absoluteRotation(dt).toRotationMatrix();
-  tf.translation() = linear_vel * dt + tf1 * reference_p - tf.linear() * reference_p;
+  tf = evaluate(dt);
 
   return true;
 }
 
+//==============================================================================
+template <typename S>
+Transform3<S> InterpMotion<S>::evaluate(S t) const
+{
+  if(t > 1)
+    t = 1;
+  else if(t < 0)
+    t = 0;
+
+  Transform3<S> result;
+  result.linear() = absoluteRotation(t).toRotationMatrix();
+  result.translation() = linear_vel * t + tf1 * reference_p - result.linear() * reference_p;
+
+  return result;
+}
+
 //==============================================================================
 template <typename S>
 S InterpMotion<S>::computeMotionBound(const BVMotionBoundVisitor<S>& mb_visitor) const
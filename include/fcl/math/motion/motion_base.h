@@ -62,6 +62,12 @@ public:
   /** @brief Integrate the motion from 0 to dt */
   virtual bool integrate(S dt) const = 0;
 
+  /** @brief Evaluate the transformation at time t, clamped to [0, 1].
+   *
+   * Unlike integrate(), this does not modify the current transformation, so
+   * it may be called concurrently on a shared motion. */
+  virtual Transform3<S> evaluate(S t) const = 0;
+
   /** @brief Compute the motion bound for a bounding volume, given the closest direction n between two query objects */
   virtual S computeMotionBound(const BVMotionBoundVisitor<S>& mb_visitor) const = 0;
 
@@ -94,14 +94,27 @@ ScrewMotion<S>::ScrewMotion(
 template <typename S>
 bool ScrewMotion<S>::integrate(double dt) const
 {
-  if(dt > 1) dt = 1;
+  tf = evaluate(dt);
 
-  tf.linear() = absoluteRotation(dt).toRotationMatrix();
+  return true;
+}
+
+//==============================================================================
+template <typename S>
+Transform3<S> ScrewMotion<S>::evaluate(S t) const
+{
+  if(t > 1)
+    t = 1;
+  else if(t < 0)
+    t = 0;
 
-  Quaternion<S> delta_rot = deltaRotation(dt);
-  tf.translation() = p + axis * (dt * linear_vel) + delta_rot * (tf1.translation() - p);
+  Transform3<S> result;
+  result.linear() = absoluteRotation(t).toRotationMatrix();
 
-  return true;
+  Quaternion<S> delta_rot = deltaRotation(t);
+  result.translation() = p + axis * (t * linear_vel) + delta_rot * (tf1.translation() - p);
+
+  return result;
 }
 
 //==============================================================================
@@ -67,6 +67,10 @@ public:
   /// We compute the current transformation from zero point instead of from last integrate time, for precision.
   bool integrate(double dt) const;
 
+  /// @brief Evaluate the transformation at time t in [0, 1] without touching
+  /// the cached current transformation.
+  Transform3<S> evaluate(S t) const;
+
   /// @brief Compute the motion bound for a bounding volume along a given direction n, which is defined in the visitor
   S computeMotionBound(const BVMotionBoundVisitor<S>& mb_visitor) const;
 
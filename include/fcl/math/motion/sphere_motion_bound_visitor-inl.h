@@ -0,0 +1,135 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */ 
+
+
+#ifndef FCL_CCD_SPHEREMOTIONBOUNDVISITOR_INL_H
+#define FCL_CCD_SPHEREMOTIONBOUNDVISITOR_INL_H
+
+#include "fcl/math/motion/sphere_motion_bound_visitor.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "fcl/common/unused.h"
+#include "fcl/math/motion/tbv_motion_bound_visitor.h"
+
+namespace fcl
+{
+
+//==============================================================================
+extern template
+class FCL_EXPORT SphereMotionBoundVisitor<double>;
+
+//==============================================================================
+template <typename S>
+SphereMotionBoundVisitor<S>::SphereMotionBoundVisitor(
+    const Vector3<S>& center_, S radius_, S t0_, S t1_)
+  : t0(t0_), t1(t1_)
+{
+  bv.axis.setIdentity();
+  bv.To = center_;
+  bv.l[0] = 0;
+  bv.l[1] = 0;
+  bv.r = radius_;
+}
+
+//==============================================================================
+template <typename S>
+S SphereMotionBoundVisitor<S>::visit(const MotionBase<S>& motion) const
+{
+  FCL_UNUSED(motion);
+
+  // Unknown motion: nothing can be culled
+  return std::numeric_limits<S>::max();
+}
+
+//==============================================================================
+template <typename S>
+S SphereMotionBoundVisitor<S>::visit(const SplineMotion<S>& motion) const
+{
+  if(t1 <= t0)
+    return 0;
+
+  // The spline bounds are displacements over [t0, t1] rather than speeds
+  return axisBound(motion) / (t1 - t0);
+}
+
+//==============================================================================
+template <typename S>
+S SphereMotionBoundVisitor<S>::visit(const ScrewMotion<S>& motion) const
+{
+  return axisBound(motion);
+}
+
+//==============================================================================
+template <typename S>
+S SphereMotionBoundVisitor<S>::visit(const InterpMotion<S>& motion) const
+{
+  return axisBound(motion);
+}
+
+//==============================================================================
+template <typename S>
+S SphereMotionBoundVisitor<S>::visit(const TranslationMotion<S>& motion) const
+{
+  return axisBound(motion);
+}
+
+//==============================================================================
+template <typename S>
+template <typename MotionT>
+S SphereMotionBoundVisitor<S>::axisBound(const MotionT& motion) const
+{
+  // The directional bounds are positively homogeneous and subadditive in the
+  // direction n, so for a unit n they are at most sum_i |n_i| m_i <= |m|, where
+  // m_i is the larger of the bounds along e_i and -e_i.
+  S sqr_bound = 0;
+  for(int i = 0; i < 3; ++i)
+  {
+    const Vector3<S> e = Vector3<S>::Unit(i);
+    TBVMotionBoundVisitor<RSS<S>> pos_visitor(bv, e, t0, t1);
+    TBVMotionBoundVisitor<RSS<S>> neg_visitor(bv, -e, t0, t1);
+    const S m = std::max(
+        S(0), std::max(pos_visitor.visit(motion), neg_visitor.visit(motion)));
+    sqr_bound += m * m;
+  }
+
+  return std::sqrt(sqr_bound);
+}
+
+} // namespace fcl
+
+#endif
@@ -0,0 +1,89 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */ 
+
+
+#ifndef FCL_CCD_SPHEREMOTIONBOUNDVISITOR_H
+#define FCL_CCD_SPHEREMOTIONBOUNDVISITOR_H
+
+#include "fcl/math/bv/RSS.h"
+#include "fcl/math/motion/bv_motion_bound_visitor.h"
+#include "fcl/math/motion/spline_motion.h"
+#include "fcl/math/motion/screw_motion.h"
+#include "fcl/math/motion/interp_motion.h"
+#include "fcl/math/motion/translation_motion.h"
+
+namespace fcl
+{
+
+/// @brief Bound the speed of every point of a sphere carried by a motion,
+/// over the time interval [t0, t1] and in any direction.
+///
+/// The sphere is given in the local frame of the moving object. The bound is
+/// assembled from TBVMotionBoundVisitor along the three coordinate axes, so it
+/// holds for the same motions, and is expressed per unit of motion time: a
+/// point of the sphere moves at most visit(motion) * (t1 - t0) over the
+/// interval. It is typically used to cull time intervals in which two objects
+/// cannot come into contact.
+template <typename S>
+class FCL_EXPORT SphereMotionBoundVisitor : public BVMotionBoundVisitor<S>
+{
+public:
+  SphereMotionBoundVisitor(const Vector3<S>& center_, S radius_, S t0_, S t1_);
+
+  S visit(const MotionBase<S>& motion) const override;
+  S visit(const SplineMotion<S>& motion) const override;
+  S visit(const ScrewMotion<S>& motion) const override;
+  S visit(const InterpMotion<S>& motion) const override;
+  S visit(const TranslationMotion<S>& motion) const override;
+
+protected:
+  template <typename MotionT>
+  S axisBound(const MotionT& motion) const;
+
+  /// @brief The sphere, stored as a zero-length RSS
+  RSS<S> bv;
+
+  /// @brief Time interval of the query
+  S t0, t1;
+};
+
+using SphereMotionBoundVisitorf = SphereMotionBoundVisitor<float>;
+using SphereMotionBoundVisitord = SphereMotionBoundVisitor<double>;
+
+} // namespace fcl
+
+#include "fcl/math/motion/sphere_motion_bound_visitor-inl.h"
+
+#endif
@@ -68,6 +68,8 @@ public:
   /// We compute the current transformation from zero point instead of from last integrate time, for precision.
   bool integrate(S dt) const override;
 
+  Transform3<S> evaluate(S t) const override;
+
   /// @brief Compute the motion bound for a bounding volume along a given direction n, which is defined in the visitor
   S computeMotionBound(const BVMotionBoundVisitor<S>& mb_visitor) const override;
 
@@ -102,9 +104,15 @@ protected:
 
 public:
   S computeTBound(const Vector3<S>& n) const;
-  
+
+  /// @brief Bound of the translation along n over the time interval [t0, t1]
+  S computeTBound(const Vector3<S>& n, S t0, S t1) const;
+
   S computeDWMax() const;
 
+  /// @brief Bound of the angular velocity over the time interval [t0, t1]
+  S computeDWMax(S t0, S t1) const;
+
   S getCurrentTime() const;
 
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
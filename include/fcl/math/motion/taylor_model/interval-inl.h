@@ -150,131 +150,16 @@ Interval<S>& Interval<S>::operator -= (const Interval<S>& other)
 template <typename S>
 Interval<S> Interval<S>::operator * (const Interval<S>& other) const
 {
-  if(other.i_[0] >= 0)
-  {
-    if(i_[0] >= 0) return Interval<S>(i_[0] * other.i_[0], i_[1] * other.i_[1]);
-    if(i_[1] <= 0) return Interval<S>(i_[0] * other.i_[1], i_[1] * other.i_[0]);
-    return Interval<S>(i_[0] * other.i_[1], i_[1] * other.i_[1]);
-  }
-  if(other.i_[1] <= 0)
-  {
-    if(i_[0] >= 0) return Interval<S>(i_[1] * other.i_[0], i_[0] * other.i_[1]);
-    if(i_[1] <= 0) return Interval<S>(i_[1] * other.i_[1], i_[0] * other.i_[0]);
-    return Interval<S>(i_[1] * other.i_[0], i_[0] * other.i_[0]);
-  }
-
-  if(i_[0] >= 0) return Interval<S>(i_[1] * other.i_[0], i_[1] * other.i_[1]);
-  if(i_[1] <= 0) return Interval<S>(i_[0] * other.i_[1], i_[0] * other.i_[0]);
-
-  S v00 = i_[0] * other.i_[0];
-  S v11 = i_[1] * other.i_[1];
-  if(v00 <= v11)
-  {
-    S v01 = i_[0] * other.i_[1];
-    S v10 = i_[1] * other.i_[0];
-    if(v01 < v10) return Interval<S>(v01, v11);
-    return Interval<S>(v10, v11);
-  }
-
-  S v01 = i_[0] * other.i_[1];
-  S v10 = i_[1] * other.i_[0];
-  if(v01 < v10) return Interval<S>(v01, v00);
-  return Interval<S>(v10, v00);
+  Interval<S> res;
+  detail::TaylorKernels<S>::intervalMultiply(i_, other.i_, res.i_);
+  return res;
 }
 
 //==============================================================================
 template <typename S>
 Interval<S>& Interval<S>::operator *= (const Interval<S>& other)
 {
-  if(other.i_[0] >= 0)
-  {
-    if(i_[0] >= 0)
-    {
-      i_[0] *= other.i_[0];
-      i_[1] *= other.i_[1];
-    }
-    else if(i_[1] <= 0)
-    {
-      i_[0] *= other.i_[1];
-      i_[1] *= other.i_[0];
-    }
-    else
-    {
-      i_[0] *= other.i_[1];
-      i_[1] *= other.i_[1];
-    }
-    return *this;
-  }
-
-  if(other.i_[1] <= 0)
-  {
-    if(i_[0] >= 0)
-    {
-      S tmp = i_[0];
-      i_[0] = i_[1] * other.i_[0];
-      i_[1] = tmp * other.i_[1];
-    }
-    else if(i_[1] <= 0)
-    {
-      S tmp = i_[0];
-      i_[0] = i_[1] * other.i_[1];
-      i_[1] = tmp * other.i_[0];
-    }
-    else
-    {
-      S tmp = i_[0];
-      i_[0] = i_[1] * other.i_[0];
-      i_[1] = tmp * other.i_[0];
-    }
-    return *this;
-  }
-
-  if(i_[0] >= 0)
-  {
-    i_[0] = i_[1] * other.i_[0];
-    i_[1] *= other.i_[1];
-    return *this;
-  }
-
-  if(i_[1] <= 0)
-  {
-    i_[1] = i_[0] * other.i_[0];
-    i_[0] *= other.i_[1];
-    return *this;
-  }
-
-  S v00 = i_[0] * other.i_[0];
-  S v11 = i_[1] * other.i_[1];
-  if(v00 <= v11)
-  {
-    S v01 = i_[0] * other.i_[1];
-    S v10 = i_[1] * other.i_[0];
-    if(v01 < v10)
-    {
-      i_[0] = v01;
-      i_[1] = v11;
-    }
-    else
-    {
-      i_[0] = v10;
-      i_[1] = v11;
-    }
-    return *this;
-  }
-
-  S v01 = i_[0] * other.i_[1];
-  S v10 = i_[1] * other.i_[0];
-  if(v01 < v10)
-  {
-    i_[0] = v01;
-    i_[1] = v00;
-  }
-  else
-  {
-    i_[0] = v10;
-    i_[1] = v00;
-  }
-
+  detail::TaylorKernels<S>::intervalMultiply(i_, other.i_, i_);
   return *this;
 }
 
@@ -282,26 +167,16 @@ Interval<S>& Interval<S>::operator *= (const Interval<S>& other)
 template <typename S>
 Interval<S> Interval<S>::operator * (S d) const
 {
-  if(d >= 0) return Interval(i_[0] * d, i_[1] * d);
-  return Interval(i_[1] * d, i_[0] * d);
+  Interval<S> res;
+  detail::TaylorKernels<S>::intervalScale(i_, d, res.i_);
+  return res;
 }
 
 //==============================================================================
 template <typename S>
 Interval<S>& Interval<S>::operator *= (S d)
 {
-  if(d >= 0)
-  {
-    i_[0] *= d;
-    i_[1] *= d;
-  }
-  else
-  {
-    S tmp = i_[0];
-    i_[0] = i_[1] * d;
-    i_[1] = tmp * d;
-  }
-
+  detail::TaylorKernels<S>::intervalScale(i_, d, i_);
   return *this;
 }
 
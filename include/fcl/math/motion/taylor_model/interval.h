@@ -41,6 +41,7 @@
 
 #include <iostream>
 #include "fcl/common/types.h"
+#include "fcl/math/detail/taylor_kernels.h"
 
 namespace fcl
 {
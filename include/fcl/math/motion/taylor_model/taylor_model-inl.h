@@ -204,7 +204,10 @@ template <typename S>
 TaylorModel<S> TaylorModel<S>::operator + (const TaylorModel<S>& other) const
 {
   assert(other.time_interval_ == time_interval_);
-  return TaylorModel(coeffs_[0] + other.coeffs_[0], coeffs_[1] + other.coeffs_[1], coeffs_[2] + other.coeffs_[2], coeffs_[3] + other.coeffs_[3], r_ + other.r_, time_interval_);
+  TaylorModel res(time_interval_);
+  detail::TaylorKernels<S>::add(coeffs_, other.coeffs_, res.coeffs_);
+  res.r_ = r_ + other.r_;
+  return res;
 }
 
 //==============================================================================
@@ -212,7 +215,10 @@ template <typename S>
 TaylorModel<S> TaylorModel<S>::operator - (const TaylorModel<S>& other) const
 {
   assert(other.time_interval_ == time_interval_);
-  return TaylorModel(coeffs_[0] - other.coeffs_[0], coeffs_[1] - other.coeffs_[1], coeffs_[2] - other.coeffs_[2], coeffs_[3] - other.coeffs_[3], r_ - other.r_, time_interval_);
+  TaylorModel res(time_interval_);
+  detail::TaylorKernels<S>::sub(coeffs_, other.coeffs_, res.coeffs_);
+  res.r_ = r_ - other.r_;
+  return res;
 }
 
 //==============================================================================
@@ -220,10 +226,7 @@ template <typename S>
 TaylorModel<S>& TaylorModel<S>::operator += (const TaylorModel<S>& other)
 {
   assert(other.time_interval_ == time_interval_);
-  coeffs_[0] += other.coeffs_[0];
-  coeffs_[1] += other.coeffs_[1];
-  coeffs_[2] += other.coeffs_[2];
-  coeffs_[3] += other.coeffs_[3];
+  detail::TaylorKernels<S>::add(coeffs_, other.coeffs_, coeffs_);
   r_ += other.r_;
   return *this;
 }
@@ -233,10 +236,7 @@ template <typename S>
 TaylorModel<S>& TaylorModel<S>::operator -= (const TaylorModel<S>& other)
 {
   assert(other.time_interval_ == time_interval_);
-  coeffs_[0] -= other.coeffs_[0];
-  coeffs_[1] -= other.coeffs_[1];
-  coeffs_[2] -= other.coeffs_[2];
-  coeffs_[3] -= other.coeffs_[3];
+  detail::TaylorKernels<S>::sub(coeffs_, other.coeffs_, coeffs_);
   r_ -= other.r_;
   return *this;
 }
@@ -267,7 +267,10 @@ TaylorModel<S> TaylorModel<S>::operator * (const TaylorModel<S>& other) const
 template <typename S>
 TaylorModel<S> TaylorModel<S>::operator * (S d) const
 {
-  return TaylorModel(coeffs_[0] * d, coeffs_[1] * d, coeffs_[2] * d, coeffs_[3] * d,  r_ * d, time_interval_);
+  TaylorModel res(time_interval_);
+  detail::TaylorKernels<S>::scale(coeffs_, d, res.coeffs_);
+  res.r_ = r_ * d;
+  return res;
 }
 
 //==============================================================================
@@ -275,33 +278,30 @@ template <typename S>
 TaylorModel<S>& TaylorModel<S>::operator *= (const TaylorModel<S>& other)
 {
   assert(other.time_interval_ == time_interval_);
-  S c0, c1, c2, c3;
-  S c0b = other.coeffs_[0], c1b = other.coeffs_[1], c2b = other.coeffs_[2], c3b = other.coeffs_[3];
-
-  const Interval<S>& rb = other.r_;
-
-  c0 = coeffs_[0] * c0b;
-  c1 = coeffs_[0] * c1b + coeffs_[1] * c0b;
-  c2 = coeffs_[0] * c2b + coeffs_[1] * c1b + coeffs_[2] * c0b;
-  c3 = coeffs_[0] * c3b + coeffs_[1] * c2b + coeffs_[2] * c1b + coeffs_[3] * c0b;
-
-  Interval<S> remainder(r_ * rb);
-  S tempVal = coeffs_[1] * c3b + coeffs_[2] * c2b + coeffs_[3] * c1b;
-  remainder += time_interval_->t4_ * tempVal;
-
-  tempVal = coeffs_[2] * c3b + coeffs_[3] * c2b;
-  remainder += time_interval_->t5_ * tempVal;
-
-  tempVal = coeffs_[3] * c3b;
-  remainder += time_interval_->t6_ * tempVal;
-
-  remainder += ((Interval<S>(coeffs_[0]) + time_interval_->t_ * coeffs_[1] + time_interval_->t2_ * coeffs_[2] + time_interval_->t3_ * coeffs_[3]) * rb +
-                (Interval<S>(c0b) + time_interval_->t_ * c1b + time_interval_->t2_ * c2b + time_interval_->t3_ * c3b) * r_);
-
-  coeffs_[0] = c0;
-  coeffs_[1] = c1;
-  coeffs_[2] = c2;
-  coeffs_[3] = c3;
+  using Kernels = detail::TaylorKernels<S>;
+  const TimeInterval<S>& t = *time_interval_;
+
+  // Bounds of the two polynomials, without their remainders
+  Interval<S> bound_a, bound_b;
+  Kernels::intervalDot3(t.t_.i_, t.t2_.i_, t.t3_.i_, coeffs_ + 1, bound_a.i_);
+  Kernels::intervalDot3(t.t_.i_, t.t2_.i_, t.t3_.i_, other.coeffs_ + 1, bound_b.i_);
+  bound_a += Interval<S>(coeffs_[0]);
+  bound_b += Interval<S>(other.coeffs_[0]);
+
+  // The terms of degree 4 to 6 go to the remainder
+  S high[3];
+  Kernels::multiply(coeffs_, other.coeffs_, coeffs_, high);
+
+  Interval<S> remainder;
+  Kernels::intervalDot3(t.t4_.i_, t.t5_.i_, t.t6_.i_, high, remainder.i_);
+
+  Interval<S> product;
+  Kernels::intervalMultiply(r_.i_, other.r_.i_, product.i_);
+  remainder += product;
+  Kernels::intervalMultiply(bound_a.i_, other.r_.i_, product.i_);
+  remainder += product;
+  Kernels::intervalMultiply(bound_b.i_, r_.i_, product.i_);
+  remainder += product;
 
   r_ = remainder;
 
@@ -312,10 +312,7 @@ TaylorModel<S>& TaylorModel<S>::operator *= (const TaylorModel<S>& other)
 template <typename S>
 TaylorModel<S>& TaylorModel<S>::operator *= (S d)
 {
-  coeffs_[0] *= d;
-  coeffs_[1] *= d;
-  coeffs_[2] *= d;
-  coeffs_[3] *= d;
+  detail::TaylorKernels<S>::scale(coeffs_, d, coeffs_);
   r_ *= d;
   return *this;
 }
@@ -349,14 +346,18 @@ Interval<S> TaylorModel<S>::getBound(S t0, S t1) const
   Interval<S> t2(t0 * t0, t1 * t1);
   Interval<S> t3(t0 * t2[0], t1 * t2[1]);
 
-  return Interval<S>(coeffs_[0]) + t * coeffs_[1] + t2 * coeffs_[2] + t3 * coeffs_[3] + r_;
+  Interval<S> res;
+  detail::TaylorKernels<S>::intervalDot3(t.i_, t2.i_, t3.i_, coeffs_ + 1, res.i_);
+  return res + Interval<S>(coeffs_[0] + r_[0], coeffs_[0] + r_[1]);
 }
 
 //==============================================================================
 template <typename S>
 Interval<S> TaylorModel<S>::getBound() const
 {
-  return Interval<S>(coeffs_[0] + r_[0], coeffs_[1] + r_[1]) + time_interval_->t_ * coeffs_[1] + time_interval_->t2_ * coeffs_[2] + time_interval_->t3_ * coeffs_[3];
+  Interval<S> res;
+  detail::TaylorKernels<S>::intervalDot3(time_interval_->t_.i_, time_interval_->t2_.i_, time_interval_->t3_.i_, coeffs_ + 1, res.i_);
+  return res + Interval<S>(coeffs_[0] + r_[0], coeffs_[0] + r_[1]);
 }
 
 //==============================================================================
@@ -611,22 +612,22 @@ void generateTaylorModelForSinFunc(TaylorModel<S>& tm, S w, S q0)
       k2 -= 0.5;
       if(ceil(k1) - floor(k2) > 1) fddddBounds[0] = -1;
     }
+  }
 
-    S w4 = w2 * w2;
-    fddddBounds *= w4;
+  S w4 = w2 * w2;
+  fddddBounds *= w4;
 
-    S midSize = 0.5 * (tm.getTimeInterval()->t_[1] - tm.getTimeInterval()->t_[0]);
-    S midSize2 = midSize * midSize;
-    S midSize4 = midSize2 * midSize2;
+  S midSize = 0.5 * (tm.getTimeInterval()->t_[1] - tm.getTimeInterval()->t_[0]);
+  S midSize2 = midSize * midSize;
+  S midSize4 = midSize2 * midSize2;
 
-    // [0, midSize4] * fdddBounds
-    if(fddddBounds[0] > 0)
-      tm.remainder().setValue(0, fddddBounds[1] * midSize4 * (1.0 / 24));
-    else if(fddddBounds[0] < 0)
-      tm.remainder().setValue(fddddBounds[0] * midSize4 * (1.0 / 24), 0);
-    else
-      tm.remainder().setValue(fddddBounds[0] * midSize4 * (1.0 / 24), fddddBounds[1] * midSize4 * (1.0 / 24));
-  }
+  // [0, midSize4] * fdddBounds
+  if(fddddBounds[0] > 0)
+    tm.remainder().setValue(0, fddddBounds[1] * midSize4 * (1.0 / 24));
+  else if(fddddBounds[0] < 0)
+    tm.remainder().setValue(fddddBounds[0] * midSize4 * (1.0 / 24), 0);
+  else
+    tm.remainder().setValue(fddddBounds[0] * midSize4 * (1.0 / 24), fddddBounds[1] * midSize4 * (1.0 / 24));
 }
 
 //==============================================================================
@@ -240,7 +240,10 @@ TaylorModel<S>& TVector3<S>::operator [] (size_t i)
 template <typename S>
 TaylorModel<S> TVector3<S>::dot(const TVector3& other) const
 {
-  return i_[0] * other.i_[0] + i_[1] * other.i_[1] + i_[2] * other.i_[2];
+  TaylorModel<S> result(i_[0] * other.i_[0]);
+  result += i_[1] * other.i_[1];
+  result += i_[2] * other.i_[2];
+  return result;
 }
 
 //==============================================================================
@@ -256,7 +259,19 @@ TVector3<S> TVector3<S>::cross(const TVector3<S>& other) const
 template <typename S>
 TaylorModel<S> TVector3<S>::dot(const Vector3<S>& other) const
 {
-  return i_[0] * other[0] + i_[1] * other[1] + i_[2] * other[2];
+  // Accumulate the coefficients directly instead of building a temporary
+  // Taylor model (and copying its time interval pointer) per term
+  TaylorModel<S> result(i_[0].getTimeInterval());
+  for(std::size_t k = 0; k < 4; ++k)
+  {
+    result.coeff(k) = i_[0].coeff(k) * other[0]
+        + i_[1].coeff(k) * other[1]
+        + i_[2].coeff(k) * other[2];
+  }
+  result.remainder() = i_[0].remainder() * other[0]
+      + i_[1].remainder() * other[1]
+      + i_[2].remainder() * other[2];
+  return result;
 }
 
 //==============================================================================
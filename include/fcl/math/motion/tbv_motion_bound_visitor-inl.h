@@ -49,7 +49,17 @@ namespace fcl
 template<typename BV>
 TBVMotionBoundVisitor<BV>::TBVMotionBoundVisitor(
     const BV& bv_, const Vector3<typename BV::S>& n_)
-  : bv(bv_), n(n_)
+  : bv(bv_), n(n_), t0(0), t1(1), has_interval(false)
+{
+  // Do nothing
+}
+
+//==============================================================================
+template<typename BV>
+TBVMotionBoundVisitor<BV>::TBVMotionBoundVisitor(
+    const BV& bv_, const Vector3<typename BV::S>& n_,
+    typename BV::S t0_, typename BV::S t1_)
+  : bv(bv_), n(n_), t0(t0_), t1(t1_), has_interval(true)
 {
   // Do nothing
 }
@@ -128,8 +138,9 @@ struct TBVMotionBoundVisitorVisitImpl<S, RSS<S>, SplineMotion<S>>
       const TBVMotionBoundVisitor<RSS<S>>& visitor,
       const SplineMotion<S>& motion)
   {
-    S T_bound = motion.computeTBound(visitor.n);
-    S tf_t = motion.getCurrentTime();
+    S t0 = visitor.has_interval ? visitor.t0 : motion.getCurrentTime();
+    S t1 = visitor.has_interval ? visitor.t1 : 1;
+    S T_bound = motion.computeTBound(visitor.n, t0, t1);
 
     Vector3<S> c1 = visitor.bv.To;
     Vector3<S> c2 = visitor.bv.To + visitor.bv.axis.col(0) * visitor.bv.l[0];
@@ -166,8 +177,8 @@ struct TBVMotionBoundVisitorVisitImpl<S, RSS<S>, SplineMotion<S>>
     if(tmp > cxn_max) cxn_max = tmp;
     cxn_max = sqrt(cxn_max);
 
-    S dWdW_max = motion.computeDWMax();
-    S ratio = std::min(1 - tf_t, dWdW_max);
+    S dWdW_max = motion.computeDWMax(t0, t1);
+    S ratio = std::min(t1 - t0, dWdW_max);
 
     S R_bound = 2 * (cn_max + cmax + cxn_max + 3 * visitor.bv.r) * ratio;
 
@@ -191,7 +202,10 @@ struct TBVMotionBoundVisitorVisitImpl<S, RSS<S>, ScrewMotion<S>>
       const ScrewMotion<S>& motion)
   {
     Transform3<S> tf;
-    motion.getCurrentTransform(tf);
+    if(visitor.has_interval)
+      tf = motion.evaluate(visitor.t0);
+    else
+      motion.getCurrentTransform(tf);
 
     const Vector3<S>& axis = motion.getAxis();
     S linear_vel = motion.getLinearVelocity();
@@ -232,7 +246,10 @@ struct TBVMotionBoundVisitorVisitImpl<S, RSS<S>, InterpMotion<S>>
       const InterpMotion<S>& motion)
   {
     Transform3<S> tf;
-    motion.getCurrentTransform(tf);
+    if(visitor.has_interval)
+      tf = motion.evaluate(visitor.t0);
+    else
+      motion.getCurrentTransform(tf);
 
     const Vector3<S>& reference_p = motion.getReferencePoint();
     const Vector3<S>& angular_axis = motion.getAngularAxis();
@@ -67,8 +67,15 @@ class FCL_EXPORT TBVMotionBoundVisitor : public BVMotionBoundVisitor<typename BV
 public:
   using S = typename BV::S;
 
+  /// @brief Bound the motion from the motion's current time to 1
   TBVMotionBoundVisitor(const BV& bv_, const Vector3<S>& n_);
 
+  /// @brief Bound the motion over the explicit time interval [t0_, t1_]. The
+  /// motion's current transform is not used, so the same motion may be
+  /// queried concurrently.
+  TBVMotionBoundVisitor(
+      const BV& bv_, const Vector3<S>& n_, S t0_, S t1_);
+
   virtual S visit(const MotionBase<S>& motion) const;
   virtual S visit(const SplineMotion<S>& motion) const;
   virtual S visit(const ScrewMotion<S>& motion) const;
@@ -81,6 +88,10 @@ protected:
 
   BV bv;
   Vector3<S> n;
+
+  /// @brief Time interval of the query, valid if has_interval is true
+  S t0, t1;
+  bool has_interval;
 };
 
 } // namespace fcl
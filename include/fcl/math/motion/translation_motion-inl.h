@@ -40,8 +40,6 @@
 
 #include "fcl/math/motion/translation_motion.h"
 
-#include "fcl/common/unused.h"
-
 namespace fcl
 {
 
@@ -79,15 +77,27 @@ TranslationMotion<S>::TranslationMotion(
 template <typename S>
 bool TranslationMotion<S>::integrate(S dt) const
 {
-  if(dt > 1)
-    dt = 1;
-
-  tf.linear() = rot.toRotationMatrix(); // TODO(JS): necessary?
-  tf.translation() = trans_start + trans_range * dt;
+  tf = evaluate(dt);
 
   return true;
 }
 
+//==============================================================================
+template <typename S>
+Transform3<S> TranslationMotion<S>::evaluate(S t) const
+{
+  if(t > 1)
+    t = 1;
+  else if(t < 0)
+    t = 0;
+
+  Transform3<S> result;
+  result.linear() = rot.toRotationMatrix();
+  result.translation() = trans_start + trans_range * t;
+
+  return result;
+}
+
 //==============================================================================
 template <typename S>
 S TranslationMotion<S>::computeMotionBound(
@@ -115,11 +125,13 @@ void TranslationMotion<S>::getCurrentTransform(Transform3<S>& tf_) const
 template <typename S>
 void TranslationMotion<S>::getTaylorModel(TMatrix3<S>& tm, TVector3<S>& tv) const
 {
-  FCL_UNUSED(tm);
-  FCL_UNUSED(tv);
+  tm = TMatrix3<S>(rot.toRotationMatrix(), this->getTimeInterval());
 
-  // Do nothing
-  // TODO(JS): Not implemented?
+  TaylorModel<S> a(this->getTimeInterval()), b(this->getTimeInterval()), c(this->getTimeInterval());
+  generateTaylorModelForLinearFunc(a, trans_start[0], trans_range[0]);
+  generateTaylorModelForLinearFunc(b, trans_start[1], trans_range[1]);
+  generateTaylorModelForLinearFunc(c, trans_start[2], trans_range[2]);
+  tv = TVector3<S>(a, b, c);
 }
 
 //==============================================================================
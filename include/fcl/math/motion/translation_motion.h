@@ -57,6 +57,8 @@ public:
 
   bool integrate(S dt) const override;
 
+  Transform3<S> evaluate(S t) const override;
+
   S computeMotionBound(
       const BVMotionBoundVisitor<S>& mb_visitor) const override;
 
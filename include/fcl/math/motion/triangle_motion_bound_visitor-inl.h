@@ -58,7 +58,17 @@ template<typename S>
 TriangleMotionBoundVisitor<S>::TriangleMotionBoundVisitor(
     const Vector3<S>& a_, const Vector3<S>& b_,
     const Vector3<S>& c_, const Vector3<S>& n_)
-  : a(a_), b(b_), c(c_), n(n_)
+  : a(a_), b(b_), c(c_), n(n_), t0(0), t1(1), has_interval(false)
+{
+  // Do nothing
+}
+
+//==============================================================================
+template<typename S>
+TriangleMotionBoundVisitor<S>::TriangleMotionBoundVisitor(
+    const Vector3<S>& a_, const Vector3<S>& b_,
+    const Vector3<S>& c_, const Vector3<S>& n_, S t0_, S t1_)
+  : a(a_), b(b_), c(c_), n(n_), t0(t0_), t1(t1_), has_interval(true)
 {
   // Do nothing
 }
@@ -124,7 +134,10 @@ struct TriangleMotionBoundVisitorVisitImpl<S, ScrewMotion<S>>
       const ScrewMotion<S>& motion)
   {
     Transform3<S> tf;
-    motion.getCurrentTransform(tf);
+    if(visitor.has_interval)
+      tf = motion.evaluate(visitor.t0);
+    else
+      motion.getCurrentTransform(tf);
 
     const Vector3<S>& axis = motion.getAxis();
     S linear_vel = motion.getLinearVelocity();
@@ -161,7 +174,10 @@ struct TriangleMotionBoundVisitorVisitImpl<S, InterpMotion<S>>
       const InterpMotion<S>& motion)
   {
     Transform3<S> tf;
-    motion.getCurrentTransform(tf);
+    if(visitor.has_interval)
+      tf = motion.evaluate(visitor.t0);
+    else
+      motion.getCurrentTransform(tf);
 
     const Vector3<S>& reference_p = motion.getReferencePoint();
     const Vector3<S>& angular_axis = motion.getAngularAxis();
@@ -193,8 +209,9 @@ struct TriangleMotionBoundVisitorVisitImpl<S, SplineMotion<S>>
       const TriangleMotionBoundVisitor<S>& visitor,
       const SplineMotion<S>& motion)
   {
-    S T_bound = motion.computeTBound(visitor.n);
-    S tf_t = motion.getCurrentTime();
+    S t0 = visitor.has_interval ? visitor.t0 : motion.getCurrentTime();
+    S t1 = visitor.has_interval ? visitor.t1 : 1;
+    S T_bound = motion.computeTBound(visitor.n, t0, t1);
 
     S R_bound = std::abs(visitor.a.dot(visitor.n)) + visitor.a.norm() + (visitor.a.cross(visitor.n)).norm();
     S R_bound_tmp = std::abs(visitor.b.dot(visitor.n)) + visitor.b.norm() + (visitor.b.cross(visitor.n)).norm();
@@ -202,8 +219,8 @@ struct TriangleMotionBoundVisitorVisitImpl<S, SplineMotion<S>>
     R_bound_tmp = std::abs(visitor.c.dot(visitor.n)) + visitor.c.norm() + (visitor.c.cross(visitor.n)).norm();
     if(R_bound_tmp > R_bound) R_bound = R_bound_tmp;
 
-    S dWdW_max = motion.computeDWMax();
-    S ratio = std::min(1 - tf_t, dWdW_max);
+    S dWdW_max = motion.computeDWMax(t0, t1);
+    S ratio = std::min(t1 - t0, dWdW_max);
 
     R_bound *= 2 * ratio;
 
@@ -74,10 +74,18 @@ template <typename S>
 class FCL_EXPORT TriangleMotionBoundVisitor
 {
 public:
+  /// @brief Bound the motion from the motion's current time to 1
   TriangleMotionBoundVisitor(
       const Vector3<S>& a_, const Vector3<S>& b_,
       const Vector3<S>& c_, const Vector3<S>& n_);
 
+  /// @brief Bound the motion over the explicit time interval [t0_, t1_]. The
+  /// motion's current transform is not used, so the same motion may be
+  /// queried concurrently.
+  TriangleMotionBoundVisitor(
+      const Vector3<S>& a_, const Vector3<S>& b_,
+      const Vector3<S>& c_, const Vector3<S>& n_, S t0_, S t1_);
+
   virtual S visit(const MotionBase<S>& motion) const { FCL_UNUSED(motion); return 0; }
   virtual S visit(const SplineMotion<S>& motion) const;
   virtual S visit(const ScrewMotion<S>& motion) const;
@@ -94,6 +102,10 @@ protected:
   friend struct TriangleMotionBoundVisitorVisitImpl<double, TranslationMotion<double>>;
 
   Vector3<S> a, b, c, n;
+
+  /// @brief Time interval of the query, valid if has_interval is true
+  S t0, t1;
+  bool has_interval;
 };
 
 } // namespace fcl
@@ -0,0 +1,258 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2013-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @author Jia Pan */
+/** @author Jia Pan */
+
+#ifndef FCL_MATH_SAMPLERBASE_INL_H
+#define FCL_MATH_SAMPLERBASE_INL_H
+
+#include "fcl/math/sampler/sampler_base.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "fcl/common/detail/parallel.h"
+#include "fcl/math/detail/low_discrepancy.h"
+#include "fcl/math/detail/seed.h"
+#include "fcl/math/detail/xoshiro256.h"
+
+namespace fcl
+{
+
+//==============================================================================
+extern template
+class FCL_EXPORT SamplerBase<double>;
+
+//==============================================================================
+template <typename S>
+constexpr std::size_t SamplerBase<S>::kBlockSize;
+
+//==============================================================================
+template <typename S>
+SamplerBase<S>::SamplerBase()
+  : sequence_type(SST_RANDOM),
+    stream_seed(detail::Seed::getNextSeed()),
+    batch_count(0),
+    sequence_index(0)
+{
+  // Do nothing
+}
+
+//==============================================================================
+template <typename S>
+void SamplerBase<S>::setSequenceType(SamplingSequenceType type)
+{
+  sequence_type = type;
+}
+
+//==============================================================================
+template <typename S>
+SamplingSequenceType SamplerBase<S>::getSequenceType() const
+{
+  return sequence_type;
+}
+
+//==============================================================================
+template <typename S>
+void SamplerBase<S>::setStreamSeed(std::uint64_t seed)
+{
+  stream_seed = seed;
+  batch_count = 0;
+  sequence_index = 0;
+}
+
+//==============================================================================
+template <typename S>
+std::uint64_t SamplerBase<S>::getStreamSeed() const
+{
+  return stream_seed;
+}
+
+//==============================================================================
+template <typename S>
+void SamplerBase<S>::sampleUnitCube(
+    std::size_t n,
+    std::size_t dim,
+    unsigned int num_threads,
+    MatrixX<S>& u) const
+{
+  u.resize(n, dim);
+
+  const SamplingSequenceType type = sequence_type;
+  const std::uint64_t seed = stream_seed;
+  const std::uint64_t batch = batch_count++;
+  const std::uint64_t first = sequence_index;
+  sequence_index += n;
+
+  // Rounding a double in [0, 1) to float may give 1
+  const S below_one = std::nextafter(S(1), S(0));
+  auto toUnit = [below_one](double value)
+  {
+    return std::min(static_cast<S>(value), below_one);
+  };
+
+  detail::parallelForChunks(n, num_threads, kBlockSize,
+                            [&](unsigned int, std::size_t begin, std::size_t end)
+  {
+    for(std::size_t block_begin = begin; block_begin < end;
+        block_begin += kBlockSize)
+    {
+      const std::size_t block_end = std::min(block_begin + kBlockSize, end);
+      detail::Xoshiro256 generator(seed, batch, block_begin / kBlockSize);
+
+      for(std::size_t j = 0; j < dim; ++j)
+      {
+        if(type == SST_HALTON && j < detail::kHaltonMaxDimension)
+        {
+          for(std::size_t i = block_begin; i < block_end; ++i)
+            u(i, j) = toUnit(detail::haltonPoint(first + i, j));
+        }
+        else if(type == SST_SOBOL && j < detail::kSobolMaxDimension)
+        {
+          std::uint32_t x = detail::sobolPoint(first + block_begin, j);
+          u(block_begin, j) = toUnit(detail::sobolToReal(x));
+          for(std::size_t i = block_begin + 1; i < block_end; ++i)
+          {
+            x = detail::sobolNext(x, first + i - 1, j);
+            u(i, j) = toUnit(detail::sobolToReal(x));
+          }
+        }
+        else
+        {
+          for(std::size_t i = block_begin; i < block_end; ++i)
+            u(i, j) = toUnit(generator.uniform01());
+        }
+      }
+    }
+  });
+}
+
+//==============================================================================
+template <typename S>
+void SamplerBase<S>::mapQuaternion(
+    const MatrixX<S>& u, int col, std::size_t begin, std::size_t end,
+    MatrixX<S>& out, int out_col)
+{
+  const auto n = end - begin;
+  const auto x0 = u.col(col).segment(begin, n).array();
+  const Eigen::Array<S, Eigen::Dynamic, 1> r1 = (S(1) - x0).sqrt();
+  const Eigen::Array<S, Eigen::Dynamic, 1> r2 = x0.sqrt();
+  const Eigen::Array<S, Eigen::Dynamic, 1> t1
+      = 2 * constants<S>::pi() * u.col(col + 1).segment(begin, n).array();
+  const Eigen::Array<S, Eigen::Dynamic, 1> t2
+      = 2 * constants<S>::pi() * u.col(col + 2).segment(begin, n).array();
+
+  out.col(out_col).segment(begin, n) = (t1.sin() * r1).matrix();
+  out.col(out_col + 1).segment(begin, n) = (t1.cos() * r1).matrix();
+  out.col(out_col + 2).segment(begin, n) = (t2.sin() * r2).matrix();
+  out.col(out_col + 3).segment(begin, n) = (t2.cos() * r2).matrix();
+}
+
+//==============================================================================
+template <typename S>
+void SamplerBase<S>::mapEulerAngles(
+    const MatrixX<S>& u, int col, std::size_t begin, std::size_t end,
+    MatrixX<S>& out, int out_col)
+{
+  for(std::size_t i = begin; i < end; ++i)
+  {
+    const S x0 = u(i, col);
+    const S r1 = std::sqrt(1 - x0);
+    const S r2 = std::sqrt(x0);
+    const S t1 = 2 * constants<S>::pi() * u(i, col + 1);
+    const S t2 = 2 * constants<S>::pi() * u(i, col + 2);
+    Quaternion<S> quat(std::sin(t1) * r1, std::cos(t1) * r1,
+                       std::sin(t2) * r2, std::cos(t2) * r2);
+    out.row(i).segment(out_col, 3)
+        = quat.toRotationMatrix().eulerAngles(0, 1, 2).transpose();
+  }
+}
+
+//==============================================================================
+template <typename S>
+void SamplerBase<S>::mapDisk(
+    const MatrixX<S>& u, int col, std::size_t begin, std::size_t end,
+    S r_min, S r_max, MatrixX<S>& out, int out_col)
+{
+  const auto n = end - begin;
+  const auto a = u.col(col).segment(begin, n).array();
+  const Eigen::Array<S, Eigen::Dynamic, 1> r
+      = (a * r_max * r_max + (1 - a) * r_min * r_min).sqrt();
+  const Eigen::Array<S, Eigen::Dynamic, 1> theta
+      = 2 * constants<S>::pi() * u.col(col + 1).segment(begin, n).array();
+
+  out.col(out_col).segment(begin, n) = (r * theta.cos()).matrix();
+  out.col(out_col + 1).segment(begin, n) = (r * theta.sin()).matrix();
+}
+
+//==============================================================================
+template <typename S>
+void SamplerBase<S>::mapBall(
+    const MatrixX<S>& u, int col, std::size_t begin, std::size_t end,
+    S r_min, S r_max, MatrixX<S>& out, int out_col)
+{
+  const auto n = end - begin;
+  const auto a = u.col(col).segment(begin, n).array();
+  const Eigen::Array<S, Eigen::Dynamic, 1> r
+      = (a * std::pow(r_max, 3) + (1 - a) * std::pow(r_min, 3))
+      .pow(S(1) / S(3));
+  const Eigen::Array<S, Eigen::Dynamic, 1> theta
+      = (1 - 2 * u.col(col + 1).segment(begin, n).array()).acos();
+  const Eigen::Array<S, Eigen::Dynamic, 1> phi
+      = 2 * constants<S>::pi() * u.col(col + 2).segment(begin, n).array();
+  const Eigen::Array<S, Eigen::Dynamic, 1> r_sintheta = r * theta.sin();
+
+  out.col(out_col).segment(begin, n) = (r * theta.cos()).matrix();
+  out.col(out_col + 1).segment(begin, n) = (r_sintheta * phi.cos()).matrix();
+  out.col(out_col + 2).segment(begin, n) = (r_sintheta * phi.sin()).matrix();
+}
+
+//==============================================================================
+template <typename S>
+void SamplerBase<S>::mapInterval(
+    const MatrixX<S>& u, int col, std::size_t begin, std::size_t end,
+    S lower_bound, S upper_bound, MatrixX<S>& out, int out_col)
+{
+  const auto n = end - begin;
+  out.col(out_col).segment(begin, n)
+      = ((upper_bound - lower_bound) * u.col(col).segment(begin, n).array()
+         + lower_bound).matrix();
+}
+
+} // namespace fcl
+
+#endif
@@ -34,25 +34,114 @@
  */
 
 /** @author Jia Pan */
+/** @author Jia Pan */
 
 #ifndef FCL_MATH_SAMPLERBASE_H
 #define FCL_MATH_SAMPLERBASE_H
 
+#include <cstddef>
+#include <cstdint>
+
+#include "fcl/common/types.h"
 #include "fcl/math/rng.h"
 
 namespace fcl
 {
 
+/// @brief Sequence the batch sampling functions draw their points from
+enum SamplingSequenceType
+{
+  SST_RANDOM, ///< independent pseudo random points
+  SST_HALTON, ///< Halton low-discrepancy sequence
+  SST_SOBOL   ///< Sobol low-discrepancy sequence
+};
+
 template <typename S>
 class FCL_EXPORT SamplerBase
 {
 public:
+  SamplerBase();
+
+  /// @brief Select the sequence used by sampleBatch(). Quasi-random sequences
+  /// cover the space more evenly than random points for the same number of
+  /// samples; they continue from one call to the next. Dimensions beyond the
+  /// ones tabulated for the sequence fall back to random numbers.
+  void setSequenceType(SamplingSequenceType type);
+
+  SamplingSequenceType getSequenceType() const;
+
+  /// @brief Set the seed of the random streams used by sampleBatch() and
+  /// restart the batch count and the quasi-random sequences. By default the
+  /// seed comes from detail::Seed, so it follows RNG::setSeed().
+  void setStreamSeed(std::uint64_t seed);
+
+  std::uint64_t getStreamSeed() const;
+
   mutable RNG<S> rng;
-};
 
-extern template
-class FCL_EXPORT SamplerBase<double>;
+protected:
+  /// @brief Fill the n x dim matrix u with points of the unit cube [0, 1)^dim,
+  /// one point per row. The rows are generated in fixed blocks, each random
+  /// block drawing from its own stream keyed by (stream seed, batch, block),
+  /// so the result only depends on the seed and the number of previous
+  /// batches, not on num_threads (0 means one thread per core).
+  void sampleUnitCube(
+      std::size_t n,
+      std::size_t dim,
+      unsigned int num_threads,
+      MatrixX<S>& u) const;
+
+  /// @brief Map the uniform columns [col, col + 3) of the rows [begin, end) of
+  /// u to unit quaternions (x, y, z, w), written to the columns
+  /// [out_col, out_col + 4) of out
+  static void mapQuaternion(
+      const MatrixX<S>& u, int col, std::size_t begin, std::size_t end,
+      MatrixX<S>& out, int out_col);
+
+  /// @brief Map the uniform columns [col, col + 3) of the rows [begin, end) of
+  /// u to the Euler angles (0, 1, 2) of uniform random rotations, written to
+  /// the columns [out_col, out_col + 3) of out
+  static void mapEulerAngles(
+      const MatrixX<S>& u, int col, std::size_t begin, std::size_t end,
+      MatrixX<S>& out, int out_col);
+
+  /// @brief Map the uniform columns [col, col + 2) of the rows [begin, end) of
+  /// u to points of the disk with radius from r_min to r_max, written to the
+  /// columns [out_col, out_col + 2) of out
+  static void mapDisk(
+      const MatrixX<S>& u, int col, std::size_t begin, std::size_t end,
+      S r_min, S r_max, MatrixX<S>& out, int out_col);
+
+  /// @brief Map the uniform columns [col, col + 3) of the rows [begin, end) of
+  /// u to points of the ball with radius from r_min to r_max, written to the
+  /// columns [out_col, out_col + 3) of out
+  static void mapBall(
+      const MatrixX<S>& u, int col, std::size_t begin, std::size_t end,
+      S r_min, S r_max, MatrixX<S>& out, int out_col);
+
+  /// @brief Map the uniform column col of the rows [begin, end) of u to
+  /// [lower_bound, upper_bound), written to the column out_col of out
+  static void mapInterval(
+      const MatrixX<S>& u, int col, std::size_t begin, std::size_t end,
+      S lower_bound, S upper_bound, MatrixX<S>& out, int out_col);
+
+  /// @brief Rows per block of the batch sampling functions
+  static constexpr std::size_t kBlockSize = 1024;
+
+private:
+  SamplingSequenceType sequence_type;
+
+  std::uint64_t stream_seed;
+
+  /// @brief Number of batches drawn so far
+  mutable std::uint64_t batch_count;
+
+  /// @brief Index of the next quasi-random point
+  mutable std::uint64_t sequence_index;
+};
 
 } // namespace fcl
 
+#include "fcl/math/sampler/sampler_base-inl.h"
+
 #endif
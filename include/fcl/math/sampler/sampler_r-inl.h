@@ -87,6 +87,24 @@ VectorN<S, N> SamplerR<S, N>::sample() const
   return q;
 }
 
+//==============================================================================
+template <typename S, std::size_t N>
+void SamplerR<S, N>::sampleBatch(
+    std::size_t n, MatrixX<S>& samples, unsigned int num_threads) const
+{
+  this->sampleUnitCube(n, N, num_threads, samples);
+
+  detail::parallelForChunks(n, num_threads, SamplerBase<S>::kBlockSize,
+                            [&](unsigned int, std::size_t begin, std::size_t end)
+  {
+    for(std::size_t i = 0; i < N; ++i)
+    {
+      this->mapInterval(samples, i, begin, end,
+                        lower_bound[i], upper_bound[i], samples, i);
+    }
+  });
+}
+
 } // namespace fcl
 
 #endif
@@ -62,6 +62,11 @@ public:
 
   VectorN<S, N> sample() const;
 
+  /// @brief Draw n samples (N coordinates) into the rows of samples, using
+  /// num_threads threads (0 means one per core)
+  void sampleBatch(std::size_t n, MatrixX<S>& samples,
+                   unsigned int num_threads = 1) const;
+
 private:
   VectorN<S, N> lower_bound;
   VectorN<S, N> upper_bound;
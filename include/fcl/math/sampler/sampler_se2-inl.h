@@ -91,13 +91,34 @@ template <typename S>
 Vector3<S> SamplerSE2<S>::sample() const
 {
   Vector3<S> q;
-  q[0] = this->rng.uniformReal(lower_bound[0], lower_bound[1]);
-  q[1] = this->rng.uniformReal(lower_bound[1], lower_bound[2]);
+  q[0] = this->rng.uniformReal(lower_bound[0], upper_bound[0]);
+  q[1] = this->rng.uniformReal(lower_bound[1], upper_bound[1]);
   q[2] = this->rng.uniformReal(-constants<S>::pi(), constants<S>::pi());
 
   return q;
 }
 
+//==============================================================================
+template <typename S>
+void SamplerSE2<S>::sampleBatch(
+    std::size_t n, MatrixX<S>& samples, unsigned int num_threads) const
+{
+  MatrixX<S> u;
+  this->sampleUnitCube(n, 3, num_threads, u);
+
+  samples.resize(n, 3);
+  detail::parallelForChunks(n, num_threads, SamplerBase<S>::kBlockSize,
+                            [&](unsigned int, std::size_t begin, std::size_t end)
+  {
+    this->mapInterval(u, 0, begin, end,
+                      lower_bound[0], upper_bound[0], samples, 0);
+    this->mapInterval(u, 1, begin, end,
+                      lower_bound[1], upper_bound[1], samples, 1);
+    this->mapInterval(u, 2, begin, end,
+                      -constants<S>::pi(), constants<S>::pi(), samples, 2);
+  });
+}
+
 } // namespace fcl
 
 #endif
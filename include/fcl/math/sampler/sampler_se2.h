@@ -66,6 +66,11 @@ public:
 
   Vector3<S> sample() const;
 
+  /// @brief Draw n samples (x, y, angle) into the rows of samples, using
+  /// num_threads threads (0 means one per core)
+  void sampleBatch(std::size_t n, MatrixX<S>& samples,
+                   unsigned int num_threads = 1) const;
+
 protected:
   Vector2<S> lower_bound;
   Vector2<S> upper_bound;
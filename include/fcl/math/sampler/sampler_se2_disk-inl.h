@@ -85,6 +85,26 @@ Vector3<S> SamplerSE2_disk<S>::sample() const
   return q;
 }
 
+//==============================================================================
+template <typename S>
+void SamplerSE2_disk<S>::sampleBatch(
+    std::size_t n, MatrixX<S>& samples, unsigned int num_threads) const
+{
+  MatrixX<S> u;
+  this->sampleUnitCube(n, 3, num_threads, u);
+
+  samples.resize(n, 3);
+  detail::parallelForChunks(n, num_threads, SamplerBase<S>::kBlockSize,
+                            [&](unsigned int, std::size_t begin, std::size_t end)
+  {
+    this->mapDisk(u, 0, begin, end, r_min, r_max, samples, 0);
+    samples.col(0).segment(begin, end - begin).array() += c[0] - cref[0];
+    samples.col(1).segment(begin, end - begin).array() += c[1] - cref[1];
+    this->mapInterval(u, 2, begin, end,
+                      -constants<S>::pi(), constants<S>::pi(), samples, 2);
+  });
+}
+
 } // namespace fcl
 
 #endif
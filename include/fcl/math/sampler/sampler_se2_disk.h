@@ -60,6 +60,11 @@ public:
 
   Vector3<S> sample() const;
 
+  /// @brief Draw n samples (x, y, angle) into the rows of samples, using
+  /// num_threads threads (0 means one per core)
+  void sampleBatch(std::size_t n, MatrixX<S>& samples,
+                   unsigned int num_threads = 1) const;
+
 protected:
   S c[2];
   S cref[2];
@@ -101,6 +101,27 @@ void SamplerSE3Euler<S>::setBound(const Vector3<S>& lower_bound_, const Vector3<
   upper_bound = upper_bound_;
 }
 
+//==============================================================================
+template <typename S>
+void SamplerSE3Euler<S>::sampleBatch(
+    std::size_t n, MatrixX<S>& samples, unsigned int num_threads) const
+{
+  MatrixX<S> u;
+  this->sampleUnitCube(n, 6, num_threads, u);
+
+  samples.resize(n, 6);
+  detail::parallelForChunks(n, num_threads, SamplerBase<S>::kBlockSize,
+                            [&](unsigned int, std::size_t begin, std::size_t end)
+  {
+    for(int i = 0; i < 3; ++i)
+    {
+      this->mapInterval(u, i, begin, end,
+                        lower_bound[i], upper_bound[i], samples, i);
+    }
+    this->mapEulerAngles(u, 3, begin, end, samples, 3);
+  });
+}
+
 } // namespace fcl
 
 #endif
@@ -98,6 +98,23 @@ Vector6<S> SamplerSE3Euler_ball<S>::sample() const
   return q;
 }
 
+//==============================================================================
+template <typename S>
+void SamplerSE3Euler_ball<S>::sampleBatch(
+    std::size_t n, MatrixX<S>& samples, unsigned int num_threads) const
+{
+  MatrixX<S> u;
+  this->sampleUnitCube(n, 6, num_threads, u);
+
+  samples.resize(n, 6);
+  detail::parallelForChunks(n, num_threads, SamplerBase<S>::kBlockSize,
+                            [&](unsigned int, std::size_t begin, std::size_t end)
+  {
+    this->mapBall(u, 0, begin, end, 0, r, samples, 0);
+    this->mapEulerAngles(u, 3, begin, end, samples, 3);
+  });
+}
+
 } // namespace fcl
 
 #endif
@@ -58,6 +58,11 @@ public:
 
   Vector6<S> sample() const;
 
+  /// @brief Draw n samples (translation, Euler angles) into the rows of samples, using
+  /// num_threads threads (0 means one per core)
+  void sampleBatch(std::size_t n, MatrixX<S>& samples,
+                   unsigned int num_threads = 1) const;
+
 protected:
   S r;
 
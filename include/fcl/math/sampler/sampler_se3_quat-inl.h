@@ -81,9 +81,9 @@ void SamplerSE3Quat<S>::setBound(const Vector3<S>& lower_bound_, const Vector3<S
 
 //==============================================================================
 template <typename S>
-Vector6<S> SamplerSE3Quat<S>::sample() const
+Vector7<S> SamplerSE3Quat<S>::sample() const
 {
-  Vector6<S> q;
+  Vector7<S> q;
   q[0] = this->rng.uniformReal(lower_bound[0], upper_bound[0]);
   q[1] = this->rng.uniformReal(lower_bound[1], upper_bound[1]);
   q[2] = this->rng.uniformReal(lower_bound[2], upper_bound[2]);
@@ -98,6 +98,27 @@ Vector6<S> SamplerSE3Quat<S>::sample() const
   return q;
 }
 
+//==============================================================================
+template <typename S>
+void SamplerSE3Quat<S>::sampleBatch(
+    std::size_t n, MatrixX<S>& samples, unsigned int num_threads) const
+{
+  MatrixX<S> u;
+  this->sampleUnitCube(n, 6, num_threads, u);
+
+  samples.resize(n, 7);
+  detail::parallelForChunks(n, num_threads, SamplerBase<S>::kBlockSize,
+                            [&](unsigned int, std::size_t begin, std::size_t end)
+  {
+    for(int i = 0; i < 3; ++i)
+    {
+      this->mapInterval(u, i, begin, end,
+                        lower_bound[i], upper_bound[i], samples, i);
+    }
+    this->mapQuaternion(u, 3, begin, end, samples, 3);
+  });
+}
+
 } // namespace fcl
 
 #endif
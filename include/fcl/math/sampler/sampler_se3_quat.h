@@ -59,7 +59,12 @@ public:
   void getBound(Vector3<S>& lower_bound_,
                 Vector3<S>& upper_bound_) const;
 
-  Vector6<S> sample() const;
+  Vector7<S> sample() const;
+
+  /// @brief Draw n samples (translation, quaternion (x, y, z, w)) into the rows of samples, using
+  /// num_threads threads (0 means one per core)
+  void sampleBatch(std::size_t n, MatrixX<S>& samples,
+                   unsigned int num_threads = 1) const;
 
 protected:
   Vector3<S> lower_bound;
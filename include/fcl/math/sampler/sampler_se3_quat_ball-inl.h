@@ -96,6 +96,23 @@ Vector7<S> SamplerSE3Quat_ball<S>::sample() const
   return q;
 }
 
+//==============================================================================
+template <typename S>
+void SamplerSE3Quat_ball<S>::sampleBatch(
+    std::size_t n, MatrixX<S>& samples, unsigned int num_threads) const
+{
+  MatrixX<S> u;
+  this->sampleUnitCube(n, 6, num_threads, u);
+
+  samples.resize(n, 7);
+  detail::parallelForChunks(n, num_threads, SamplerBase<S>::kBlockSize,
+                            [&](unsigned int, std::size_t begin, std::size_t end)
+  {
+    this->mapBall(u, 0, begin, end, 0, r, samples, 0);
+    this->mapQuaternion(u, 3, begin, end, samples, 3);
+  });
+}
+
 } // namespace fcl
 
 #endif
@@ -40,9 +40,11 @@
 
 #include "fcl/narrowphase/collision.h"
 
+#include "fcl/common/profiler.h"
 #include "fcl/narrowphase/detail/collision_func_matrix.h"
 #include "fcl/narrowphase/detail/gjk_solver_indep.h"
 #include "fcl/narrowphase/detail/gjk_solver_libccd.h"
+#include "fcl/narrowphase/detail/query_statistics_recorder.h"
 
 namespace fcl
 {
@@ -101,6 +103,11 @@ std::size_t collide(
     const CollisionRequest<S>& request,
     CollisionResult<S>& result)
 {
+  FCL_PROFILE_TIMER(Collide);
+
+  detail::QueryStatisticsRecorder recorder(
+        request.enable_statistics ? &result.statistics : nullptr);
+
   const NarrowPhaseSolver* nsolver = nsolver_;
   if(!nsolver_)
     nsolver = new NarrowPhaseSolver();
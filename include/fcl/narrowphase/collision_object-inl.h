@@ -85,6 +85,17 @@ CollisionObject<S>::CollisionObject(
   computeAABB();
 }
 
+//==============================================================================
+template <typename S>
+template <typename Geometry>
+CollisionObject<S>::CollisionObject(
+    const std::shared_ptr<const Geometry>& cgeom_,
+    const Transform3<S>& tf)
+  : cgeom_const(cgeom_), t(tf)
+{
+  computeAABB();
+}
+
 //==============================================================================
 template <typename S>
 CollisionObject<S>::~CollisionObject()
@@ -96,14 +107,14 @@ CollisionObject<S>::~CollisionObject()
 template <typename S>
 OBJECT_TYPE CollisionObject<S>::getObjectType() const
 {
-  return cgeom->getObjectType();
+  return cgeom_const->getObjectType();
 }
 
 //==============================================================================
 template <typename S>
 NODE_TYPE CollisionObject<S>::getNodeType() const
 {
-  return cgeom->getNodeType();
+  return cgeom_const->getNodeType();
 }
 
 //==============================================================================
@@ -119,12 +130,12 @@ void CollisionObject<S>::computeAABB()
 {
   if(t.linear().isIdentity())
   {
-    aabb = translate(cgeom->aabb_local, t.translation());
+    aabb = translate(cgeom_const->aabb_local, t.translation());
   }
   else
   {
-    Vector3<S> center = t * cgeom->aabb_center;
-    Vector3<S> delta = Vector3<S>::Constant(cgeom->aabb_radius);
+    Vector3<S> center = t * cgeom_const->aabb_center;
+    Vector3<S> delta = Vector3<S>::Constant(cgeom_const->aabb_radius);
     aabb.min_ = center - delta;
     aabb.max_ = center + delta;
   }
@@ -234,7 +245,7 @@ void CollisionObject<S>::setIdentityTransform()
 template <typename S>
 const CollisionGeometry<S>*CollisionObject<S>::getCollisionGeometry() const
 {
-  return cgeom.get();
+  return cgeom_const.get();
 }
 
 //==============================================================================
@@ -249,35 +260,36 @@ CollisionObject<S>::collisionGeometry() const
 template <typename S>
 S CollisionObject<S>::getCostDensity() const
 {
-  return cgeom->cost_density;
+  return cgeom_const->cost_density;
 }
 
 //==============================================================================
 template <typename S>
 void CollisionObject<S>::setCostDensity(S c)
 {
-  cgeom->cost_density = c;
+  if(cgeom)
+    cgeom->cost_density = c;
 }
 
 //==============================================================================
 template <typename S>
 bool CollisionObject<S>::isOccupied() const
 {
-  return cgeom->isOccupied();
+  return cgeom_const->isOccupied();
 }
 
 //==============================================================================
 template <typename S>
 bool CollisionObject<S>::isFree() const
 {
-  return cgeom->isFree();
+  return cgeom_const->isFree();
 }
 
 //==============================================================================
 template <typename S>
 bool CollisionObject<S>::isUncertain() const
 {
-  return cgeom->isUncertain();
+  return cgeom_const->isUncertain();
 }
 
 } // namespace fcl
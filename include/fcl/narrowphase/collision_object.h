@@ -60,6 +60,16 @@ public:
                   const Matrix3<S>& R,
                   const Vector3<S>& T);
 
+  /// @brief Create an instance of an immutable geometry, which may be shared
+  /// by any number of instances and threads. The instance only holds its
+  /// transform and world AABB and never writes the geometry, so the local
+  /// AABB of the geometry must be up to date: BVHModel::endModel() computes
+  /// it, other geometries need one call to computeLocalAABB() before they are
+  /// shared.
+  template <typename Geometry>
+  CollisionObject(const std::shared_ptr<const Geometry>& cgeom,
+                  const Transform3<S>& tf = Transform3<S>::Identity());
+
   ~CollisionObject();
 
   /// @brief get the type of the object
@@ -126,7 +136,8 @@ public:
   /// @brief get object's cost density
   S getCostDensity() const;
 
-  /// @brief set object's cost density
+  /// @brief set object's cost density. The density belongs to the geometry,
+  /// so this has no effect on an instance of an immutable geometry.
   void setCostDensity(S c);
 
   /// @brief whether the object is completely occupied
@@ -140,7 +151,9 @@ public:
 
 protected:
 
+  /// @brief The geometry, if it may be modified through this object
   std::shared_ptr<CollisionGeometry<S>> cgeom;
+
   std::shared_ptr<const CollisionGeometry<S>> cgeom_const;
 
   Transform3<S> t;
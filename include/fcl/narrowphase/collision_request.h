@@ -93,6 +93,10 @@ struct FCL_EXPORT CollisionRequest
   /// a value that is consistent with the precision of `S`.
   Real gjk_tolerance{1e-6};
 
+  /// @brief If true, the work done by the query is added to
+  /// CollisionResult::statistics.
+  bool enable_statistics{false};
+
   /// @brief Default constructor
   CollisionRequest(size_t num_max_contacts_ = 1,
                    bool enable_contact_ = false,
@@ -40,16 +40,20 @@
 
 #include "fcl/narrowphase/continuous_collision.h"
 
-#include "fcl/common/unused.h"
+#include "fcl/common/time.h"
 
 #include "fcl/math/motion/translation_motion.h"
 #include "fcl/math/motion/interp_motion.h"
 #include "fcl/math/motion/screw_motion.h"
 #include "fcl/math/motion/spline_motion.h"
+#include "fcl/math/motion/sphere_motion_bound_visitor.h"
 
 #include "fcl/narrowphase/collision.h"
 #include "fcl/narrowphase/collision_result.h"
+#include "fcl/narrowphase/distance.h"
+#include "fcl/narrowphase/detail/convexity_based_algorithm/gjk_raycast.h"
 #include "fcl/narrowphase/detail/traversal/collision_node.h"
+#include "fcl/narrowphase/detail/traversal/collision/mesh_continuous_collision_query.h"
 
 namespace fcl
 {
@@ -146,11 +150,8 @@ S continuousCollideNaive(
   for(std::size_t i = 0; i < n_iter; ++i)
   {
     S t = i / (S) (n_iter - 1);
-    motion1->integrate(t);
-    motion2->integrate(t);
-
-    motion1->getCurrentTransform(cur_tf1);
-    motion2->getCurrentTransform(cur_tf2);
+    cur_tf1 = motion1->evaluate(t);
+    cur_tf2 = motion2->evaluate(t);
 
     CollisionRequest<S> c_request;
     CollisionResult<S> c_result;
@@ -184,57 +185,26 @@ typename BV::S continuousCollideBVHPolynomial(
     const ContinuousCollisionRequest<typename BV::S>& request,
     ContinuousCollisionResult<typename BV::S>& result)
 {
-  FCL_UNUSED(request);
-
-  using S = typename BV::S;
-
-  const BVHModel<BV>* o1__ = static_cast<const BVHModel<BV>*>(o1_);
-  const BVHModel<BV>* o2__ = static_cast<const BVHModel<BV>*>(o2_);
-
-  // ugly, but lets do it now.
-  BVHModel<BV>* o1 = const_cast<BVHModel<BV>*>(o1__);
-  BVHModel<BV>* o2 = const_cast<BVHModel<BV>*>(o2__);
-  std::vector<Vector3<S>> new_v1(o1->num_vertices);
-  std::vector<Vector3<S>> new_v2(o2->num_vertices);
+  const BVHModel<BV>* o1 = static_cast<const BVHModel<BV>*>(o1_);
+  const BVHModel<BV>* o2 = static_cast<const BVHModel<BV>*>(o2_);
 
-  for(std::size_t i = 0; i < new_v1.size(); ++i)
-    new_v1[i] = o1->vertices[i] + motion1->getVelocity();
-  for(std::size_t i = 0; i < new_v2.size(); ++i)
-    new_v2[i] = o2->vertices[i] + motion2->getVelocity();
-
-  o1->beginUpdateModel();
-  o1->updateSubModel(new_v1);
-  o1->endUpdateModel(true, true);
-
-  o2->beginUpdateModel();
-  o2->updateSubModel(new_v2);
-  o2->endUpdateModel(true, true);
-
-  MeshContinuousCollisionTraversalNode<BV> node;
-  CollisionRequest<S> c_request;
-
-  motion1->integrate(0);
-  motion2->integrate(0);
-  Transform3<S> tf1;
-  Transform3<S> tf2;
-  motion1->getCurrentTransform(tf1);
-  motion2->getCurrentTransform(tf2);
-  if(!initialize<BV>(node, *o1, tf1, *o2, tf2, c_request))
+  if(o1->getModelType() != BVH_MODEL_TRIANGLES
+     || o2->getModelType() != BVH_MODEL_TRIANGLES)
     return -1.0;
 
-  collide(&node);
+  // The models are left untouched; the query sweeps them itself.
+  MeshContinuousCollisionQuery<BV> query(
+      *o1, motion1->evaluate(0), motion1->evaluate(1),
+      *o2, motion2->evaluate(0), motion2->evaluate(1));
+  query.run(request.num_threads);
 
-  result.is_collide = (node.pairs.size() > 0);
-  result.time_of_contact = node.time_of_contact;
+  result.is_collide = query.is_collide;
+  result.time_of_contact = query.time_of_contact;
 
   if(result.is_collide)
   {
-    motion1->integrate(node.time_of_contact);
-    motion2->integrate(node.time_of_contact);
-    motion1->getCurrentTransform(tf1);
-    motion2->getCurrentTransform(tf2);
-    result.contact_tf1 = tf1;
-    result.contact_tf2 = tf2;
+    result.contact_tf1 = motion1->evaluate(query.time_of_contact);
+    result.contact_tf2 = motion2->evaluate(query.time_of_contact);
   }
 
   return result.time_of_contact;
@@ -330,7 +300,9 @@ typename NarrowPhaseSolver::S continuousCollideConservativeAdvancement(
   }
   else
   {
+    const time::point start = time::now();
     res = looktable.conservative_advancement_matrix[node_type1][node_type2](o1, motion1, o2, motion2, nsolver, request, result);
+    result.computation_time = time::seconds(time::now() - start);
   }
 
   if(!nsolver_)
@@ -338,15 +310,8 @@ typename NarrowPhaseSolver::S continuousCollideConservativeAdvancement(
 
   if(result.is_collide)
   {
-    motion1->integrate(result.time_of_contact);
-    motion2->integrate(result.time_of_contact);
-
-    Transform3<S> tf1;
-  Transform3<S> tf2;
-    motion1->getCurrentTransform(tf1);
-    motion2->getCurrentTransform(tf2);
-    result.contact_tf1 = tf1;
-    result.contact_tf2 = tf2;
+    result.contact_tf1 = motion1->evaluate(result.time_of_contact);
+    result.contact_tf2 = motion2->evaluate(result.time_of_contact);
   }
 
   return res;
@@ -381,6 +346,238 @@ S continuousCollideConservativeAdvancement(
   }
 }
 
+namespace detail
+{
+
+//==============================================================================
+template<typename NarrowPhaseSolver>
+FCL_EXPORT
+typename NarrowPhaseSolver::S continuousCollideAdaptiveBisection(
+    const CollisionGeometry<typename NarrowPhaseSolver::S>* o1,
+    const MotionBase<typename NarrowPhaseSolver::S>* motion1,
+    const CollisionGeometry<typename NarrowPhaseSolver::S>* o2,
+    const MotionBase<typename NarrowPhaseSolver::S>* motion2,
+    const NarrowPhaseSolver* nsolver,
+    const ContinuousCollisionRequest<typename NarrowPhaseSolver::S>& request,
+    ContinuousCollisionResult<typename NarrowPhaseSolver::S>& result)
+{
+  using S = typename NarrowPhaseSolver::S;
+
+  // The culling needs the local bounding spheres, i.e. computeLocalAABB()
+  if(o1->aabb_radius <= 0 || o2->aabb_radius <= 0)
+    return continuousCollideNaive(o1, motion1, o2, motion2, request, result);
+
+  // Same time resolution as the uniform sampling of continuousCollideNaive
+  std::size_t n_iter = std::min(request.num_max_iterations, (std::size_t)ceil(1 / request.toc_err));
+  const S min_dt = (n_iter > 1) ? 1 / (S)(n_iter - 1) : (S)1;
+
+  CollisionRequest<S> c_request;
+  CollisionResult<S> c_result;
+  DistanceRequest<S> d_request;
+  DistanceResult<S> d_result;
+
+  auto inCollision = [&](const Transform3<S>& tf1, const Transform3<S>& tf2)
+  {
+    c_result.clear();
+    return fcl::collide(o1, tf1, o2, tf2, nsolver, c_request, c_result) > 0;
+  };
+
+  auto reportContact = [&](S t, const Transform3<S>& tf1, const Transform3<S>& tf2)
+  {
+    result.is_collide = true;
+    result.time_of_contact = t;
+    result.contact_tf1 = tf1;
+    result.contact_tf2 = tf2;
+    return t;
+  };
+
+  // Poses at the start of the current interval, which is always known to be
+  // collision free once the first pose has been tested.
+  S cur_t = 0;
+  Transform3<S> cur_tf1 = motion1->evaluate(0);
+  Transform3<S> cur_tf2 = motion2->evaluate(0);
+  if(inCollision(cur_tf1, cur_tf2))
+    return reportContact(0, cur_tf1, cur_tf2);
+
+  // Intervals are visited in time order, so the first contact found is the
+  // earliest one at this resolution.
+  std::vector<std::pair<S, S>> stack;
+  stack.emplace_back(0, 1);
+  while(!stack.empty())
+  {
+    const S t0 = stack.back().first;
+    const S t1 = stack.back().second;
+    stack.pop_back();
+
+    if(t0 != cur_t)
+    {
+      cur_t = t0;
+      cur_tf1 = motion1->evaluate(t0);
+      cur_tf2 = motion2->evaluate(t0);
+    }
+
+    // How much the two objects can close the gap between them over [t0, t1]
+    const SphereMotionBoundVisitor<S> mb_visitor1(o1->aabb_center, o1->aabb_radius, t0, t1);
+    const SphereMotionBoundVisitor<S> mb_visitor2(o2->aabb_center, o2->aabb_radius, t0, t1);
+    const S reach = (motion1->computeMotionBound(mb_visitor1)
+                     + motion2->computeMotionBound(mb_visitor2)) * (t1 - t0);
+
+    // Cheap test on the bounding spheres first, then on the exact distance
+    const S sphere_distance = (cur_tf1 * o1->aabb_center - cur_tf2 * o2->aabb_center).norm()
+        - o1->aabb_radius - o2->aabb_radius;
+    if(sphere_distance > reach)
+      continue;
+
+    d_result.clear();
+    fcl::distance(o1, cur_tf1, o2, cur_tf2, nsolver, d_request, d_result);
+    if(d_result.min_distance > reach)
+      continue;
+
+    if(t1 - t0 > min_dt)
+    {
+      const S t_mid = (t0 + t1) / 2;
+      stack.emplace_back(t_mid, t1);
+      stack.emplace_back(t0, t_mid);
+      continue;
+    }
+
+    Transform3<S> tf1 = motion1->evaluate(t1);
+    Transform3<S> tf2 = motion2->evaluate(t1);
+    if(!inCollision(tf1, tf2))
+    {
+      cur_t = t1;
+      cur_tf1 = tf1;
+      cur_tf2 = tf2;
+      continue;
+    }
+
+    // Free at t0 and in contact at t1: bisect down to toc_err
+    S lo = t0;
+    S hi = t1;
+    while(hi - lo > request.toc_err)
+    {
+      const S t_mid = (lo + hi) / 2;
+      const Transform3<S> mid_tf1 = motion1->evaluate(t_mid);
+      const Transform3<S> mid_tf2 = motion2->evaluate(t_mid);
+      if(inCollision(mid_tf1, mid_tf2))
+      {
+        hi = t_mid;
+        tf1 = mid_tf1;
+        tf2 = mid_tf2;
+      }
+      else
+      {
+        lo = t_mid;
+      }
+    }
+
+    return reportContact(hi, tf1, tf2);
+  }
+
+  result.is_collide = false;
+  result.time_of_contact = S(1);
+  return result.time_of_contact;
+}
+
+} // namespace detail
+
+//==============================================================================
+/// @brief Adaptive version of continuousCollideNaive. Time intervals in which
+/// the motion bounds of the two objects cannot close the distance between them
+/// are skipped, the others are bisected down to the sampling step of the naive
+/// solver and the first contact is then refined to within toc_err. Like the
+/// naive solver, contacts that begin and end between two samples are missed.
+template <typename S>
+FCL_EXPORT
+S continuousCollideAdaptiveBisection(
+    const CollisionGeometry<S>* o1,
+    const MotionBase<S>* motion1,
+    const CollisionGeometry<S>* o2,
+    const MotionBase<S>* motion2,
+    const ContinuousCollisionRequest<S>& request,
+    ContinuousCollisionResult<S>& result)
+{
+  switch(request.gjk_solver_type)
+  {
+  case GST_LIBCCD:
+    {
+      detail::GJKSolver_libccd<S> solver;
+      return detail::continuousCollideAdaptiveBisection(o1, motion1, o2, motion2, &solver, request, result);
+    }
+  case GST_INDEP:
+    {
+      detail::GJKSolver_indep<S> solver;
+      return detail::continuousCollideAdaptiveBisection(o1, motion1, o2, motion2, &solver, request, result);
+    }
+  default:
+    return -1;
+  }
+}
+
+//==============================================================================
+/// @brief Time of impact of two translating convex shapes, computed by casting
+/// a ray against their Minkowski difference with GJK. The time of contact is a
+/// lower bound of the true one, within toc_err.
+template <typename S>
+FCL_EXPORT
+S continuousCollideRayShooting(
+    const CollisionGeometry<S>* o1,
+    const TranslationMotion<S>* motion1,
+    const CollisionGeometry<S>* o2,
+    const TranslationMotion<S>* motion2,
+    const ContinuousCollisionRequest<S>& request,
+    ContinuousCollisionResult<S>& result)
+{
+  for(const CollisionGeometry<S>* o : {o1, o2})
+  {
+    switch(o->getNodeType())
+    {
+    case GEOM_BOX:
+    case GEOM_SPHERE:
+    case GEOM_ELLIPSOID:
+    case GEOM_CAPSULE:
+    case GEOM_CONE:
+    case GEOM_CYLINDER:
+    case GEOM_CONVEX:
+    case GEOM_TRIANGLE:
+      break;
+    default:
+      std::cerr << "Warning: shape type " << o->getNodeType() << " is not supported by ray shooting CCD" << std::endl;
+      return -1;
+    }
+  }
+
+  const Transform3<S> tf1 = motion1->evaluate(0);
+  const Transform3<S> tf2 = motion2->evaluate(0);
+  const Vector3<S> v1 = motion1->evaluate(1).translation() - tf1.translation();
+  const Vector3<S> v2 = motion2->evaluate(1).translation() - tf2.translation();
+
+  // toc_err is converted into a distance along the relative motion, but not
+  // below the accuracy of the GJK solver
+  const detail::GJKSolver_indep<S> solver;
+  const S tolerance = std::max(request.toc_err * (v1 - v2).norm(), solver.gjk_tolerance);
+
+  S toc;
+  result.is_collide = detail::gjkRaycast(
+        *static_cast<const ShapeBase<S>*>(o1), tf1, v1,
+        *static_cast<const ShapeBase<S>*>(o2), tf2, v2,
+        tolerance, static_cast<unsigned int>(solver.gjk_max_iterations),
+        &toc, &result.contact_point, &result.contact_normal);
+
+  if(result.is_collide)
+  {
+    result.time_of_contact = toc;
+    result.contact_tf1 = motion1->evaluate(toc);
+    result.contact_tf2 = motion2->evaluate(toc);
+  }
+  else
+  {
+    result.time_of_contact = 1;
+  }
+
+  return result.time_of_contact;
+}
+
 //==============================================================================
 template <typename S>
 FCL_EXPORT
@@ -409,7 +606,9 @@ S continuousCollide(
   case CCDC_RAY_SHOOTING:
     if(o1->getObjectType() == OT_GEOM && o2->getObjectType() == OT_GEOM && request.ccd_motion_type == CCDM_TRANS)
     {
-
+      return continuousCollideRayShooting(o1, (const TranslationMotion<S>*)motion1,
+                                          o2, (const TranslationMotion<S>*)motion2,
+                                          request, result);
     }
     else
       std::cerr << "Warning! Invalid continuous collision setting" << std::endl;
@@ -424,6 +623,12 @@ S continuousCollide(
     else
       std::cerr << "Warning! Invalid continuous collision checking" << std::endl;
     break;
+  case CCDC_ADAPTIVE_BISECTION:
+    return continuousCollideAdaptiveBisection(o1, motion1,
+                                              o2, motion2,
+                                              request,
+                                              result);
+    break;
   default:
     std::cerr << "Warning! Invalid continuous collision setting" << std::endl;
   }
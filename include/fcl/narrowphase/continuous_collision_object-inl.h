@@ -47,6 +47,11 @@ namespace fcl
 extern template
 class FCL_EXPORT ContinuousCollisionObject<double>;
 
+//==============================================================================
+extern template
+AABB<double> computeSweptAABB(
+    const AABB<double>& aabb_local, const MotionBase<double>& motion);
+
 //==============================================================================
 template <typename S>
 ContinuousCollisionObject<S>::ContinuousCollisionObject(
@@ -63,7 +68,8 @@ ContinuousCollisionObject<S>::ContinuousCollisionObject(
     const std::shared_ptr<MotionBase<S>>& motion_)
   : cgeom(cgeom_), cgeom_const(cgeom), motion(motion_)
 {
-  // Do nothing
+  cgeom->computeLocalAABB();
+  computeAABB();
 }
 
 //==============================================================================
@@ -98,41 +104,7 @@ const AABB<S>&ContinuousCollisionObject<S>::getAABB() const
 template <typename S>
 void ContinuousCollisionObject<S>::computeAABB()
 {
-  IVector3<S> box;
-  TMatrix3<S> R;
-  TVector3<S> T;
-  motion->getTaylorModel(R, T);
-
-  Vector3<S> p = cgeom->aabb_local.min_;
-  box = (R * p + T).getTightBound();
-
-  p[2] = cgeom->aabb_local.max_[2];
-  box = bound(box, (R * p + T).getTightBound());
-
-  p[1] = cgeom->aabb_local.max_[1];
-  p[2] = cgeom->aabb_local.min_[2];
-  box = bound(box, (R * p + T).getTightBound());
-
-  p[2] = cgeom->aabb_local.max_[2];
-  box = bound(box, (R * p + T).getTightBound());
-
-  p[0] = cgeom->aabb_local.max_[0];
-  p[1] = cgeom->aabb_local.min_[1];
-  p[2] = cgeom->aabb_local.min_[2];
-  box = bound(box, (R * p + T).getTightBound());
-
-  p[2] = cgeom->aabb_local.max_[2];
-  box = bound(box, (R * p + T).getTightBound());
-
-  p[1] = cgeom->aabb_local.max_[1];
-  p[2] = cgeom->aabb_local.min_[2];
-  box = bound(box, (R * p + T).getTightBound());
-
-  p[2] = cgeom->aabb_local.max_[2];
-  box = bound(box, (R * p + T).getTightBound());
-
-  aabb.min_ = box.getLow();
-  aabb.max_ = box.getHigh();
+  aabb = computeSweptAABB(cgeom->aabb_local, *motion);
 }
 
 //==============================================================================
@@ -156,6 +128,13 @@ MotionBase<S>* ContinuousCollisionObject<S>::getMotion() const
   return motion.get();
 }
 
+//==============================================================================
+template <typename S>
+Transform3<S> ContinuousCollisionObject<S>::getTransform(S t) const
+{
+  return motion->evaluate(t);
+}
+
 //==============================================================================
 template <typename S>
 const CollisionGeometry<S>*
@@ -172,6 +151,28 @@ ContinuousCollisionObject<S>::collisionGeometry() const
   return cgeom_const;
 }
 
+//==============================================================================
+template <typename S>
+AABB<S> computeSweptAABB(const AABB<S>& aabb_local, const MotionBase<S>& motion)
+{
+  TMatrix3<S> R;
+  TVector3<S> T;
+  motion.getTaylorModel(R, T);
+
+  // Bound the trajectories of the eight corners of the local box
+  IVector3<S> box;
+  for(int i = 0; i < 8; ++i)
+  {
+    const Vector3<S> p((i & 4) ? aabb_local.max_[0] : aabb_local.min_[0],
+                       (i & 2) ? aabb_local.max_[1] : aabb_local.min_[1],
+                       (i & 1) ? aabb_local.max_[2] : aabb_local.min_[2]);
+    const IVector3<S> corner_box = (R * p + T).getTightBound();
+    box = (i == 0) ? corner_box : bound(box, corner_box);
+  }
+
+  return AABB<S>(box.getLow(), box.getHigh());
+}
+
 } // namespace fcl
 
 #endif
@@ -81,6 +81,10 @@ public:
   /// @brief get motion from the object instance
   MotionBase<S>* getMotion() const;
 
+  /// @brief get the object transform at time t in [0, 1] of the motion; safe
+  /// to call concurrently
+  Transform3<S> getTransform(S t) const;
+
   /// @brief get geometry from the object instance
   FCL_DEPRECATED
   const CollisionGeometry<S>* getCollisionGeometry() const;
@@ -105,6 +109,12 @@ protected:
 using ContinuousCollisionObjectf = ContinuousCollisionObject<float>;
 using ContinuousCollisionObjectd = ContinuousCollisionObject<double>;
 
+/// @brief compute the AABB in the world space swept by aabb_local (given in
+/// the object frame) along the motion, from the Taylor model of the motion
+template <typename S>
+FCL_EXPORT
+AABB<S> computeSweptAABB(const AABB<S>& aabb_local, const MotionBase<S>& motion);
+
 } // namespace fcl
 
 #include "fcl/narrowphase/continuous_collision_object-inl.h"
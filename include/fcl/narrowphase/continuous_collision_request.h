@@ -46,7 +46,9 @@ namespace fcl
 {
 
 enum CCDMotionType {CCDM_TRANS, CCDM_LINEAR, CCDM_SCREW, CCDM_SPLINE};
-enum CCDSolverType {CCDC_NAIVE, CCDC_CONSERVATIVE_ADVANCEMENT, CCDC_RAY_SHOOTING, CCDC_POLYNOMIAL_SOLVER};
+/// @brief CCDC_ADAPTIVE_BISECTION refines the naive sampling only where a
+/// motion bound cannot rule out a contact
+enum CCDSolverType {CCDC_NAIVE, CCDC_CONSERVATIVE_ADVANCEMENT, CCDC_RAY_SHOOTING, CCDC_POLYNOMIAL_SOLVER, CCDC_ADAPTIVE_BISECTION};
 
 template <typename S>
 struct FCL_EXPORT ContinuousCollisionRequest
@@ -60,17 +62,24 @@ struct FCL_EXPORT ContinuousCollisionRequest
   /// @brief ccd motion type
   CCDMotionType ccd_motion_type;
 
-  /// @brief gjk solver type
+  /// @brief gjk solver type. CCDC_CONSERVATIVE_ADVANCEMENT warm-starts each
+  /// GJK query from the previous one only with GST_INDEP; GST_LIBCCD does not
+  /// support warm starts
   GJKSolverType gjk_solver_type;
 
   /// @brief ccd solver type
   CCDSolverType ccd_solver_type;
+
+  /// @brief number of threads used by the polynomial solver for the
+  /// primitive tests (0 means one per hardware core)
+  unsigned int num_threads;
   
   ContinuousCollisionRequest(std::size_t num_max_iterations_ = 10,
                              S toc_err_ = 0.0001,
                              CCDMotionType ccd_motion_type_ = CCDM_TRANS,
                              GJKSolverType gjk_solver_type_ = GST_LIBCCD,
-                             CCDSolverType ccd_solver_type_ = CCDC_NAIVE);
+                             CCDSolverType ccd_solver_type_ = CCDC_NAIVE,
+                             unsigned int num_threads_ = 1);
   
 };
 
@@ -50,7 +50,9 @@ struct ContinuousCollisionResult<double>;
 //==============================================================================
 template <typename S>
 ContinuousCollisionResult<S>::ContinuousCollisionResult()
-  : is_collide(false), time_of_contact(1.0)
+  : is_collide(false), time_of_contact(1.0),
+    contact_point(Vector3<S>::Zero()), contact_normal(Vector3<S>::Zero()),
+    num_iterations(0), computation_time(0)
 {
   // Do nothing
 }
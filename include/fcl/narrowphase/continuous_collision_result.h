@@ -56,6 +56,23 @@ struct FCL_EXPORT ContinuousCollisionResult
   Transform3<S> contact_tf1;
 
   Transform3<S> contact_tf2;
+
+  /// @brief contact point at the time of contact, in the world frame. Only
+  /// computed by CCDC_RAY_SHOOTING
+  Vector3<S> contact_point;
+
+  /// @brief contact normal at the time of contact, pointing from o1 to o2.
+  /// Only computed by CCDC_RAY_SHOOTING, zero if the objects already touch at
+  /// the start of the motion
+  Vector3<S> contact_normal;
+
+  /// @brief number of advancement steps taken before the objects got within
+  /// the time tolerance. Only computed by CCDC_CONSERVATIVE_ADVANCEMENT
+  unsigned int num_iterations;
+
+  /// @brief wall-clock time spent in the query, in seconds. Only computed by
+  /// CCDC_CONSERVATIVE_ADVANCEMENT
+  double computation_time;
   
   ContinuousCollisionResult();
 
@@ -66,6 +66,7 @@
 #include "fcl/narrowphase/detail/traversal/collision/mesh_collision_traversal_node.h"
 #include "fcl/narrowphase/detail/traversal/collision/mesh_continuous_collision_traversal_node.h"
 #include "fcl/narrowphase/detail/traversal/collision/mesh_shape_collision_traversal_node.h"
+#include "fcl/narrowphase/detail/traversal/collision/quantized_mesh_shape_collision_traversal_node.h"
 #include "fcl/narrowphase/detail/traversal/collision/shape_bvh_collision_traversal_node.h"
 #include "fcl/narrowphase/detail/traversal/collision/shape_collision_traversal_node.h"
 #include "fcl/narrowphase/detail/traversal/collision/shape_mesh_collision_traversal_node.h"
@@ -274,6 +275,31 @@ std::size_t BVHOcTreeCollide(
 
 #endif
 
+//==============================================================================
+template <typename Q, typename Shape, typename NarrowPhaseSolver>
+std::size_t QuantizedBVHShapeCollide(
+    const CollisionGeometry<typename Shape::S>* o1,
+    const Transform3<typename Shape::S>& tf1,
+    const CollisionGeometry<typename Shape::S>* o2,
+    const Transform3<typename Shape::S>& tf2,
+    const NarrowPhaseSolver* nsolver,
+    const CollisionRequest<typename Shape::S>& request,
+    CollisionResult<typename Shape::S>& result)
+{
+  using S = typename Shape::S;
+
+  if(request.isSatisfied(result)) return result.numContacts();
+
+  QuantizedMeshShapeCollisionTraversalNode<Q, Shape, NarrowPhaseSolver> node;
+  const QuantizedBVHModel<S, Q>* obj1 = static_cast<const QuantizedBVHModel<S, Q>*>(o1);
+  const Shape* obj2 = static_cast<const Shape*>(o2);
+
+  initialize(node, *obj1, tf1, *obj2, tf2, nsolver, request, result);
+  collide(&node);
+
+  return result.numContacts();
+}
+
 //==============================================================================
 template <typename Shape1, typename Shape2, typename NarrowPhaseSolver>
 std::size_t ShapeShapeCollide(
@@ -334,15 +360,11 @@ struct BVHShapeCollider
 
       MeshShapeCollisionTraversalNode<BV, Shape, NarrowPhaseSolver> node;
       const BVHModel<BV>* obj1 = static_cast<const BVHModel<BV>* >(o1);
-      BVHModel<BV>* obj1_tmp = new BVHModel<BV>(*obj1);
-      Transform3<S> tf1_tmp = tf1;
       const Shape* obj2 = static_cast<const Shape*>(o2);
 
-      initialize(node, *obj1_tmp, tf1_tmp, *obj2, tf2, nsolver, no_cost_request, result);
+      initialize(node, *obj1, tf1, *obj2, tf2, nsolver, no_cost_request, result);
       fcl::detail::collide(&node);
 
-      delete obj1_tmp;
-
       Box<S> box;
       Transform3<S> box_tf;
       constructBox(obj1->getBV(0).bv, tf1, box, box_tf);
@@ -358,14 +380,10 @@ struct BVHShapeCollider
     {
       MeshShapeCollisionTraversalNode<BV, Shape, NarrowPhaseSolver> node;
       const BVHModel<BV>* obj1 = static_cast<const BVHModel<BV>* >(o1);
-      BVHModel<BV>* obj1_tmp = new BVHModel<BV>(*obj1);
-      Transform3<S> tf1_tmp = tf1;
       const Shape* obj2 = static_cast<const Shape*>(o2);
 
-      initialize(node, *obj1_tmp, tf1_tmp, *obj2, tf2, nsolver, request, result);
+      initialize(node, *obj1, tf1, *obj2, tf2, nsolver, request, result);
       fcl::detail::collide(&node);
-
-      delete obj1_tmp;
     }
 
     return result.numContacts();
@@ -521,6 +539,30 @@ struct BVHShapeCollider<OBBRSS<typename Shape::S>, Shape, NarrowPhaseSolver>
   }
 };
 
+//==============================================================================
+template <typename Shape, typename NarrowPhaseSolver>
+struct BVHShapeCollider<FloatOBBRSS<typename Shape::S>, Shape, NarrowPhaseSolver>
+{
+  using S = typename Shape::S;
+
+  static std::size_t collide(
+      const CollisionGeometry<S>* o1,
+      const Transform3<S>& tf1,
+      const CollisionGeometry<S>* o2,
+      const Transform3<S>& tf2,
+      const NarrowPhaseSolver* nsolver,
+      const CollisionRequest<S>& request,
+      CollisionResult<S>& result)
+  {
+    return detail::orientedBVHShapeCollide<
+        MeshShapeCollisionTraversalNodeFloatOBBRSS<Shape, NarrowPhaseSolver>,
+        FloatOBBRSS<S>,
+        Shape,
+        NarrowPhaseSolver>(
+          o1, tf1, o2, tf2, nsolver, request, result);
+  }
+};
+
 //==============================================================================
 template <typename S, typename BV>
 struct BVHCollideImpl
@@ -538,17 +580,10 @@ struct BVHCollideImpl
     MeshCollisionTraversalNode<BV> node;
     const BVHModel<BV>* obj1 = static_cast<const BVHModel<BV>* >(o1);
     const BVHModel<BV>* obj2 = static_cast<const BVHModel<BV>* >(o2);
-    BVHModel<BV>* obj1_tmp = new BVHModel<BV>(*obj1);
-    Transform3<S> tf1_tmp = tf1;
-    BVHModel<BV>* obj2_tmp = new BVHModel<BV>(*obj2);
-    Transform3<S> tf2_tmp = tf2;
 
-    initialize(node, *obj1_tmp, tf1_tmp, *obj2_tmp, tf2_tmp, request, result);
+    initialize(node, *obj1, tf1, *obj2, tf2, request, result);
     collide(&node);
 
-    delete obj1_tmp;
-    delete obj2_tmp;
-
     return result.numContacts();
   }
 };
@@ -625,6 +660,24 @@ struct BVHCollideImpl<S, OBBRSS<S>>
   }
 };
 
+//==============================================================================
+template <typename S>
+struct BVHCollideImpl<S, FloatOBBRSS<S>>
+{
+  static std::size_t run(
+      const CollisionGeometry<S>* o1,
+      const Transform3<S>& tf1,
+      const CollisionGeometry<S>* o2,
+      const Transform3<S>& tf2,
+      const CollisionRequest<S>& request,
+      CollisionResult<S>& result)
+  {
+    return detail::orientedMeshCollide<
+        MeshCollisionTraversalNodeFloatOBBRSS<S>, FloatOBBRSS<S>>(
+            o1, tf1, o2, tf2, request, result);
+  }
+};
+
 //==============================================================================
 template <typename S>
 struct BVHCollideImpl<S, kIOS<S>>
@@ -840,6 +893,16 @@ CollisionFunctionMatrix<NarrowPhaseSolver>::CollisionFunctionMatrix()
   collision_matrix[BV_OBBRSS][GEOM_PLANE] = &BVHShapeCollider<OBBRSS<S>, Plane<S>, NarrowPhaseSolver>::collide;
   collision_matrix[BV_OBBRSS][GEOM_HALFSPACE] = &BVHShapeCollider<OBBRSS<S>, Halfspace<S>, NarrowPhaseSolver>::collide;
 
+  collision_matrix[BV_FLOAT_OBBRSS][GEOM_BOX] = &BVHShapeCollider<FloatOBBRSS<S>, Box<S>, NarrowPhaseSolver>::collide;
+  collision_matrix[BV_FLOAT_OBBRSS][GEOM_SPHERE] = &BVHShapeCollider<FloatOBBRSS<S>, Sphere<S>, NarrowPhaseSolver>::collide;
+  collision_matrix[BV_FLOAT_OBBRSS][GEOM_ELLIPSOID] = &BVHShapeCollider<FloatOBBRSS<S>, Ellipsoid<S>, NarrowPhaseSolver>::collide;
+  collision_matrix[BV_FLOAT_OBBRSS][GEOM_CAPSULE] = &BVHShapeCollider<FloatOBBRSS<S>, Capsule<S>, NarrowPhaseSolver>::collide;
+  collision_matrix[BV_FLOAT_OBBRSS][GEOM_CONE] = &BVHShapeCollider<FloatOBBRSS<S>, Cone<S>, NarrowPhaseSolver>::collide;
+  collision_matrix[BV_FLOAT_OBBRSS][GEOM_CYLINDER] = &BVHShapeCollider<FloatOBBRSS<S>, Cylinder<S>, NarrowPhaseSolver>::collide;
+  collision_matrix[BV_FLOAT_OBBRSS][GEOM_CONVEX] = &BVHShapeCollider<FloatOBBRSS<S>, Convex<S>, NarrowPhaseSolver>::collide;
+  collision_matrix[BV_FLOAT_OBBRSS][GEOM_PLANE] = &BVHShapeCollider<FloatOBBRSS<S>, Plane<S>, NarrowPhaseSolver>::collide;
+  collision_matrix[BV_FLOAT_OBBRSS][GEOM_HALFSPACE] = &BVHShapeCollider<FloatOBBRSS<S>, Halfspace<S>, NarrowPhaseSolver>::collide;
+
   collision_matrix[BV_AABB][BV_AABB] = &BVHCollide<AABB<S>, NarrowPhaseSolver>;
   collision_matrix[BV_OBB][BV_OBB] = &BVHCollide<OBB<S>, NarrowPhaseSolver>;
   collision_matrix[BV_RSS][BV_RSS] = &BVHCollide<RSS<S>, NarrowPhaseSolver>;
@@ -848,6 +911,27 @@ CollisionFunctionMatrix<NarrowPhaseSolver>::CollisionFunctionMatrix()
   collision_matrix[BV_KDOP24][BV_KDOP24] = &BVHCollide<KDOP<S, 24>, NarrowPhaseSolver>;
   collision_matrix[BV_kIOS][BV_kIOS] = &BVHCollide<kIOS<S>, NarrowPhaseSolver>;
   collision_matrix[BV_OBBRSS][BV_OBBRSS] = &BVHCollide<OBBRSS<S>, NarrowPhaseSolver>;
+  collision_matrix[BV_FLOAT_OBBRSS][BV_FLOAT_OBBRSS] = &BVHCollide<FloatOBBRSS<S>, NarrowPhaseSolver>;
+
+  collision_matrix[BV_QUANTIZED8][GEOM_BOX] = &QuantizedBVHShapeCollide<std::uint8_t, Box<S>, NarrowPhaseSolver>;
+  collision_matrix[BV_QUANTIZED8][GEOM_SPHERE] = &QuantizedBVHShapeCollide<std::uint8_t, Sphere<S>, NarrowPhaseSolver>;
+  collision_matrix[BV_QUANTIZED8][GEOM_ELLIPSOID] = &QuantizedBVHShapeCollide<std::uint8_t, Ellipsoid<S>, NarrowPhaseSolver>;
+  collision_matrix[BV_QUANTIZED8][GEOM_CAPSULE] = &QuantizedBVHShapeCollide<std::uint8_t, Capsule<S>, NarrowPhaseSolver>;
+  collision_matrix[BV_QUANTIZED8][GEOM_CONE] = &QuantizedBVHShapeCollide<std::uint8_t, Cone<S>, NarrowPhaseSolver>;
+  collision_matrix[BV_QUANTIZED8][GEOM_CYLINDER] = &QuantizedBVHShapeCollide<std::uint8_t, Cylinder<S>, NarrowPhaseSolver>;
+  collision_matrix[BV_QUANTIZED8][GEOM_CONVEX] = &QuantizedBVHShapeCollide<std::uint8_t, Convex<S>, NarrowPhaseSolver>;
+  collision_matrix[BV_QUANTIZED8][GEOM_PLANE] = &QuantizedBVHShapeCollide<std::uint8_t, Plane<S>, NarrowPhaseSolver>;
+  collision_matrix[BV_QUANTIZED8][GEOM_HALFSPACE] = &QuantizedBVHShapeCollide<std::uint8_t, Halfspace<S>, NarrowPhaseSolver>;
+
+  collision_matrix[BV_QUANTIZED16][GEOM_BOX] = &QuantizedBVHShapeCollide<std::uint16_t, Box<S>, NarrowPhaseSolver>;
+  collision_matrix[BV_QUANTIZED16][GEOM_SPHERE] = &QuantizedBVHShapeCollide<std::uint16_t, Sphere<S>, NarrowPhaseSolver>;
+  collision_matrix[BV_QUANTIZED16][GEOM_ELLIPSOID] = &QuantizedBVHShapeCollide<std::uint16_t, Ellipsoid<S>, NarrowPhaseSolver>;
+  collision_matrix[BV_QUANTIZED16][GEOM_CAPSULE] = &QuantizedBVHShapeCollide<std::uint16_t, Capsule<S>, NarrowPhaseSolver>;
+  collision_matrix[BV_QUANTIZED16][GEOM_CONE] = &QuantizedBVHShapeCollide<std::uint16_t, Cone<S>, NarrowPhaseSolver>;
+  collision_matrix[BV_QUANTIZED16][GEOM_CYLINDER] = &QuantizedBVHShapeCollide<std::uint16_t, Cylinder<S>, NarrowPhaseSolver>;
+  collision_matrix[BV_QUANTIZED16][GEOM_CONVEX] = &QuantizedBVHShapeCollide<std::uint16_t, Convex<S>, NarrowPhaseSolver>;
+  collision_matrix[BV_QUANTIZED16][GEOM_PLANE] = &QuantizedBVHShapeCollide<std::uint16_t, Plane<S>, NarrowPhaseSolver>;
+  collision_matrix[BV_QUANTIZED16][GEOM_HALFSPACE] = &QuantizedBVHShapeCollide<std::uint16_t, Halfspace<S>, NarrowPhaseSolver>;
 
 #if FCL_HAVE_OCTOMAP
   collision_matrix[GEOM_OCTREE][GEOM_BOX] = &OcTreeShapeCollide<Box<S>, NarrowPhaseSolver>;
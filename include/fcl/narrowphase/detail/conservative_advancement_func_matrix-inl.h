@@ -40,6 +40,8 @@
 
 #include "fcl/narrowphase/detail/conservative_advancement_func_matrix.h"
 
+#include <algorithm>
+
 #include "fcl/common/unused.h"
 
 #include "fcl/narrowphase/collision_object.h"
@@ -70,6 +72,52 @@ namespace fcl
 namespace detail
 {
 
+//==============================================================================
+/// @brief Index of the leaf BV holding each triangle of a BVH model
+template <typename BV>
+std::vector<int> getTriangleLeaves(const BVHModel<BV>& model)
+{
+  std::vector<int> leaves(model.num_tris, -1);
+  for(int i = 0; i < model.getNumBVs(); ++i)
+  {
+    const BVNode<BV>& bv = model.getBV(i);
+    if(bv.isLeaf())
+      leaves[bv.primitiveId()] = i;
+  }
+
+  return leaves;
+}
+
+//==============================================================================
+/// @brief Enable the cached guess of a solver for the lifetime of the object,
+/// then restore the cached guess state the solver had before
+template <typename NarrowPhaseSolver>
+class ScopedCachedGuess
+{
+public:
+  explicit ScopedCachedGuess(const NarrowPhaseSolver* solver)
+    : solver_(solver),
+      enabled_(solver->isCachedGuessEnabled()),
+      guess_(solver->getCachedGuess())
+  {
+    solver_->enableCachedGuess(true);
+  }
+
+  ~ScopedCachedGuess()
+  {
+    solver_->setCachedGuess(guess_);
+    solver_->enableCachedGuess(enabled_);
+  }
+
+  ScopedCachedGuess(const ScopedCachedGuess&) = delete;
+  ScopedCachedGuess& operator=(const ScopedCachedGuess&) = delete;
+
+private:
+  const NarrowPhaseSolver* solver_;
+  bool enabled_;
+  Vector3<typename NarrowPhaseSolver::S> guess_;
+};
+
 //==============================================================================
 template<typename BV>
 bool conservativeAdvancement(const BVHModel<BV>& o1,
@@ -78,19 +126,19 @@ bool conservativeAdvancement(const BVHModel<BV>& o1,
                              const MotionBase<typename BV::S>* motion2,
                              const CollisionRequest<typename BV::S>& request,
                              CollisionResult<typename BV::S>& result,
-                             typename BV::S& toc)
+                             typename BV::S& toc,
+                             unsigned int* num_iterations = nullptr)
 {
   using S = typename BV::S;
 
-  Transform3<S> tf1;
-  Transform3<S> tf2;
-  motion1->getCurrentTransform(tf1);
-  motion2->getCurrentTransform(tf2);
+  Transform3<S> tf1 = motion1->evaluate(0);
+  Transform3<S> tf2 = motion2->evaluate(0);
 
   // whether the first start configuration is in collision
   if(collide(&o1, tf1, &o2, tf2, request, result))
   {
     toc = 0;
+    if(num_iterations) *num_iterations = 0;
     return true;
   }
 
@@ -104,8 +152,12 @@ bool conservativeAdvancement(const BVHModel<BV>& o1,
   node.motion1 = motion1;
   node.motion2 = motion2;
 
+  unsigned int iterations = 0;
+
   do
   {
+    ++iterations;
+
     // repeatedly update mesh to global coordinate, so time consuming
     initialize(node, *o1_tmp, tf1, *o2_tmp, tf2);
 
@@ -127,14 +179,13 @@ bool conservativeAdvancement(const BVHModel<BV>& o1,
       break;
     }
 
-    node.motion1->integrate(node.toc);
-    node.motion2->integrate(node.toc);
-
-    motion1->getCurrentTransform(tf1);
-    motion2->getCurrentTransform(tf2);
+    tf1 = motion1->evaluate(node.toc);
+    tf2 = motion2->evaluate(node.toc);
   }
   while(1);
 
+  if(num_iterations) *num_iterations = iterations;
+
   delete o1_tmp;
   delete o2_tmp;
 
@@ -153,19 +204,19 @@ bool conservativeAdvancementMeshOriented(const BVHModel<BV>& o1,
                                          const MotionBase<typename BV::S>* motion2,
                                          const CollisionRequest<typename BV::S>& request,
                                          CollisionResult<typename BV::S>& result,
-                                         typename BV::S& toc)
+                                         typename BV::S& toc,
+                                         unsigned int* num_iterations = nullptr)
 {
   using S = typename BV::S;
 
-  Transform3<S> tf1;
-  Transform3<S> tf2;
-  motion1->getCurrentTransform(tf1);
-  motion2->getCurrentTransform(tf2);
+  Transform3<S> tf1 = motion1->evaluate(0);
+  Transform3<S> tf2 = motion2->evaluate(0);
 
   // whether the first start configuration is in collision
   if(collide(&o1, tf1, &o2, tf2, request, result))
   {
     toc = 0;
+    if(num_iterations) *num_iterations = 0;
     return true;
   }
 
@@ -177,10 +228,14 @@ bool conservativeAdvancementMeshOriented(const BVHModel<BV>& o1,
   node.motion1 = motion1;
   node.motion2 = motion2;
 
+  unsigned int iterations = 0;
+
   do
   {
-    node.motion1->getCurrentTransform(tf1);
-    node.motion2->getCurrentTransform(tf2);
+    ++iterations;
+
+    tf1 = node.motion1->evaluate(node.toc);
+    tf2 = node.motion2->evaluate(node.toc);
 
     // compute the transformation from 1 to 2
     Transform3<S> tf = tf1.inverse(Eigen::Isometry) * tf2;
@@ -204,12 +259,11 @@ bool conservativeAdvancementMeshOriented(const BVHModel<BV>& o1,
       node.toc = 1;
       break;
     }
-
-    node.motion1->integrate(node.toc);
-    node.motion2->integrate(node.toc);
   }
   while(1);
 
+  if(num_iterations) *num_iterations = iterations;
+
   toc = node.toc;
 
   if(node.toc < 1)
@@ -226,19 +280,19 @@ bool conservativeAdvancement(const Shape1& o1,
                              const NarrowPhaseSolver* solver,
                              const CollisionRequest<typename Shape1::S>& request,
                              CollisionResult<typename Shape1::S>& result,
-                             typename Shape1::S& toc)
+                             typename Shape1::S& toc,
+                             unsigned int* num_iterations = nullptr)
 {
   using S = typename Shape1::S;
 
-  Transform3<S> tf1;
-  Transform3<S> tf2;
-  motion1->getCurrentTransform(tf1);
-  motion2->getCurrentTransform(tf2);
+  Transform3<S> tf1 = motion1->evaluate(0);
+  Transform3<S> tf2 = motion2->evaluate(0);
 
   // whether the first start configuration is in collision
   if(collide(&o1, tf1, &o2, tf2, request, result))
   {
     toc = 0;
+    if(num_iterations) *num_iterations = 0;
     return true;
   }
 
@@ -249,10 +303,19 @@ bool conservativeAdvancement(const Shape1& o1,
   node.motion1 = motion1;
   node.motion2 = motion2;
 
+  // Each iteration queries the same pair at a slightly advanced pose, so GJK
+  // is warm-started from the simplex of the previous one. The libccd solver
+  // does not support warm starts and ignores this.
+  ScopedCachedGuess<NarrowPhaseSolver> cached_guess(solver);
+
+  unsigned int iterations = 0;
+
   do
   {
-    motion1->getCurrentTransform(tf1);
-    motion2->getCurrentTransform(tf2);
+    ++iterations;
+
+    tf1 = motion1->evaluate(node.toc);
+    tf2 = motion2->evaluate(node.toc);
     node.tf1 = tf1;
     node.tf2 = tf2;
 
@@ -273,12 +336,11 @@ bool conservativeAdvancement(const Shape1& o1,
       node.toc = 1;
       break;
     }
-
-    node.motion1->integrate(node.toc);
-    node.motion2->integrate(node.toc);
   }
   while(1);
 
+  if(num_iterations) *num_iterations = iterations;
+
   toc = node.toc;
 
   if(node.toc < 1)
@@ -295,36 +357,54 @@ bool conservativeAdvancement(const BVHModel<BV>& o1,
                              const NarrowPhaseSolver* nsolver,
                              const CollisionRequest<typename BV::S>& request,
                              CollisionResult<typename BV::S>& result,
-                             typename BV::S& toc)
+                             typename BV::S& toc,
+                             unsigned int* num_iterations = nullptr)
 {
   using S = typename BV::S;
 
-  Transform3<S> tf1;
-  Transform3<S> tf2;
-  motion1->getCurrentTransform(tf1);
-  motion2->getCurrentTransform(tf2);
+  Transform3<S> tf1 = motion1->evaluate(0);
+  Transform3<S> tf2 = motion2->evaluate(0);
 
   if(collide(&o1, tf1, &o2, tf2, request, result))
   {
     toc = 0;
+    if(num_iterations) *num_iterations = 0;
     return true;
   }
 
   BVHModel<BV>* o1_tmp = new BVHModel<BV>(o1);
+  const std::vector<int> leaves = getTriangleLeaves(o1);
 
   MeshShapeConservativeAdvancementTraversalNode<BV, Shape, NarrowPhaseSolver> node;
 
   node.motion1 = motion1;
   node.motion2 = motion2;
 
+  // The triangles met by successive iterations are close to each other, so
+  // GJK is warm-started from the simplex of the previous query. The libccd
+  // solver does not support warm starts and ignores this.
+  ScopedCachedGuess<NarrowPhaseSolver> cached_guess(nsolver);
+
+  unsigned int iterations = 0;
+
   do
   {
-    // initialize update mesh to global coordinate, so time consuming
+    ++iterations;
+
+    // initialize update mesh to global coordinate, so time consuming. It
+    // transforms the vertices in place, so they are first reset to the model
+    // frame.
+    std::copy(o1.vertices, o1.vertices + o1.num_vertices, o1_tmp->vertices);
     initialize(node, *o1_tmp, tf1, o2, tf2, nsolver);
 
     node.delta_t = 1;
     node.min_distance = std::numeric_limits<S>::max();
 
+    // Start from the closest triangle of the previous iteration: the distance
+    // it gives lets the traversal cull most of the other BVs right away.
+    if(node.last_tri_id >= 0)
+      node.leafTesting(leaves[node.last_tri_id], 0);
+
     distanceRecurse<S>(&node, 0, 0, nullptr);
 
     if(node.delta_t <= node.t_err)
@@ -339,14 +419,13 @@ bool conservativeAdvancement(const BVHModel<BV>& o1,
       break;
     }
 
-    node.motion1->integrate(node.toc);
-    node.motion2->integrate(node.toc);
-
-    motion1->getCurrentTransform(tf1);
-    motion2->getCurrentTransform(tf2);
+    tf1 = motion1->evaluate(node.toc);
+    tf2 = motion2->evaluate(node.toc);
   }
   while(1);
 
+  if(num_iterations) *num_iterations = iterations;
+
   delete o1_tmp;
 
   toc = node.toc;
@@ -365,18 +444,18 @@ bool conservativeAdvancementMeshShapeOriented(const BVHModel<BV>& o1,
                                               const NarrowPhaseSolver* nsolver,
                                               const CollisionRequest<typename BV::S>& request,
                                               CollisionResult<typename BV::S>& result,
-                                              typename BV::S& toc)
+                                              typename BV::S& toc,
+                                              unsigned int* num_iterations = nullptr)
 {
   using S = typename BV::S;
 
-  Transform3<S> tf1;
-  Transform3<S> tf2;
-  motion1->getCurrentTransform(tf1);
-  motion2->getCurrentTransform(tf2);
+  Transform3<S> tf1 = motion1->evaluate(0);
+  Transform3<S> tf2 = motion2->evaluate(0);
 
   if(collide(&o1, tf1, &o2, tf2, request, result))
   {
     toc = 0;
+    if(num_iterations) *num_iterations = 0;
     return true;
   }
 
@@ -387,10 +466,18 @@ bool conservativeAdvancementMeshShapeOriented(const BVHModel<BV>& o1,
   node.motion1 = motion1;
   node.motion2 = motion2;
 
+  const std::vector<int> leaves = getTriangleLeaves(o1);
+
+  ScopedCachedGuess<NarrowPhaseSolver> cached_guess(nsolver);
+
+  unsigned int iterations = 0;
+
   do
   {
-    node.motion1->getCurrentTransform(tf1);
-    node.motion2->getCurrentTransform(tf2);
+    ++iterations;
+
+    tf1 = node.motion1->evaluate(node.toc);
+    tf2 = node.motion2->evaluate(node.toc);
 
     node.tf1 = tf1;
     node.tf2 = tf2;
@@ -398,6 +485,9 @@ bool conservativeAdvancementMeshShapeOriented(const BVHModel<BV>& o1,
     node.delta_t = 1;
     node.min_distance = std::numeric_limits<S>::max();
 
+    if(node.last_tri_id >= 0)
+      node.leafTesting(leaves[node.last_tri_id], 0);
+
     distanceRecurse(&node, 0, 0, nullptr);
 
     if(node.delta_t <= node.t_err)
@@ -411,12 +501,11 @@ bool conservativeAdvancementMeshShapeOriented(const BVHModel<BV>& o1,
       node.toc = 1;
       break;
     }
-
-    node.motion1->integrate(node.toc);
-    node.motion2->integrate(node.toc);
   }
   while(1);
 
+  if(num_iterations) *num_iterations = iterations;
+
   toc = node.toc;
 
   if(node.toc < 1)
@@ -433,11 +522,12 @@ bool conservativeAdvancement(const BVHModel<RSS<typename Shape::S>>& o1,
                              const NarrowPhaseSolver* nsolver,
                              const CollisionRequest<typename Shape::S>& request,
                              CollisionResult<typename Shape::S>& result,
-                             typename Shape::S& toc)
+                             typename Shape::S& toc,
+                             unsigned int* num_iterations = nullptr)
 {
   using S = typename Shape::S;
 
-  return detail::conservativeAdvancementMeshShapeOriented<RSS<S>, Shape, NarrowPhaseSolver, MeshShapeConservativeAdvancementTraversalNodeRSS<Shape, NarrowPhaseSolver> >(o1, motion1, o2, motion2, nsolver, request, result, toc);
+  return detail::conservativeAdvancementMeshShapeOriented<RSS<S>, Shape, NarrowPhaseSolver, MeshShapeConservativeAdvancementTraversalNodeRSS<Shape, NarrowPhaseSolver> >(o1, motion1, o2, motion2, nsolver, request, result, toc, num_iterations);
 }
 
 template<typename Shape, typename NarrowPhaseSolver>
@@ -448,11 +538,12 @@ bool conservativeAdvancement(const BVHModel<OBBRSS<typename Shape::S>>& o1,
                              const NarrowPhaseSolver* nsolver,
                              const CollisionRequest<typename Shape::S>& request,
                              CollisionResult<typename Shape::S>& result,
-                             typename Shape::S& toc)
+                             typename Shape::S& toc,
+                             unsigned int* num_iterations = nullptr)
 {
   using S = typename Shape::S;
 
-  return detail::conservativeAdvancementMeshShapeOriented<OBBRSS<S>, Shape, NarrowPhaseSolver, MeshShapeConservativeAdvancementTraversalNodeOBBRSS<Shape, NarrowPhaseSolver> >(o1, motion1, o2, motion2, nsolver, request, result, toc);
+  return detail::conservativeAdvancementMeshShapeOriented<OBBRSS<S>, Shape, NarrowPhaseSolver, MeshShapeConservativeAdvancementTraversalNodeOBBRSS<Shape, NarrowPhaseSolver> >(o1, motion1, o2, motion2, nsolver, request, result, toc, num_iterations);
 }
 
 template<typename Shape, typename BV, typename NarrowPhaseSolver>
@@ -463,36 +554,47 @@ bool conservativeAdvancement(const Shape& o1,
                              const NarrowPhaseSolver* nsolver,
                              const CollisionRequest<typename BV::S>& request,
                              CollisionResult<typename BV::S>& result,
-                             typename BV::S& toc)
+                             typename BV::S& toc,
+                             unsigned int* num_iterations = nullptr)
 {
   using S = typename BV::S;
 
-  Transform3<S> tf1;
-  Transform3<S> tf2;
-  motion1->getCurrentTransform(tf1);
-  motion2->getCurrentTransform(tf2);
+  Transform3<S> tf1 = motion1->evaluate(0);
+  Transform3<S> tf2 = motion2->evaluate(0);
 
   if(collide(&o1, tf1, &o2, tf2, request, result))
   {
     toc = 0;
+    if(num_iterations) *num_iterations = 0;
     return true;
   }
 
   BVHModel<BV>* o2_tmp = new BVHModel<BV>(o2);
+  const std::vector<int> leaves = getTriangleLeaves(o2);
 
   ShapeMeshConservativeAdvancementTraversalNode<Shape, BV, NarrowPhaseSolver> node;
 
   node.motion1 = motion1;
   node.motion2 = motion2;
 
+  ScopedCachedGuess<NarrowPhaseSolver> cached_guess(nsolver);
+
+  unsigned int iterations = 0;
+
   do
   {
+    ++iterations;
+
     // initialize update mesh to global coordinate, so time consuming
+    std::copy(o2.vertices, o2.vertices + o2.num_vertices, o2_tmp->vertices);
     initialize(node, o1, tf1, *o2_tmp, tf2, nsolver);
 
     node.delta_t = 1;
     node.min_distance = std::numeric_limits<S>::max();
 
+    if(node.last_tri_id >= 0)
+      node.leafTesting(0, leaves[node.last_tri_id]);
+
     distanceRecurse(&node, 0, 0, nullptr);
 
     if(node.delta_t <= node.t_err)
@@ -507,14 +609,13 @@ bool conservativeAdvancement(const Shape& o1,
       break;
     }
 
-    node.motion1->integrate(node.toc);
-    node.motion2->integrate(node.toc);
-
-    motion1->getCurrentTransform(tf1);
-    motion2->getCurrentTransform(tf2);
+    tf1 = motion1->evaluate(node.toc);
+    tf2 = motion2->evaluate(node.toc);
   }
   while(1);
 
+  if(num_iterations) *num_iterations = iterations;
+
   delete o2_tmp;
 
   toc = node.toc;
@@ -533,17 +634,17 @@ bool conservativeAdvancementShapeMeshOriented(const Shape& o1,
                                               const NarrowPhaseSolver* nsolver,
                                               const CollisionRequest<typename BV::S>& request,
                                               CollisionResult<typename BV::S>& result,
-                                              typename BV::S& toc)
+                                              typename BV::S& toc,
+                                              unsigned int* num_iterations = nullptr)
 {
   using S = typename BV::S;
-  Transform3<S> tf1;
-  Transform3<S> tf2;
-  motion1->getCurrentTransform(tf1);
-  motion2->getCurrentTransform(tf2);
+  Transform3<S> tf1 = motion1->evaluate(0);
+  Transform3<S> tf2 = motion2->evaluate(0);
 
   if(collide(&o1, tf1, &o2, tf2, request, result))
   {
     toc = 0;
+    if(num_iterations) *num_iterations = 0;
     return true;
   }
 
@@ -554,10 +655,18 @@ bool conservativeAdvancementShapeMeshOriented(const Shape& o1,
   node.motion1 = motion1;
   node.motion2 = motion2;
 
+  const std::vector<int> leaves = getTriangleLeaves(o2);
+
+  ScopedCachedGuess<NarrowPhaseSolver> cached_guess(nsolver);
+
+  unsigned int iterations = 0;
+
   do
   {
-    node.motion1->getCurrentTransform(tf1);
-    node.motion2->getCurrentTransform(tf2);
+    ++iterations;
+
+    tf1 = node.motion1->evaluate(node.toc);
+    tf2 = node.motion2->evaluate(node.toc);
 
     node.tf1 = tf1;
     node.tf2 = tf2;
@@ -565,6 +674,9 @@ bool conservativeAdvancementShapeMeshOriented(const Shape& o1,
     node.delta_t = 1;
     node.min_distance = std::numeric_limits<S>::max();
 
+    if(node.last_tri_id >= 0)
+      node.leafTesting(0, leaves[node.last_tri_id]);
+
     distanceRecurse(&node, 0, 0, nullptr);
 
     if(node.delta_t <= node.t_err)
@@ -578,12 +690,11 @@ bool conservativeAdvancementShapeMeshOriented(const Shape& o1,
       node.toc = 1;
       break;
     }
-
-    node.motion1->integrate(node.toc);
-    node.motion2->integrate(node.toc);
   }
   while(1);
 
+  if(num_iterations) *num_iterations = iterations;
+
   toc = node.toc;
 
   if(node.toc < 1)
@@ -604,9 +715,10 @@ struct ConservativeAdvancementImpl
       const NarrowPhaseSolver* nsolver,
       const CollisionRequest<S>& request,
       CollisionResult<S>& result,
-      S& toc)
+      S& toc,
+      unsigned int* num_iterations = nullptr)
   {
-    return detail::conservativeAdvancementShapeMeshOriented<Shape, RSS<S>, NarrowPhaseSolver, ShapeMeshConservativeAdvancementTraversalNodeRSS<Shape, NarrowPhaseSolver> >(o1, motion1, o2, motion2, nsolver, request, result, toc);
+    return detail::conservativeAdvancementShapeMeshOriented<Shape, RSS<S>, NarrowPhaseSolver, ShapeMeshConservativeAdvancementTraversalNodeRSS<Shape, NarrowPhaseSolver> >(o1, motion1, o2, motion2, nsolver, request, result, toc, num_iterations);
   }
 
   static bool run(
@@ -617,9 +729,10 @@ struct ConservativeAdvancementImpl
       const NarrowPhaseSolver* nsolver,
       const CollisionRequest<S>& request,
       CollisionResult<S>& result,
-      S& toc)
+      S& toc,
+      unsigned int* num_iterations = nullptr)
   {
-    return detail::conservativeAdvancementShapeMeshOriented<Shape, OBBRSS<S>, NarrowPhaseSolver, ShapeMeshConservativeAdvancementTraversalNodeOBBRSS<Shape, NarrowPhaseSolver> >(o1, motion1, o2, motion2, nsolver, request, result, toc);
+    return detail::conservativeAdvancementShapeMeshOriented<Shape, OBBRSS<S>, NarrowPhaseSolver, ShapeMeshConservativeAdvancementTraversalNodeOBBRSS<Shape, NarrowPhaseSolver> >(o1, motion1, o2, motion2, nsolver, request, result, toc, num_iterations);
   }
 };
 
@@ -631,11 +744,12 @@ bool conservativeAdvancement(const Shape& o1,
                              const NarrowPhaseSolver* nsolver,
                              const CollisionRequest<typename Shape::S>& request,
                              CollisionResult<typename Shape::S>& result,
-                             typename Shape::S& toc)
+                             typename Shape::S& toc,
+                             unsigned int* num_iterations = nullptr)
 {
   return ConservativeAdvancementImpl<
       typename Shape::S, Shape, NarrowPhaseSolver>::run(
-        o1, motion1, o2, motion2, nsolver, request, result, toc);
+        o1, motion1, o2, motion2, nsolver, request, result, toc, num_iterations);
 }
 
 template<typename Shape, typename NarrowPhaseSolver>
@@ -646,11 +760,12 @@ bool conservativeAdvancement(const Shape& o1,
                              const NarrowPhaseSolver* nsolver,
                              const CollisionRequest<typename Shape::S>& request,
                              CollisionResult<typename Shape::S>& result,
-                             typename Shape::S& toc)
+                             typename Shape::S& toc,
+                             unsigned int* num_iterations = nullptr)
 {
   return ConservativeAdvancementImpl<
       typename Shape::S, Shape, NarrowPhaseSolver>::run(
-        o1, motion1, o2, motion2, nsolver, request, result, toc);
+        o1, motion1, o2, motion2, nsolver, request, result, toc, num_iterations);
 }
 
 //==============================================================================
@@ -665,9 +780,10 @@ struct ConservativeAdvancementImpl<S, BVHModel<RSS<S>>, NarrowPhaseSolver>
       const NarrowPhaseSolver* /*nsolver*/,
       const CollisionRequest<S>& request,
       CollisionResult<S>& result,
-      S& toc)
+      S& toc,
+      unsigned int* num_iterations = nullptr)
   {
-    return detail::conservativeAdvancementMeshOriented<RSS<S>, MeshConservativeAdvancementTraversalNodeRSS<S>>(o1, motion1, o2, motion2, request, result, toc);
+    return detail::conservativeAdvancementMeshOriented<RSS<S>, MeshConservativeAdvancementTraversalNodeRSS<S>>(o1, motion1, o2, motion2, request, result, toc, num_iterations);
   }
 };
 
@@ -683,9 +799,10 @@ struct ConservativeAdvancementImpl<S, BVHModel<OBBRSS<S>>, NarrowPhaseSolver>
       const NarrowPhaseSolver* /*nsolver*/,
       const CollisionRequest<S>& request,
       CollisionResult<S>& result,
-      S& toc)
+      S& toc,
+      unsigned int* num_iterations = nullptr)
   {
-    return detail::conservativeAdvancementMeshOriented<OBBRSS<S>, MeshConservativeAdvancementTraversalNodeOBBRSS<S>>(o1, motion1, o2, motion2, request, result, toc);
+    return detail::conservativeAdvancementMeshOriented<OBBRSS<S>, MeshConservativeAdvancementTraversalNodeOBBRSS<S>>(o1, motion1, o2, motion2, request, result, toc, num_iterations);
   }
 };
 
@@ -703,7 +820,7 @@ typename BV::S BVHConservativeAdvancement(const CollisionGeometry<typename BV::S
   CollisionRequest<S> c_request;
   CollisionResult<S> c_result;
   S toc;
-  bool is_collide = conservativeAdvancement(*obj1, motion1, *obj2, motion2, c_request, c_result, toc);
+  bool is_collide = conservativeAdvancement(*obj1, motion1, *obj2, motion2, c_request, c_result, toc, &result.num_iterations);
 
   result.is_collide = is_collide;
   result.time_of_contact = toc;
@@ -724,7 +841,7 @@ typename Shape1::S ShapeConservativeAdvancement(const CollisionGeometry<typename
   CollisionRequest<S> c_request;
   CollisionResult<S> c_result;
   S toc;
-  bool is_collide = conservativeAdvancement(*obj1, motion1, *obj2, motion2, nsolver, c_request, c_result, toc);
+  bool is_collide = conservativeAdvancement(*obj1, motion1, *obj2, motion2, nsolver, c_request, c_result, toc, &result.num_iterations);
 
   result.is_collide = is_collide;
   result.time_of_contact = toc;
@@ -746,7 +863,7 @@ typename BV::S ShapeBVHConservativeAdvancement(const CollisionGeometry<typename
   CollisionResult<S> c_result;
   S toc;
 
-  bool is_collide = conservativeAdvancement<Shape, BV, NarrowPhaseSolver>(*obj1, motion1, *obj2, motion2, nsolver, c_request, c_result, toc);
+  bool is_collide = conservativeAdvancement<Shape, BV, NarrowPhaseSolver>(*obj1, motion1, *obj2, motion2, nsolver, c_request, c_result, toc, &result.num_iterations);
 
   result.is_collide = is_collide;
   result.time_of_contact = toc;
@@ -768,7 +885,7 @@ typename BV::S BVHShapeConservativeAdvancement(const CollisionGeometry<typename
   CollisionResult<S> c_result;
   S toc;
 
-  bool is_collide = conservativeAdvancement<BV, Shape, NarrowPhaseSolver>(*obj1, motion1, *obj2, motion2, nsolver, c_request, c_result, toc);
+  bool is_collide = conservativeAdvancement<BV, Shape, NarrowPhaseSolver>(*obj1, motion1, *obj2, motion2, nsolver, c_request, c_result, toc, &result.num_iterations);
 
   result.is_collide = is_collide;
   result.time_of_contact = toc;
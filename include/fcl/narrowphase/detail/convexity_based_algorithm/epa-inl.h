@@ -40,6 +40,9 @@
 
 #include "fcl/narrowphase/detail/convexity_based_algorithm/epa.h"
 
+#include "fcl/common/profiler.h"
+#include "fcl/narrowphase/detail/query_statistics_recorder.h"
+
 namespace fcl
 {
 
@@ -291,6 +294,7 @@ typename EPA<S>::Status EPA<S>::evaluate(GJK<S>& gjk, const Vector3<S>& guess)
             {
               // need to add the edge connectivity between first and last faces
               bind(horizon.ff, 2, horizon.cf, 1);
+              FCL_PROFILE_COUNT(EPAFaces, horizon.nf);
               hull.remove(best);
               stock.append(best);
               best = findBest();
@@ -311,6 +315,8 @@ typename EPA<S>::Status EPA<S>::evaluate(GJK<S>& gjk, const Vector3<S>& guess)
           status = OutOfVertices; break;
         }
       }
+      recordWork(Counter::EPAIterations,
+                 &QueryStatistics::num_epa_iterations, iterations);
 
       Vector3<S> projection = outer.n * outer.d;
       normal = outer.n;
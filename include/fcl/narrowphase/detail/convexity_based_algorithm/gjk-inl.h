@@ -40,6 +40,8 @@
 
 #include "fcl/narrowphase/detail/convexity_based_algorithm/gjk.h"
 
+#include "fcl/narrowphase/detail/query_statistics_recorder.h"
+
 namespace fcl
 {
 
@@ -189,6 +191,9 @@ typename GJK<S>::Status GJK<S>::evaluate(const MinkowskiDiff<S>& shape_, const V
 
   } while(status == Valid);
 
+  recordWork(Counter::GJKIterations,
+             &QueryStatistics::num_gjk_iterations, iterations);
+
   simplex = &simplices[current];
   switch(status)
   {
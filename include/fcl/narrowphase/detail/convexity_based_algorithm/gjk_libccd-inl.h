@@ -43,8 +43,10 @@
 #include <unordered_set>
 #include <unordered_map>
 
+#include "fcl/common/profiler.h"
 #include "fcl/common/unused.h"
 #include "fcl/common/warning.h"
+#include "fcl/narrowphase/detail/query_statistics_recorder.h"
 
 namespace fcl
 {
@@ -173,6 +175,9 @@ template <typename S>
 struct ccd_convex_t : public ccd_obj_t
 {
   const Convex<S>* convex;
+
+  /// The last support vertex, which the next support query starts from
+  mutable int support_hint;
 };
 
 struct ccd_triangle_t : public ccd_obj_t
@@ -1227,6 +1232,7 @@ static int expandPolytope(ccd_pt_t *polytope, ccd_pt_el_t *el,
     // Now add the face.
     ccdPtAddFace(polytope, border_edge, e[0], e[1]);
   }
+  FCL_PROFILE_COUNT(EPAFaces, border_edges.size());
 
   return 0;
 }
@@ -1350,10 +1356,12 @@ static int nextSupport(const ccd_pt_t* polytope, const void* obj1,
 static int __ccdGJK(const void *obj1, const void *obj2,
                     const ccd_t *ccd, ccd_simplex_t *simplex)
 {
-  unsigned long iterations;
+  unsigned long iterations = 0UL;
   ccd_vec3_t dir; // direction vector
   ccd_support_t last; // last support point
   int do_simplex_res;
+  ScopedWorkCount<unsigned long> work_count(
+      Counter::GJKIterations, &QueryStatistics::num_gjk_iterations, iterations);
 
   // initialize simplex struct
   ccdSimplexInit(simplex);
@@ -1410,6 +1418,9 @@ static int __ccdEPA(const void *obj1, const void *obj2,
 {
     ccd_support_t supp; // support point
     int ret, size;
+    std::size_t iterations = 0;
+    ScopedWorkCount<std::size_t> work_count(
+        Counter::EPAIterations, &QueryStatistics::num_epa_iterations, iterations);
 
 
     ret = 0;
@@ -1445,6 +1456,7 @@ static int __ccdEPA(const void *obj1, const void *obj2,
         // expand nearest triangle using new point - supp
         if (expandPolytope(polytope, *nearest, &supp) != 0)
             return -2;
+        ++iterations;
     }
 
     return 0;
@@ -1689,8 +1701,10 @@ static inline ccd_real_t _ccdDist(const void *obj1, const void *obj2,
 {
   ccd_real_t last_dist = CCD_REAL_MAX;
 
-  for (unsigned long iterations = 0UL; iterations < ccd->max_iterations;
-       ++iterations) {
+  unsigned long iterations = 0UL;
+  ScopedWorkCount<unsigned long> work_count(
+      Counter::GJKIterations, &QueryStatistics::num_gjk_iterations, iterations);
+  for (iterations = 0UL; iterations < ccd->max_iterations; ++iterations) {
     ccd_vec3_t closest_p; // The point on the simplex that is closest to the
                           // origin.
     ccd_real_t dist;
@@ -1984,6 +1998,7 @@ static void convexToGJK(const Convex<S>& s, const Transform3<S>& tf,
 {
   shapeToGJK(s, tf, conv);
   conv->convex = &s;
+  conv->support_hint = 0;
 }
 
 /** Support functions */
@@ -2137,25 +2152,18 @@ static void supportConvex(const void* obj, const ccd_vec3_t* dir_,
                           ccd_vec3_t* v)
 {
   const auto* c = (const ccd_convex_t<S>*)obj;
-  ccd_vec3_t dir, p;
-  ccd_real_t maxdot, dot;
-  const auto& center = c->convex->getInteriorPoint();
+  ccd_vec3_t dir;
 
   ccdVec3Copy(&dir, dir_);
   ccdQuatRotVec(&dir, &c->rot_inv);
 
-  maxdot = -CCD_REAL_MAX;
-
-  for (const auto& vertex : c->convex->getVertices())
-  {
-    ccdVec3Set(&p, vertex[0] - center[0], vertex[1] - center[1],
-               vertex[2] - center[2]);
-    dot = ccdVec3Dot(&dir, &p);
-    if (dot > maxdot) {
-      ccdVec3Set(v, vertex[0], vertex[1], vertex[2]);
-      maxdot = dot;
-    }
-  }
+  // Consecutive GJK/EPA directions are close, so the previous support vertex
+  // is a good starting point.
+  c->support_hint = c->convex->findExtremeVertexIndex(
+      Vector3<S>(ccdVec3X(&dir), ccdVec3Y(&dir), ccdVec3Z(&dir)),
+      c->support_hint);
+  const Vector3<S>& vertex = c->convex->getVertices()[c->support_hint];
+  ccdVec3Set(v, vertex[0], vertex[1], vertex[2]);
 
   // transform support vertex
   ccdQuatRotVec(v, &c->rot);
@@ -0,0 +1,228 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @author Jia Pan */
+
+#ifndef FCL_NARROWPHASE_DETAIL_GJKRAYCAST_INL_H
+#define FCL_NARROWPHASE_DETAIL_GJKRAYCAST_INL_H
+
+#include "fcl/narrowphase/detail/convexity_based_algorithm/gjk_raycast.h"
+
+#include "fcl/math/detail/project.h"
+
+namespace fcl
+{
+
+namespace detail
+{
+
+//==============================================================================
+extern template
+bool gjkRaycast(
+    const ShapeBase<double>& shape1,
+    const Transform3<double>& tf1,
+    const Vector3<double>& v1,
+    const ShapeBase<double>& shape2,
+    const Transform3<double>& tf2,
+    const Vector3<double>& v2,
+    double tolerance,
+    unsigned int max_iterations,
+    double* time_of_contact,
+    Vector3<double>* contact_point,
+    Vector3<double>* contact_normal);
+
+//==============================================================================
+template <typename S>
+bool gjkRaycast(
+    const ShapeBase<S>& shape1,
+    const Transform3<S>& tf1,
+    const Vector3<S>& v1,
+    const ShapeBase<S>& shape2,
+    const Transform3<S>& tf2,
+    const Vector3<S>& v2,
+    S tolerance,
+    unsigned int max_iterations,
+    S* time_of_contact,
+    Vector3<S>* contact_point,
+    Vector3<S>* contact_normal)
+{
+  MinkowskiDiff<S> shape;
+  shape.shapes[0] = &shape1;
+  shape.shapes[1] = &shape2;
+  shape.toshape1.noalias() = tf2.linear().transpose() * tf1.linear();
+  shape.toshape0 = tf1.inverse(Eigen::Isometry) * tf2;
+
+  // Everything is expressed in the frame of shape1 at time 0, with shape2
+  // held still. The shapes touch at time t iff t * r lies in shape2 - shape1.
+  const Vector3<S> r = tf1.linear().transpose() * (v1 - v2);
+
+  // Simplex of support points b[i] - a[i] of shape2 - shape1, with the
+  // barycentric weights of the point closest to the ray point x
+  Vector3<S> a[4];
+  Vector3<S> b[4];
+  S weights[4];
+  int n = 1;
+
+  // The support functions expect unit directions
+  const Vector3<S> d0 = (r.squaredNorm() > 0) ? Vector3<S>(r.normalized()) : Vector3<S>(Vector3<S>::UnitX());
+  a[0] = shape.support0(d0);
+  b[0] = shape.support1(d0);
+  weights[0] = 1;
+
+  S lambda = 0;
+  Vector3<S> x = Vector3<S>::Zero();
+  Vector3<S> normal = Vector3<S>::Zero();
+  Vector3<S> v = x - (b[0] - a[0]);
+
+  const S tolerance2 = tolerance * tolerance;
+  bool converged = v.squaredNorm() <= tolerance2;
+
+  for(unsigned int i = 0; i < max_iterations && !converged; ++i)
+  {
+    const Vector3<S> d = v.normalized();
+    const Vector3<S> a_new = shape.support0(-d);
+    const Vector3<S> b_new = shape.support1(d);
+    const Vector3<S> w = x - (b_new - a_new);
+
+    // The support plane separates x from the difference: advance the ray up
+    // to that plane, or give up when the ray points away from it.
+    const S vw = v.dot(w);
+    if(vw > 0)
+    {
+      const S vr = v.dot(r);
+      if(vr >= 0)
+        return false;
+
+      lambda -= vw / vr;
+      if(lambda > 1)
+        return false;
+
+      x = lambda * r;
+      normal = v;
+    }
+
+    bool duplicate = false;
+    for(int j = 0; j < n; ++j)
+    {
+      if(((b[j] - a[j]) - (b_new - a_new)).squaredNorm() <= tolerance2)
+        duplicate = true;
+    }
+
+    if(!duplicate)
+    {
+      a[n] = a_new;
+      b[n] = b_new;
+      ++n;
+    }
+
+    // Closest point of the simplex translated by x to the origin
+    Vector3<S> y[4];
+    for(int j = 0; j < n; ++j)
+      y[j] = x - (b[j] - a[j]);
+
+    typename Project<S>::ProjectResult res;
+    switch(n)
+    {
+    case 1:
+      res.parameterization[0] = 1;
+      res.sqr_distance = y[0].squaredNorm();
+      res.encode = 1;
+      break;
+    case 2:
+      res = Project<S>::projectLineOrigin(y[0], y[1]);
+      break;
+    case 3:
+      res = Project<S>::projectTriangleOrigin(y[0], y[1], y[2]);
+      break;
+    default:
+      res = Project<S>::projectTetrahedraOrigin(y[0], y[1], y[2], y[3]);
+      break;
+    }
+
+    if(res.sqr_distance < 0)
+    {
+      // Degenerate simplex, restart from the newest support point
+      a[0] = a[n - 1];
+      b[0] = b[n - 1];
+      y[0] = y[n - 1];
+      res.parameterization[0] = 1;
+      res.encode = 1;
+      n = 1;
+    }
+
+    // Keep only the vertices supporting the closest point
+    int m = 0;
+    v.setZero();
+    for(int j = 0; j < n; ++j)
+    {
+      if(!(res.encode & (1 << j)))
+        continue;
+
+      v += res.parameterization[j] * y[j];
+      a[m] = a[j];
+      b[m] = b[j];
+      weights[m] = res.parameterization[j];
+      ++m;
+    }
+    n = m;
+
+    // The ray point is within tolerance of the difference, or inside a full
+    // simplex
+    converged = (n == 4 || v.squaredNorm() <= tolerance2);
+  }
+
+  // lambda is only a lower bound of the time of impact until the ray point
+  // is confirmed to touch the difference
+  if(!converged)
+    return false;
+
+  Vector3<S> point = Vector3<S>::Zero();
+  for(int j = 0; j < n; ++j)
+    point += weights[j] * b[j];
+
+  *time_of_contact = lambda;
+  *contact_point = tf1 * point + lambda * v2;
+  if(normal.squaredNorm() > 0)
+    *contact_normal = -(tf1.linear() * normal).normalized();
+  else
+    contact_normal->setZero();
+
+  return true;
+}
+
+} // namespace detail
+} // namespace fcl
+
+#endif
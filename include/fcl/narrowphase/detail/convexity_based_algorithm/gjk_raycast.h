@@ -0,0 +1,87 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @author Jia Pan */
+
+#ifndef FCL_NARROWPHASE_DETAIL_GJKRAYCAST_H
+#define FCL_NARROWPHASE_DETAIL_GJKRAYCAST_H
+
+#include "fcl/common/types.h"
+#include "fcl/narrowphase/detail/convexity_based_algorithm/minkowski_diff.h"
+
+namespace fcl
+{
+
+namespace detail
+{
+
+/// @brief Time of impact of two translating convex shapes.
+///
+/// Over the normalized time interval [0, 1], shape1 moves from tf1 by the
+/// world-frame displacement v1 and shape2 from tf2 by v2. The first contact is
+/// found by casting the ray t * (v1 - v2) against the Minkowski difference
+/// shape2 - shape1 with GJK (G. van den Bergen, "Ray Casting against General
+/// Convex Objects with Application to Continuous Collision Detection", 2004).
+///
+/// The ray parameter only ever advances to a time at which the shapes are
+/// provably apart, so time_of_contact is a lower bound of the true time of
+/// impact; it is accurate once the distance at that time is below tolerance.
+///
+/// @return true if the shapes touch within [0, 1]. In that case
+/// contact_point is the world-frame contact point at time_of_contact and
+/// contact_normal the unit normal pointing from shape1 to shape2 (zero when
+/// the shapes already touch at time 0). false if the shapes do not touch, or
+/// if max_iterations is reached before the contact is confirmed.
+template <typename S>
+FCL_EXPORT
+bool gjkRaycast(
+    const ShapeBase<S>& shape1,
+    const Transform3<S>& tf1,
+    const Vector3<S>& v1,
+    const ShapeBase<S>& shape2,
+    const Transform3<S>& tf2,
+    const Vector3<S>& v2,
+    S tolerance,
+    unsigned int max_iterations,
+    S* time_of_contact,
+    Vector3<S>* contact_point,
+    Vector3<S>* contact_normal);
+
+} // namespace detail
+} // namespace fcl
+
+#include "fcl/narrowphase/detail/convexity_based_algorithm/gjk_raycast-inl.h"
+
+#endif
@@ -67,6 +67,18 @@ FCL_EXPORT
 Vector3<S> getSupport(
     const ShapeBase<S>* shape,
     const Eigen::MatrixBase<Derived>& dir)
+{
+  int hint = 0;
+  return getSupport(shape, dir, hint);
+}
+
+//==============================================================================
+template <typename S, typename Derived>
+FCL_EXPORT
+Vector3<S> getSupport(
+    const ShapeBase<S>* shape,
+    const Eigen::MatrixBase<Derived>& dir,
+    int& hint)
 {
   // Check the number of rows is 6 at compile time
   EIGEN_STATIC_ASSERT(
@@ -182,18 +194,8 @@ Vector3<S> getSupport(
   case GEOM_CONVEX:
     {
       const Convex<S>* convex = static_cast<const Convex<S>*>(shape);
-      S maxdot = - std::numeric_limits<S>::max();
-      Vector3<S> bestv = Vector3<S>::Zero();
-      for(const auto& vertex : convex->getVertices())
-      {
-        S dot = dir.dot(vertex);
-        if(dot > maxdot)
-        {
-          bestv = vertex;
-          maxdot = dot;
-        }
-      }
-      return bestv;
+      hint = convex->findExtremeVertexIndex(dir, hint);
+      return convex->getVertices()[hint];
     }
     break;
   case GEOM_PLANE:
@@ -209,21 +211,22 @@ Vector3<S> getSupport(
 template <typename S>
 MinkowskiDiff<S>::MinkowskiDiff()
 {
-  // Do nothing
+  support_hints[0] = 0;
+  support_hints[1] = 0;
 }
 
 //==============================================================================
 template <typename S>
 Vector3<S> MinkowskiDiff<S>::support0(const Vector3<S>& d) const
 {
-  return getSupport(shapes[0], d);
+  return getSupport(shapes[0], d, support_hints[0]);
 }
 
 //==============================================================================
 template <typename S>
 Vector3<S> MinkowskiDiff<S>::support1(const Vector3<S>& d) const
 {
-  return toshape0 * getSupport(shapes[1], toshape1 * d);
+  return toshape0 * getSupport(shapes[1], toshape1 * d, support_hints[1]);
 }
 
 //==============================================================================
@@ -248,9 +251,9 @@ template <typename S>
 Vector3<S> MinkowskiDiff<S>::support0(const Vector3<S>& d, const Vector3<S>& v) const
 {
   if(d.dot(v) <= 0)
-    return getSupport(shapes[0], d);
+    return getSupport(shapes[0], d, support_hints[0]);
   else
-    return getSupport(shapes[0], d) + v;
+    return getSupport(shapes[0], d, support_hints[0]) + v;
 }
 
 //==============================================================================
@@ -53,6 +53,14 @@ Vector3<S> getSupport(
     const ShapeBase<S>* shape,
     const Eigen::MatrixBase<Derived>& dir);
 
+/// @brief the support function for shape. For a Convex, hint is the vertex
+/// index the search starts from, and is updated to the support vertex found
+template <typename S, typename Derived>
+Vector3<S> getSupport(
+    const ShapeBase<S>* shape,
+    const Eigen::MatrixBase<Derived>& dir,
+    int& hint);
+
 /// @brief Minkowski difference class of two shapes
 template <typename S>
 struct FCL_EXPORT MinkowskiDiff
@@ -66,6 +74,10 @@ struct FCL_EXPORT MinkowskiDiff
   /// @brief transform from shape1 to shape0 
   Transform3<S> toshape0;
 
+  /// @brief the last support vertices of the two shapes (when they are
+  /// Convex), which the next support queries start from
+  mutable int support_hints[2];
+
   MinkowskiDiff();
 
   /// @brief support function for shape0
@@ -58,6 +58,7 @@
 #include "fcl/narrowphase/detail/traversal/distance/mesh_conservative_advancement_traversal_node.h"
 #include "fcl/narrowphase/detail/traversal/distance/mesh_shape_distance_traversal_node.h"
 #include "fcl/narrowphase/detail/traversal/distance/mesh_shape_conservative_advancement_traversal_node.h"
+#include "fcl/narrowphase/detail/traversal/distance/quantized_mesh_shape_distance_traversal_node.h"
 #include "fcl/narrowphase/detail/traversal/distance/shape_bvh_distance_traversal_node.h"
 #include "fcl/narrowphase/detail/traversal/distance/shape_distance_traversal_node.h"
 #include "fcl/narrowphase/detail/traversal/distance/shape_conservative_advancement_traversal_node.h"
@@ -204,6 +205,32 @@ typename BV::S OcTreeBVHDistance(
 
 #endif
 
+//==============================================================================
+template <typename Q, typename Shape, typename NarrowPhaseSolver>
+typename Shape::S QuantizedBVHShapeDistance(
+    const CollisionGeometry<typename Shape::S>* o1,
+    const Transform3<typename Shape::S>& tf1,
+    const CollisionGeometry<typename Shape::S>* o2,
+    const Transform3<typename Shape::S>& tf2,
+    const NarrowPhaseSolver* nsolver,
+    const DistanceRequest<typename Shape::S>& request,
+    DistanceResult<typename Shape::S>& result)
+{
+  using S = typename Shape::S;
+
+  if(request.isSatisfied(result)) return result.min_distance;
+
+  QuantizedMeshShapeDistanceTraversalNode<Q, Shape, NarrowPhaseSolver> node;
+  const QuantizedBVHModel<S, Q>* obj1 = static_cast<const QuantizedBVHModel<S, Q>*>(o1);
+  const Shape* obj2 = static_cast<const Shape*>(o2);
+
+  initialize(node, *obj1, tf1, *obj2, tf2, nsolver, request, result);
+  distance(&node);
+
+  return result.min_distance;
+}
+
+//==============================================================================
 template <typename Shape1, typename Shape2, typename NarrowPhaseSolver>
 typename Shape1::S ShapeShapeDistance(
     const CollisionGeometry<typename Shape1::S>* o1,
@@ -242,14 +269,11 @@ struct BVHShapeDistancer
     if(request.isSatisfied(result)) return result.min_distance;
     MeshShapeDistanceTraversalNode<BV, Shape, NarrowPhaseSolver> node;
     const BVHModel<BV>* obj1 = static_cast<const BVHModel<BV>* >(o1);
-    BVHModel<BV>* obj1_tmp = new BVHModel<BV>(*obj1);
-    Transform3<S> tf1_tmp = tf1;
     const Shape* obj2 = static_cast<const Shape*>(o2);
 
-    initialize(node, *obj1_tmp, tf1_tmp, *obj2, tf2, nsolver, request, result);
+    initialize(node, *obj1, tf1, *obj2, tf2, nsolver, request, result);
     ::fcl::distance(&node);
 
-    delete obj1_tmp;
     return result.min_distance;
   }
 };
@@ -339,6 +363,27 @@ struct BVHShapeDistancer<OBBRSS<typename Shape::S>, Shape, NarrowPhaseSolver>
   }
 };
 
+template <typename Shape, typename NarrowPhaseSolver>
+struct BVHShapeDistancer<FloatOBBRSS<typename Shape::S>, Shape, NarrowPhaseSolver>
+{
+  static typename Shape::S distance(
+      const CollisionGeometry<typename Shape::S>* o1,
+      const Transform3<typename Shape::S>& tf1,
+      const CollisionGeometry<typename Shape::S>* o2,
+      const Transform3<typename Shape::S>& tf2,
+      const NarrowPhaseSolver* nsolver,
+      const DistanceRequest<typename Shape::S>& request,
+      DistanceResult<typename Shape::S>& result)
+  {
+    return detail::orientedBVHShapeDistance<
+        MeshShapeDistanceTraversalNodeFloatOBBRSS<Shape, NarrowPhaseSolver>,
+        FloatOBBRSS<typename Shape::S>,
+        Shape,
+        NarrowPhaseSolver>(
+          o1, tf1, o2, tf2, nsolver, request, result);
+  }
+};
+
 //==============================================================================
 template <typename S, typename BV>
 struct BVHDistanceImpl
@@ -355,15 +400,9 @@ struct BVHDistanceImpl
     MeshDistanceTraversalNode<BV> node;
     const BVHModel<BV>* obj1 = static_cast<const BVHModel<BV>* >(o1);
     const BVHModel<BV>* obj2 = static_cast<const BVHModel<BV>* >(o2);
-    BVHModel<BV>* obj1_tmp = new BVHModel<BV>(*obj1);
-    Transform3<S> tf1_tmp = tf1;
-    BVHModel<BV>* obj2_tmp = new BVHModel<BV>(*obj2);
-    Transform3<S> tf2_tmp = tf2;
 
-    initialize(node, *obj1_tmp, tf1_tmp, *obj2_tmp, tf2_tmp, request, result);
+    initialize(node, *obj1, tf1, *obj2, tf2, request, result);
     distance(&node);
-    delete obj1_tmp;
-    delete obj2_tmp;
 
     return result.min_distance;
   }
@@ -457,6 +496,24 @@ struct BVHDistanceImpl<S, OBBRSS<S>>
   }
 };
 
+//==============================================================================
+template <typename S>
+struct BVHDistanceImpl<S, FloatOBBRSS<S>>
+{
+  static S run(
+      const CollisionGeometry<S>* o1,
+      const Transform3<S>& tf1,
+      const CollisionGeometry<S>* o2,
+      const Transform3<S>& tf2,
+      const DistanceRequest<S>& request,
+      DistanceResult<S>& result)
+  {
+    return detail::orientedMeshDistance<
+        MeshDistanceTraversalNodeFloatOBBRSS<S>, FloatOBBRSS<S>>(
+            o1, tf1, o2, tf2, request, result);
+  }
+};
+
 //==============================================================================
 template <typename BV, typename NarrowPhaseSolver>
 typename BV::S BVHDistance(
@@ -657,10 +714,41 @@ DistanceFunctionMatrix<NarrowPhaseSolver>::DistanceFunctionMatrix()
   distance_matrix[BV_OBBRSS][GEOM_PLANE] = &BVHShapeDistancer<OBBRSS<S>, Plane<S>, NarrowPhaseSolver>::distance;
   distance_matrix[BV_OBBRSS][GEOM_HALFSPACE] = &BVHShapeDistancer<OBBRSS<S>, Halfspace<S>, NarrowPhaseSolver>::distance;
 
+  distance_matrix[BV_FLOAT_OBBRSS][GEOM_BOX] = &BVHShapeDistancer<FloatOBBRSS<S>, Box<S>, NarrowPhaseSolver>::distance;
+  distance_matrix[BV_FLOAT_OBBRSS][GEOM_SPHERE] = &BVHShapeDistancer<FloatOBBRSS<S>, Sphere<S>, NarrowPhaseSolver>::distance;
+  distance_matrix[BV_FLOAT_OBBRSS][GEOM_ELLIPSOID] = &BVHShapeDistancer<FloatOBBRSS<S>, Ellipsoid<S>, NarrowPhaseSolver>::distance;
+  distance_matrix[BV_FLOAT_OBBRSS][GEOM_CAPSULE] = &BVHShapeDistancer<FloatOBBRSS<S>, Capsule<S>, NarrowPhaseSolver>::distance;
+  distance_matrix[BV_FLOAT_OBBRSS][GEOM_CONE] = &BVHShapeDistancer<FloatOBBRSS<S>, Cone<S>, NarrowPhaseSolver>::distance;
+  distance_matrix[BV_FLOAT_OBBRSS][GEOM_CYLINDER] = &BVHShapeDistancer<FloatOBBRSS<S>, Cylinder<S>, NarrowPhaseSolver>::distance;
+  distance_matrix[BV_FLOAT_OBBRSS][GEOM_CONVEX] = &BVHShapeDistancer<FloatOBBRSS<S>, Convex<S>, NarrowPhaseSolver>::distance;
+  distance_matrix[BV_FLOAT_OBBRSS][GEOM_PLANE] = &BVHShapeDistancer<FloatOBBRSS<S>, Plane<S>, NarrowPhaseSolver>::distance;
+  distance_matrix[BV_FLOAT_OBBRSS][GEOM_HALFSPACE] = &BVHShapeDistancer<FloatOBBRSS<S>, Halfspace<S>, NarrowPhaseSolver>::distance;
+
   distance_matrix[BV_AABB][BV_AABB] = &BVHDistance<AABB<S>, NarrowPhaseSolver>;
   distance_matrix[BV_RSS][BV_RSS] = &BVHDistance<RSS<S>, NarrowPhaseSolver>;
   distance_matrix[BV_kIOS][BV_kIOS] = &BVHDistance<kIOS<S>, NarrowPhaseSolver>;
   distance_matrix[BV_OBBRSS][BV_OBBRSS] = &BVHDistance<OBBRSS<S>, NarrowPhaseSolver>;
+  distance_matrix[BV_FLOAT_OBBRSS][BV_FLOAT_OBBRSS] = &BVHDistance<FloatOBBRSS<S>, NarrowPhaseSolver>;
+
+  distance_matrix[BV_QUANTIZED8][GEOM_BOX] = &QuantizedBVHShapeDistance<std::uint8_t, Box<S>, NarrowPhaseSolver>;
+  distance_matrix[BV_QUANTIZED8][GEOM_SPHERE] = &QuantizedBVHShapeDistance<std::uint8_t, Sphere<S>, NarrowPhaseSolver>;
+  distance_matrix[BV_QUANTIZED8][GEOM_ELLIPSOID] = &QuantizedBVHShapeDistance<std::uint8_t, Ellipsoid<S>, NarrowPhaseSolver>;
+  distance_matrix[BV_QUANTIZED8][GEOM_CAPSULE] = &QuantizedBVHShapeDistance<std::uint8_t, Capsule<S>, NarrowPhaseSolver>;
+  distance_matrix[BV_QUANTIZED8][GEOM_CONE] = &QuantizedBVHShapeDistance<std::uint8_t, Cone<S>, NarrowPhaseSolver>;
+  distance_matrix[BV_QUANTIZED8][GEOM_CYLINDER] = &QuantizedBVHShapeDistance<std::uint8_t, Cylinder<S>, NarrowPhaseSolver>;
+  distance_matrix[BV_QUANTIZED8][GEOM_CONVEX] = &QuantizedBVHShapeDistance<std::uint8_t, Convex<S>, NarrowPhaseSolver>;
+  distance_matrix[BV_QUANTIZED8][GEOM_PLANE] = &QuantizedBVHShapeDistance<std::uint8_t, Plane<S>, NarrowPhaseSolver>;
+  distance_matrix[BV_QUANTIZED8][GEOM_HALFSPACE] = &QuantizedBVHShapeDistance<std::uint8_t, Halfspace<S>, NarrowPhaseSolver>;
+
+  distance_matrix[BV_QUANTIZED16][GEOM_BOX] = &QuantizedBVHShapeDistance<std::uint16_t, Box<S>, NarrowPhaseSolver>;
+  distance_matrix[BV_QUANTIZED16][GEOM_SPHERE] = &QuantizedBVHShapeDistance<std::uint16_t, Sphere<S>, NarrowPhaseSolver>;
+  distance_matrix[BV_QUANTIZED16][GEOM_ELLIPSOID] = &QuantizedBVHShapeDistance<std::uint16_t, Ellipsoid<S>, NarrowPhaseSolver>;
+  distance_matrix[BV_QUANTIZED16][GEOM_CAPSULE] = &QuantizedBVHShapeDistance<std::uint16_t, Capsule<S>, NarrowPhaseSolver>;
+  distance_matrix[BV_QUANTIZED16][GEOM_CONE] = &QuantizedBVHShapeDistance<std::uint16_t, Cone<S>, NarrowPhaseSolver>;
+  distance_matrix[BV_QUANTIZED16][GEOM_CYLINDER] = &QuantizedBVHShapeDistance<std::uint16_t, Cylinder<S>, NarrowPhaseSolver>;
+  distance_matrix[BV_QUANTIZED16][GEOM_CONVEX] = &QuantizedBVHShapeDistance<std::uint16_t, Convex<S>, NarrowPhaseSolver>;
+  distance_matrix[BV_QUANTIZED16][GEOM_PLANE] = &QuantizedBVHShapeDistance<std::uint16_t, Plane<S>, NarrowPhaseSolver>;
+  distance_matrix[BV_QUANTIZED16][GEOM_HALFSPACE] = &QuantizedBVHShapeDistance<std::uint16_t, Halfspace<S>, NarrowPhaseSolver>;
 
 #if FCL_HAVE_OCTOMAP
   distance_matrix[GEOM_OCTREE][GEOM_BOX] = &OcTreeShapeDistance<Box<S>, NarrowPhaseSolver>;
@@ -48,6 +48,8 @@
 
 #include "fcl/narrowphase/detail/convexity_based_algorithm/gjk.h"
 #include "fcl/narrowphase/detail/convexity_based_algorithm/epa.h"
+#include "fcl/narrowphase/detail/primitive_shape_algorithm/box_triangle.h"
+#include "fcl/narrowphase/detail/primitive_shape_algorithm/capsule_box.h"
 #include "fcl/narrowphase/detail/primitive_shape_algorithm/capsule_capsule.h"
 #include "fcl/narrowphase/detail/primitive_shape_algorithm/sphere_box.h"
 #include "fcl/narrowphase/detail/primitive_shape_algorithm/sphere_capsule.h"
@@ -183,7 +185,7 @@ bool GJKSolver_indep<S>::shapeIntersect(
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
 // |            | box | sphere | ellipsoid | capsule | cone | cylinder | plane | half-space | triangle |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
-// | box        |  O  |   O    |           |         |      |          |   O   |      O     |          |
+// | box        |  O  |   O    |           |    O    |      |          |   O   |      O     |     O    |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
 // | sphere     |/////|   O    |           |    O    |      |    O     |   O   |      O     |     O    |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
@@ -250,6 +252,8 @@ FCL_GJK_INDEP_SHAPE_SHAPE_INTERSECT(Sphere, Capsule, detail::sphereCapsuleInters
 
 FCL_GJK_INDEP_SHAPE_SHAPE_INTERSECT(Sphere, Box, detail::sphereBoxIntersect)
 
+FCL_GJK_INDEP_SHAPE_SHAPE_INTERSECT(Capsule, Box, detail::capsuleBoxIntersect)
+
 FCL_GJK_INDEP_SHAPE_SHAPE_INTERSECT(Sphere, Cylinder, detail::sphereCylinderIntersect)
 
 FCL_GJK_INDEP_SHAPE_SHAPE_INTERSECT(Sphere, Halfspace, detail::sphereHalfspaceIntersect)
@@ -439,6 +443,26 @@ struct ShapeTriangleIntersectIndepImpl<S, Sphere<S>>
   }
 };
 
+//==============================================================================
+template<typename S>
+struct ShapeTriangleIntersectIndepImpl<S, Box<S>>
+{
+  static bool run(
+      const GJKSolver_indep<S>& /*gjkSolver*/,
+      const Box<S>& s,
+      const Transform3<S>& tf,
+      const Vector3<S>& P1,
+      const Vector3<S>& P2,
+      const Vector3<S>& P3,
+      Vector3<S>* contact_points,
+      S* penetration_depth,
+      Vector3<S>* normal)
+  {
+    return detail::boxTriangleIntersect(
+          s, tf, P1, P2, P3, contact_points, penetration_depth, normal);
+  }
+};
+
 
 //==============================================================================
 template<typename S, typename Shape>
@@ -540,6 +564,28 @@ struct ShapeTransformedTriangleIntersectIndepImpl<S, Sphere<S>>
   }
 };
 
+//==============================================================================
+template<typename S>
+struct ShapeTransformedTriangleIntersectIndepImpl<S, Box<S>>
+{
+  static bool run(
+      const GJKSolver_indep<S>& /*gjkSolver*/,
+      const Box<S>& s,
+      const Transform3<S>& tf1,
+      const Vector3<S>& P1,
+      const Vector3<S>& P2,
+      const Vector3<S>& P3,
+      const Transform3<S>& tf2,
+      Vector3<S>* contact_points,
+      S* penetration_depth,
+      Vector3<S>* normal)
+  {
+    return detail::boxTriangleIntersect(
+          s, tf1, tf2 * P1, tf2 * P2, tf2 * P3,
+          contact_points, penetration_depth, normal);
+  }
+};
+
 //==============================================================================
 template<typename S>
 struct ShapeTransformedTriangleIntersectIndepImpl<S, Halfspace<S>>
@@ -678,7 +724,7 @@ bool GJKSolver_indep<S>::shapeSignedDistance(
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
 // |            | box | sphere | ellipsoid | capsule | cone | cylinder | plane | half-space | triangle |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
-// | box        |     |   O    |           |         |      |          |       |            |          |
+// | box        |     |   O    |           |    O    |      |          |       |            |          |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
 // | sphere     |/////|   O    |           |    O    |      |    O     |       |            |     O    |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
@@ -841,6 +887,42 @@ struct ShapeDistanceIndepImpl<S, Capsule<S>, Capsule<S>>
   }
 };
 
+//==============================================================================
+template<typename S>
+struct ShapeDistanceIndepImpl<S, Capsule<S>, Box<S>>
+{
+  static bool run(
+      const GJKSolver_indep<S>& /*gjkSolver*/,
+      const Capsule<S>& s1,
+      const Transform3<S>& tf1,
+      const Box<S>& s2,
+      const Transform3<S>& tf2,
+      S* dist,
+      Vector3<S>* p1,
+      Vector3<S>* p2)
+  {
+    return detail::capsuleBoxDistance(s1, tf1, s2, tf2, dist, p1, p2);
+  }
+};
+
+//==============================================================================
+template<typename S>
+struct ShapeDistanceIndepImpl<S, Box<S>, Capsule<S>>
+{
+  static bool run(
+      const GJKSolver_indep<S>& /*gjkSolver*/,
+      const Box<S>& s1,
+      const Transform3<S>& tf1,
+      const Capsule<S>& s2,
+      const Transform3<S>& tf2,
+      S* dist,
+      Vector3<S>* p1,
+      Vector3<S>* p2)
+  {
+    return detail::capsuleBoxDistance(s2, tf2, s1, tf1, dist, p2, p1);
+  }
+};
+
 //==============================================================================
 template<typename S, typename Shape>
 struct ShapeTriangleDistanceIndepImpl
@@ -882,9 +964,10 @@ struct ShapeTriangleDistanceIndepImpl
       }
 
       if(distance) *distance = (w0 - w1).norm();
-      // The answers are produced in world coordinates. Keep them there.
-      if(p1) *p1 = w0;
-      if(p2) *p2 = w1;
+      // Answer is solved in the shape's local frame; answers are given in the
+      // world frame.
+      if(p1) p1->noalias() = tf * w0;
+      if(p2) p2->noalias() = tf * w1;
       return true;
     }
     else
@@ -1045,6 +1128,13 @@ void GJKSolver_indep<S>::enableCachedGuess(bool if_enable) const
   enable_cached_guess = if_enable;
 }
 
+//==============================================================================
+template <typename S>
+bool GJKSolver_indep<S>::isCachedGuessEnabled() const
+{
+  return enable_cached_guess;
+}
+
 //==============================================================================
 template <typename S>
 void GJKSolver_indep<S>::setCachedGuess(const Vector3<S>& guess) const
@@ -152,6 +152,8 @@ struct FCL_EXPORT GJKSolver_indep
 
   void enableCachedGuess(bool if_enable) const;
 
+  bool isCachedGuessEnabled() const;
+
   void setCachedGuess(const Vector3<S>& guess) const;
 
   Vector3<S> getCachedGuess() const;
@@ -45,6 +45,8 @@
 #include "fcl/common/unused.h"
 
 #include "fcl/narrowphase/detail/convexity_based_algorithm/gjk_libccd.h"
+#include "fcl/narrowphase/detail/primitive_shape_algorithm/box_triangle.h"
+#include "fcl/narrowphase/detail/primitive_shape_algorithm/capsule_box.h"
 #include "fcl/narrowphase/detail/primitive_shape_algorithm/capsule_capsule.h"
 #include "fcl/narrowphase/detail/primitive_shape_algorithm/sphere_box.h"
 #include "fcl/narrowphase/detail/primitive_shape_algorithm/sphere_capsule.h"
@@ -179,7 +181,7 @@ bool GJKSolver_libccd<S>::shapeIntersect(
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
 // |            | box | sphere | ellipsoid | capsule | cone | cylinder | plane | half-space | triangle |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
-// | box        |  O  |   O    |           |         |      |          |   O   |      O     |          |
+// | box        |  O  |   O    |           |    O    |      |          |   O   |      O     |     O    |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
 // | sphere     |/////|   O    |           |    O    |      |    O     |   O   |      O     |    O     |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
@@ -246,6 +248,8 @@ FCL_GJK_LIBCCD_SHAPE_SHAPE_INTERSECT(Sphere, Capsule, detail::sphereCapsuleInter
 
 FCL_GJK_LIBCCD_SHAPE_SHAPE_INTERSECT(Sphere, Box, detail::sphereBoxIntersect)
 
+FCL_GJK_LIBCCD_SHAPE_SHAPE_INTERSECT(Capsule, Box, detail::capsuleBoxIntersect)
+
 FCL_GJK_LIBCCD_SHAPE_SHAPE_INTERSECT(Sphere, Cylinder, detail::sphereCylinderIntersect)
 
 FCL_GJK_LIBCCD_SHAPE_SHAPE_INTERSECT(Sphere, Halfspace, detail::sphereHalfspaceIntersect)
@@ -414,6 +418,26 @@ struct ShapeTriangleIntersectLibccdImpl<S, Sphere<S>>
   }
 };
 
+//==============================================================================
+template<typename S>
+struct ShapeTriangleIntersectLibccdImpl<S, Box<S>>
+{
+  static bool run(
+      const GJKSolver_libccd<S>& /*gjkSolver*/,
+      const Box<S>& s,
+      const Transform3<S>& tf,
+      const Vector3<S>& P1,
+      const Vector3<S>& P2,
+      const Vector3<S>& P3,
+      Vector3<S>* contact_points,
+      S* penetration_depth,
+      Vector3<S>* normal)
+  {
+    return detail::boxTriangleIntersect(
+          s, tf, P1, P2, P3, contact_points, penetration_depth, normal);
+  }
+};
+
 //==============================================================================
 template<typename S, typename Shape>
 struct ShapeTransformedTriangleIntersectLibccdImpl
@@ -493,6 +517,28 @@ struct ShapeTransformedTriangleIntersectLibccdImpl<S, Sphere<S>>
   }
 };
 
+//==============================================================================
+template<typename S>
+struct ShapeTransformedTriangleIntersectLibccdImpl<S, Box<S>>
+{
+  static bool run(
+      const GJKSolver_libccd<S>& /*gjkSolver*/,
+      const Box<S>& s,
+      const Transform3<S>& tf1,
+      const Vector3<S>& P1,
+      const Vector3<S>& P2,
+      const Vector3<S>& P3,
+      const Transform3<S>& tf2,
+      Vector3<S>* contact_points,
+      S* penetration_depth,
+      Vector3<S>* normal)
+  {
+    return detail::boxTriangleIntersect(
+          s, tf1, tf2 * P1, tf2 * P2, tf2 * P3,
+          contact_points, penetration_depth, normal);
+  }
+};
+
 //==============================================================================
 template<typename S>
 struct ShapeTransformedTriangleIntersectLibccdImpl<S, Halfspace<S>>
@@ -645,7 +691,7 @@ bool GJKSolver_libccd<S>::shapeDistance(
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
 // |            | box | sphere | ellipsoid | capsule | cone | cylinder | plane | half-space | triangle |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
-// | box        |     |   O    |           |         |      |          |       |            |          |
+// | box        |     |   O    |           |    O    |      |          |       |            |          |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
 // | sphere     |/////|   O    |           |    O    |      |    O     |       |            |     O    |
 // +------------+-----+--------+-----------+---------+------+----------+-------+------------+----------+
@@ -808,6 +854,42 @@ struct ShapeDistanceLibccdImpl<S, Capsule<S>, Capsule<S>>
   }
 };
 
+//==============================================================================
+template<typename S>
+struct ShapeDistanceLibccdImpl<S, Capsule<S>, Box<S>>
+{
+  static bool run(
+      const GJKSolver_libccd<S>& /*gjkSolver*/,
+      const Capsule<S>& s1,
+      const Transform3<S>& tf1,
+      const Box<S>& s2,
+      const Transform3<S>& tf2,
+      S* dist,
+      Vector3<S>* p1,
+      Vector3<S>* p2)
+  {
+    return detail::capsuleBoxDistance(s1, tf1, s2, tf2, dist, p1, p2);
+  }
+};
+
+//==============================================================================
+template<typename S>
+struct ShapeDistanceLibccdImpl<S, Box<S>, Capsule<S>>
+{
+  static bool run(
+      const GJKSolver_libccd<S>& /*gjkSolver*/,
+      const Box<S>& s1,
+      const Transform3<S>& tf1,
+      const Capsule<S>& s2,
+      const Transform3<S>& tf2,
+      S* dist,
+      Vector3<S>* p1,
+      Vector3<S>* p2)
+  {
+    return detail::capsuleBoxDistance(s2, tf2, s1, tf1, dist, p2, p1);
+  }
+};
+
 //==============================================================================
 template<typename S, typename Shape>
 struct ShapeTriangleDistanceLibccdImpl
@@ -975,6 +1057,13 @@ void GJKSolver_libccd<S>::enableCachedGuess(bool if_enable) const
   // TODO: need change libccd to exploit spatial coherence
 }
 
+//==============================================================================
+template<typename S>
+bool GJKSolver_libccd<S>::isCachedGuessEnabled() const
+{
+  return false;
+}
+
 //==============================================================================
 template<typename S>
 void GJKSolver_libccd<S>::setCachedGuess(
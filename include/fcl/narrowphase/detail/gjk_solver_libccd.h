@@ -150,8 +150,13 @@ struct FCL_EXPORT GJKSolver_libccd
   /// @brief default setting for GJK algorithm
   GJKSolver_libccd();
 
+  /// @brief No-op: the libccd GJK always starts from its default direction,
+  /// so the cached guess (warm start) is not supported by this solver
   void enableCachedGuess(bool if_enable) const;
 
+  /// @brief Always false, see enableCachedGuess()
+  bool isCachedGuessEnabled() const;
+
   void setCachedGuess(const Vector3<S>& guess) const;
 
   Vector3<S> getCachedGuess() const;
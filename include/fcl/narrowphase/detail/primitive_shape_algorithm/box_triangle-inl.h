@@ -0,0 +1,339 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @author Jia Pan */
+
+#ifndef FCL_NARROWPHASE_DETAIL_BOXTRIANGLE_INL_H
+#define FCL_NARROWPHASE_DETAIL_BOXTRIANGLE_INL_H
+
+#include "fcl/narrowphase/detail/primitive_shape_algorithm/box_triangle.h"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace fcl
+{
+
+namespace detail
+{
+
+//==============================================================================
+extern template
+bool boxTriangleIntersect(const Box<double>& box, const Transform3<double>& tf,
+                          const Vector3<double>& P1, const Vector3<double>& P2,
+                          const Vector3<double>& P3,
+                          Vector3<double>* contact_point,
+                          double* penetration_depth, Vector3<double>* normal);
+
+//==============================================================================
+// Nearest points of the segments from a0 to a1 and from b0 to b1; returns the
+// point midway between them.
+template <typename S>
+Vector3<S> segmentSegmentMidpoint(const Vector3<S>& a0, const Vector3<S>& a1,
+                                  const Vector3<S>& b0, const Vector3<S>& b1)
+{
+  const Vector3<S> d1 = a1 - a0;
+  const Vector3<S> d2 = b1 - b0;
+  const Vector3<S> r = a0 - b0;
+  const S a = d1.squaredNorm();
+  const S e = d2.squaredNorm();
+  const S f = d2.dot(r);
+  const S c = d1.dot(r);
+  const S b = d1.dot(d2);
+
+  S s = 0;
+  S t = 0;
+  if (a > 0 && e > 0)
+  {
+    const S denom = a * e - b * b;
+    if (denom > 0)
+      s = std::min(std::max((b * f - c * e) / denom, S(0)), S(1));
+    t = (b * s + f) / e;
+    if (t < 0)
+    {
+      t = 0;
+      s = std::min(std::max(-c / a, S(0)), S(1));
+    }
+    else if (t > 1)
+    {
+      t = 1;
+      s = std::min(std::max((b - c) / a, S(0)), S(1));
+    }
+  }
+  else if (a > 0)
+  {
+    s = std::min(std::max(-c / a, S(0)), S(1));
+  }
+  else if (e > 0)
+  {
+    t = std::min(std::max(f / e, S(0)), S(1));
+  }
+
+  return ((a0 + d1 * s) + (b0 + d2 * t)) / 2;
+}
+
+//==============================================================================
+// Sutherland-Hodgman clipping of a convex polygon (a point or a segment are
+// accepted as degenerate polygons) against the half-space dot(n, x) <= d.
+template <typename S>
+void clipPolygonAgainstPlane(const std::vector<Vector3<S>>& in,
+                             const Vector3<S>& n, S d,
+                             std::vector<Vector3<S>>& out)
+{
+  out.clear();
+  const std::size_t size = in.size();
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    const Vector3<S>& a = in[i];
+    const Vector3<S>& b = in[(i + 1) % size];
+    const S da = n.dot(a) - d;
+    const S db = n.dot(b) - d;
+    if (da <= 0)
+      out.push_back(a);
+    if ((da < 0 && db > 0) || (da > 0 && db < 0))
+      out.push_back(a + (b - a) * (da / (da - db)));
+  }
+}
+
+//==============================================================================
+template <typename S>
+bool boxTriangleIntersect(const Box<S>& box, const Transform3<S>& tf,
+                          const Vector3<S>& P1, const Vector3<S>& P2,
+                          const Vector3<S>& P3, Vector3<S>* contact_point,
+                          S* penetration_depth, Vector3<S>* normal)
+{
+  // Work in the box frame, where the box is centered and axis aligned.
+  const Transform3<S> X_BF = tf.inverse();
+  const Vector3<S> v[3] = {X_BF * P1, X_BF * P2, X_BF * P3};
+  const Vector3<S> edges[3] = {v[1] - v[0], v[2] - v[1], v[0] - v[2]};
+  const Vector3<S> half_size = box.side / 2;
+
+  S scale = half_size.maxCoeff();
+  for (int i = 0; i < 3; ++i)
+    scale = std::max(scale, v[i].cwiseAbs().maxCoeff());
+  // Face axes win ties with edge axes; an axis must be better by more than
+  // rounding noise to replace the current one.
+  const S tol = constants<S>::eps_34() * scale;
+
+  S min_overlap = std::numeric_limits<S>::max();
+  Vector3<S> n_best = Vector3<S>::UnitX();
+
+  // Returns false if the axis separates the shapes.
+  auto test_axis = [&](const Vector3<S>& axis) {
+    const S box_radius = half_size.dot(axis.cwiseAbs());
+    const S p0 = axis.dot(v[0]);
+    const S p1 = axis.dot(v[1]);
+    const S p2 = axis.dot(v[2]);
+    const S tri_min = std::min(p0, std::min(p1, p2));
+    const S tri_max = std::max(p0, std::max(p1, p2));
+    if (tri_min > box_radius || tri_max < -box_radius)
+      return false;
+
+    // Overlap when the triangle is pushed out along +axis or along -axis.
+    const S up = box_radius - tri_min;
+    const S down = tri_max + box_radius;
+    const S overlap = std::min(up, down);
+    if (overlap + tol < min_overlap)
+    {
+      min_overlap = overlap;
+      n_best = up <= down ? axis : Vector3<S>(-axis);
+    }
+    return true;
+  };
+
+  for (int i = 0; i < 3; ++i)
+  {
+    if (!test_axis(Vector3<S>::Unit(i)))
+      return false;
+  }
+
+  const Vector3<S> tri_normal = edges[0].cross(edges[1]);
+  const S tri_normal_norm = tri_normal.norm();
+  const bool has_normal = tri_normal_norm
+      > constants<S>::eps_34() * edges[0].norm() * edges[1].norm();
+  if (has_normal && !test_axis(Vector3<S>(tri_normal / tri_normal_norm)))
+    return false;
+
+  for (int i = 0; i < 3; ++i)
+  {
+    for (int j = 0; j < 3; ++j)
+    {
+      const Vector3<S> axis = Vector3<S>::Unit(i).cross(edges[j]);
+      const S norm = axis.norm();
+      if (norm > constants<S>::eps_34() * edges[j].norm()
+          && !test_axis(Vector3<S>(axis / norm)))
+        return false;
+    }
+  }
+
+  if (!contact_point && !penetration_depth && !normal)
+    return true;
+
+  // The normal n points from the box into the triangle. Along n, the box
+  // extends up to box_radius and the triangle down to box_radius - depth.
+  const Vector3<S>& n = n_best;
+  const S depth = min_overlap;
+  const S box_radius = half_size.dot(n.cwiseAbs());
+
+  // Find the features supporting the contact: the triangle vertices deepest
+  // along -n and the box vertices furthest along n.
+  std::vector<Vector3<S>> tri_feature;
+  for (int i = 0; i < 3; ++i)
+  {
+    if (v[i].dot(n) <= box_radius - depth + tol)
+      tri_feature.push_back(v[i]);
+  }
+
+  Vector3<S> box_vertex;
+  int free_axes[3];
+  int num_free_axes = 0;
+  for (int i = 0; i < 3; ++i)
+  {
+    if (std::abs(n[i]) <= constants<S>::eps_34())
+    {
+      box_vertex[i] = 0;
+      free_axes[num_free_axes++] = i;
+    }
+    else
+    {
+      box_vertex[i] = n[i] > 0 ? half_size[i] : -half_size[i];
+    }
+  }
+
+  Vector3<S> p;
+  bool found = true;
+  if (tri_feature.size() == 1)
+  {
+    p = tri_feature[0];
+  }
+  else if (num_free_axes == 0)
+  {
+    p = box_vertex;
+  }
+  else if (num_free_axes == 1 && tri_feature.size() == 2)
+  {
+    // Edge-edge contact.
+    Vector3<S> b0 = box_vertex;
+    Vector3<S> b1 = box_vertex;
+    b0[free_axes[0]] = -half_size[free_axes[0]];
+    b1[free_axes[0]] = half_size[free_axes[0]];
+    p = segmentSegmentMidpoint(tri_feature[0], tri_feature[1], b0, b1);
+  }
+  else if (num_free_axes == 1 && has_normal)
+  {
+    // Triangle face against box edge: clip the edge to the triangle prism.
+    const int axis = free_axes[0];
+    const Vector3<S> face_normal = tri_normal / tri_normal_norm;
+    Vector3<S> b0 = box_vertex;
+    b0[axis] = -half_size[axis];
+    const S length = 2 * half_size[axis];
+    S t0 = 0;
+    S t1 = length;
+    for (int j = 0; j < 3 && t0 <= t1; ++j)
+    {
+      // Inward normal of the triangle edge j in the triangle plane.
+      Vector3<S> m = face_normal.cross(edges[j]);
+      if (m.dot(v[(j + 2) % 3] - v[j]) < 0)
+        m = -m;
+      const S dist = m.dot(b0 - v[j]);
+      const S rate = m[axis];
+      if (rate == 0)
+      {
+        if (dist < 0) t1 = -1;
+      }
+      else if (rate > 0)
+      {
+        t0 = std::max(t0, -dist / rate);
+      }
+      else
+      {
+        t1 = std::min(t1, -dist / rate);
+      }
+    }
+    found = t0 <= t1;
+    p = b0;
+    p[axis] += (t0 + t1) / 2;
+  }
+  else
+  {
+    // Face contact: clip the triangle feature against the box slabs.
+    std::vector<Vector3<S>> polygon = tri_feature;
+    std::vector<Vector3<S>> clipped;
+    for (int i = 0; i < 3 && !polygon.empty(); ++i)
+    {
+      clipPolygonAgainstPlane(
+            polygon, Vector3<S>(Vector3<S>::Unit(i)), half_size[i] + tol,
+            clipped);
+      clipPolygonAgainstPlane(
+            clipped, Vector3<S>(-Vector3<S>::Unit(i)), half_size[i] + tol,
+            polygon);
+    }
+    found = !polygon.empty();
+    if (found)
+    {
+      p.setZero();
+      for (const auto& q : polygon)
+        p += q;
+      p /= static_cast<S>(polygon.size());
+    }
+  }
+
+  if (!found)
+  {
+    // The supporting features do not overlap laterally, which only happens
+    // within rounding noise of a touching contact; fall back to the midpoint
+    // of the feature centroids.
+    Vector3<S> tri_center = Vector3<S>::Zero();
+    for (const auto& q : tri_feature)
+      tri_center += q;
+    tri_center /= static_cast<S>(tri_feature.size());
+    p = (tri_center + box_vertex) / 2;
+  }
+
+  // Move the point halfway through the overlap along the normal.
+  p += n * (box_radius - depth / 2 - n.dot(p));
+
+  if (contact_point) *contact_point = tf * p;
+  if (penetration_depth) *penetration_depth = depth;
+  if (normal) *normal = tf.linear() * n;
+
+  return true;
+}
+
+} // namespace detail
+} // namespace fcl
+
+#endif
@@ -0,0 +1,73 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @author Jia Pan */
+
+#ifndef FCL_NARROWPHASE_DETAIL_BOXTRIANGLE_H
+#define FCL_NARROWPHASE_DETAIL_BOXTRIANGLE_H
+
+#include "fcl/geometry/shape/box.h"
+
+namespace fcl
+{
+
+namespace detail
+{
+
+/// @brief Detect collision between a box and a triangle with the separating
+/// axis test.
+///
+/// The 13 candidate axes are the three box axes, the triangle normal and the
+/// cross products of the box axes with the triangle edges. If the shapes
+/// collide (touching counts as colliding), the axis of least overlap gives
+/// the penetration depth (positive) and the normal, which points from the box
+/// into the triangle. The contact point is taken on the features of both
+/// shapes that support that axis, halfway through the overlap.
+///
+/// The triangle vertices P1, P2 and P3 are expressed in the same frame as the
+/// box pose tf, and so are the outputs. The optional outputs may be null.
+template <typename S>
+FCL_EXPORT
+bool boxTriangleIntersect(const Box<S>& box, const Transform3<S>& tf,
+                          const Vector3<S>& P1, const Vector3<S>& P2,
+                          const Vector3<S>& P3, Vector3<S>* contact_point,
+                          S* penetration_depth, Vector3<S>* normal);
+
+} // namespace detail
+} // namespace fcl
+
+#include "fcl/narrowphase/detail/primitive_shape_algorithm/box_triangle-inl.h"
+
+#endif
@@ -0,0 +1,347 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @author Jia Pan */
+
+#ifndef FCL_NARROWPHASE_DETAIL_CAPSULEBOX_INL_H
+#define FCL_NARROWPHASE_DETAIL_CAPSULEBOX_INL_H
+
+#include "fcl/narrowphase/detail/primitive_shape_algorithm/capsule_box.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "fcl/narrowphase/detail/primitive_shape_algorithm/sphere_box.h"
+
+namespace fcl {
+namespace detail {
+
+extern template FCL_EXPORT bool
+capsuleBoxIntersect(const Capsule<double>& capsule,
+                    const Transform3<double>& X_FC, const Box<double>& box,
+                    const Transform3<double>& X_FB,
+                    std::vector<ContactPoint<double>>* contacts);
+
+//==============================================================================
+
+extern template FCL_EXPORT bool
+capsuleBoxDistance(const Capsule<double>& capsule,
+                   const Transform3<double>& X_FC, const Box<double>& box,
+                   const Transform3<double>& X_FB, double* distance,
+                   Vector3<double>* p_FCb, Vector3<double>* p_FBc);
+
+//==============================================================================
+
+// Helper function for capsule-box queries. Given a box defined in its
+// canonical frame B with the given half sizes and the segment
+// A(t) = A + t * v, t in [0, 1], finds the parameter of the point on the
+// segment nearest to the (solid) box.
+//
+// The squared distance from A(t) to the box is the sum over the three axes of
+// the squared amount by which A(t) leaves the slab |x_i| <= half_size_i. On
+// each interval between slab crossings the set of violated slabs is fixed, so
+// the function is a single convex quadratic whose minimum is found in closed
+// form and clamped to the interval.
+// @param half_size       The half sizes of the box.
+// @param p_BA            The start point A of the segment, in frame B.
+// @param v_B             The segment vector, in frame B.
+// @param[out] t_ptr      The parameter of the nearest point on the segment.
+// @returns the squared distance between the segment and the box.
+template <typename S>
+S segmentBoxSquaredDistance(const Vector3<S>& half_size,
+                            const Vector3<S>& p_BA, const Vector3<S>& v_B,
+                            S* t_ptr) {
+  assert(t_ptr != nullptr);
+
+  // Squared distance from A(t) to the box.
+  auto squared_distance = [&](S t) {
+    S sum{0};
+    for (int i = 0; i < 3; ++i) {
+      const S excess = std::abs(p_BA(i) + t * v_B(i)) - half_size(i);
+      if (excess > 0) sum += excess * excess;
+    }
+    return sum;
+  };
+
+  // At most two slab crossings per axis, plus the segment end points. The
+  // crossings are inserted in order, which is cheap for so few entries.
+  S breaks[8];
+  int num_breaks = 0;
+  breaks[num_breaks++] = 0;
+  for (int i = 0; i < 3; ++i) {
+    if (v_B(i) == 0) continue;
+    const S sides[2] = {-half_size(i), half_size(i)};
+    for (S side : sides) {
+      const S t = (side - p_BA(i)) / v_B(i);
+      if (!(t > 0 && t < 1)) continue;
+      int k = num_breaks++;
+      for (; breaks[k - 1] > t; --k) breaks[k] = breaks[k - 1];
+      breaks[k] = t;
+    }
+  }
+  breaks[num_breaks++] = 1;
+
+  S best_t{0};
+  S best_squared_distance = squared_distance(best_t);
+  for (int k = 0; k + 1 < num_breaks; ++k) {
+    const S t0 = breaks[k];
+    const S t1 = breaks[k + 1];
+    const S t_mid = (t0 + t1) / 2;
+
+    // On this interval, each violated slab contributes (c_i + t * v_i)^2.
+    S num{0};
+    S den{0};
+    for (int i = 0; i < 3; ++i) {
+      const S x = p_BA(i) + t_mid * v_B(i);
+      S c;
+      if (x > half_size(i))
+        c = p_BA(i) - half_size(i);
+      else if (x < -half_size(i))
+        c = p_BA(i) + half_size(i);
+      else
+        continue;
+      num += c * v_B(i);
+      den += v_B(i) * v_B(i);
+    }
+
+    const S t = den > 0 ? std::min(std::max(-num / den, t0), t1) : t0;
+    const S value = squared_distance(t);
+    if (value < best_squared_distance) {
+      best_squared_distance = value;
+      best_t = t;
+    }
+  }
+
+  *t_ptr = best_t;
+  return best_squared_distance;
+}
+
+//==============================================================================
+
+// Helper function for capsule-box queries. Clips the segment A(t) = A + t * v,
+// t in [0, 1], against the box with the given half sizes in its canonical
+// frame B. Returns false if no part of the segment lies inside the box.
+template <typename S>
+bool clipSegmentToBox(const Vector3<S>& half_size, const Vector3<S>& p_BA,
+                      const Vector3<S>& v_B, S* t_enter, S* t_exit) {
+  S t0{0};
+  S t1{1};
+  for (int i = 0; i < 3; ++i) {
+    if (v_B(i) == 0) {
+      if (std::abs(p_BA(i)) > half_size(i)) return false;
+      continue;
+    }
+    S ta = (-half_size(i) - p_BA(i)) / v_B(i);
+    S tb = (half_size(i) - p_BA(i)) / v_B(i);
+    if (ta > tb) std::swap(ta, tb);
+    t0 = std::max(t0, ta);
+    t1 = std::min(t1, tb);
+    if (t0 > t1) return false;
+  }
+  *t_enter = t0;
+  *t_exit = t1;
+  return true;
+}
+
+//==============================================================================
+
+// Helper function for capsule-box queries. Computes the penetration of the
+// segment from P0 to P1 into the box with the given half sizes in its
+// canonical frame B by the separating axis test. The candidate axes are the
+// box axes and the cross products of the segment direction with them.
+// @param[out] depth      The penetration depth of the segment.
+// @param[out] n_B        The unit normal pointing from the segment into the
+//                        box, in frame B.
+// @param[out] p_BS       The point of the segment deepest along n_B.
+template <typename S>
+void segmentBoxPenetration(const Vector3<S>& half_size,
+                           const Vector3<S>& p_BP0, const Vector3<S>& p_BP1,
+                           S* depth, Vector3<S>* n_B, Vector3<S>* p_BS) {
+  const Vector3<S> center = (p_BP0 + p_BP1) / 2;
+  const Vector3<S> half_extent = (p_BP1 - p_BP0) / 2;
+  const S half_length = half_extent.norm();
+
+  // Face axes win ties with edge axes; an edge axis must be better by more
+  // than rounding noise to be chosen.
+  const S tol = constants<S>::eps_34()
+      * (half_size.maxCoeff() + center.cwiseAbs().maxCoeff() + half_length);
+
+  S min_overlap = std::numeric_limits<S>::max();
+  auto test_axis = [&](const Vector3<S>& axis) {
+    const S box_radius = half_size.dot(axis.cwiseAbs());
+    const S segment_radius = std::abs(half_extent.dot(axis));
+    const S separation = axis.dot(center);
+    const S overlap = box_radius + segment_radius - std::abs(separation);
+    if (overlap + tol < min_overlap) {
+      min_overlap = overlap;
+      // The box is centered at the origin, so the segment is on the side of
+      // the sign of the separation; the normal points back towards the box.
+      *n_B = separation >= 0 ? Vector3<S>(-axis) : axis;
+    }
+  };
+
+  for (int i = 0; i < 3; ++i)
+    test_axis(Vector3<S>::Unit(i));
+
+  if (half_length > constants<S>::eps_34()) {
+    const Vector3<S> u = half_extent / half_length;
+    for (int i = 0; i < 3; ++i) {
+      const Vector3<S> axis = u.cross(Vector3<S>::Unit(i));
+      const S norm = axis.norm();
+      if (norm > constants<S>::eps_34()) test_axis(axis / norm);
+    }
+  }
+
+  *depth = min_overlap;
+
+  // The deepest point of the segment along the normal is an end point unless
+  // the segment is perpendicular to the normal; then use the middle of the
+  // part of the segment inside the box.
+  const S d0 = p_BP0.dot(*n_B);
+  const S d1 = p_BP1.dot(*n_B);
+  if (std::abs(d0 - d1) > tol) {
+    *p_BS = d0 > d1 ? p_BP0 : p_BP1;
+  } else {
+    S t0, t1;
+    const Vector3<S> v = p_BP1 - p_BP0;
+    if (clipSegmentToBox(half_size, p_BP0, v, &t0, &t1))
+      *p_BS = p_BP0 + v * ((t0 + t1) / 2);
+    else
+      *p_BS = center;
+  }
+}
+
+//==============================================================================
+
+template <typename S>
+FCL_EXPORT bool capsuleBoxIntersect(const Capsule<S>& capsule,
+                                    const Transform3<S>& X_FC,
+                                    const Box<S>& box,
+                                    const Transform3<S>& X_FB,
+                                    std::vector<ContactPoint<S>>* contacts) {
+  const S r = capsule.radius;
+  // Find the end points of the capsule's core segment in the box's frame.
+  const Transform3<S> X_BC = X_FB.inverse() * X_FC;
+  const Vector3<S> p_BP0 = X_BC * Vector3<S>(0, 0, -capsule.lz / 2);
+  const Vector3<S> p_BP1 = X_BC * Vector3<S>(0, 0, capsule.lz / 2);
+  const Vector3<S> v_B = p_BP1 - p_BP0;
+  const Vector3<S> half_size = box.side / 2;
+
+  S t;
+  const S squared_distance =
+      segmentBoxSquaredDistance(half_size, p_BP0, v_B, &t);
+  if (squared_distance > r * r)
+    return false;
+
+  // Now we know they are colliding.
+
+  if (contacts != nullptr) {
+    S depth;
+    Vector3<S> n_CB_B; // Normal pointing from capsule into box (in box frame)
+    Vector3<S> p_BP;   // Contact position (P) in the box frame.
+    // Same precision argument as in sphereBoxIntersect: the segment only
+    // counts as outside the box if it is further than this epsilon from it.
+    const auto eps = 16 * constants<S>::eps();
+    if (squared_distance > eps * eps) {
+      // The segment is outside the box. The capsule behaves like a sphere
+      // centered on the nearest point of the segment.
+      const Vector3<S> p_BQ = p_BP0 + t * v_B;
+      Vector3<S> p_BN;
+      nearestPointInBox(box.side, p_BQ, &p_BN);
+      const S distance = std::sqrt(squared_distance);
+      n_CB_B = (p_BN - p_BQ) / distance;
+      depth = r - distance;
+      p_BP = p_BN + n_CB_B * (depth / 2);
+    } else {
+      // The segment is inside the box. Rounding the segment by r moves its
+      // support point along the normal by exactly r.
+      S segment_depth;
+      Vector3<S> p_BS;
+      segmentBoxPenetration(half_size, p_BP0, p_BP1, &segment_depth, &n_CB_B,
+                            &p_BS);
+      depth = segment_depth + r;
+      // Midway between the deepest point of the capsule and the box surface.
+      p_BP = p_BS + n_CB_B * (r - depth / 2);
+    }
+    contacts->emplace_back(X_FB.linear() * n_CB_B, X_FB * p_BP, depth);
+  }
+  return true;
+}
+
+//==============================================================================
+
+template <typename S>
+FCL_EXPORT bool capsuleBoxDistance(const Capsule<S>& capsule,
+                                   const Transform3<S>& X_FC,
+                                   const Box<S>& box,
+                                   const Transform3<S>& X_FB, S* distance,
+                                   Vector3<S>* p_FCb, Vector3<S>* p_FBc) {
+  const S r = capsule.radius;
+  const Transform3<S> X_BC = X_FB.inverse() * X_FC;
+  const Vector3<S> p_BP0 = X_BC * Vector3<S>(0, 0, -capsule.lz / 2);
+  const Vector3<S> p_BP1 = X_BC * Vector3<S>(0, 0, capsule.lz / 2);
+  const Vector3<S> v_B = p_BP1 - p_BP0;
+
+  S t;
+  const S squared_distance =
+      segmentBoxSquaredDistance(Vector3<S>(box.side / 2), p_BP0, v_B, &t);
+
+  if (squared_distance > r * r) {
+    // The nearest point of the core segment is farther than the radius; we
+    // have proven separation.
+    const S d = std::sqrt(squared_distance);
+    const Vector3<S> p_BQ = p_BP0 + t * v_B;
+    Vector3<S> p_BN;
+    nearestPointInBox(box.side, p_BQ, &p_BN);
+    if (distance != nullptr)
+      *distance = d - r;
+    if (p_FBc != nullptr)
+      *p_FBc = X_FB * p_BN;
+    if (p_FCb != nullptr) {
+      const Vector3<S> p_BCb = p_BQ + (p_BN - p_BQ) * (r / d);
+      *p_FCb = X_FB * p_BCb;
+    }
+    return true;
+  }
+
+  // We didn't *prove* separation, so we must be in penetration.
+  if (distance != nullptr) *distance = -1;
+  return false;
+}
+
+} // namespace detail
+} // namespace fcl
+
+#endif // FCL_NARROWPHASE_DETAIL_CAPSULEBOX_INL_H
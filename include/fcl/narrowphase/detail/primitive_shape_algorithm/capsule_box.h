@@ -0,0 +1,130 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @author Jia Pan */
+
+#ifndef FCL_NARROWPHASE_DETAIL_CAPSULEBOX_H
+#define FCL_NARROWPHASE_DETAIL_CAPSULEBOX_H
+
+#include "fcl/geometry/shape/box.h"
+#include "fcl/geometry/shape/capsule.h"
+#include "fcl/narrowphase/contact_point.h"
+
+namespace fcl {
+
+namespace detail {
+
+/** @name       Custom capsule-box proximity algorithms
+
+ These functions provide custom algorithms for analyzing the relationship
+ between a capsule and a box. They replace the generic GJK/MPR fallback for
+ this pair.
+
+ A capsule is the Minkowski sum of its core segment and a ball of radius r, so
+ every query reduces to an exact segment-box query plus r:
+
+   - The squared distance from the segment to the box is a convex, piecewise
+     quadratic function of the segment parameter. Its pieces are delimited by
+     the parameters at which the segment crosses the box's slab planes, so the
+     minimum is found exactly by minimizing each piece in closed form.
+   - If the segment itself penetrates the box, the penetration depth is found
+     with the separating axis test over the three box axes and the cross
+     products of the segment direction with the box axes. Those are all the
+     face normals of the Minkowski difference of the box and the segment.
+
+ These functions use the same
+ [Drake monogram
+ notation](http://drake.mit.edu/doxygen_cxx/group__multibody__notation__basics.html)
+ and the same touching-is-colliding convention as the sphere-box functions.
+ Both shapes must be posed in a common frame F and all results are reported
+ in F.
+ */
+
+//@{
+
+/** Detect collision between the capsule and box. If colliding, return
+ characterization of collision in the provided vector.
+
+ The reported normal points from the capsule into the box. While the core
+ segment of the capsule lies outside the box, the depth, normal and contact
+ position are continuous with respect to the relative pose. Once the segment
+ enters the box the normal is chosen from a finite set of axes and may jump
+ between them; box face axes are preferred when several axes give the same
+ depth.
+
+ @param capsule        The capsule geometry.
+ @param X_FC           The pose of the capsule C in the common frame F.
+ @param box            The box geometry.
+ @param X_FB           The pose of the box B in the common frame F.
+ @param contacts[out]  (optional) If the shapes collide, the contact point data
+                       will be appended to the end of this vector.
+ @return True if the objects are colliding (including touching).
+ @tparam S The scalar parameter (must be a valid Eigen scalar).  */
+template <typename S>
+FCL_EXPORT bool capsuleBoxIntersect(const Capsule<S>& capsule,
+                                    const Transform3<S>& X_FC,
+                                    const Box<S>& box,
+                                    const Transform3<S>& X_FB,
+                                    std::vector<ContactPoint<S>>* contacts);
+
+/** Evaluate the minimum separating distance between a capsule and box. If
+ separated, the nearest points on each shape will be returned in frame F.
+ @param capsule        The capsule geometry.
+ @param X_FC           The pose of the capsule C in the common frame F.
+ @param box            The box geometry.
+ @param X_FB           The pose of the box B in the common frame F.
+ @param distance[out]  (optional) The separating distance between the capsule
+                       and box. Set to -1 if the shapes are penetrating.
+ @param p_FCb[out]     (optional) The closest point on the *capsule* to the box
+                       measured and expressed in frame F.
+ @param p_FBc[out]     (optional) The closest point on the *box* to the capsule
+                       measured and expressed in frame F.
+ @return True if the objects are separated.
+ @tparam S The scalar parameter (must be a valid Eigen scalar).  */
+template <typename S>
+FCL_EXPORT bool capsuleBoxDistance(const Capsule<S>& capsule,
+                                   const Transform3<S>& X_FC,
+                                   const Box<S>& box,
+                                   const Transform3<S>& X_FB, S* distance,
+                                   Vector3<S>* p_FCb, Vector3<S>* p_FBc);
+
+//@}
+
+} // namespace detail
+} // namespace fcl
+
+#include "fcl/narrowphase/detail/primitive_shape_algorithm/capsule_box-inl.h"
+
+#endif // FCL_NARROWPHASE_DETAIL_CAPSULEBOX_H
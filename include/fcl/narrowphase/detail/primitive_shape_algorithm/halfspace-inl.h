@@ -497,20 +497,10 @@ bool convexHalfspaceIntersect(const Convex<S>& s1, const Transform3<S>& tf1,
 {
   Halfspace<S> new_s2 = transform(s2, tf2);
 
-  Vector3<S> v;
-  S depth = std::numeric_limits<S>::max();
-
-  for (const auto& vertex : s1.getVertices())
-  {
-    Vector3<S> p = tf1 * vertex;
-
-    S d = new_s2.signedDistance(p);
-    if(d < depth)
-    {
-      depth = d;
-      v = p;
-    }
-  }
+  // The deepest vertex is the support vertex opposite to the normal
+  const Vector3<S> v =
+      tf1 * s1.findExtremeVertex(-(tf1.linear().transpose() * new_s2.n));
+  const S depth = new_s2.signedDistance(v);
 
   if(depth <= 0)
   {
@@ -645,18 +645,13 @@ bool convexPlaneIntersect(const Convex<S>& s1, const Transform3<S>& tf1,
 {
   Plane<S> new_s2 = transform(s2, tf2);
 
-  Vector3<S> v_min, v_max;
-  S d_min = std::numeric_limits<S>::max(), d_max = -std::numeric_limits<S>::max();
-
-  for (const auto& vertex : s1.getVertices())
-  {
-    Vector3<S> p = tf1 * vertex;
-
-    S d = new_s2.signedDistance(p);
-
-    if(d < d_min) { d_min = d; v_min = p; }
-    if(d > d_max) { d_max = d; v_max = p; }
-  }
+  // The vertices furthest on either side are the support vertices along and
+  // opposite to the normal
+  const Vector3<S> n = tf1.linear().transpose() * new_s2.n;
+  const Vector3<S> v_min = tf1 * s1.findExtremeVertex(-n);
+  const Vector3<S> v_max = tf1 * s1.findExtremeVertex(n);
+  const S d_min = new_s2.signedDistance(v_min);
+  const S d_max = new_s2.signedDistance(v_max);
 
   if(d_min * d_max > 0) return false;
   else
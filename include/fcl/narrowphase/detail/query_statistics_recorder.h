@@ -0,0 +1,239 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/** @author Jia Pan */
+
+#ifndef FCL_NARROWPHASE_DETAIL_QUERYSTATISTICSRECORDER_H
+#define FCL_NARROWPHASE_DETAIL_QUERYSTATISTICSRECORDER_H
+
+#include <chrono>
+
+#include "fcl/config.h"
+#include "fcl/common/unused.h"
+#include "fcl/common/detail/counters.h"
+#include "fcl/narrowphase/query_statistics.h"
+
+namespace fcl
+{
+
+namespace detail
+{
+
+/// @brief Records the statistics of one collision or distance query.
+///
+/// While a recorder is alive, the solvers and traversals running on the same
+/// thread add their work to it through add(). Recorders nest: the work of an
+/// inner query is also added to the query that issued it, and a query that
+/// does not request statistics adds its work to the enclosing recorder, if
+/// any. Without an active recorder, add() costs one thread-local load.
+class FCL_EXPORT QueryStatisticsRecorder
+{
+public:
+  /// @brief Start recording into the given statistics, or do nothing if it is
+  /// null
+  explicit QueryStatisticsRecorder(QueryStatistics* statistics);
+
+  /// @brief Add the recorded work and time to the statistics
+  ~QueryStatisticsRecorder();
+
+  QueryStatisticsRecorder(const QueryStatisticsRecorder&) = delete;
+  QueryStatisticsRecorder& operator=(const QueryStatisticsRecorder&) = delete;
+
+  /// @brief Statistics of the innermost query recorded on the calling thread,
+  /// or nullptr
+  static QueryStatistics* active();
+
+  /// @brief Add n to one field of the active statistics, if any
+  static void add(std::size_t QueryStatistics::* field, std::size_t n);
+
+private:
+  static QueryStatistics*& activeSlot();
+
+  QueryStatistics* statistics_;
+  QueryStatistics* outer_;
+  QueryStatistics local_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+/// @brief Adds n units of work of a solver or traversal to both its sinks:
+/// the profiling counter, when built with FCL_ENABLE_PROFILING and counting
+/// is on, and one field of the active statistics, if any.
+void recordWork(Counter counter, std::size_t QueryStatistics::* field,
+                std::size_t n);
+
+/// @brief Records the value of a variable as work (see recordWork()) when it
+/// goes out of scope; meant for loop counters of functions with several
+/// exits.
+template <typename T>
+class ScopedWorkCount
+{
+public:
+  ScopedWorkCount(Counter counter, std::size_t QueryStatistics::* field,
+                  const T& value);
+
+  ~ScopedWorkCount();
+
+  ScopedWorkCount(const ScopedWorkCount&) = delete;
+  ScopedWorkCount& operator=(const ScopedWorkCount&) = delete;
+
+private:
+  Counter counter_;
+  std::size_t QueryStatistics::* field_;
+  const T& value_;
+};
+
+/// @brief While counting is on or a query is recorded, turns on the
+/// statistics of a BVH traversal node and records the BV and leaf tests the
+/// node performed during its lifetime as work (see recordWork()).
+class FCL_EXPORT ScopedTraversalWork
+{
+public:
+  ScopedTraversalWork(
+      bool& enable_statistics, const int& num_bv_tests,
+      const int& num_leaf_tests);
+
+  ~ScopedTraversalWork();
+
+  ScopedTraversalWork(const ScopedTraversalWork&) = delete;
+  ScopedTraversalWork& operator=(const ScopedTraversalWork&) = delete;
+
+private:
+  /// @brief Whether the profiling counters are compiled in and on
+  static bool countersEnabled();
+
+  bool counting_;
+  QueryStatistics* statistics_;
+  bool& enable_statistics_;
+  const int& num_bv_tests_;
+  const int& num_leaf_tests_;
+  bool was_enabled_;
+  int start_bv_tests_;
+  int start_leaf_tests_;
+};
+
+//==============================================================================
+inline void QueryStatisticsRecorder::add(
+    std::size_t QueryStatistics::* field, std::size_t n)
+{
+  QueryStatistics* statistics = active();
+  if(statistics)
+    statistics->*field += n;
+}
+
+//==============================================================================
+inline void recordWork(
+    Counter counter, std::size_t QueryStatistics::* field, std::size_t n)
+{
+#if FCL_ENABLE_PROFILING
+  Counters::add(counter, n);
+#else
+  FCL_UNUSED(counter);
+#endif
+  QueryStatisticsRecorder::add(field, n);
+}
+
+//==============================================================================
+template <typename T>
+ScopedWorkCount<T>::ScopedWorkCount(
+    Counter counter, std::size_t QueryStatistics::* field, const T& value)
+  : counter_(counter), field_(field), value_(value)
+{
+  // Do nothing
+}
+
+//==============================================================================
+template <typename T>
+ScopedWorkCount<T>::~ScopedWorkCount()
+{
+  recordWork(counter_, field_, static_cast<std::size_t>(value_));
+}
+
+//==============================================================================
+inline bool ScopedTraversalWork::countersEnabled()
+{
+#if FCL_ENABLE_PROFILING
+  return Counters::enabled();
+#else
+  return false;
+#endif
+}
+
+//==============================================================================
+inline ScopedTraversalWork::ScopedTraversalWork(
+    bool& enable_statistics, const int& num_bv_tests, const int& num_leaf_tests)
+  : counting_(countersEnabled()),
+    statistics_(QueryStatisticsRecorder::active()),
+    enable_statistics_(enable_statistics),
+    num_bv_tests_(num_bv_tests),
+    num_leaf_tests_(num_leaf_tests),
+    was_enabled_(enable_statistics),
+    start_bv_tests_(num_bv_tests),
+    start_leaf_tests_(num_leaf_tests)
+{
+  if(counting_ || statistics_)
+    enable_statistics_ = true;
+}
+
+//==============================================================================
+inline ScopedTraversalWork::~ScopedTraversalWork()
+{
+  if(!counting_ && !statistics_)
+    return;
+
+  const std::size_t num_bv_tests
+      = static_cast<std::size_t>(num_bv_tests_ - start_bv_tests_);
+  const std::size_t num_leaf_tests
+      = static_cast<std::size_t>(num_leaf_tests_ - start_leaf_tests_);
+
+  if(counting_)
+  {
+    Counters::add(Counter::BVTests, num_bv_tests);
+    Counters::add(Counter::LeafTests, num_leaf_tests);
+  }
+
+  if(statistics_)
+  {
+    statistics_->num_bv_tests += num_bv_tests;
+    statistics_->num_leaf_tests += num_leaf_tests;
+  }
+
+  enable_statistics_ = was_enabled_;
+}
+
+} // namespace detail
+} // namespace fcl
+
+#endif
@@ -88,9 +88,6 @@ public:
   /// @brief The second BVH model
   const BVHModel<BV>* model2;
 
-  /// @brief statistical information
-  mutable int num_bv_tests;
-  mutable int num_leaf_tests;
   mutable S query_time_seconds;
 };
 
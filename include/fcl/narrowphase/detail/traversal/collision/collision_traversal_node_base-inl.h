@@ -55,7 +55,8 @@ class FCL_EXPORT CollisionTraversalNodeBase<double>;
 //==============================================================================
 template <typename S>
 CollisionTraversalNodeBase<S>::CollisionTraversalNodeBase()
-  : result(nullptr), enable_statistics(false)
+  : result(nullptr), enable_statistics(false), num_bv_tests(0),
+    num_leaf_tests(0)
 {
   // Do nothing
 }
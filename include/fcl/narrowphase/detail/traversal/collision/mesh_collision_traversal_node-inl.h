@@ -110,6 +110,21 @@ bool initialize(
     const CollisionRequest<double>& request,
     CollisionResult<double>& result);
 
+//==============================================================================
+extern template
+class FCL_EXPORT MeshCollisionTraversalNodeFloatOBBRSS<double>;
+
+//==============================================================================
+extern template
+bool initialize(
+    MeshCollisionTraversalNodeFloatOBBRSS<double>& node,
+    const BVHModel<FloatOBBRSS<double>>& model1,
+    const Transform3<double>& tf1,
+    const BVHModel<FloatOBBRSS<double>>& model2,
+    const Transform3<double>& tf2,
+    const CollisionRequest<double>& request,
+    CollisionResult<double>& result);
+
 //==============================================================================
 template <typename BV>
 MeshCollisionTraversalNode<BV>::MeshCollisionTraversalNode()
@@ -119,84 +134,42 @@ MeshCollisionTraversalNode<BV>::MeshCollisionTraversalNode()
   vertices2 = nullptr;
   tri_indices1 = nullptr;
   tri_indices2 = nullptr;
+
+  tf.setIdentity();
 }
 
 //==============================================================================
 template <typename BV>
-void MeshCollisionTraversalNode<BV>::leafTesting(int b1, int b2) const
+bool MeshCollisionTraversalNode<BV>::BVTesting(int b1, int b2) const
 {
-  if(this->enable_statistics) this->num_leaf_tests++;
-
-  const BVNode<BV>& node1 = this->model1->getBV(b1);
-  const BVNode<BV>& node2 = this->model2->getBV(b2);
-
-  int primitive_id1 = node1.primitiveId();
-  int primitive_id2 = node2.primitiveId();
-
-  const Triangle& tri_id1 = tri_indices1[primitive_id1];
-  const Triangle& tri_id2 = tri_indices2[primitive_id2];
-
-  const Vector3<S>& p1 = vertices1[tri_id1[0]];
-  const Vector3<S>& p2 = vertices1[tri_id1[1]];
-  const Vector3<S>& p3 = vertices1[tri_id1[2]];
-  const Vector3<S>& q1 = vertices2[tri_id2[0]];
-  const Vector3<S>& q2 = vertices2[tri_id2[1]];
-  const Vector3<S>& q3 = vertices2[tri_id2[2]];
-
-  if(this->model1->isOccupied() && this->model2->isOccupied())
-  {
-    bool is_intersect = false;
-
-    if(!this->request.enable_contact) // only interested in collision or not
-    {
-      if(Intersect<S>::intersect_Triangle(p1, p2, p3, q1, q2, q3))
-      {
-        is_intersect = true;
-        if(this->result->numContacts() < this->request.num_max_contacts)
-          this->result->addContact(Contact<S>(this->model1, this->model2, primitive_id1, primitive_id2));
-      }
-    }
-    else // need compute the contact information
-    {
-      S penetration;
-      Vector3<S> normal;
-      unsigned int n_contacts;
-      Vector3<S> contacts[2];
-
-      if(Intersect<S>::intersect_Triangle(p1, p2, p3, q1, q2, q3,
-                                       contacts,
-                                       &n_contacts,
-                                       &penetration,
-                                       &normal))
-      {
-        is_intersect = true;
-
-        if(this->request.num_max_contacts < n_contacts + this->result->numContacts())
-          n_contacts = (this->request.num_max_contacts >= this->result->numContacts()) ? (this->request.num_max_contacts - this->result->numContacts()) : 0;
+  if(this->enable_statistics) this->num_bv_tests++;
 
-        for(unsigned int i = 0; i < n_contacts; ++i)
-        {
-          this->result->addContact(Contact<S>(this->model1, this->model2, primitive_id1, primitive_id2, contacts[i], normal, penetration));
-        }
-      }
-    }
+  BV bv2;
+  transformBV(this->model2->getBV(b2).bv, tf, bv2);
+  return !this->model1->getBV(b1).bv.overlap(bv2);
+}
 
-    if(is_intersect && this->request.enable_cost)
-    {
-      AABB<S> overlap_part;
-      AABB<S>(p1, p2, p3).overlap(AABB<S>(q1, q2, q3), overlap_part);
-      this->result->addCostSource(CostSource<S>(overlap_part, cost_density), this->request.num_max_cost_sources);
-    }
-  }
-  else if((!this->model1->isFree() && !this->model2->isFree()) && this->request.enable_cost)
-  {
-    if(Intersect<S>::intersect_Triangle(p1, p2, p3, q1, q2, q3))
-    {
-      AABB<S> overlap_part;
-      AABB<S>(p1, p2, p3).overlap(AABB<S>(q1, q2, q3), overlap_part);
-      this->result->addCostSource(CostSource<S>(overlap_part, cost_density), this->request.num_max_cost_sources);
-    }
-  }
+//==============================================================================
+template <typename BV>
+void MeshCollisionTraversalNode<BV>::leafTesting(int b1, int b2) const
+{
+  detail::meshCollisionOrientedNodeLeafTesting(
+        b1,
+        b2,
+        this->model1,
+        this->model2,
+        vertices1,
+        vertices2,
+        tri_indices1,
+        tri_indices2,
+        tf,
+        this->tf1,
+        this->tf2,
+        this->enable_statistics,
+        cost_density,
+        this->num_leaf_tests,
+        this->request,
+        *this->result);
 }
 
 //==============================================================================
@@ -210,55 +183,17 @@ bool MeshCollisionTraversalNode<BV>::canStop() const
 template <typename BV>
 bool initialize(
     MeshCollisionTraversalNode<BV>& node,
-    BVHModel<BV>& model1,
-    Transform3<typename BV::S>& tf1,
-    BVHModel<BV>& model2,
-    Transform3<typename BV::S>& tf2,
+    const BVHModel<BV>& model1,
+    const Transform3<typename BV::S>& tf1,
+    const BVHModel<BV>& model2,
+    const Transform3<typename BV::S>& tf2,
     const CollisionRequest<typename BV::S>& request,
-    CollisionResult<typename BV::S>& result,
-    bool use_refit,
-    bool refit_bottomup)
+    CollisionResult<typename BV::S>& result)
 {
-  using S = typename BV::S;
-
   if(model1.getModelType() != BVH_MODEL_TRIANGLES
      || model2.getModelType() != BVH_MODEL_TRIANGLES)
     return false;
 
-  if(!tf1.matrix().isIdentity())
-  {
-    std::vector<Vector3<S>> vertices_transformed1(model1.num_vertices);
-    for(int i = 0; i < model1.num_vertices; ++i)
-    {
-      Vector3<S>& p = model1.vertices[i];
-      Vector3<S> new_v = tf1 * p;
-      vertices_transformed1[i] = new_v;
-    }
-
-    model1.beginReplaceModel();
-    model1.replaceSubModel(vertices_transformed1);
-    model1.endReplaceModel(use_refit, refit_bottomup);
-
-    tf1.setIdentity();
-  }
-
-  if(!tf2.matrix().isIdentity())
-  {
-    std::vector<Vector3<S>> vertices_transformed2(model2.num_vertices);
-    for(int i = 0; i < model2.num_vertices; ++i)
-    {
-      Vector3<S>& p = model2.vertices[i];
-      Vector3<S> new_v = tf2 * p;
-      vertices_transformed2[i] = new_v;
-    }
-
-    model2.beginReplaceModel();
-    model2.replaceSubModel(vertices_transformed2);
-    model2.endReplaceModel(use_refit, refit_bottomup);
-
-    tf2.setIdentity();
-  }
-
   node.model1 = &model1;
   node.tf1 = tf1;
   node.model2 = &model2;
@@ -275,6 +210,8 @@ bool initialize(
 
   node.cost_density = model1.cost_density * model2.cost_density;
 
+  node.tf = tf1.inverse(Eigen::Isometry) * tf2;
+
   return true;
 }
 
@@ -523,6 +460,48 @@ void MeshCollisionTraversalNodeOBBRSS<S>::leafTesting(int b1, int b2) const
         *this->result);
 }
 
+//==============================================================================
+template <typename S>
+MeshCollisionTraversalNodeFloatOBBRSS<S>::MeshCollisionTraversalNodeFloatOBBRSS()
+  : MeshCollisionTraversalNode<FloatOBBRSS<S>>(),
+    R(Matrix3<S>::Identity())
+{
+  // Do nothing
+}
+
+//==============================================================================
+template <typename S>
+bool MeshCollisionTraversalNodeFloatOBBRSS<S>::BVTesting(int b1, int b2) const
+{
+  if(this->enable_statistics) this->num_bv_tests++;
+
+  return !overlap(R, T, this->model1->getBV(b1).bv, this->model2->getBV(b2).bv);
+}
+
+//==============================================================================
+template <typename S>
+void MeshCollisionTraversalNodeFloatOBBRSS<S>::leafTesting(int b1, int b2) const
+{
+  detail::meshCollisionOrientedNodeLeafTesting(
+        b1,
+        b2,
+        this->model1,
+        this->model2,
+        this->vertices1,
+        this->vertices2,
+        this->tri_indices1,
+        this->tri_indices2,
+        R,
+        T,
+        this->tf1,
+        this->tf2,
+        this->enable_statistics,
+        this->cost_density,
+        this->num_leaf_tests,
+        this->request,
+        *this->result);
+}
+
 template <typename BV>
 void meshCollisionOrientedNodeLeafTesting(
     int b1, int b2,
@@ -804,6 +783,21 @@ bool initialize(
         node, model1, tf1, model2, tf2, request, result);
 }
 
+//==============================================================================
+template <typename S>
+bool initialize(
+    MeshCollisionTraversalNodeFloatOBBRSS<S>& node,
+    const BVHModel<FloatOBBRSS<S>>& model1,
+    const Transform3<S>& tf1,
+    const BVHModel<FloatOBBRSS<S>>& model2,
+    const Transform3<S>& tf2,
+    const CollisionRequest<S>& request,
+    CollisionResult<S>& result)
+{
+  return detail::setupMeshCollisionOrientedNode(
+        node, model1, tf1, model2, tf2, request, result);
+}
+
 } // namespace detail
 } // namespace fcl
 
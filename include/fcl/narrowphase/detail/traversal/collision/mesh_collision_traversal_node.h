@@ -41,7 +41,9 @@
 #include "fcl/math/bv/OBB.h"
 #include "fcl/math/bv/RSS.h"
 #include "fcl/math/bv/OBBRSS.h"
+#include "fcl/math/bv/FloatOBBRSS.h"
 #include "fcl/math/bv/kIOS.h"
+#include "fcl/math/bv/utility.h"
 #include "fcl/narrowphase/contact.h"
 #include "fcl/narrowphase/cost_source.h"
 #include "fcl/narrowphase/detail/traversal/collision/intersect.h"
@@ -63,6 +65,10 @@ public:
 
   MeshCollisionTraversalNode();
 
+  /// @brief BV culling test in one BVTT node, with the BV of model2 bounded in
+  /// the frame of model1
+  bool BVTesting(int b1, int b2) const;
+
   /// @brief Intersection testing between leaves (two triangles)
   void leafTesting(int b1, int b2) const;
 
@@ -76,22 +82,26 @@ public:
   Triangle* tri_indices2;
 
   S cost_density;
+
+  /// @brief The pose of model2 in the frame of model1
+  Transform3<S> tf;
+
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 };
 
 /// @brief Initialize traversal node for collision between two meshes, given the
-/// current transforms
+/// current transforms. Neither mesh is modified: the traversal runs in the
+/// frame of model1.
 template <typename BV>
 FCL_EXPORT
 bool initialize(
     MeshCollisionTraversalNode<BV>& node,
-    BVHModel<BV>& model1,
-    Transform3<typename BV::S>& tf1,
-    BVHModel<BV>& model2,
-    Transform3<typename BV::S>& tf2,
+    const BVHModel<BV>& model1,
+    const Transform3<typename BV::S>& tf1,
+    const BVHModel<BV>& model2,
+    const Transform3<typename BV::S>& tf2,
     const CollisionRequest<typename BV::S>& request,
-    CollisionResult<typename BV::S>& result,
-    bool use_refit = false,
-    bool refit_bottomup = false);
+    CollisionResult<typename BV::S>& result);
 
 /// @brief Traversal node for collision between two meshes if their underlying
 /// BVH node is oriented node (OBB, RSS, OBBRSS, kIOS)
@@ -242,6 +252,39 @@ bool initialize(
     const CollisionRequest<S>& request,
     CollisionResult<S>& result);
 
+template <typename S>
+class FCL_EXPORT MeshCollisionTraversalNodeFloatOBBRSS
+    : public MeshCollisionTraversalNode<FloatOBBRSS<S>>
+{
+public:
+  MeshCollisionTraversalNodeFloatOBBRSS();
+
+  bool BVTesting(int b1, int b2) const;
+
+  void leafTesting(int b1, int b2) const;
+
+  Matrix3<S> R;
+  Vector3<S> T;
+
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+using MeshCollisionTraversalNodeFloatOBBRSSf = MeshCollisionTraversalNodeFloatOBBRSS<float>;
+using MeshCollisionTraversalNodeFloatOBBRSSd = MeshCollisionTraversalNodeFloatOBBRSS<double>;
+
+/// @brief Initialize traversal node for collision between two meshes,
+/// specialized for FloatOBBRSS type
+template <typename S>
+FCL_EXPORT
+bool initialize(
+    MeshCollisionTraversalNodeFloatOBBRSS<S>& node,
+    const BVHModel<FloatOBBRSS<S>>& model1,
+    const Transform3<S>& tf1,
+    const BVHModel<FloatOBBRSS<S>>& model2,
+    const Transform3<S>& tf2,
+    const CollisionRequest<S>& request,
+    CollisionResult<S>& result);
+
 template <typename BV>
 FCL_EXPORT
 void meshCollisionOrientedNodeLeafTesting(
@@ -0,0 +1,276 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @author Jia Pan */
+
+#ifndef FCL_TRAVERSAL_MESHCONTINUOUSCOLLISIONQUERY_INL_H
+#define FCL_TRAVERSAL_MESHCONTINUOUSCOLLISIONQUERY_INL_H
+
+#include "fcl/narrowphase/detail/traversal/collision/mesh_continuous_collision_query.h"
+
+#include <algorithm>
+
+#include "fcl/common/detail/parallel.h"
+#include "fcl/math/bv/utility.h"
+#include "fcl/narrowphase/detail/traversal/collision/intersect.h"
+
+namespace fcl
+{
+
+namespace detail
+{
+
+//==============================================================================
+template <typename BV>
+MeshContinuousCollisionQuery<BV>::MeshContinuousCollisionQuery(
+    const BVHModel<BV>& model1,
+    const Transform3<S>& tf1_beg,
+    const Transform3<S>& tf1_end,
+    const BVHModel<BV>& model2,
+    const Transform3<S>& tf2_beg,
+    const Transform3<S>& tf2_end)
+  : is_collide(false),
+    time_of_contact(1),
+    num_candidates(0)
+{
+  mesh1.model = &model1;
+  mesh1.tf_beg = tf1_beg;
+  mesh1.tf_end = tf1_end;
+
+  mesh2.model = &model2;
+  mesh2.tf_beg = tf2_beg;
+  mesh2.tf_end = tf2_end;
+}
+
+//==============================================================================
+template <typename BV>
+typename BV::S MeshContinuousCollisionQuery<BV>::run(unsigned int num_threads)
+{
+  is_collide = false;
+  time_of_contact = 1;
+  pairs.clear();
+  candidates.clear();
+  num_candidates = 0;
+
+  if(mesh1.model->getNumBVs() == 0 || mesh2.model->getNumBVs() == 0)
+    return time_of_contact;
+
+  initialize(mesh1, num_threads);
+  initialize(mesh2, num_threads);
+
+  // Collect the leaf pairs whose swept volumes overlap. The swept volumes of
+  // the nodes are only computed when the traversal reaches them.
+  std::vector<std::pair<int, int>> stack;
+  stack.emplace_back(0, 0);
+  while(!stack.empty())
+  {
+    const int b1 = stack.back().first;
+    const int b2 = stack.back().second;
+    stack.pop_back();
+
+    const AABB<S>& bv1 = sweptBV(mesh1, b1);
+    const AABB<S>& bv2 = sweptBV(mesh2, b2);
+    if(!bv1.overlap(bv2))
+      continue;
+
+    const BVNode<BV>& node1 = mesh1.model->getBV(b1);
+    const BVNode<BV>& node2 = mesh2.model->getBV(b2);
+    const bool l1 = node1.isLeaf();
+    const bool l2 = node2.isLeaf();
+
+    if(l1 && l2)
+    {
+      candidates.emplace_back(node1.primitiveId(), node2.primitiveId());
+    }
+    else if(l2 || (!l1 && bv1.size() > bv2.size()))
+    {
+      stack.emplace_back(node1.rightChild(), b2);
+      stack.emplace_back(node1.leftChild(), b2);
+    }
+    else
+    {
+      stack.emplace_back(b1, node2.rightChild());
+      stack.emplace_back(b1, node2.leftChild());
+    }
+  }
+
+  num_candidates = candidates.size();
+
+  // The root solves of different triangle pairs are independent, so they are
+  // batched after the traversal and split over the threads.
+  std::vector<S> times(candidates.size());
+  parallelForChunks(candidates.size(), num_threads, 64,
+                    [&](unsigned int, std::size_t begin, std::size_t end)
+  {
+    for(std::size_t i = begin; i < end; ++i)
+      times[i] = leafTesting(candidates[i].first, candidates[i].second);
+  });
+
+  for(std::size_t i = 0; i < candidates.size(); ++i)
+  {
+    if(times[i] > 1)
+      continue;
+
+    pairs.emplace_back(candidates[i].first, candidates[i].second, times[i]);
+    time_of_contact = std::min(time_of_contact, times[i]);
+  }
+
+  is_collide = !pairs.empty();
+
+  return time_of_contact;
+}
+
+//==============================================================================
+template <typename BV>
+void MeshContinuousCollisionQuery<BV>::initialize(
+    SweptMesh& mesh, unsigned int num_threads)
+{
+  const BVHModel<BV>& model = *mesh.model;
+
+  // The previous vertices are only meaningful right after an update.
+  const Vector3<S>* prev_vertices =
+      (model.build_state == BVH_BUILD_STATE_UPDATED && model.prev_vertices)
+      ? model.prev_vertices : model.vertices;
+
+  const std::size_t num_vertices = model.num_vertices;
+  mesh.vertices_beg.resize(num_vertices);
+  mesh.vertices_end.resize(num_vertices);
+  parallelForChunks(num_vertices, num_threads, 1024,
+                    [&](unsigned int, std::size_t begin, std::size_t end)
+  {
+    for(std::size_t i = begin; i < end; ++i)
+    {
+      mesh.vertices_beg[i].noalias() = mesh.tf_beg * prev_vertices[i];
+      mesh.vertices_end[i].noalias() = mesh.tf_end * model.vertices[i];
+    }
+  });
+
+  mesh.bvs.resize(model.getNumBVs());
+  mesh.bv_valid.assign(model.getNumBVs(), 0);
+}
+
+//==============================================================================
+template <typename BV>
+const AABB<typename BV::S>& MeshContinuousCollisionQuery<BV>::sweptBV(
+    SweptMesh& mesh, int id)
+{
+  AABB<S>& bv = mesh.bvs[id];
+  if(mesh.bv_valid[id])
+    return bv;
+
+  const BVNode<BV>& node = mesh.model->getBV(id);
+  if(node.isLeaf())
+  {
+    // Leaves are bounded tightly by the start and end positions of their
+    // triangle; the vertices move linearly in between.
+    const Triangle& tri = mesh.model->tri_indices[node.primitiveId()];
+    bv = AABB<S>(mesh.vertices_beg[tri[0]]);
+    for(int i = 0; i < 3; ++i)
+    {
+      bv += mesh.vertices_beg[tri[i]];
+      bv += mesh.vertices_end[tri[i]];
+    }
+  }
+  else
+  {
+    // The model bounding volume contains the previous and the current
+    // vertices, so its images at the start and end poses bound the sweep.
+    AABB<S> bv_end;
+    convertBV(node.bv, mesh.tf_beg, bv);
+    convertBV(node.bv, mesh.tf_end, bv_end);
+    bv += bv_end;
+  }
+
+  mesh.bv_valid[id] = 1;
+  return bv;
+}
+
+//==============================================================================
+template <typename BV>
+typename BV::S MeshContinuousCollisionQuery<BV>::leafTesting(
+    int tri1, int tri2) const
+{
+  const Triangle& tri_id1 = mesh1.model->tri_indices[tri1];
+  const Triangle& tri_id2 = mesh2.model->tri_indices[tri2];
+
+  const Vector3<S>* S0[3];
+  const Vector3<S>* S1[3];
+  const Vector3<S>* T0[3];
+  const Vector3<S>* T1[3];
+
+  for(int i = 0; i < 3; ++i)
+  {
+    S0[i] = &mesh1.vertices_beg[tri_id1[i]];
+    S1[i] = &mesh1.vertices_end[tri_id1[i]];
+    T0[i] = &mesh2.vertices_beg[tri_id2[i]];
+    T1[i] = &mesh2.vertices_end[tri_id2[i]];
+  }
+
+  S collision_time = 2;
+  S tmp;
+  Vector3<S> tmpv;
+
+  // 6 VF checks
+  for(int i = 0; i < 3; ++i)
+  {
+    if(Intersect<S>::intersect_VF_filtered(*(S0[0]), *(S0[1]), *(S0[2]), *(T0[i]), *(S1[0]), *(S1[1]), *(S1[2]), *(T1[i]), &tmp, &tmpv))
+      collision_time = std::min(collision_time, tmp);
+
+    if(Intersect<S>::intersect_VF_filtered(*(T0[0]), *(T0[1]), *(T0[2]), *(S0[i]), *(T1[0]), *(T1[1]), *(T1[2]), *(S1[i]), &tmp, &tmpv))
+      collision_time = std::min(collision_time, tmp);
+  }
+
+  // 9 EE checks
+  for(int i = 0; i < 3; ++i)
+  {
+    const int S_id1 = i;
+    const int S_id2 = (i + 1) % 3;
+    for(int j = 0; j < 3; ++j)
+    {
+      const int T_id1 = j;
+      const int T_id2 = (j + 1) % 3;
+
+      if(Intersect<S>::intersect_EE_filtered(*(S0[S_id1]), *(S0[S_id2]), *(T0[T_id1]), *(T0[T_id2]), *(S1[S_id1]), *(S1[S_id2]), *(T1[T_id1]), *(T1[T_id2]), &tmp, &tmpv))
+        collision_time = std::min(collision_time, tmp);
+    }
+  }
+
+  return collision_time;
+}
+
+} // namespace detail
+} // namespace fcl
+
+#endif
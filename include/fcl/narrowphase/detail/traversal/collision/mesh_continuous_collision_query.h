@@ -0,0 +1,131 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @author Jia Pan */
+
+#ifndef FCL_TRAVERSAL_MESHCONTINUOUSCOLLISIONQUERY_H
+#define FCL_TRAVERSAL_MESHCONTINUOUSCOLLISIONQUERY_H
+
+#include <vector>
+
+#include "fcl/math/bv/AABB.h"
+#include "fcl/geometry/bvh/BVH_model.h"
+#include "fcl/narrowphase/detail/traversal/collision/mesh_continuous_collision_traversal_node.h"
+
+namespace fcl
+{
+
+namespace detail
+{
+
+/// @brief Continuous collision query between two triangle meshes whose
+/// vertices move linearly over the normalized time interval [0, 1].
+///
+/// Unlike MeshContinuousCollisionTraversalNode, the query never modifies the
+/// models: the start and end vertex positions are written to buffers owned by
+/// the query, and swept bounding volumes are only built for the nodes the
+/// traversal visits. The vertex-face and edge-edge tests of all candidate
+/// triangle pairs are run after the traversal, optionally on several threads.
+template <typename BV>
+class FCL_EXPORT MeshContinuousCollisionQuery
+{
+public:
+
+  using S = typename BV::S;
+
+  /// @brief Each model moves rigidly from tf_beg to tf_end. A model whose last
+  /// change was an update (beginUpdateModel() ... endUpdateModel()) also
+  /// deforms from its previous vertices to its current ones.
+  MeshContinuousCollisionQuery(
+      const BVHModel<BV>& model1,
+      const Transform3<S>& tf1_beg,
+      const Transform3<S>& tf1_end,
+      const BVHModel<BV>& model2,
+      const Transform3<S>& tf2_beg,
+      const Transform3<S>& tf2_end);
+
+  /// @brief Run the query and return the first time of contact, or 1 if the
+  /// meshes do not touch during the motion.
+  S run(unsigned int num_threads = 1);
+
+  /// @brief Whether the meshes touch during the motion
+  bool is_collide;
+
+  /// @brief The first time of contact
+  S time_of_contact;
+
+  /// @brief All triangle pairs that touch during the motion, with the first
+  /// time of contact of each pair
+  std::vector<BVHContinuousCollisionPair<S>> pairs;
+
+  /// @brief Number of triangle pairs whose swept volumes overlap
+  std::size_t num_candidates;
+
+protected:
+
+  /// @brief Vertices and lazily built swept bounding volumes of one mesh
+  struct SweptMesh
+  {
+    const BVHModel<BV>* model;
+    Transform3<S> tf_beg;
+    Transform3<S> tf_end;
+    std::vector<Vector3<S>> vertices_beg;
+    std::vector<Vector3<S>> vertices_end;
+    std::vector<AABB<S>> bvs;
+    std::vector<unsigned char> bv_valid;
+  };
+
+  /// @brief Compute the start and end positions of the vertices of a mesh
+  void initialize(SweptMesh& mesh, unsigned int num_threads);
+
+  /// @brief Bounding box of the sweep of a node, computed on first use
+  const AABB<S>& sweptBV(SweptMesh& mesh, int id);
+
+  /// @brief First time of contact between two triangles, or 2 if they do
+  /// not touch
+  S leafTesting(int tri1, int tri2) const;
+
+  SweptMesh mesh1;
+  SweptMesh mesh2;
+
+  std::vector<std::pair<int, int>> candidates;
+};
+
+} // namespace detail
+} // namespace fcl
+
+#include "fcl/narrowphase/detail/traversal/collision/mesh_continuous_collision_query-inl.h"
+
+#endif
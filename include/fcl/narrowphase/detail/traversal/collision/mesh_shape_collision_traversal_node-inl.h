@@ -48,6 +48,31 @@ namespace fcl
 namespace detail
 {
 
+//==============================================================================
+template <typename S>
+template <typename Shape>
+void MeshShapeTriangleCuller<S>::init(
+    const Shape& shape, const Transform3<S>& tf_mesh,
+    const Transform3<S>& tf_shape)
+{
+  tf_shape_mesh = tf_shape.inverse(Eigen::Isometry) * tf_mesh;
+  computeBV(shape, Transform3<S>(tf_shape_mesh.inverse(Eigen::Isometry)),
+            shape_aabb_in_mesh);
+  computeBV(shape, Transform3<S>::Identity(), shape_aabb);
+}
+
+//==============================================================================
+template <typename S>
+bool MeshShapeTriangleCuller<S>::cull(
+    const Vector3<S>& p1, const Vector3<S>& p2, const Vector3<S>& p3) const
+{
+  if(!AABB<S>(p1, p2, p3).overlap(shape_aabb_in_mesh))
+    return true;
+
+  return !AABB<S>(tf_shape_mesh * p1, tf_shape_mesh * p2, tf_shape_mesh * p3)
+      .overlap(shape_aabb);
+}
+
 //==============================================================================
 template <typename BV, typename Shape, typename NarrowPhaseSolver>
 MeshShapeCollisionTraversalNode<BV, Shape, NarrowPhaseSolver>::MeshShapeCollisionTraversalNode()
@@ -57,6 +82,16 @@ MeshShapeCollisionTraversalNode<BV, Shape, NarrowPhaseSolver>::MeshShapeCollisio
   tri_indices = nullptr;
 
   nsolver = nullptr;
+
+  leaf_cluster_size = 8;
+}
+
+//==============================================================================
+template <typename BV, typename Shape, typename NarrowPhaseSolver>
+bool MeshShapeCollisionTraversalNode<BV, Shape, NarrowPhaseSolver>::isFirstNodeLeaf(int b) const
+{
+  const BVNode<BV>& node = this->model1->getBV(b);
+  return node.isLeaf() || node.num_primitives <= leaf_cluster_size;
 }
 
 //==============================================================================
@@ -65,63 +100,73 @@ void MeshShapeCollisionTraversalNode<BV, Shape, NarrowPhaseSolver>::leafTesting(
 {
   FCL_UNUSED(b2);
 
-  if(this->enable_statistics) this->num_leaf_tests++;
   const BVNode<BV>& node = this->model1->getBV(b1);
 
-  int primitive_id = node.primitiveId();
+  for(int i = node.first_primitive; i < node.first_primitive + node.num_primitives; ++i)
+  {
+    int primitive_id = this->model1->getPrimitiveId(i);
 
-  const Triangle& tri_id = tri_indices[primitive_id];
+    const Triangle& tri_id = tri_indices[primitive_id];
 
-  const Vector3<S>& p1 = vertices[tri_id[0]];
-  const Vector3<S>& p2 = vertices[tri_id[1]];
-  const Vector3<S>& p3 = vertices[tri_id[2]];
+    const Vector3<S>& p1 = vertices[tri_id[0]];
+    const Vector3<S>& p2 = vertices[tri_id[1]];
+    const Vector3<S>& p3 = vertices[tri_id[2]];
 
-  if(this->model1->isOccupied() && this->model2->isOccupied())
-  {
-    bool is_intersect = false;
+    if(triangle_culler.cull(p1, p2, p3))
+      continue;
+
+    if(this->enable_statistics) this->num_leaf_tests++;
 
-    if(!this->request.enable_contact)
+    if(this->model1->isOccupied() && this->model2->isOccupied())
     {
-      if(nsolver->shapeTriangleIntersect(*(this->model2), this->tf2, p1, p2, p3, nullptr, nullptr, nullptr))
+      bool is_intersect = false;
+
+      if(!this->request.enable_contact)
       {
-        is_intersect = true;
-        if(this->request.num_max_contacts > this->result->numContacts())
-          this->result->addContact(Contact<S>(this->model1, this->model2, primitive_id, Contact<S>::NONE));
+        if(nsolver->shapeTriangleIntersect(*(this->model2), this->tf2, p1, p2, p3, this->tf1, nullptr, nullptr, nullptr))
+        {
+          is_intersect = true;
+          if(this->request.num_max_contacts > this->result->numContacts())
+            this->result->addContact(Contact<S>(this->model1, this->model2, primitive_id, Contact<S>::NONE));
+        }
       }
-    }
-    else
-    {
-      S penetration;
-      Vector3<S> normal;
-      Vector3<S> contactp;
-
-      if(nsolver->shapeTriangleIntersect(*(this->model2), this->tf2, p1, p2, p3, &contactp, &penetration, &normal))
+      else
       {
-        is_intersect = true;
-        if(this->request.num_max_contacts > this->result->numContacts())
-          this->result->addContact(Contact<S>(this->model1, this->model2, primitive_id, Contact<S>::NONE, contactp, -normal, penetration));
+        S penetration;
+        Vector3<S> normal;
+        Vector3<S> contactp;
+
+        if(nsolver->shapeTriangleIntersect(*(this->model2), this->tf2, p1, p2, p3, this->tf1, &contactp, &penetration, &normal))
+        {
+          is_intersect = true;
+          if(this->request.num_max_contacts > this->result->numContacts())
+            this->result->addContact(Contact<S>(this->model1, this->model2, primitive_id, Contact<S>::NONE, contactp, -normal, penetration));
+        }
       }
-    }
 
-    if(is_intersect && this->request.enable_cost)
-    {
-      AABB<S> overlap_part;
-      AABB<S> shape_aabb;
-      computeBV(*(this->model2), this->tf2, shape_aabb);
-      AABB<S>(p1, p2, p3).overlap(shape_aabb, overlap_part);
-      this->result->addCostSource(CostSource<S>(overlap_part, cost_density), this->request.num_max_cost_sources);
+      if(is_intersect && this->request.enable_cost)
+      {
+        AABB<S> overlap_part;
+        AABB<S> shape_aabb;
+        computeBV(*(this->model2), this->tf2, shape_aabb);
+        AABB<S>(this->tf1 * p1, this->tf1 * p2, this->tf1 * p3).overlap(shape_aabb, overlap_part);
+        this->result->addCostSource(CostSource<S>(overlap_part, cost_density), this->request.num_max_cost_sources);
+      }
     }
-  }
-  if((!this->model1->isFree() && !this->model2->isFree()) && this->request.enable_cost)
-  {
-    if(nsolver->shapeTriangleIntersect(*(this->model2), this->tf2, p1, p2, p3, nullptr, nullptr, nullptr))
+    if((!this->model1->isFree() && !this->model2->isFree()) && this->request.enable_cost)
     {
-      AABB<S> overlap_part;
-      AABB<S> shape_aabb;
-      computeBV(*(this->model2), this->tf2, shape_aabb);
-      AABB<S>(p1, p2, p3).overlap(shape_aabb, overlap_part);
-      this->result->addCostSource(CostSource<S>(overlap_part, cost_density), this->request.num_max_cost_sources);
+      if(nsolver->shapeTriangleIntersect(*(this->model2), this->tf2, p1, p2, p3, this->tf1, nullptr, nullptr, nullptr))
+      {
+        AABB<S> overlap_part;
+        AABB<S> shape_aabb;
+        computeBV(*(this->model2), this->tf2, shape_aabb);
+        AABB<S>(this->tf1 * p1, this->tf1 * p2, this->tf1 * p3).overlap(shape_aabb, overlap_part);
+        this->result->addCostSource(CostSource<S>(overlap_part, cost_density), this->request.num_max_cost_sources);
+      }
     }
+
+    if(this->request.isSatisfied(*(this->result)))
+      break;
   }
 }
 
@@ -136,45 +181,28 @@ bool MeshShapeCollisionTraversalNode<BV, Shape, NarrowPhaseSolver>::canStop() co
 template <typename BV, typename Shape, typename NarrowPhaseSolver>
 bool initialize(
     MeshShapeCollisionTraversalNode<BV, Shape, NarrowPhaseSolver>& node,
-    BVHModel<BV>& model1,
-    Transform3<typename BV::S>& tf1,
+    const BVHModel<BV>& model1,
+    const Transform3<typename BV::S>& tf1,
     const Shape& model2,
     const Transform3<typename BV::S>& tf2,
     const NarrowPhaseSolver* nsolver,
     const CollisionRequest<typename BV::S>& request,
-    CollisionResult<typename BV::S>& result,
-    bool use_refit,
-    bool refit_bottomup)
+    CollisionResult<typename BV::S>& result)
 {
   using S = typename BV::S;
 
   if(model1.getModelType() != BVH_MODEL_TRIANGLES)
     return false;
 
-  if(!tf1.matrix().isIdentity())
-  {
-    std::vector<Vector3<S>> vertices_transformed(model1.num_vertices);
-    for(int i = 0; i < model1.num_vertices; ++i)
-    {
-      Vector3<S>& p = model1.vertices[i];
-      Vector3<S> new_v = tf1 * p;
-      vertices_transformed[i] = new_v;
-    }
-
-    model1.beginReplaceModel();
-    model1.replaceSubModel(vertices_transformed);
-    model1.endReplaceModel(use_refit, refit_bottomup);
-
-    tf1.setIdentity();
-  }
-
   node.model1 = &model1;
   node.tf1 = tf1;
   node.model2 = &model2;
   node.tf2 = tf2;
   node.nsolver = nsolver;
 
-  computeBV(model2, tf2, node.model2_bv);
+  computeBV(model2, Transform3<S>(tf1.inverse(Eigen::Isometry) * tf2),
+            node.model2_bv);
+  node.triangle_culler.init(model2, tf1, tf2);
 
   node.vertices = model1.vertices;
   node.tri_indices = model1.tri_indices;
@@ -192,6 +220,7 @@ template <typename BV, typename Shape, typename NarrowPhaseSolver>
 void meshShapeCollisionOrientedNodeLeafTesting(
     int b1, int b2,
     const BVHModel<BV>* model1, const Shape& model2,
+    const MeshShapeTriangleCuller<typename BV::S>& triangle_culler,
     Vector3<typename BV::S>* vertices, Triangle* tri_indices,
     const Transform3<typename BV::S>& tf1,
     const Transform3<typename BV::S>& tf2,
@@ -206,63 +235,73 @@ void meshShapeCollisionOrientedNodeLeafTesting(
 
   using S = typename BV::S;
 
-  if(enable_statistics) num_leaf_tests++;
   const BVNode<BV>& node = model1->getBV(b1);
 
-  int primitive_id = node.primitiveId();
+  for(int i = node.first_primitive; i < node.first_primitive + node.num_primitives; ++i)
+  {
+    int primitive_id = model1->getPrimitiveId(i);
 
-  const Triangle& tri_id = tri_indices[primitive_id];
+    const Triangle& tri_id = tri_indices[primitive_id];
 
-  const Vector3<S>& p1 = vertices[tri_id[0]];
-  const Vector3<S>& p2 = vertices[tri_id[1]];
-  const Vector3<S>& p3 = vertices[tri_id[2]];
+    const Vector3<S>& p1 = vertices[tri_id[0]];
+    const Vector3<S>& p2 = vertices[tri_id[1]];
+    const Vector3<S>& p3 = vertices[tri_id[2]];
 
-  if(model1->isOccupied() && model2.isOccupied())
-  {
-    bool is_intersect = false;
+    if(triangle_culler.cull(p1, p2, p3))
+      continue;
+
+    if(enable_statistics) num_leaf_tests++;
 
-    if(!request.enable_contact) // only interested in collision or not
+    if(model1->isOccupied() && model2.isOccupied())
     {
-      if(nsolver->shapeTriangleIntersect(model2, tf2, p1, p2, p3, tf1, nullptr, nullptr, nullptr))
+      bool is_intersect = false;
+
+      if(!request.enable_contact) // only interested in collision or not
       {
-        is_intersect = true;
-        if(request.num_max_contacts > result.numContacts())
-          result.addContact(Contact<S>(model1, &model2, primitive_id, Contact<S>::NONE));
+        if(nsolver->shapeTriangleIntersect(model2, tf2, p1, p2, p3, tf1, nullptr, nullptr, nullptr))
+        {
+          is_intersect = true;
+          if(request.num_max_contacts > result.numContacts())
+            result.addContact(Contact<S>(model1, &model2, primitive_id, Contact<S>::NONE));
+        }
       }
-    }
-    else
-    {
-      S penetration;
-      Vector3<S> normal;
-      Vector3<S> contactp;
-
-      if(nsolver->shapeTriangleIntersect(model2, tf2, p1, p2, p3, tf1, &contactp, &penetration, &normal))
+      else
       {
-        is_intersect = true;
-        if(request.num_max_contacts > result.numContacts())
-          result.addContact(Contact<S>(model1, &model2, primitive_id, Contact<S>::NONE, contactp, -normal, penetration));
+        S penetration;
+        Vector3<S> normal;
+        Vector3<S> contactp;
+
+        if(nsolver->shapeTriangleIntersect(model2, tf2, p1, p2, p3, tf1, &contactp, &penetration, &normal))
+        {
+          is_intersect = true;
+          if(request.num_max_contacts > result.numContacts())
+            result.addContact(Contact<S>(model1, &model2, primitive_id, Contact<S>::NONE, contactp, -normal, penetration));
+        }
       }
-    }
 
-    if(is_intersect && request.enable_cost)
-    {
-      AABB<S> overlap_part;
-      AABB<S> shape_aabb;
-      computeBV(model2, tf2, shape_aabb);
-      /* bool res = */ AABB<S>(tf1 * p1, tf1 * p2, tf1 * p3).overlap(shape_aabb, overlap_part);
-      result.addCostSource(CostSource<S>(overlap_part, cost_density), request.num_max_cost_sources);
+      if(is_intersect && request.enable_cost)
+      {
+        AABB<S> overlap_part;
+        AABB<S> shape_aabb;
+        computeBV(model2, tf2, shape_aabb);
+        /* bool res = */ AABB<S>(tf1 * p1, tf1 * p2, tf1 * p3).overlap(shape_aabb, overlap_part);
+        result.addCostSource(CostSource<S>(overlap_part, cost_density), request.num_max_cost_sources);
+      }
     }
-  }
-  else if((!model1->isFree() || model2.isFree()) && request.enable_cost)
-  {
-    if(nsolver->shapeTriangleIntersect(model2, tf2, p1, p2, p3, tf1, nullptr, nullptr, nullptr))
+    else if((!model1->isFree() || model2.isFree()) && request.enable_cost)
     {
-      AABB<S> overlap_part;
-      AABB<S> shape_aabb;
-      computeBV(model2, tf2, shape_aabb);
-      /* bool res = */ AABB<S>(tf1 * p1, tf1 * p2, tf1 * p3).overlap(shape_aabb, overlap_part);
-      result.addCostSource(CostSource<S>(overlap_part, cost_density), request.num_max_cost_sources);
+      if(nsolver->shapeTriangleIntersect(model2, tf2, p1, p2, p3, tf1, nullptr, nullptr, nullptr))
+      {
+        AABB<S> overlap_part;
+        AABB<S> shape_aabb;
+        computeBV(model2, tf2, shape_aabb);
+        /* bool res = */ AABB<S>(tf1 * p1, tf1 * p2, tf1 * p3).overlap(shape_aabb, overlap_part);
+        result.addCostSource(CostSource<S>(overlap_part, cost_density), request.num_max_cost_sources);
+      }
     }
+
+    if(request.isSatisfied(result))
+      break;
   }
 }
 
@@ -289,7 +328,7 @@ bool MeshShapeCollisionTraversalNodeOBB<Shape, NarrowPhaseSolver>::BVTesting(int
 template <typename Shape, typename NarrowPhaseSolver>
 void MeshShapeCollisionTraversalNodeOBB<Shape, NarrowPhaseSolver>::leafTesting(int b1, int b2) const
 {
-  detail::meshShapeCollisionOrientedNodeLeafTesting(b1, b2, this->model1, *(this->model2), this->vertices, this->tri_indices,
+  detail::meshShapeCollisionOrientedNodeLeafTesting(b1, b2, this->model1, *(this->model2), this->triangle_culler, this->vertices, this->tri_indices,
                                                      this->tf1, this->tf2, this->nsolver, this->enable_statistics, this->cost_density, this->num_leaf_tests, this->request, *(this->result));
 }
 
@@ -315,7 +354,7 @@ bool MeshShapeCollisionTraversalNodeRSS<Shape, NarrowPhaseSolver>::BVTesting(int
 template <typename Shape, typename NarrowPhaseSolver>
 void MeshShapeCollisionTraversalNodeRSS<Shape, NarrowPhaseSolver>::leafTesting(int b1, int b2) const
 {
-  detail::meshShapeCollisionOrientedNodeLeafTesting(b1, b2, this->model1, *(this->model2), this->vertices, this->tri_indices,
+  detail::meshShapeCollisionOrientedNodeLeafTesting(b1, b2, this->model1, *(this->model2), this->triangle_culler, this->vertices, this->tri_indices,
                                                      this->tf1, this->tf2, this->nsolver, this->enable_statistics, this->cost_density, this->num_leaf_tests, this->request, *(this->result));
 }
 
@@ -342,7 +381,7 @@ bool MeshShapeCollisionTraversalNodekIOS<Shape, NarrowPhaseSolver>::BVTesting(in
 template <typename Shape, typename NarrowPhaseSolver>
 void MeshShapeCollisionTraversalNodekIOS<Shape, NarrowPhaseSolver>::leafTesting(int b1, int b2) const
 {
-  detail::meshShapeCollisionOrientedNodeLeafTesting(b1, b2, this->model1, *(this->model2), this->vertices, this->tri_indices,
+  detail::meshShapeCollisionOrientedNodeLeafTesting(b1, b2, this->model1, *(this->model2), this->triangle_culler, this->vertices, this->tri_indices,
                                                      this->tf1, this->tf2, this->nsolver, this->enable_statistics, this->cost_density, this->num_leaf_tests, this->request, *(this->result));
 }
 
@@ -368,7 +407,33 @@ bool MeshShapeCollisionTraversalNodeOBBRSS<Shape, NarrowPhaseSolver>::BVTesting(
 template <typename Shape, typename NarrowPhaseSolver>
 void MeshShapeCollisionTraversalNodeOBBRSS<Shape, NarrowPhaseSolver>::leafTesting(int b1, int b2) const
 {
-  detail::meshShapeCollisionOrientedNodeLeafTesting(b1, b2, this->model1, *(this->model2), this->vertices, this->tri_indices,
+  detail::meshShapeCollisionOrientedNodeLeafTesting(b1, b2, this->model1, *(this->model2), this->triangle_culler, this->vertices, this->tri_indices,
+                                                     this->tf1, this->tf2, this->nsolver, this->enable_statistics, this->cost_density, this->num_leaf_tests, this->request, *(this->result));
+}
+
+//==============================================================================
+template <typename Shape, typename NarrowPhaseSolver>
+MeshShapeCollisionTraversalNodeFloatOBBRSS<Shape, NarrowPhaseSolver>::
+MeshShapeCollisionTraversalNodeFloatOBBRSS()
+  : MeshShapeCollisionTraversalNode<FloatOBBRSS<typename Shape::S>, Shape, NarrowPhaseSolver>()
+{
+}
+
+//==============================================================================
+template <typename Shape, typename NarrowPhaseSolver>
+bool MeshShapeCollisionTraversalNodeFloatOBBRSS<Shape, NarrowPhaseSolver>::BVTesting(int b1, int b2) const
+{
+  FCL_UNUSED(b2);
+
+  if(this->enable_statistics) this->num_bv_tests++;
+  return !overlap(this->tf1.linear(), this->tf1.translation(), this->model2_bv, this->model1->getBV(b1).bv);
+}
+
+//==============================================================================
+template <typename Shape, typename NarrowPhaseSolver>
+void MeshShapeCollisionTraversalNodeFloatOBBRSS<Shape, NarrowPhaseSolver>::leafTesting(int b1, int b2) const
+{
+  detail::meshShapeCollisionOrientedNodeLeafTesting(b1, b2, this->model1, *(this->model2), this->triangle_culler, this->vertices, this->tri_indices,
                                                      this->tf1, this->tf2, this->nsolver, this->enable_statistics, this->cost_density, this->num_leaf_tests, this->request, *(this->result));
 }
 
@@ -393,6 +458,7 @@ bool setupMeshShapeCollisionOrientedNode(
   node.nsolver = nsolver;
 
   computeBV(model2, tf2, node.model2_bv);
+  node.triangle_culler.init(model2, tf1, tf2);
 
   node.vertices = model1.vertices;
   node.tri_indices = model1.tri_indices;
@@ -469,6 +535,22 @@ bool initialize(
         node, model1, tf1, model2, tf2, nsolver, request, result);
 }
 
+//==============================================================================
+template <typename Shape, typename NarrowPhaseSolver>
+bool initialize(
+    MeshShapeCollisionTraversalNodeFloatOBBRSS<Shape, NarrowPhaseSolver>& node,
+    const BVHModel<FloatOBBRSS<typename Shape::S>>& model1,
+    const Transform3<typename Shape::S>& tf1,
+    const Shape& model2,
+    const Transform3<typename Shape::S>& tf2,
+    const NarrowPhaseSolver* nsolver,
+    const CollisionRequest<typename Shape::S>& request,
+    CollisionResult<typename Shape::S>& result)
+{
+  return detail::setupMeshShapeCollisionOrientedNode(
+        node, model1, tf1, model2, tf2, nsolver, request, result);
+}
+
 } // namespace detail
 } // namespace fcl
 
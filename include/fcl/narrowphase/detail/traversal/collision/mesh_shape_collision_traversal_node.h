@@ -47,6 +47,34 @@ namespace fcl
 namespace detail
 {
 
+/// @brief Cheap rejection of mesh triangles against a shape, applied before
+/// the narrow phase. A triangle is kept only if its AABB overlaps the AABB of
+/// the shape both in the frame of the mesh and in the frame of the shape; the
+/// latter is tight for boxes, capsules, cones and cylinders in any pose.
+template <typename S>
+struct FCL_EXPORT MeshShapeTriangleCuller
+{
+  /// @brief Set up the culler for the shape at tf_shape against a mesh at
+  /// tf_mesh
+  template <typename Shape>
+  void init(const Shape& shape, const Transform3<S>& tf_mesh,
+            const Transform3<S>& tf_shape);
+
+  /// @brief Whether the triangle, given in the frame of the mesh, is
+  /// certainly disjoint from the shape
+  bool cull(const Vector3<S>& p1, const Vector3<S>& p2,
+            const Vector3<S>& p3) const;
+
+  /// @brief The AABB of the shape in the frame of the mesh
+  AABB<S> shape_aabb_in_mesh;
+
+  /// @brief The AABB of the shape in its own frame
+  AABB<S> shape_aabb;
+
+  /// @brief The pose of the mesh in the frame of the shape
+  Transform3<S> tf_shape_mesh;
+};
+
 /// @brief Traversal node for collision between mesh and shape
 template <typename BV, typename Shape, typename NarrowPhaseSolver>
 class FCL_EXPORT MeshShapeCollisionTraversalNode
@@ -58,7 +86,12 @@ public:
 
   MeshShapeCollisionTraversalNode();
 
-  /// @brief Intersection testing between leaves (one triangle and one shape)
+  /// @brief Whether the BV node is tested as a leaf: a node holding at most
+  /// leaf_cluster_size triangles is not traversed further
+  bool isFirstNodeLeaf(int b) const;
+
+  /// @brief Intersection testing between leaves (the cluster of triangles
+  /// under one BV node and one shape)
   void leafTesting(int b1, int b2) const;
 
   /// @brief Whether the traversal process can stop early
@@ -70,22 +103,30 @@ public:
   S cost_density;
 
   const NarrowPhaseSolver* nsolver;
+
+  /// @brief The largest number of triangles tested together as one leaf
+  /// cluster. The triangles of a cluster go through triangle_culler instead
+  /// of the BV tests of the last few tree levels.
+  int leaf_cluster_size;
+
+  MeshShapeTriangleCuller<S> triangle_culler;
 };
 
 /// @brief Initialize traversal node for collision between one mesh and one
-/// shape, given current object transform
+/// shape, given current object transform. The mesh is left untouched: the BV
+/// of the shape is computed in the frame of the mesh and the triangles are
+/// moved to the world frame only inside the narrow phase.
 template <typename BV, typename Shape, typename NarrowPhaseSolver>
 FCL_EXPORT
 bool initialize(
     MeshShapeCollisionTraversalNode<BV, Shape, NarrowPhaseSolver>& node,
-    BVHModel<BV>& model1,
-    Transform3<typename BV::S>& tf1,
+    const BVHModel<BV>& model1,
+    const Transform3<typename BV::S>& tf1,
     const Shape& model2,
     const Transform3<typename BV::S>& tf2,
     const NarrowPhaseSolver* nsolver,
     const CollisionRequest<typename BV::S>& request,
-    CollisionResult<typename BV::S>& result,
-    bool use_refit = false, bool refit_bottomup = false);
+    CollisionResult<typename BV::S>& result);
 
 template <typename BV, typename Shape, typename NarrowPhaseSolver>
 FCL_EXPORT
@@ -94,6 +135,7 @@ void meshShapeCollisionOrientedNodeLeafTesting(
     int b2,
     const BVHModel<BV>* model1,
     const Shape& model2,
+    const MeshShapeTriangleCuller<typename BV::S>& triangle_culler,
     Vector3<typename BV::S>* vertices,
     Triangle* tri_indices,
     const Transform3<typename BV::S>& tf1,
@@ -218,6 +260,34 @@ bool initialize(
     const CollisionRequest<typename Shape::S>& request,
     CollisionResult<typename Shape::S>& result);
 
+template <typename Shape, typename NarrowPhaseSolver>
+class FCL_EXPORT MeshShapeCollisionTraversalNodeFloatOBBRSS
+    : public MeshShapeCollisionTraversalNode<
+          FloatOBBRSS<typename Shape::S>, Shape, NarrowPhaseSolver>
+{
+public:
+  MeshShapeCollisionTraversalNodeFloatOBBRSS();
+
+  bool BVTesting(int b1, int b2) const;
+
+  void leafTesting(int b1, int b2) const;
+
+};
+
+/// @brief Initialize the traversal node for collision between one mesh and one
+/// shape, specialized for FloatOBBRSS type
+template <typename Shape, typename NarrowPhaseSolver>
+FCL_EXPORT
+bool initialize(
+    MeshShapeCollisionTraversalNodeFloatOBBRSS<Shape, NarrowPhaseSolver>& node,
+    const BVHModel<FloatOBBRSS<typename Shape::S>>& model1,
+    const Transform3<typename Shape::S>& tf1,
+    const Shape& model2,
+    const Transform3<typename Shape::S>& tf2,
+    const NarrowPhaseSolver* nsolver,
+    const CollisionRequest<typename Shape::S>& request,
+    CollisionResult<typename Shape::S>& result);
+
 } // namespace detail
 } // namespace fcl
 
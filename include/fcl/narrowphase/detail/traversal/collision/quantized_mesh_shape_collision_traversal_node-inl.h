@@ -0,0 +1,212 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/** @author Jia Pan */
+
+#ifndef FCL_TRAVERSAL_QUANTIZEDMESHSHAPECOLLISIONTRAVERSALNODE_INL_H
+#define FCL_TRAVERSAL_QUANTIZEDMESHSHAPECOLLISIONTRAVERSALNODE_INL_H
+
+#include "fcl/narrowphase/detail/traversal/collision/quantized_mesh_shape_collision_traversal_node.h"
+
+namespace fcl
+{
+
+namespace detail
+{
+
+//==============================================================================
+template <typename Q, typename Shape, typename NarrowPhaseSolver>
+QuantizedMeshShapeCollisionTraversalNode<Q, Shape, NarrowPhaseSolver>::
+QuantizedMeshShapeCollisionTraversalNode()
+{
+  model1 = nullptr;
+  model2 = nullptr;
+
+  cost_density = 1;
+
+  nsolver = nullptr;
+}
+
+//==============================================================================
+template <typename Q, typename Shape, typename NarrowPhaseSolver>
+bool QuantizedMeshShapeCollisionTraversalNode<Q, Shape, NarrowPhaseSolver>::
+BVTesting(int, int) const
+{
+  return false;
+}
+
+//==============================================================================
+template <typename Q, typename Shape, typename NarrowPhaseSolver>
+void QuantizedMeshShapeCollisionTraversalNode<Q, Shape, NarrowPhaseSolver>::
+leafTesting(int, int) const
+{
+  if(model1->getNumBVs() == 0)
+    return;
+
+  recurse(0, model1->getRootBV());
+}
+
+//==============================================================================
+template <typename Q, typename Shape, typename NarrowPhaseSolver>
+bool QuantizedMeshShapeCollisionTraversalNode<Q, Shape, NarrowPhaseSolver>::
+recurse(int b, const AABB<S>& parent_bv) const
+{
+  const QuantizedBVNode<S, Q>& node = model1->getBV(b);
+  const AABB<S> bv = node.getAABB(parent_bv);
+
+  if(this->enable_statistics) this->num_bv_tests++;
+
+  if(!bv.overlap(model2_aabb))
+    return false;
+
+  if(!node.getOBB(bv).overlap(model2_obb))
+    return false;
+
+  if(node.isLeaf())
+  {
+    primitiveTesting(node.primitiveId());
+    return this->request.isSatisfied(*(this->result));
+  }
+
+  if(recurse(node.leftChild(), bv))
+    return true;
+
+  return recurse(node.rightChild(), bv);
+}
+
+//==============================================================================
+template <typename Q, typename Shape, typename NarrowPhaseSolver>
+void QuantizedMeshShapeCollisionTraversalNode<Q, Shape, NarrowPhaseSolver>::
+primitiveTesting(int primitive_id) const
+{
+  const Triangle& tri_id = model1->tri_indices[primitive_id];
+
+  const Vector3<S>& p1 = model1->vertices[tri_id[0]];
+  const Vector3<S>& p2 = model1->vertices[tri_id[1]];
+  const Vector3<S>& p3 = model1->vertices[tri_id[2]];
+
+  if(this->enable_statistics) this->num_leaf_tests++;
+
+  const CollisionRequest<S>& request = this->request;
+  CollisionResult<S>& result = *(this->result);
+  const Transform3<S>& tf1 = this->tf1;
+  const Transform3<S>& tf2 = this->tf2;
+
+  if(model1->isOccupied() && model2->isOccupied())
+  {
+    bool is_intersect = false;
+
+    if(!request.enable_contact) // only interested in collision or not
+    {
+      if(nsolver->shapeTriangleIntersect(*model2, tf2, p1, p2, p3, tf1, nullptr, nullptr, nullptr))
+      {
+        is_intersect = true;
+        if(request.num_max_contacts > result.numContacts())
+          result.addContact(Contact<S>(model1, model2, primitive_id, Contact<S>::NONE));
+      }
+    }
+    else
+    {
+      S penetration;
+      Vector3<S> normal;
+      Vector3<S> contactp;
+
+      if(nsolver->shapeTriangleIntersect(*model2, tf2, p1, p2, p3, tf1, &contactp, &penetration, &normal))
+      {
+        is_intersect = true;
+        if(request.num_max_contacts > result.numContacts())
+          result.addContact(Contact<S>(model1, model2, primitive_id, Contact<S>::NONE, contactp, -normal, penetration));
+      }
+    }
+
+    if(is_intersect && request.enable_cost)
+    {
+      AABB<S> overlap_part;
+      AABB<S> shape_aabb;
+      computeBV(*model2, tf2, shape_aabb);
+      AABB<S>(tf1 * p1, tf1 * p2, tf1 * p3).overlap(shape_aabb, overlap_part);
+      result.addCostSource(CostSource<S>(overlap_part, cost_density), request.num_max_cost_sources);
+    }
+  }
+  else if((!model1->isFree() || model2->isFree()) && request.enable_cost)
+  {
+    if(nsolver->shapeTriangleIntersect(*model2, tf2, p1, p2, p3, tf1, nullptr, nullptr, nullptr))
+    {
+      AABB<S> overlap_part;
+      AABB<S> shape_aabb;
+      computeBV(*model2, tf2, shape_aabb);
+      AABB<S>(tf1 * p1, tf1 * p2, tf1 * p3).overlap(shape_aabb, overlap_part);
+      result.addCostSource(CostSource<S>(overlap_part, cost_density), request.num_max_cost_sources);
+    }
+  }
+}
+
+//==============================================================================
+template <typename Q, typename Shape, typename NarrowPhaseSolver>
+bool initialize(
+    QuantizedMeshShapeCollisionTraversalNode<Q, Shape, NarrowPhaseSolver>& node,
+    const QuantizedBVHModel<typename Shape::S, Q>& model1,
+    const Transform3<typename Shape::S>& tf1,
+    const Shape& model2,
+    const Transform3<typename Shape::S>& tf2,
+    const NarrowPhaseSolver* nsolver,
+    const CollisionRequest<typename Shape::S>& request,
+    CollisionResult<typename Shape::S>& result)
+{
+  using S = typename Shape::S;
+
+  node.request = request;
+  node.result = &result;
+
+  node.model1 = &model1;
+  node.tf1 = tf1;
+  node.model2 = &model2;
+  node.tf2 = tf2;
+  node.nsolver = nsolver;
+
+  const Transform3<S> tf = tf1.inverse(Eigen::Isometry) * tf2;
+  computeBV(model2, tf, node.model2_aabb);
+  computeBV(model2, tf, node.model2_obb);
+
+  node.cost_density = model1.cost_density * model2.cost_density;
+
+  return true;
+}
+
+} // namespace detail
+} // namespace fcl
+
+#endif
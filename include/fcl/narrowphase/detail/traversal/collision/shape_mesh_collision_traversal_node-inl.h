@@ -86,7 +86,7 @@ void ShapeMeshCollisionTraversalNode<Shape, BV, NarrowPhaseSolver>::leafTesting(
 
     if(!this->request.enable_contact)
     {
-      if(nsolver->shapeTriangleIntersect(*(this->model1), this->tf1, p1, p2, p3, nullptr, nullptr, nullptr))
+      if(nsolver->shapeTriangleIntersect(*(this->model1), this->tf1, p1, p2, p3, this->tf2, nullptr, nullptr, nullptr))
       {
         is_intersect = true;
         if(this->request.num_max_contacts > this->result->numContacts())
@@ -99,7 +99,7 @@ void ShapeMeshCollisionTraversalNode<Shape, BV, NarrowPhaseSolver>::leafTesting(
       Vector3<S> normal;
       Vector3<S> contactp;
 
-      if(nsolver->shapeTriangleIntersect(*(this->model1), this->tf1, p1, p2, p3, &contactp, &penetration, &normal))
+      if(nsolver->shapeTriangleIntersect(*(this->model1), this->tf1, p1, p2, p3, this->tf2, &contactp, &penetration, &normal))
       {
         is_intersect = true;
         if(this->request.num_max_contacts > this->result->numContacts())
@@ -112,18 +112,18 @@ void ShapeMeshCollisionTraversalNode<Shape, BV, NarrowPhaseSolver>::leafTesting(
       AABB<S> overlap_part;
       AABB<S> shape_aabb;
       computeBV(*(this->model1), this->tf1, shape_aabb);
-      AABB<S>(p1, p2, p3).overlap(shape_aabb, overlap_part);
+      AABB<S>(this->tf2 * p1, this->tf2 * p2, this->tf2 * p3).overlap(shape_aabb, overlap_part);
       this->result->addCostSource(CostSource<S>(overlap_part, cost_density), this->request.num_max_cost_sources);
     }
   }
   else if((!this->model1->isFree() && !this->model2->isFree()) && this->request.enable_cost)
   {
-    if(nsolver->shapeTriangleIntersect(*(this->model1), this->tf1, p1, p2, p3, nullptr, nullptr, nullptr))
+    if(nsolver->shapeTriangleIntersect(*(this->model1), this->tf1, p1, p2, p3, this->tf2, nullptr, nullptr, nullptr))
     {
       AABB<S> overlap_part;
       AABB<S> shape_aabb;
       computeBV(*(this->model1), this->tf1, shape_aabb);
-      AABB<S>(p1, p2, p3).overlap(shape_aabb, overlap_part);
+      AABB<S>(this->tf2 * p1, this->tf2 * p2, this->tf2 * p3).overlap(shape_aabb, overlap_part);
       this->result->addCostSource(CostSource<S>(overlap_part, cost_density), this->request.num_max_cost_sources);
     }
   }
@@ -144,43 +144,25 @@ bool initialize(
     ShapeMeshCollisionTraversalNode<Shape, BV, NarrowPhaseSolver>& node,
     const Shape& model1,
     const Transform3<typename BV::S>& tf1,
-    BVHModel<BV>& model2,
-    Transform3<typename BV::S>& tf2,
+    const BVHModel<BV>& model2,
+    const Transform3<typename BV::S>& tf2,
     const NarrowPhaseSolver* nsolver,
     const CollisionRequest<typename BV::S>& request,
-    CollisionResult<typename BV::S>& result,
-    bool use_refit,
-    bool refit_bottomup)
+    CollisionResult<typename BV::S>& result)
 {
   using S = typename BV::S;
 
   if(model2.getModelType() != BVH_MODEL_TRIANGLES)
     return false;
 
-  if(!tf2.matrix().isIdentity())
-  {
-    std::vector<Vector3<S>> vertices_transformed(model2.num_vertices);
-    for(int i = 0; i < model2.num_vertices; ++i)
-    {
-      Vector3<S>& p = model2.vertices[i];
-      Vector3<S> new_v = tf2 * p;
-      vertices_transformed[i] = new_v;
-    }
-
-    model2.beginReplaceModel();
-    model2.replaceSubModel(vertices_transformed);
-    model2.endReplaceModel(use_refit, refit_bottomup);
-
-    tf2.setIdentity();
-  }
-
   node.model1 = &model1;
   node.tf1 = tf1;
   node.model2 = &model2;
   node.tf2 = tf2;
   node.nsolver = nsolver;
 
-  computeBV(model1, tf1, node.model1_bv);
+  computeBV(model1, Transform3<S>(tf2.inverse(Eigen::Isometry) * tf1),
+            node.model1_bv);
 
   node.vertices = model2.vertices;
   node.tri_indices = model2.tri_indices;
@@ -79,12 +79,11 @@ bool initialize(
     ShapeMeshCollisionTraversalNode<Shape, BV, NarrowPhaseSolver>& node,
     const Shape& model1,
     const Transform3<typename BV::S>& tf1,
-    BVHModel<BV>& model2,
-    Transform3<typename BV::S>& tf2,
+    const BVHModel<BV>& model2,
+    const Transform3<typename BV::S>& tf2,
     const NarrowPhaseSolver* nsolver,
     const CollisionRequest<typename BV::S>& request,
-    CollisionResult<typename BV::S>& result,
-    bool use_refit = false, bool refit_bottomup = false);
+    CollisionResult<typename BV::S>& result);
 
 /// @brief Traversal node for shape and mesh, when mesh BVH is one of the oriented node (OBB, RSS, OBBRSS, kIOS)
 template <typename Shape, typename NarrowPhaseSolver>
@@ -40,6 +40,8 @@
 
 #include "fcl/narrowphase/detail/traversal/collision_node.h"
 
+#include "fcl/narrowphase/detail/query_statistics_recorder.h"
+
 /// @brief collision and distance function on traversal nodes. these functions provide a higher level abstraction for collision functions provided in collision_func_matrix
 namespace fcl
 {
@@ -71,6 +73,9 @@ void collide2(MeshCollisionTraversalNodeRSS<double>* node, BVHFrontList* front_l
 template <typename S>
 void collide(CollisionTraversalNodeBase<S>* node, BVHFrontList* front_list)
 {
+  ScopedTraversalWork traversal_work(
+        node->enable_statistics, node->num_bv_tests, node->num_leaf_tests);
+
   if(front_list && front_list->size() > 0)
   {
     propagateBVHFrontListCollisionRecurse(node, front_list);
@@ -85,6 +90,9 @@ void collide(CollisionTraversalNodeBase<S>* node, BVHFrontList* front_list)
 template <typename S>
 void collide2(MeshCollisionTraversalNodeOBB<S>* node, BVHFrontList* front_list)
 {
+  ScopedTraversalWork traversal_work(
+        node->enable_statistics, node->num_bv_tests, node->num_leaf_tests);
+
   if(front_list && front_list->size() > 0)
   {
     propagateBVHFrontListCollisionRecurse(node, front_list);
@@ -107,6 +115,9 @@ void collide2(MeshCollisionTraversalNodeOBB<S>* node, BVHFrontList* front_list)
 template <typename S>
 void collide2(MeshCollisionTraversalNodeRSS<S>* node, BVHFrontList* front_list)
 {
+  ScopedTraversalWork traversal_work(
+        node->enable_statistics, node->num_bv_tests, node->num_leaf_tests);
+
   if(front_list && front_list->size() > 0)
   {
     propagateBVHFrontListCollisionRecurse(node, front_list);
@@ -121,6 +132,8 @@ void collide2(MeshCollisionTraversalNodeRSS<S>* node, BVHFrontList* front_list)
 template <typename S>
 void selfCollide(CollisionTraversalNodeBase<S>* node, BVHFrontList* front_list)
 {
+  ScopedTraversalWork traversal_work(
+        node->enable_statistics, node->num_bv_tests, node->num_leaf_tests);
 
   if(front_list && front_list->size() > 0)
   {
@@ -136,9 +149,14 @@ void selfCollide(CollisionTraversalNodeBase<S>* node, BVHFrontList* front_list)
 template <typename S>
 void distance(DistanceTraversalNodeBase<S>* node, BVHFrontList* front_list, int qsize)
 {
+  ScopedTraversalWork traversal_work(
+        node->enable_statistics, node->num_bv_tests, node->num_leaf_tests);
+
   node->preprocess();
 
-  if(qsize <= 2)
+  if(node->request.enable_approximate_distance)
+    distanceBestFirst(node, 0, 0);
+  else if(qsize <= 2)
     distanceRecurse(node, 0, 0, front_list);
   else
     distanceQueueRecurse(node, 0, 0, front_list, qsize);
@@ -54,8 +54,6 @@ BVHDistanceTraversalNode<BV>::BVHDistanceTraversalNode()
   model1 = nullptr;
   model2 = nullptr;
 
-  num_bv_tests = 0;
-  num_leaf_tests = 0;
   query_time_seconds = 0.0;
 }
 
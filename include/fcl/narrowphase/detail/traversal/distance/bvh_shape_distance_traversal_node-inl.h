@@ -56,8 +56,6 @@ BVHShapeDistanceTraversalNode<BV, Shape>::BVHShapeDistanceTraversalNode()
   model1 = nullptr;
   model2 = nullptr;
 
-  num_bv_tests = 0;
-  num_leaf_tests = 0;
   query_time_seconds = 0.0;
 }
 
@@ -150,7 +150,7 @@ void MeshConservativeAdvancementTraversalNode<BV>::leafTesting(int b1, int b2) c
   Vector3<S> n = P2 - P1;
   n.normalize();
   // here n is already in global frame as we assume the body is in original configuration (I, 0) for general BVH
-  TriangleMotionBoundVisitor<S> mb_visitor1(p1, p2, p3, n), mb_visitor2(q1, q2, q3, n);
+  TriangleMotionBoundVisitor<S> mb_visitor1(p1, p2, p3, n, this->toc, 1), mb_visitor2(q1, q2, q3, n, this->toc, 1);
   S bound1 = motion1->computeMotionBound(mb_visitor1);
   S bound2 = motion2->computeMotionBound(mb_visitor2);
 
@@ -197,7 +197,7 @@ struct CanStopImpl
 
       assert(c == d);
 
-      TBVMotionBoundVisitor<BV> mb_visitor1(node.model1->getBV(c1).bv, n), mb_visitor2(node.model2->getBV(c2).bv, n);
+      TBVMotionBoundVisitor<BV> mb_visitor1(node.model1->getBV(c1).bv, n, node.toc, 1), mb_visitor2(node.model2->getBV(c2).bv, n, node.toc, 1);
       S bound1 = node.motion1->computeMotionBound(mb_visitor1);
       S bound2 = node.motion2->computeMotionBound(mb_visitor2);
 
@@ -255,6 +255,7 @@ struct CanStopImpl<S, OBB<S>>
           node.model2,
           node.motion1,
           node.motion2,
+          node.toc,
           node.stack,
           node.delta_t);
   }
@@ -278,6 +279,7 @@ struct CanStopImpl<S, RSS<S>>
           node.model2,
           node.motion1,
           node.motion2,
+          node.toc,
           node.stack,
           node.delta_t);
   }
@@ -301,6 +303,7 @@ struct CanStopImpl<S, OBBRSS<S>>
           node.model2,
           node.motion1,
           node.motion2,
+          node.toc,
           node.stack,
           node.delta_t);
   }
@@ -385,6 +388,7 @@ leafTesting(int b1, int b2) const
         T,
         this->motion1,
         this->motion2,
+        this->toc,
         this->enable_statistics,
         this->min_distance,
         this->closest_p1,
@@ -409,6 +413,7 @@ bool MeshConservativeAdvancementTraversalNodeRSS<S>::canStop(S c) const
         this->model2,
         this->motion1,
         this->motion2,
+        this->toc,
         this->stack,
         this->delta_t);
 }
@@ -440,6 +445,7 @@ leafTesting(int b1, int b2) const
         this->T,
         this->motion1,
         this->motion2,
+        this->toc,
         this->enable_statistics,
         this->min_distance,
         this->closest_p1,
@@ -464,6 +470,7 @@ bool MeshConservativeAdvancementTraversalNodeOBBRSS<S>::canStop(S c) const
         this->model2,
         this->motion1,
         this->motion2,
+        this->toc,
         this->stack,
         this->delta_t);
 }
@@ -510,6 +517,7 @@ bool meshConservativeAdvancementTraversalNodeCanStop(
     const BVHModel<BV>* model2,
     const MotionBase<typename BV::S>* motion1,
     const MotionBase<typename BV::S>* motion2,
+    typename BV::S toc,
     std::vector<ConservativeAdvancementStackData<typename BV::S>>& stack,
     typename BV::S& delta_t)
 {
@@ -545,7 +553,7 @@ bool meshConservativeAdvancementTraversalNodeCanStop(
         getBVAxis(model1->getBV(c1).bv, 1) * n[1] +
         getBVAxis(model1->getBV(c1).bv, 2) * n[2];
 
-    TBVMotionBoundVisitor<BV> mb_visitor1(model1->getBV(c1).bv, n_transformed), mb_visitor2(model2->getBV(c2).bv, n_transformed);
+    TBVMotionBoundVisitor<BV> mb_visitor1(model1->getBV(c1).bv, n_transformed, toc, 1), mb_visitor2(model2->getBV(c2).bv, n_transformed, toc, 1);
     S bound1 = motion1->computeMotionBound(mb_visitor1);
     S bound2 = motion2->computeMotionBound(mb_visitor2);
 
@@ -588,6 +596,7 @@ bool meshConservativeAdvancementOrientedNodeCanStop(
     const BVHModel<BV>* model2,
     const MotionBase<typename BV::S>* motion1,
     const MotionBase<typename BV::S>* motion2,
+    typename BV::S toc,
     std::vector<ConservativeAdvancementStackData<typename BV::S>>& stack,
     typename BV::S& delta_t)
 {
@@ -623,12 +632,11 @@ bool meshConservativeAdvancementOrientedNodeCanStop(
       getBVAxis(model1->getBV(c1).bv, 0) * n[0] +
       getBVAxis(model1->getBV(c1).bv, 1) * n[1] +
       getBVAxis(model1->getBV(c1).bv, 2) * n[2];
-    Quaternion<S> R0;
-    motion1->getCurrentRotation(R0);
+    Quaternion<S> R0(motion1->evaluate(toc).linear());
     n_transformed = R0 * n_transformed;
     n_transformed.normalize();
 
-    TBVMotionBoundVisitor<BV> mb_visitor1(model1->getBV(c1).bv, n_transformed), mb_visitor2(model2->getBV(c2).bv, -n_transformed);
+    TBVMotionBoundVisitor<BV> mb_visitor1(model1->getBV(c1).bv, n_transformed, toc, 1), mb_visitor2(model2->getBV(c2).bv, -n_transformed, toc, 1);
     S bound1 = motion1->computeMotionBound(mb_visitor1);
     S bound2 = motion2->computeMotionBound(mb_visitor2);
 
@@ -674,6 +682,7 @@ void meshConservativeAdvancementOrientedNodeLeafTesting(
     const Vector3<typename BV::S>& T,
     const MotionBase<typename BV::S>* motion1,
     const MotionBase<typename BV::S>* motion2,
+    typename BV::S toc,
     bool enable_statistics,
     typename BV::S& min_distance,
     Vector3<typename BV::S>& p1,
@@ -726,12 +735,11 @@ void meshConservativeAdvancementOrientedNodeLeafTesting(
   /// n is the local frame of object 1, pointing from object 1 to object2
   Vector3<S> n = P2 - P1;
   /// turn n into the global frame, pointing from object 1 to object 2
-  Quaternion<S> R0;
-  motion1->getCurrentRotation(R0);
+  Quaternion<S> R0(motion1->evaluate(toc).linear());
   Vector3<S> n_transformed = R0 * n;
   n_transformed.normalize(); // normalized here
 
-  TriangleMotionBoundVisitor<S> mb_visitor1(t11, t12, t13, n_transformed), mb_visitor2(t21, t22, t23, -n_transformed);
+  TriangleMotionBoundVisitor<S> mb_visitor1(t11, t12, t13, n_transformed, toc, 1), mb_visitor2(t21, t22, t23, -n_transformed, toc, 1);
   S bound1 = motion1->computeMotionBound(mb_visitor1);
   S bound2 = motion2->computeMotionBound(mb_visitor2);
 
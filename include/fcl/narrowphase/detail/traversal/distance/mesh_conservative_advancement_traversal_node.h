@@ -224,6 +224,7 @@ bool meshConservativeAdvancementTraversalNodeCanStop(
     const BVHModel<BV>* model2,
     const MotionBase<typename BV::S>* motion1,
     const MotionBase<typename BV::S>* motion2,
+    typename BV::S toc,
     std::vector<ConservativeAdvancementStackData<typename BV::S>>& stack,
     typename BV::S& delta_t);
 
@@ -239,6 +240,7 @@ bool meshConservativeAdvancementOrientedNodeCanStop(
     const BVHModel<BV>* model2,
     const MotionBase<typename BV::S>* motion1,
     const MotionBase<typename BV::S>* motion2,
+    typename BV::S toc,
     std::vector<ConservativeAdvancementStackData<typename BV::S>>& stack,
     typename BV::S& delta_t);
 
@@ -257,6 +259,7 @@ void meshConservativeAdvancementOrientedNodeLeafTesting(
     const Vector3<typename BV::S>& T,
     const MotionBase<typename BV::S>* motion1,
     const MotionBase<typename BV::S>* motion2,
+    typename BV::S toc,
     bool enable_statistics,
     typename BV::S& min_distance,
     Vector3<typename BV::S>& p1,
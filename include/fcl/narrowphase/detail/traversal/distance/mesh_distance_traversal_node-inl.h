@@ -91,6 +91,21 @@ bool initialize(
     const DistanceRequest<double>& request,
     DistanceResult<double>& result);
 
+//==============================================================================
+extern template
+class FCL_EXPORT MeshDistanceTraversalNodeFloatOBBRSS<double>;
+
+//==============================================================================
+extern template
+bool initialize(
+    MeshDistanceTraversalNodeFloatOBBRSS<double>& node,
+    const BVHModel<FloatOBBRSS<double>>& model1,
+    const Transform3<double>& tf1,
+    const BVHModel<FloatOBBRSS<double>>& model2,
+    const Transform3<double>& tf2,
+    const DistanceRequest<double>& request,
+    DistanceResult<double>& result);
+
 //==============================================================================
 template <typename BV>
 MeshDistanceTraversalNode<BV>::MeshDistanceTraversalNode() : BVHDistanceTraversalNode<BV>()
@@ -102,130 +117,66 @@ MeshDistanceTraversalNode<BV>::MeshDistanceTraversalNode() : BVHDistanceTraversa
 
   rel_err = this->request.rel_err;
   abs_err = this->request.abs_err;
+
+  tf.setIdentity();
 }
 
 //==============================================================================
 template <typename BV>
-void MeshDistanceTraversalNode<BV>::leafTesting(int b1, int b2) const
+void MeshDistanceTraversalNode<BV>::postprocess()
 {
-  if(this->enable_statistics) this->num_leaf_tests++;
-
-  const BVNode<BV>& node1 = this->model1->getBV(b1);
-  const BVNode<BV>& node2 = this->model2->getBV(b2);
-
-  int primitive_id1 = node1.primitiveId();
-  int primitive_id2 = node2.primitiveId();
-
-  const Triangle& tri_id1 = tri_indices1[primitive_id1];
-  const Triangle& tri_id2 = tri_indices2[primitive_id2];
-
-  const Vector3<S>& t11 = vertices1[tri_id1[0]];
-  const Vector3<S>& t12 = vertices1[tri_id1[1]];
-  const Vector3<S>& t13 = vertices1[tri_id1[2]];
-
-  const Vector3<S>& t21 = vertices2[tri_id2[0]];
-  const Vector3<S>& t22 = vertices2[tri_id2[1]];
-  const Vector3<S>& t23 = vertices2[tri_id2[2]];
-
-  // nearest point pair
-  Vector3<S> P1, P2;
+  detail::distancePostprocessOrientedNode(
+        this->model1,
+        this->model2,
+        this->tf1,
+        this->request,
+        *this->result);
+}
 
-  S d = TriangleDistance<S>::triDistance(t11, t12, t13, t21, t22, t23,
-                                           P1, P2);
+//==============================================================================
+template <typename BV>
+typename BV::S MeshDistanceTraversalNode<BV>::BVTesting(int b1, int b2) const
+{
+  if(this->enable_statistics) this->num_bv_tests++;
 
-  if(this->request.enable_nearest_points)
-  {
-    this->result->update(d, this->model1, this->model2, primitive_id1, primitive_id2, P1, P2);
-  }
-  else
-  {
-    this->result->update(d, this->model1, this->model2, primitive_id1, primitive_id2);
-  }
+  BV bv2;
+  transformBV(this->model2->getBV(b2).bv, tf, bv2);
+  return this->model1->getBV(b1).bv.distance(bv2);
 }
 
 //==============================================================================
 template <typename BV>
-bool MeshDistanceTraversalNode<BV>::canStop(typename BV::S c) const
+void MeshDistanceTraversalNode<BV>::leafTesting(int b1, int b2) const
 {
-  if((c >= this->result->min_distance - abs_err) && (c * (1 + rel_err) >= this->result->min_distance))
-    return true;
-  return false;
+  detail::meshDistanceOrientedNodeLeafTesting(
+        b1,
+        b2,
+        this->model1,
+        this->model2,
+        vertices1,
+        vertices2,
+        tri_indices1,
+        tri_indices2,
+        tf,
+        this->enable_statistics,
+        this->num_leaf_tests,
+        this->request,
+        *this->result);
 }
 
 //==============================================================================
 template <typename BV>
-bool initialize(
-    MeshDistanceTraversalNode<BV>& node,
-    BVHModel<BV>& model1,
-    Transform3<typename BV::S>& tf1,
-    BVHModel<BV>& model2,
-    Transform3<typename BV::S>& tf2,
-    const DistanceRequest<typename BV::S>& request,
-    DistanceResult<typename BV::S>& result,
-    bool use_refit,
-    bool refit_bottomup)
+bool MeshDistanceTraversalNode<BV>::canStop(typename BV::S c) const
 {
-  using S = typename BV::S;
-
-  if(model1.getModelType() != BVH_MODEL_TRIANGLES || model2.getModelType() != BVH_MODEL_TRIANGLES)
-    return false;
-
-  if(!tf1.matrix().isIdentity())
-  {
-    std::vector<Vector3<S>> vertices_transformed1(model1.num_vertices);
-    for(int i = 0; i < model1.num_vertices; ++i)
-    {
-      Vector3<S>& p = model1.vertices[i];
-      Vector3<S> new_v = tf1 * p;
-      vertices_transformed1[i] = new_v;
-    }
-
-    model1.beginReplaceModel();
-    model1.replaceSubModel(vertices_transformed1);
-    model1.endReplaceModel(use_refit, refit_bottomup);
-
-    tf1.setIdentity();
-  }
-
-  if(!tf2.matrix().isIdentity())
-  {
-    std::vector<Vector3<S>> vertices_transformed2(model2.num_vertices);
-    for(int i = 0; i < model2.num_vertices; ++i)
-    {
-      Vector3<S>& p = model2.vertices[i];
-      Vector3<S> new_v = tf2 * p;
-      vertices_transformed2[i] = new_v;
-    }
-
-    model2.beginReplaceModel();
-    model2.replaceSubModel(vertices_transformed2);
-    model2.endReplaceModel(use_refit, refit_bottomup);
-
-    tf2.setIdentity();
-  }
-
-  node.request = request;
-  node.result = &result;
-
-  node.model1 = &model1;
-  node.tf1 = tf1;
-  node.model2 = &model2;
-  node.tf2 = tf2;
-
-  node.vertices1 = model1.vertices;
-  node.vertices2 = model2.vertices;
-
-  node.tri_indices1 = model1.tri_indices;
-  node.tri_indices2 = model2.tri_indices;
-
-  return true;
+  if((c >= this->result->min_distance - abs_err) && (c * (1 + rel_err) >= this->result->min_distance))
+    return true;
+  return false;
 }
 
 //==============================================================================
 template <typename S>
 MeshDistanceTraversalNodeRSS<S>::MeshDistanceTraversalNodeRSS()
-  : MeshDistanceTraversalNode<RSS<S>>(),
-    tf(Transform3<S>::Identity())
+  : MeshDistanceTraversalNode<RSS<S>>()
 {
 }
 
@@ -242,7 +193,7 @@ void MeshDistanceTraversalNodeRSS<S>::preprocess()
         this->tri_indices2,
         0,
         0,
-        tf,
+        this->tf,
         this->request,
         *this->result);
 }
@@ -272,7 +223,7 @@ void MeshDistanceTraversalNodeRSS<S>::leafTesting(int b1, int b2) const
         this->vertices2,
         this->tri_indices1,
         this->tri_indices2,
-        tf,
+        this->tf,
         this->enable_statistics,
         this->num_leaf_tests,
         this->request,
@@ -282,8 +233,7 @@ void MeshDistanceTraversalNodeRSS<S>::leafTesting(int b1, int b2) const
 //==============================================================================
 template <typename S>
 MeshDistanceTraversalNodekIOS<S>::MeshDistanceTraversalNodekIOS()
-  : MeshDistanceTraversalNode<kIOS<S>>(),
-    tf(Transform3<S>::Identity())
+  : MeshDistanceTraversalNode<kIOS<S>>()
 {
   // Do nothing
 }
@@ -301,7 +251,7 @@ void MeshDistanceTraversalNodekIOS<S>::preprocess()
         this->tri_indices2,
         0,
         0,
-        tf,
+        this->tf,
         this->request,
         *this->result);
 }
@@ -331,7 +281,7 @@ void MeshDistanceTraversalNodekIOS<S>::leafTesting(int b1, int b2) const
         this->vertices2,
         this->tri_indices1,
         this->tri_indices2,
-        tf,
+        this->tf,
         this->enable_statistics,
         this->num_leaf_tests,
         this->request,
@@ -341,8 +291,7 @@ void MeshDistanceTraversalNodekIOS<S>::leafTesting(int b1, int b2) const
 //==============================================================================
 template <typename S>
 MeshDistanceTraversalNodeOBBRSS<S>::MeshDistanceTraversalNodeOBBRSS()
-  : MeshDistanceTraversalNode<OBBRSS<S>>(),
-    tf(Transform3<S>::Identity())
+  : MeshDistanceTraversalNode<OBBRSS<S>>()
 {
   // Do nothing
 }
@@ -360,7 +309,7 @@ void MeshDistanceTraversalNodeOBBRSS<S>::preprocess()
         this->tri_indices2,
         0,
         0,
-        tf,
+        this->tf,
         this->request,
         *this->result);
 }
@@ -390,7 +339,65 @@ void MeshDistanceTraversalNodeOBBRSS<S>::leafTesting(int b1, int b2) const
         this->vertices2,
         this->tri_indices1,
         this->tri_indices2,
-        tf,
+        this->tf,
+        this->enable_statistics,
+        this->num_leaf_tests,
+        this->request,
+        *this->result);
+}
+
+//==============================================================================
+template <typename S>
+MeshDistanceTraversalNodeFloatOBBRSS<S>::MeshDistanceTraversalNodeFloatOBBRSS()
+  : MeshDistanceTraversalNode<FloatOBBRSS<S>>()
+{
+  // Do nothing
+}
+
+//==============================================================================
+template <typename S>
+void MeshDistanceTraversalNodeFloatOBBRSS<S>::preprocess()
+{
+  detail::distancePreprocessOrientedNode(
+        this->model1,
+        this->model2,
+        this->vertices1,
+        this->vertices2,
+        this->tri_indices1,
+        this->tri_indices2,
+        0,
+        0,
+        this->tf,
+        this->request,
+        *this->result);
+}
+
+//==============================================================================
+template <typename S>
+void MeshDistanceTraversalNodeFloatOBBRSS<S>::postprocess()
+{
+  detail::distancePostprocessOrientedNode(
+        this->model1,
+        this->model2,
+        this->tf1,
+        this->request,
+        *this->result);
+}
+
+//==============================================================================
+template <typename S>
+void MeshDistanceTraversalNodeFloatOBBRSS<S>::leafTesting(int b1, int b2) const
+{
+  detail::meshDistanceOrientedNodeLeafTesting(
+        b1,
+        b2,
+        this->model1,
+        this->model2,
+        this->vertices1,
+        this->vertices2,
+        this->tri_indices1,
+        this->tri_indices2,
+        this->tf,
         this->enable_statistics,
         this->num_leaf_tests,
         this->request,
@@ -632,6 +639,21 @@ static bool setupMeshDistanceOrientedNode(
   return true;
 }
 
+//==============================================================================
+template <typename BV>
+bool initialize(
+    MeshDistanceTraversalNode<BV>& node,
+    const BVHModel<BV>& model1,
+    const Transform3<typename BV::S>& tf1,
+    const BVHModel<BV>& model2,
+    const Transform3<typename BV::S>& tf2,
+    const DistanceRequest<typename BV::S>& request,
+    DistanceResult<typename BV::S>& result)
+{
+  return detail::setupMeshDistanceOrientedNode(
+        node, model1, tf1, model2, tf2, request, result);
+}
+
 //==============================================================================
 template <typename S>
 bool initialize(
@@ -677,6 +699,21 @@ bool initialize(
         node, model1, tf1, model2, tf2, request, result);
 }
 
+//==============================================================================
+template <typename S>
+bool initialize(
+    MeshDistanceTraversalNodeFloatOBBRSS<S>& node,
+    const BVHModel<FloatOBBRSS<S>>& model1,
+    const Transform3<S>& tf1,
+    const BVHModel<FloatOBBRSS<S>>& model2,
+    const Transform3<S>& tf2,
+    const DistanceRequest<S>& request,
+    DistanceResult<S>& result)
+{
+  return detail::setupMeshDistanceOrientedNode(
+        node, model1, tf1, model2, tf2, request, result);
+}
+
 } // namespace detail
 } // namespace fcl
 
@@ -41,7 +41,9 @@
 #include "fcl/narrowphase/detail/primitive_shape_algorithm/triangle_distance.h"
 #include "fcl/math/bv/RSS.h"
 #include "fcl/math/bv/OBBRSS.h"
+#include "fcl/math/bv/FloatOBBRSS.h"
 #include "fcl/math/bv/kIOS.h"
+#include "fcl/math/bv/utility.h"
 #include "fcl/narrowphase/detail/traversal/distance/bvh_distance_traversal_node.h"
 
 namespace fcl
@@ -60,6 +62,14 @@ public:
 
   MeshDistanceTraversalNode();
 
+  /// @brief Nearest points of the leaves are found in the frame of model1;
+  /// move them to the world frame
+  void postprocess();
+
+  /// @brief BV test between b1 and b2, with the BV of model2 bounded in the
+  /// frame of model1
+  S BVTesting(int b1, int b2) const;
+
   /// @brief Distance testing between leaves (two triangles)
   void leafTesting(int b1, int b2) const;
 
@@ -75,21 +85,26 @@ public:
   /// @brief relative and absolute error, default value is 0.01 for both terms
   S rel_err;
   S abs_err;
+
+  /// @brief The pose of model2 in the frame of model1
+  Transform3<S> tf;
+
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 };
 
 /// @brief Initialize traversal node for distance computation between two
-/// meshes, given the current transforms
+/// meshes, given the current transforms. Neither mesh is modified: the
+/// traversal runs in the frame of model1.
 template <typename BV>
 FCL_EXPORT
 bool initialize(
     MeshDistanceTraversalNode<BV>& node,
-    BVHModel<BV>& model1,
-    Transform3<typename BV::S>& tf1,
-    BVHModel<BV>& model2,
-    Transform3<typename BV::S>& tf2,
+    const BVHModel<BV>& model1,
+    const Transform3<typename BV::S>& tf1,
+    const BVHModel<BV>& model2,
+    const Transform3<typename BV::S>& tf2,
     const DistanceRequest<typename BV::S>& request,
-    DistanceResult<typename BV::S>& result,
-    bool use_refit = false, bool refit_bottomup = false);
+    DistanceResult<typename BV::S>& result);
 
 /// @brief Traversal node for distance computation between two meshes if their underlying BVH node is oriented node (RSS, OBBRSS, kIOS)
 template <typename S>
@@ -107,13 +122,11 @@ public:
   {
     if (this->enable_statistics) this->num_bv_tests++;
 
-    return distance(tf.linear(), tf.translation(), this->model1->getBV(b1).bv, this->model2->getBV(b2).bv);
+    return distance(this->tf.linear(), this->tf.translation(), this->model1->getBV(b1).bv, this->model2->getBV(b2).bv);
   }
 
   void leafTesting(int b1, int b2) const;
 
-  Transform3<S> tf;
-
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 };
 
@@ -148,13 +161,11 @@ public:
   {
     if (this->enable_statistics) this->num_bv_tests++;
 
-    return distance(tf.linear(), tf.translation(), this->model1->getBV(b1).bv, this->model2->getBV(b2).bv);
+    return distance(this->tf.linear(), this->tf.translation(), this->model1->getBV(b1).bv, this->model2->getBV(b2).bv);
   }
 
   void leafTesting(int b1, int b2) const;
 
-  Transform3<S> tf;
-
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 };
 
@@ -189,13 +200,11 @@ public:
   {
     if (this->enable_statistics) this->num_bv_tests++;
 
-    return distance(tf.linear(), tf.translation(), this->model1->getBV(b1).bv, this->model2->getBV(b2).bv);
+    return distance(this->tf.linear(), this->tf.translation(), this->model1->getBV(b1).bv, this->model2->getBV(b2).bv);
   }
 
   void leafTesting(int b1, int b2) const;
 
-  Transform3<S> tf;
-
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 };
 
@@ -215,6 +224,45 @@ bool initialize(
     const DistanceRequest<S>& request,
     DistanceResult<S>& result);
 
+template <typename S>
+class FCL_EXPORT MeshDistanceTraversalNodeFloatOBBRSS
+    : public MeshDistanceTraversalNode<FloatOBBRSS<S>>
+{
+public:
+  MeshDistanceTraversalNodeFloatOBBRSS();
+
+  void preprocess();
+
+  void postprocess();
+
+  S BVTesting(int b1, int b2) const
+  {
+    if (this->enable_statistics) this->num_bv_tests++;
+
+    return distance(this->tf.linear(), this->tf.translation(), this->model1->getBV(b1).bv, this->model2->getBV(b2).bv);
+  }
+
+  void leafTesting(int b1, int b2) const;
+
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+using MeshDistanceTraversalNodeFloatOBBRSSf = MeshDistanceTraversalNodeFloatOBBRSS<float>;
+using MeshDistanceTraversalNodeFloatOBBRSSd = MeshDistanceTraversalNodeFloatOBBRSS<double>;
+
+/// @brief Initialize traversal node for distance computation between two
+///  meshes, specialized for FloatOBBRSS type
+template <typename S>
+FCL_EXPORT
+bool initialize(
+    MeshDistanceTraversalNodeFloatOBBRSS<S>& node,
+    const BVHModel<FloatOBBRSS<S>>& model1,
+    const Transform3<S>& tf1,
+    const BVHModel<FloatOBBRSS<S>>& model2,
+    const Transform3<S>& tf2,
+    const DistanceRequest<S>& request,
+    DistanceResult<S>& result);
+
 template <typename BV>
 FCL_DEPRECATED_EXPORT
 void meshDistanceOrientedNodeLeafTesting(
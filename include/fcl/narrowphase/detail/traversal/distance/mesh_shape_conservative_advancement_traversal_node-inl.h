@@ -54,6 +54,8 @@ MeshShapeConservativeAdvancementTraversalNode<BV, Shape, NarrowPhaseSolver>::
 MeshShapeConservativeAdvancementTraversalNode(S w_) :
   MeshShapeDistanceTraversalNode<BV, Shape, NarrowPhaseSolver>()
 {
+  last_tri_id = -1;
+
   delta_t = 1;
   toc = 0;
   t_err = (S)0.0001;
@@ -100,7 +102,14 @@ leafTesting(int b1, int b2) const
 
   S d;
   Vector3<S> P1, P2;
-  this->nsolver->shapeTriangleDistance(*(this->model2), this->tf2, p1, p2, p3, &d, &P2, &P1);
+  if(!this->nsolver->shapeTriangleDistance(*(this->model2), this->tf2, p1, p2, p3, &d, &P2, &P1))
+  {
+    // The triangle already touches the shape, the motion cannot advance
+    this->min_distance = 0;
+    last_tri_id = primitive_id;
+    delta_t = 0;
+    return;
+  }
 
   if(d < this->min_distance)
   {
@@ -112,10 +121,10 @@ leafTesting(int b1, int b2) const
     last_tri_id = primitive_id;
   }
 
-  Vector3<S> n = this->tf2 * p2 - P1; n.normalize();
+  Vector3<S> n = P2 - P1; n.normalize();
   // here n should be in global frame
-  TriangleMotionBoundVisitor<S> mb_visitor1(p1, p2, p3, n);
-  TBVMotionBoundVisitor<BV> mb_visitor2(this->model2_bv, -n);
+  TriangleMotionBoundVisitor<S> mb_visitor1(p1, p2, p3, n, this->toc, 1);
+  TBVMotionBoundVisitor<BV> mb_visitor2(this->model2_bv, -n, this->toc, 1);
   S bound1 = motion1->computeMotionBound(mb_visitor1);
   S bound2 = motion2->computeMotionBound(mb_visitor2);
 
@@ -142,8 +151,8 @@ canStop(S c) const
     Vector3<S> n = this->tf2 * data.P2 - data.P1; n.normalize();
     int c1 = data.c1;
 
-    TBVMotionBoundVisitor<BV> mb_visitor1(this->model1->getBV(c1).bv, n);
-    TBVMotionBoundVisitor<BV> mb_visitor2(this->model2_bv, -n);
+    TBVMotionBoundVisitor<BV> mb_visitor1(this->model1->getBV(c1).bv, n, this->toc, 1);
+    TBVMotionBoundVisitor<BV> mb_visitor2(this->model2_bv, -n, this->toc, 1);
     S bound1 = motion1->computeMotionBound(mb_visitor1);
     S bound2 = motion2->computeMotionBound(mb_visitor2);
 
@@ -226,6 +235,7 @@ void meshShapeConservativeAdvancementOrientedNodeLeafTesting(
     const Transform3<typename BV::S>& tf2,
     const MotionBase<typename BV::S>* motion1,
     const MotionBase<typename BV::S>* motion2,
+    typename BV::S toc,
     const NarrowPhaseSolver* nsolver,
     bool enable_statistics,
     typename BV::S& min_distance,
@@ -250,7 +260,14 @@ void meshShapeConservativeAdvancementOrientedNodeLeafTesting(
   S distance;
   Vector3<S> P1 = Vector3<S>::Zero();
   Vector3<S> P2 = Vector3<S>::Zero();
-  nsolver->shapeTriangleDistance(model2, tf2, t1, t2, t3, tf1, &distance, &P2, &P1);
+  if(!nsolver->shapeTriangleDistance(model2, tf2, t1, t2, t3, tf1, &distance, &P2, &P1))
+  {
+    // The triangle already touches the shape, the motion cannot advance
+    min_distance = 0;
+    last_tri_id = primitive_id;
+    delta_t = 0;
+    return;
+  }
 
   if(distance < min_distance)
   {
@@ -265,8 +282,8 @@ void meshShapeConservativeAdvancementOrientedNodeLeafTesting(
   // n is in global frame
   Vector3<S> n = P2 - P1; n.normalize();
 
-  TriangleMotionBoundVisitor<S> mb_visitor1(t1, t2, t3, n);
-  TBVMotionBoundVisitor<BV> mb_visitor2(model2_bv, -n);
+  TriangleMotionBoundVisitor<S> mb_visitor1(t1, t2, t3, n, toc, 1);
+  TBVMotionBoundVisitor<BV> mb_visitor2(model2_bv, -n, toc, 1);
   S bound1 = motion1->computeMotionBound(mb_visitor1);
   S bound2 = motion2->computeMotionBound(mb_visitor2);
 
@@ -293,6 +310,7 @@ bool meshShapeConservativeAdvancementOrientedNodeCanStop(
     const BV& model2_bv,
     const MotionBase<typename BV::S>* motion1,
     const MotionBase<typename BV::S>* motion2,
+    typename BV::S toc,
     std::vector<ConservativeAdvancementStackData<typename BV::S>>& stack,
     typename BV::S& delta_t)
 {
@@ -306,8 +324,8 @@ bool meshShapeConservativeAdvancementOrientedNodeCanStop(
     Vector3<S> n = data.P2 - data.P1; n.normalize();
     int c1 = data.c1;
 
-    TBVMotionBoundVisitor<BV> mb_visitor1(model1->getBV(c1).bv, n);
-    TBVMotionBoundVisitor<BV> mb_visitor2(model2_bv, -n);
+    TBVMotionBoundVisitor<BV> mb_visitor1(model1->getBV(c1).bv, n, toc, 1);
+    TBVMotionBoundVisitor<BV> mb_visitor2(model2_bv, -n, toc, 1);
 
     S bound1 = motion1->computeMotionBound(mb_visitor1);
     S bound2 = motion2->computeMotionBound(mb_visitor2);
@@ -375,6 +393,7 @@ leafTesting(int b1, int b2) const
         this->tf2,
         this->motion1,
         this->motion2,
+        this->toc,
         this->nsolver,
         this->enable_statistics,
         this->min_distance,
@@ -402,6 +421,7 @@ canStop(typename Shape::S c) const
         this->model2_bv,
         this->motion1,
         this->motion2,
+        this->toc,
         this->stack,
         this->delta_t);
 }
@@ -476,6 +496,7 @@ leafTesting(int b1, int b2) const
         this->tf2,
         this->motion1,
         this->motion2,
+        this->toc,
         this->nsolver,
         this->enable_statistics,
         this->min_distance,
@@ -503,6 +524,7 @@ canStop(typename Shape::S c) const
         this->model2_bv,
         this->motion1,
         this->motion2,
+        this->toc,
         this->stack,
         this->delta_t);
 }
@@ -115,6 +115,7 @@ void meshShapeConservativeAdvancementOrientedNodeLeafTesting(
     const Transform3<typename BV::S>& tf2,
     const MotionBase<typename BV::S>* motion1,
     const MotionBase<typename BV::S>* motion2,
+    typename BV::S toc,
     const NarrowPhaseSolver* nsolver,
     bool enable_statistics,
     typename BV::S& min_distance,
@@ -136,6 +137,7 @@ bool meshShapeConservativeAdvancementOrientedNodeCanStop(
     const BV& model2_bv,
     const MotionBase<typename BV::S>* motion1,
     const MotionBase<typename BV::S>* motion2,
+    typename BV::S toc,
     std::vector<ConservativeAdvancementStackData<typename BV::S>>& stack,
     typename BV::S& delta_t);
 
@@ -68,32 +68,20 @@ template <typename BV, typename Shape, typename NarrowPhaseSolver>
 void MeshShapeDistanceTraversalNode<BV, Shape, NarrowPhaseSolver>::
 leafTesting(int b1, int b2) const
 {
-  FCL_UNUSED(b2);
-
-  if(this->enable_statistics) this->num_leaf_tests++;
-
-  const BVNode<BV>& node = this->model1->getBV(b1);
-
-  int primitive_id = node.primitiveId();
-
-  const Triangle& tri_id = tri_indices[primitive_id];
-
-  const Vector3<S>& p1 = vertices[tri_id[0]];
-  const Vector3<S>& p2 = vertices[tri_id[1]];
-  const Vector3<S>& p3 = vertices[tri_id[2]];
-
-  S d;
-  Vector3<S> closest_p1, closest_p2;
-  nsolver->shapeTriangleDistance(*(this->model2), this->tf2, p1, p2, p3, &d, &closest_p2, &closest_p1);
-
-  this->result->update(
-        d,
+  detail::meshShapeDistanceOrientedNodeLeafTesting(
+        b1,
+        b2,
         this->model1,
-        this->model2,
-        primitive_id,
-        DistanceResult<S>::NONE,
-        closest_p1,
-        closest_p2);
+        *(this->model2),
+        vertices,
+        tri_indices,
+        this->tf1,
+        this->tf2,
+        nsolver,
+        this->enable_statistics,
+        this->num_leaf_tests,
+        this->request,
+        *(this->result));
 }
 
 //==============================================================================
@@ -110,38 +98,19 @@ canStop(S c) const
 template <typename BV, typename Shape, typename NarrowPhaseSolver>
 bool initialize(
     MeshShapeDistanceTraversalNode<BV, Shape, NarrowPhaseSolver>& node,
-    BVHModel<BV>& model1,
-    Transform3<typename Shape::S>& tf1,
+    const BVHModel<BV>& model1,
+    const Transform3<typename BV::S>& tf1,
     const Shape& model2,
     const Transform3<typename BV::S>& tf2,
     const NarrowPhaseSolver* nsolver,
     const DistanceRequest<typename BV::S>& request,
-    DistanceResult<typename BV::S>& result,
-    bool use_refit,
-    bool refit_bottomup)
+    DistanceResult<typename BV::S>& result)
 {
   using S = typename BV::S;
 
   if(model1.getModelType() != BVH_MODEL_TRIANGLES)
     return false;
 
-  if(!tf1.matrix().isIdentity())
-  {
-    std::vector<Vector3<S>> vertices_transformed1(model1.num_vertices);
-    for(int i = 0; i < model1.num_vertices; ++i)
-    {
-      Vector3<S>& p = model1.vertices[i];
-      Vector3<S> new_v = tf1 * p;
-      vertices_transformed1[i] = new_v;
-    }
-
-    model1.beginReplaceModel();
-    model1.replaceSubModel(vertices_transformed1);
-    model1.endReplaceModel(use_refit, refit_bottomup);
-
-    tf1.setIdentity();
-  }
-
   node.request = request;
   node.result = &result;
 
@@ -154,7 +123,8 @@ bool initialize(
   node.vertices = model1.vertices;
   node.tri_indices = model1.tri_indices;
 
-  computeBV(model2, tf2, node.model2_bv);
+  computeBV(model2, Transform3<S>(tf1.inverse(Eigen::Isometry) * tf2),
+            node.model2_bv);
 
   return true;
 }
@@ -382,6 +352,48 @@ void MeshShapeDistanceTraversalNodeOBBRSS<Shape, NarrowPhaseSolver>::leafTesting
                                                     this->tf1, this->tf2, this->nsolver, this->enable_statistics, this->num_leaf_tests, this->request, *(this->result));
 }
 
+//==============================================================================
+template <typename Shape, typename NarrowPhaseSolver>
+MeshShapeDistanceTraversalNodeFloatOBBRSS<Shape, NarrowPhaseSolver>::MeshShapeDistanceTraversalNodeFloatOBBRSS() : MeshShapeDistanceTraversalNode<FloatOBBRSS<S>, Shape, NarrowPhaseSolver>()
+{
+}
+
+//==============================================================================
+template <typename Shape, typename NarrowPhaseSolver>
+void MeshShapeDistanceTraversalNodeFloatOBBRSS<Shape, NarrowPhaseSolver>::preprocess()
+{
+  detail::distancePreprocessOrientedNode(this->model1, this->vertices, this->tri_indices, 0,
+                                          *(this->model2), this->tf1, this->tf2, this->nsolver, this->request, *(this->result));
+}
+
+//==============================================================================
+template <typename Shape, typename NarrowPhaseSolver>
+void MeshShapeDistanceTraversalNodeFloatOBBRSS<Shape, NarrowPhaseSolver>::postprocess()
+{
+
+}
+
+//==============================================================================
+template <typename Shape, typename NarrowPhaseSolver>
+typename Shape::S
+MeshShapeDistanceTraversalNodeFloatOBBRSS<Shape, NarrowPhaseSolver>::
+BVTesting(int b1, int b2) const
+{
+  FCL_UNUSED(b2);
+
+  if(this->enable_statistics) this->num_bv_tests++;
+
+  return distance(this->tf1.linear(), this->tf1.translation(), this->model2_bv, this->model1->getBV(b1).bv);
+}
+
+//==============================================================================
+template <typename Shape, typename NarrowPhaseSolver>
+void MeshShapeDistanceTraversalNodeFloatOBBRSS<Shape, NarrowPhaseSolver>::leafTesting(int b1, int b2) const
+{
+  detail::meshShapeDistanceOrientedNodeLeafTesting(b1, b2, this->model1, *(this->model2), this->vertices, this->tri_indices,
+                                                    this->tf1, this->tf2, this->nsolver, this->enable_statistics, this->num_leaf_tests, this->request, *(this->result));
+}
+
 template <typename BV, typename Shape, typename NarrowPhaseSolver, template <typename, typename> class OrientedNode>
 static bool setupMeshShapeDistanceOrientedNode(OrientedNode<Shape, NarrowPhaseSolver>& node,
                                                       const BVHModel<BV>& model1, const Transform3<typename BV::S>& tf1,
@@ -449,6 +461,19 @@ bool initialize(
   return detail::setupMeshShapeDistanceOrientedNode(node, model1, tf1, model2, tf2, nsolver, request, result);
 }
 
+//==============================================================================
+template <typename Shape, typename NarrowPhaseSolver>
+bool initialize(
+    MeshShapeDistanceTraversalNodeFloatOBBRSS<Shape, NarrowPhaseSolver>& node,
+    const BVHModel<FloatOBBRSS<typename Shape::S>>& model1, const Transform3<typename Shape::S>& tf1,
+    const Shape& model2, const Transform3<typename Shape::S>& tf2,
+    const NarrowPhaseSolver* nsolver,
+    const DistanceRequest<typename Shape::S>& request,
+    DistanceResult<typename Shape::S>& result)
+{
+  return detail::setupMeshShapeDistanceOrientedNode(node, model1, tf1, model2, tf2, nsolver, request, result);
+}
+
 } // namespace detail
 } // namespace fcl
 
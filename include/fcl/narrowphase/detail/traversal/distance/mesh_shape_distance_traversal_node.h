@@ -103,18 +103,18 @@ void distancePreprocessOrientedNode(
     DistanceResult<typename BV::S>& result);
 
 /// @brief Initialize traversal node for distance computation between one mesh
-/// and one shape, given the current transforms
+/// and one shape, given the current transforms. The mesh is left untouched:
+/// the BV of the shape is computed in the frame of the mesh.
 template <typename BV, typename Shape, typename NarrowPhaseSolver>
 bool initialize(
     MeshShapeDistanceTraversalNode<BV, Shape, NarrowPhaseSolver>& node,
-    BVHModel<BV>& model1,
-    Transform3<typename BV::S>& tf1,
+    const BVHModel<BV>& model1,
+    const Transform3<typename BV::S>& tf1,
     const Shape& model2,
     const Transform3<typename BV::S>& tf2,
     const NarrowPhaseSolver* nsolver,
     const DistanceRequest<typename BV::S>& request,
-    DistanceResult<typename BV::S>& result,
-    bool use_refit = false, bool refit_bottomup = false);
+    DistanceResult<typename BV::S>& result);
 
 /// @brief Traversal node for distance between mesh and shape, when mesh BVH is one of the oriented node (RSS, OBBRSS, kIOS)
 template <typename Shape, typename NarrowPhaseSolver>
@@ -207,6 +207,36 @@ bool initialize(
     const DistanceRequest<typename Shape::S>& request,
     DistanceResult<typename Shape::S>& result);
 
+template <typename Shape, typename NarrowPhaseSolver>
+class FCL_EXPORT MeshShapeDistanceTraversalNodeFloatOBBRSS
+    : public MeshShapeDistanceTraversalNode<FloatOBBRSS<typename Shape::S>, Shape, NarrowPhaseSolver>
+{
+public:
+  using S = typename Shape::S;
+
+  MeshShapeDistanceTraversalNodeFloatOBBRSS();
+
+  void preprocess();
+
+  void postprocess();
+
+  S BVTesting(int b1, int b2) const;
+
+  void leafTesting(int b1, int b2) const;
+};
+
+/// @brief Initialize traversal node for distance computation between one mesh and one shape, specialized for FloatOBBRSS type
+template <typename Shape, typename NarrowPhaseSolver>
+bool initialize(
+    MeshShapeDistanceTraversalNodeFloatOBBRSS<Shape, NarrowPhaseSolver>& node,
+    const BVHModel<FloatOBBRSS<typename Shape::S>>& model1,
+    const Transform3<typename Shape::S>& tf1,
+    const Shape& model2,
+    const Transform3<typename Shape::S>& tf2,
+    const NarrowPhaseSolver* nsolver,
+    const DistanceRequest<typename Shape::S>& request,
+    DistanceResult<typename Shape::S>& result);
+
 } // namespace detail
 } // namespace fcl
 
@@ -0,0 +1,191 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/** @author Jia Pan */
+
+#ifndef FCL_TRAVERSAL_QUANTIZEDMESHSHAPEDISTANCETRAVERSALNODE_INL_H
+#define FCL_TRAVERSAL_QUANTIZEDMESHSHAPEDISTANCETRAVERSALNODE_INL_H
+
+#include "fcl/narrowphase/detail/traversal/distance/quantized_mesh_shape_distance_traversal_node.h"
+
+#include <utility>
+
+namespace fcl
+{
+
+namespace detail
+{
+
+//==============================================================================
+template <typename Q, typename Shape, typename NarrowPhaseSolver>
+QuantizedMeshShapeDistanceTraversalNode<Q, Shape, NarrowPhaseSolver>::
+QuantizedMeshShapeDistanceTraversalNode()
+{
+  rel_err = 0;
+  abs_err = 0;
+
+  model1 = nullptr;
+  model2 = nullptr;
+
+  nsolver = nullptr;
+}
+
+//==============================================================================
+template <typename Q, typename Shape, typename NarrowPhaseSolver>
+typename Shape::S
+QuantizedMeshShapeDistanceTraversalNode<Q, Shape, NarrowPhaseSolver>::
+BVTesting(int, int) const
+{
+  return -1;
+}
+
+//==============================================================================
+template <typename Q, typename Shape, typename NarrowPhaseSolver>
+void QuantizedMeshShapeDistanceTraversalNode<Q, Shape, NarrowPhaseSolver>::
+leafTesting(int, int) const
+{
+  if(model1->getNumBVs() == 0)
+    return;
+
+  if(this->enable_statistics) this->num_bv_tests++;
+
+  recurse(0, model1->getBV(0).getAABB(model1->getRootBV()));
+}
+
+//==============================================================================
+template <typename Q, typename Shape, typename NarrowPhaseSolver>
+bool QuantizedMeshShapeDistanceTraversalNode<Q, Shape, NarrowPhaseSolver>::
+canStop(S c) const
+{
+  if((c >= this->result->min_distance - abs_err) && (c * (1 + rel_err) >= this->result->min_distance))
+    return true;
+  return false;
+}
+
+//==============================================================================
+template <typename Q, typename Shape, typename NarrowPhaseSolver>
+void QuantizedMeshShapeDistanceTraversalNode<Q, Shape, NarrowPhaseSolver>::
+recurse(int b, const AABB<S>& bv) const
+{
+  const QuantizedBVNode<S, Q>& node = model1->getBV(b);
+
+  if(node.isLeaf())
+  {
+    if(this->enable_statistics) this->num_leaf_tests++;
+
+    const int primitive_id = node.primitiveId();
+    const Triangle& tri_id = model1->tri_indices[primitive_id];
+    const Vector3<S>& p1 = model1->vertices[tri_id[0]];
+    const Vector3<S>& p2 = model1->vertices[tri_id[1]];
+    const Vector3<S>& p3 = model1->vertices[tri_id[2]];
+
+    S distance;
+    Vector3<S> closest_p1, closest_p2;
+    nsolver->shapeTriangleDistance(*model2, this->tf2, p1, p2, p3, this->tf1, &distance, &closest_p2, &closest_p1);
+
+    this->result->update(
+          distance,
+          model1,
+          model2,
+          primitive_id,
+          DistanceResult<S>::NONE,
+          closest_p1,
+          closest_p2);
+    return;
+  }
+
+  int children[2] = {node.leftChild(), node.rightChild()};
+  AABB<S> child_bvs[2];
+  S d[2];
+  for(int i = 0; i < 2; ++i)
+  {
+    if(this->enable_statistics) this->num_bv_tests++;
+    child_bvs[i] = model1->getBV(children[i]).getAABB(bv);
+    d[i] = child_bvs[i].distance(model2_aabb);
+  }
+
+  if(d[1] < d[0])
+  {
+    std::swap(children[0], children[1]);
+    std::swap(child_bvs[0], child_bvs[1]);
+    std::swap(d[0], d[1]);
+  }
+
+  for(int i = 0; i < 2; ++i)
+  {
+    if(canStop(d[i]))
+      return;
+
+    recurse(children[i], child_bvs[i]);
+  }
+}
+
+//==============================================================================
+template <typename Q, typename Shape, typename NarrowPhaseSolver>
+bool initialize(
+    QuantizedMeshShapeDistanceTraversalNode<Q, Shape, NarrowPhaseSolver>& node,
+    const QuantizedBVHModel<typename Shape::S, Q>& model1,
+    const Transform3<typename Shape::S>& tf1,
+    const Shape& model2,
+    const Transform3<typename Shape::S>& tf2,
+    const NarrowPhaseSolver* nsolver,
+    const DistanceRequest<typename Shape::S>& request,
+    DistanceResult<typename Shape::S>& result)
+{
+  using S = typename Shape::S;
+
+  node.request = request;
+  node.result = &result;
+
+  node.model1 = &model1;
+  node.tf1 = tf1;
+  node.model2 = &model2;
+  node.tf2 = tf2;
+  node.nsolver = nsolver;
+
+  node.rel_err = request.rel_err;
+  node.abs_err = request.abs_err;
+
+  computeBV(model2, Transform3<S>(tf1.inverse(Eigen::Isometry) * tf2),
+            node.model2_aabb);
+
+  return true;
+}
+
+} // namespace detail
+} // namespace fcl
+
+#endif
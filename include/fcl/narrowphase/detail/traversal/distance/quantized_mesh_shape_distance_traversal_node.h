@@ -0,0 +1,109 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/** @author Jia Pan */
+
+#ifndef FCL_TRAVERSAL_QUANTIZEDMESHSHAPEDISTANCETRAVERSALNODE_H
+#define FCL_TRAVERSAL_QUANTIZEDMESHSHAPEDISTANCETRAVERSALNODE_H
+
+#include "fcl/geometry/shape/utility.h"
+#include "fcl/geometry/bvh/quantized_BVH_model.h"
+#include "fcl/narrowphase/detail/traversal/distance/distance_traversal_node_base.h"
+
+namespace fcl
+{
+
+namespace detail
+{
+
+/// @brief Traversal node for distance between a quantized mesh and a shape.
+/// As for collision, the whole traversal runs from leafTesting(); the nearer
+/// child, by distance between its decoded AABB and the AABB of the shape, is
+/// visited first.
+template <typename Q, typename Shape, typename NarrowPhaseSolver>
+class FCL_EXPORT QuantizedMeshShapeDistanceTraversalNode
+    : public DistanceTraversalNodeBase<typename Shape::S>
+{
+public:
+
+  using S = typename Shape::S;
+
+  QuantizedMeshShapeDistanceTraversalNode();
+
+  S BVTesting(int, int) const;
+
+  void leafTesting(int, int) const;
+
+  bool canStop(S c) const;
+
+  S rel_err;
+  S abs_err;
+
+  const QuantizedBVHModel<S, Q>* model1;
+  const Shape* model2;
+
+  /// @brief AABB of the shape in the frame of the mesh
+  AABB<S> model2_aabb;
+
+  const NarrowPhaseSolver* nsolver;
+
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+private:
+
+  /// @brief Traverse the subtree of node b, given its decoded AABB
+  void recurse(int b, const AABB<S>& bv) const;
+};
+
+/// @brief Initialize traversal node for distance between one quantized mesh
+/// and one shape, given current object transform
+template <typename Q, typename Shape, typename NarrowPhaseSolver>
+bool initialize(
+    QuantizedMeshShapeDistanceTraversalNode<Q, Shape, NarrowPhaseSolver>& node,
+    const QuantizedBVHModel<typename Shape::S, Q>& model1,
+    const Transform3<typename Shape::S>& tf1,
+    const Shape& model2,
+    const Transform3<typename Shape::S>& tf2,
+    const NarrowPhaseSolver* nsolver,
+    const DistanceRequest<typename Shape::S>& request,
+    DistanceResult<typename Shape::S>& result);
+
+} // namespace detail
+} // namespace fcl
+
+#include "fcl/narrowphase/detail/traversal/distance/quantized_mesh_shape_distance_traversal_node-inl.h"
+
+#endif
@@ -56,11 +56,16 @@ ShapeBVHDistanceTraversalNode<Shape, BV>::ShapeBVHDistanceTraversalNode()
   model1 = nullptr;
   model2 = nullptr;
 
-  num_bv_tests = 0;
-  num_leaf_tests = 0;
   query_time_seconds = 0.0;
 }
 
+//==============================================================================
+template<typename Shape, typename BV>
+bool ShapeBVHDistanceTraversalNode<Shape, BV>::firstOverSecond(int, int) const
+{
+  return false;
+}
+
 //==============================================================================
 template<typename Shape, typename BV>
 bool ShapeBVHDistanceTraversalNode<Shape, BV>::isSecondNodeLeaf(int b) const
@@ -59,6 +59,9 @@ public:
 
   ShapeBVHDistanceTraversalNode();
 
+  /// @brief Alway extend the second model, which is a BVH model
+  bool firstOverSecond(int, int) const;
+
   /// @brief Whether the BV node in the second BVH tree is leaf
   bool isSecondNodeLeaf(int b) const;
 
@@ -74,9 +77,7 @@ public:
   const Shape* model1;
   const BVHModel<BV>* model2;
   BV model1_bv;
-  
-  mutable int num_bv_tests;
-  mutable int num_leaf_tests;
+
   mutable S query_time_seconds;
 };
 
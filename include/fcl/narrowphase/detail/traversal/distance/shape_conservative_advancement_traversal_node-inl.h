@@ -74,12 +74,17 @@ leafTesting(int, int) const
   // to always set the closest points.
   Vector3<S> closest_p1 = Vector3<S>::Zero();
   Vector3<S> closest_p2 = Vector3<S>::Zero();
-  this->nsolver->shapeDistance(*(this->model1), this->tf1, *(this->model2), this->tf2, &distance, &closest_p1, &closest_p2);
-
-  Vector3<S> n = this->tf2 * closest_p2 - this->tf1 * closest_p1;
+  if(!this->nsolver->shapeDistance(*(this->model1), this->tf1, *(this->model2), this->tf2, &distance, &closest_p1, &closest_p2))
+  {
+    // The shapes already touch, the motion cannot advance
+    delta_t = 0;
+    return;
+  }
+
+  Vector3<S> n = closest_p2 - closest_p1;
   n.normalize();
-  TBVMotionBoundVisitor<RSS<S>> mb_visitor1(model1_bv, n);
-  TBVMotionBoundVisitor<RSS<S>> mb_visitor2(model2_bv, -n);
+  TBVMotionBoundVisitor<RSS<S>> mb_visitor1(model1_bv, n, this->toc, 1);
+  TBVMotionBoundVisitor<RSS<S>> mb_visitor2(model2_bv, -n, this->toc, 1);
   S bound1 = motion1->computeMotionBound(mb_visitor1);
   S bound2 = motion2->computeMotionBound(mb_visitor2);
 
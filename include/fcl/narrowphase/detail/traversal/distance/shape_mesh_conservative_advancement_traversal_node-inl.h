@@ -54,6 +54,8 @@ ShapeMeshConservativeAdvancementTraversalNode<Shape, BV, NarrowPhaseSolver>::
 ShapeMeshConservativeAdvancementTraversalNode(S w_)
   : ShapeMeshDistanceTraversalNode<Shape, BV, NarrowPhaseSolver>()
 {
+  last_tri_id = -1;
+
   delta_t = 1;
   toc = 0;
   t_err = (S)0.0001;
@@ -99,7 +101,14 @@ void ShapeMeshConservativeAdvancementTraversalNode<Shape, BV, NarrowPhaseSolver>
 
   S d;
   Vector3<S> P1, P2;
-  this->nsolver->shapeTriangleDistance(*(this->model1), this->tf1, p1, p2, p3, &d, &P1, &P2);
+  if(!this->nsolver->shapeTriangleDistance(*(this->model1), this->tf1, p1, p2, p3, &d, &P1, &P2))
+  {
+    // The triangle already touches the shape, the motion cannot advance
+    this->min_distance = 0;
+    last_tri_id = primitive_id;
+    delta_t = 0;
+    return;
+  }
 
   if(d < this->min_distance)
   {
@@ -111,10 +120,10 @@ void ShapeMeshConservativeAdvancementTraversalNode<Shape, BV, NarrowPhaseSolver>
     last_tri_id = primitive_id;
   }
 
-  Vector3<S> n = P2 - this->tf1 * p1; n.normalize();
+  Vector3<S> n = P2 - P1; n.normalize();
   // here n should be in global frame
-  TBVMotionBoundVisitor<BV> mb_visitor1(this->model1_bv, n);
-  TriangleMotionBoundVisitor<S> mb_visitor2(p1, p2, p3, -n);
+  TBVMotionBoundVisitor<BV> mb_visitor1(this->model1_bv, n, this->toc, 1);
+  TriangleMotionBoundVisitor<S> mb_visitor2(p1, p2, p3, -n, this->toc, 1);
   S bound1 = motion1->computeMotionBound(mb_visitor1);
   S bound2 = motion2->computeMotionBound(mb_visitor2);
 
@@ -140,8 +149,8 @@ canStop(S c) const
     Vector3<S> n = data.P2 - this->tf1 * data.P1; n.normalize();
     int c2 = data.c2;
 
-    TBVMotionBoundVisitor<BV> mb_visitor1(this->model1_bv, n);
-    TBVMotionBoundVisitor<BV> mb_visitor2(this->model2->getBV(c2).bv, -n);
+    TBVMotionBoundVisitor<BV> mb_visitor1(this->model1_bv, n, this->toc, 1);
+    TBVMotionBoundVisitor<BV> mb_visitor2(this->model2->getBV(c2).bv, -n, this->toc, 1);
     S bound1 = motion1->computeMotionBound(mb_visitor1);
     S bound2 = motion2->computeMotionBound(mb_visitor2);
 
@@ -255,6 +264,7 @@ leafTesting(int b1, int b2) const
         this->tf1,
         this->motion2,
         this->motion1,
+        this->toc,
         this->nsolver,
         this->enable_statistics,
         this->min_distance,
@@ -281,6 +291,7 @@ canStop(typename Shape::S c) const
         this->model1_bv,
         this->motion2,
         this->motion1,
+        this->toc,
         this->stack,
         this->delta_t);
 }
@@ -355,6 +366,7 @@ leafTesting(int b1, int b2) const
         this->tf1,
         this->motion2,
         this->motion1,
+        this->toc,
         this->nsolver,
         this->enable_statistics,
         this->min_distance,
@@ -381,6 +393,7 @@ canStop(typename Shape::S c) const
         this->model1_bv,
         this->motion2,
         this->motion1,
+        this->toc,
         this->stack,
         this->delta_t);
 }
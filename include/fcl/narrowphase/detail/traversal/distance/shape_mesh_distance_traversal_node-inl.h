@@ -85,7 +85,7 @@ void ShapeMeshDistanceTraversalNode<Shape, BV, NarrowPhaseSolver>::leafTesting(i
 
   S distance;
   Vector3<S> closest_p1, closest_p2;
-  nsolver->shapeTriangleDistance(*(this->model1), this->tf1, p1, p2, p3, &distance, &closest_p1, &closest_p2);
+  nsolver->shapeTriangleDistance(*(this->model1), this->tf1, p1, p2, p3, this->tf2, &distance, &closest_p1, &closest_p2);
 
   this->result->update(
         distance,
@@ -113,36 +113,17 @@ bool initialize(
     ShapeMeshDistanceTraversalNode<Shape, BV, NarrowPhaseSolver>& node,
     const Shape& model1,
     const Transform3<typename BV::S>& tf1,
-    BVHModel<BV>& model2,
-    Transform3<typename BV::S>& tf2,
+    const BVHModel<BV>& model2,
+    const Transform3<typename BV::S>& tf2,
     const NarrowPhaseSolver* nsolver,
     const DistanceRequest<typename BV::S>& request,
-    DistanceResult<typename BV::S>& result,
-    bool use_refit,
-    bool refit_bottomup)
+    DistanceResult<typename BV::S>& result)
 {
   using S = typename BV::S;
 
   if(model2.getModelType() != BVH_MODEL_TRIANGLES)
     return false;
 
-  if(!tf2.matrix().isIdentity())
-  {
-    std::vector<Vector3<S>> vertices_transformed(model2.num_vertices);
-    for(int i = 0; i < model2.num_vertices; ++i)
-    {
-      Vector3<S>& p = model2.vertices[i];
-      Vector3<S> new_v = tf2 * p;
-      vertices_transformed[i] = new_v;
-    }
-
-    model2.beginReplaceModel();
-    model2.replaceSubModel(vertices_transformed);
-    model2.endReplaceModel(use_refit, refit_bottomup);
-
-    tf2.setIdentity();
-  }
-
   node.request = request;
   node.result = &result;
 
@@ -155,7 +136,8 @@ bool initialize(
   node.vertices = model2.vertices;
   node.tri_indices = model2.tri_indices;
 
-  computeBV(model1, tf1, node.model1_bv);
+  computeBV(model1, Transform3<S>(tf2.inverse(Eigen::Isometry) * tf1),
+            node.model1_bv);
 
   return true;
 }
@@ -80,13 +80,11 @@ bool initialize(
     ShapeMeshDistanceTraversalNode<Shape, BV, NarrowPhaseSolver>& node,
     const Shape& model1,
     const Transform3<typename BV::S>& tf1,
-    BVHModel<BV>& model2,
-    Transform3<typename BV::S>& tf2,
+    const BVHModel<BV>& model2,
+    const Transform3<typename BV::S>& tf2,
     const NarrowPhaseSolver* nsolver,
     const DistanceRequest<typename BV::S>& request,
-    DistanceResult<typename BV::S>& result,
-    bool use_refit = false,
-    bool refit_bottomup = false);
+    DistanceResult<typename BV::S>& result);
 
 template <typename Shape, typename NarrowPhaseSolver>
 class FCL_EXPORT ShapeMeshDistanceTraversalNodeRSS
@@ -40,6 +40,7 @@
 
 #include "fcl/narrowphase/detail/traversal/traversal_recurse.h"
 
+#include <algorithm>
 #include <queue>
 
 #include "fcl/common/unused.h"
@@ -74,6 +75,10 @@ void distanceRecurse(DistanceTraversalNodeBase<double>* node, int b1, int b2, BV
 extern template
 void distanceQueueRecurse(DistanceTraversalNodeBase<double>* node, int b1, int b2, BVHFrontList* front_list, int qsize);
 
+//==============================================================================
+extern template
+void distanceBestFirst(DistanceTraversalNodeBase<double>* node, int b1, int b2);
+
 //==============================================================================
 extern template
 void propagateBVHFrontListCollisionRecurse(CollisionTraversalNodeBase<double>* node, BVHFrontList* front_list);
@@ -459,6 +464,69 @@ void distanceQueueRecurse(DistanceTraversalNodeBase<S>* node, int b1, int b2, BV
   }
 }
 
+//==============================================================================
+template <typename S>
+FCL_EXPORT
+void distanceBestFirst(DistanceTraversalNodeBase<S>* node, int b1, int b2)
+{
+  const S abs_err = node->request.abs_err;
+  const S rel_err = node->request.rel_err;
+  DistanceResult<S>* result = node->result;
+
+  std::priority_queue<BVT<S>, std::vector<BVT<S>>, BVT_Comparer<S>> pq;
+
+  BVT<S> root;
+  root.b1 = b1;
+  root.b2 = b2;
+  root.d = node->BVTesting(b1, b2);
+  pq.push(root);
+
+  while(!pq.empty())
+  {
+    // The front of the queue bounds the distance of every untested pair, and
+    // min_distance is the distance of a tested pair of primitives.
+    const BVT<S> min_test = pq.top();
+    const S upper = result->min_distance;
+    if(min_test.d >= upper - abs_err || min_test.d * (1 + rel_err) >= upper)
+      break;
+
+    pq.pop();
+
+    if(node->isFirstNodeLeaf(min_test.b1) && node->isSecondNodeLeaf(min_test.b2))
+    {
+      node->leafTesting(min_test.b1, min_test.b2);
+      continue;
+    }
+
+    BVT<S> bvt[2];
+    if(node->firstOverSecond(min_test.b1, min_test.b2))
+    {
+      bvt[0].b1 = node->getFirstLeftChild(min_test.b1);
+      bvt[1].b1 = node->getFirstRightChild(min_test.b1);
+      bvt[0].b2 = bvt[1].b2 = min_test.b2;
+    }
+    else
+    {
+      bvt[0].b1 = bvt[1].b1 = min_test.b1;
+      bvt[0].b2 = node->getSecondLeftChild(min_test.b2);
+      bvt[1].b2 = node->getSecondRightChild(min_test.b2);
+    }
+
+    for(int i = 0; i < 2; ++i)
+    {
+      // A child can not be closer than its parent
+      bvt[i].d = std::max(node->BVTesting(bvt[i].b1, bvt[i].b2), min_test.d);
+      if(bvt[i].d < result->min_distance)
+        pq.push(bvt[i]);
+    }
+  }
+
+  const S lower = pq.empty() ? result->min_distance
+                             : std::min(pq.top().d, result->min_distance);
+  result->min_distance_lower_bound
+      = std::min(result->min_distance_lower_bound, lower);
+}
+
 //==============================================================================
 template <typename S>
 FCL_EXPORT
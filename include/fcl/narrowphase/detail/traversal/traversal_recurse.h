@@ -80,6 +80,13 @@ template <typename S>
 FCL_EXPORT
 void distanceQueueRecurse(DistanceTraversalNodeBase<S>* node, int b1, int b2, BVHFrontList* front_list, int qsize);
 
+/// @brief Best-first distance traversal. Pairs of nodes are expanded in order
+/// of their BV distance until the distance is known within the abs_err or
+/// rel_err of the request; the remaining lower bound is stored in the result.
+template <typename S>
+FCL_EXPORT
+void distanceBestFirst(DistanceTraversalNodeBase<S>* node, int b1, int b2);
+
 /// @brief Recurse function for front list propagation
 template <typename S>
 FCL_EXPORT
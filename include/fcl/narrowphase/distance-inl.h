@@ -40,7 +40,9 @@
 
 #include "fcl/narrowphase/distance.h"
 
+#include "fcl/common/profiler.h"
 #include "fcl/narrowphase/collision.h"
+#include "fcl/narrowphase/detail/query_statistics_recorder.h"
 
 namespace fcl
 {
@@ -100,6 +102,11 @@ typename NarrowPhaseSolver::S distance(
 {
   using S = typename NarrowPhaseSolver::S;
 
+  FCL_PROFILE_TIMER(Distance);
+
+  detail::QueryStatisticsRecorder recorder(
+        request.enable_statistics ? &result.statistics : nullptr);
+
   const NarrowPhaseSolver* nsolver = nsolver_;
   if(!nsolver_)
     nsolver = new NarrowPhaseSolver();
@@ -186,6 +193,10 @@ typename NarrowPhaseSolver::S distance(
     }
   }
 
+  // The bound is not maintained by paths that assign min_distance directly
+  result.min_distance_lower_bound
+      = std::min(result.min_distance_lower_bound, result.min_distance);
+
   if(!nsolver_)
     delete nsolver;
 
@@ -95,12 +95,23 @@ struct FCL_EXPORT DistanceRequest
   S rel_err; // relative error, between 0 and 1
   S abs_err; // absoluate error
 
+  /// @brief If true, BVH distance queries expand pairs of nodes best-first and
+  /// stop as soon as the distance is known within abs_err or within rel_err,
+  /// whichever is reached first. The true distance then lies in
+  /// [DistanceResult::min_distance_lower_bound, DistanceResult::min_distance].
+  /// Front lists are not maintained in this mode.
+  bool enable_approximate_distance{false};
+
   /// @brief the threshold used in GJK algorithm to stop distance iteration
   S distance_tolerance;
 
   /// @brief narrow phase solver type
   GJKSolverType gjk_solver_type;
 
+  /// @brief If true, the work done by the query is added to
+  /// DistanceResult::statistics.
+  bool enable_statistics{false};
+
   explicit DistanceRequest(
       bool enable_nearest_points_ = false,
       bool enable_signed_distance = false,
@@ -40,6 +40,8 @@
 
 #include "fcl/narrowphase/distance_result.h"
 
+#include <algorithm>
+
 namespace fcl
 {
 
@@ -52,6 +54,7 @@ template <typename S>
 FCL_EXPORT
 DistanceResult<S>::DistanceResult(S min_distance_)
   : min_distance(min_distance_),
+    min_distance_lower_bound(min_distance_),
     o1(nullptr),
     o2(nullptr),
     b1(NONE),
@@ -73,6 +76,7 @@ void DistanceResult<S>::update(
   if(min_distance > distance)
   {
     min_distance = distance;
+    min_distance_lower_bound = std::min(min_distance_lower_bound, distance);
     o1 = o1_;
     o2 = o2_;
     b1 = b1_;
@@ -95,6 +99,7 @@ void DistanceResult<S>::update(
   if(min_distance > distance)
   {
     min_distance = distance;
+    min_distance_lower_bound = std::min(min_distance_lower_bound, distance);
     o1 = o1_;
     o2 = o2_;
     b1 = b1_;
@@ -109,6 +114,9 @@ template <typename S>
 FCL_EXPORT
 void DistanceResult<S>::update(const DistanceResult& other_result)
 {
+  min_distance_lower_bound = std::min(
+        min_distance_lower_bound, other_result.min_distance_lower_bound);
+
   if(min_distance > other_result.min_distance)
   {
     min_distance = other_result.min_distance;
@@ -127,10 +135,12 @@ FCL_EXPORT
 void DistanceResult<S>::clear()
 {
   min_distance = std::numeric_limits<S>::max();
+  min_distance_lower_bound = std::numeric_limits<S>::max();
   o1 = nullptr;
   o2 = nullptr;
   b1 = NONE;
   b2 = NONE;
+  statistics.clear();
 }
 
 } // namespace fcl
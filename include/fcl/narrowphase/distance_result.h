@@ -39,6 +39,7 @@
 #define FCL_DISTANCERESULT_H
 
 #include "fcl/common/types.h"
+#include "fcl/narrowphase/query_statistics.h"
 
 namespace fcl
 {
@@ -63,6 +64,16 @@ public:
   /// @sa DistanceRequest::enable_signed_distance
   S min_distance;
 
+  /// @brief Certified lower bound on the distance between the two objects.
+  ///
+  /// Equal to min_distance unless the query stopped early, in which case the
+  /// true distance lies in [min_distance_lower_bound, min_distance]. Like
+  /// min_distance, it is only meaningful when the objects are not in
+  /// collision.
+  ///
+  /// @sa DistanceRequest::enable_approximate_distance
+  S min_distance_lower_bound;
+
   /// @brief Nearest points in the world coordinates.
   ///
   /// @sa DistanceRequest::enable_nearest_points
@@ -86,6 +97,11 @@ public:
   /// if object 2 is octree, it is the id of the cell
   int b2;
 
+  /// @brief Work done by the queries that filled this result
+  ///
+  /// @sa DistanceRequest::enable_statistics
+  QueryStatistics statistics;
+
   /// @brief invalid contact primitive information
   static const int NONE = -1;
   
@@ -0,0 +1,96 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/** @author Jia Pan */
+
+#ifndef FCL_NARROWPHASE_QUERYSTATISTICS_H
+#define FCL_NARROWPHASE_QUERYSTATISTICS_H
+
+#include <cstddef>
+#include <iostream>
+
+#include "fcl/export.h"
+
+namespace fcl
+{
+
+/// @brief Work done by collision and distance queries, filled in when
+/// CollisionRequest::enable_statistics or DistanceRequest::enable_statistics
+/// is set.
+///
+/// The statistics are added to the ones already in the result, in the same
+/// way contacts are, so a result shared by the callback of a broadphase query
+/// accumulates the statistics of every narrowphase query it runs. Call
+/// clear() to start over.
+struct FCL_EXPORT QueryStatistics
+{
+  /// @brief Number of collide() or distance() calls
+  std::size_t num_queries;
+
+  /// @brief Bounding volume tests performed in BVH traversal
+  std::size_t num_bv_tests;
+
+  /// @brief Primitive (triangle, point or shape) tests performed in BVH
+  /// traversal
+  std::size_t num_leaf_tests;
+
+  /// @brief GJK iterations of both the libccd and the built-in solver. The
+  /// MPR iterations that libccd itself runs for shape intersection are not
+  /// counted.
+  std::size_t num_gjk_iterations;
+
+  /// @brief EPA polytope expansions of both the libccd and the built-in
+  /// solver
+  std::size_t num_epa_iterations;
+
+  /// @brief Wall-clock time spent in the queries, in seconds
+  double time_seconds;
+
+  QueryStatistics();
+
+  /// @brief Reset all statistics to zero
+  void clear();
+
+  /// @brief Add the statistics of other queries to these
+  QueryStatistics& operator+=(const QueryStatistics& other);
+
+  /// @brief Print all statistics on one line
+  void print(std::ostream& out = std::cout) const;
+};
+
+} // namespace fcl
+
+#endif
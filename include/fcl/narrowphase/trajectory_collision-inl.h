@@ -0,0 +1,234 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @author Jia Pan */
+
+#ifndef FCL_TRAJECTORY_COLLISION_INL_H
+#define FCL_TRAJECTORY_COLLISION_INL_H
+
+#include "fcl/narrowphase/trajectory_collision.h"
+
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+
+#include "fcl/common/detail/parallel.h"
+
+namespace fcl
+{
+
+//==============================================================================
+extern template
+std::size_t collideTrajectory(
+    const CollisionGeometry<double>* o1,
+    const aligned_vector<Transform3<double>>& waypoints1,
+    const CollisionGeometry<double>* o2,
+    const aligned_vector<Transform3<double>>& waypoints2,
+    const TrajectoryCollisionRequest<double>& request,
+    TrajectoryCollisionResult<double>& result);
+
+//==============================================================================
+extern template
+std::size_t collideTrajectory(
+    const CollisionGeometry<double>* o1,
+    const std::vector<MotionBasePtr<double>>& motions1,
+    const CollisionGeometry<double>* o2,
+    const std::vector<MotionBasePtr<double>>& motions2,
+    const TrajectoryCollisionRequest<double>& request,
+    TrajectoryCollisionResult<double>& result);
+
+namespace detail
+{
+
+//==============================================================================
+/// @brief Check num_segments trajectory segments, whose motions are given by
+/// segment_motions(i, motion1, motion2).
+template <typename S, typename SegmentMotions>
+FCL_EXPORT
+std::size_t collideTrajectory(
+    const CollisionGeometry<S>* o1,
+    const CollisionGeometry<S>* o2,
+    std::size_t num_segments,
+    SegmentMotions segment_motions,
+    const TrajectoryCollisionRequest<S>& request,
+    TrajectoryCollisionResult<S>& result)
+{
+  result.clear();
+
+  // Geometries whose local AABB was never computed cannot be culled
+  const bool cull = (o1->aabb_local.min_[0] <= o1->aabb_local.max_[0])
+      && (o2->aabb_local.min_[0] <= o2->aabb_local.max_[0]);
+
+  std::vector<char> is_collide(num_segments, 0);
+  std::vector<S> time_of_contact(num_segments, S(1));
+  std::atomic<std::size_t> num_culled(0);
+  std::atomic<std::size_t> first_collision(num_segments);
+
+  parallelForChunks(
+        num_segments, request.num_threads, 1,
+        [&](unsigned int /*thread*/, std::size_t begin, std::size_t end)
+  {
+    for(std::size_t i = begin; i < end; ++i)
+    {
+      // Once a segment collides, the later ones cannot be the first hit
+      if(!request.find_all_segments
+         && i > first_collision.load(std::memory_order_relaxed))
+        return;
+
+      MotionBasePtr<S> motion1;
+      MotionBasePtr<S> motion2;
+      segment_motions(i, motion1, motion2);
+
+      if(cull)
+      {
+        const AABB<S> aabb1 = computeSweptAABB(o1->aabb_local, *motion1);
+        const AABB<S> aabb2 = computeSweptAABB(o2->aabb_local, *motion2);
+        if(!aabb1.overlap(aabb2))
+        {
+          num_culled.fetch_add(1, std::memory_order_relaxed);
+          continue;
+        }
+      }
+
+      ContinuousCollisionResult<S> segment_result;
+      continuousCollide(o1, motion1.get(), o2, motion2.get(),
+                        request.ccd_request, segment_result);
+      if(!segment_result.is_collide)
+        continue;
+
+      is_collide[i] = 1;
+      time_of_contact[i] = segment_result.time_of_contact;
+
+      std::size_t current = first_collision.load(std::memory_order_relaxed);
+      while(i < current && !first_collision.compare_exchange_weak(current, i))
+      {
+        // Retry with the updated value
+      }
+    }
+  });
+
+  for(std::size_t i = 0; i < num_segments; ++i)
+  {
+    if(!is_collide[i])
+      continue;
+
+    result.segments.push_back(i);
+    result.times_of_contact.push_back(time_of_contact[i]);
+    if(!request.find_all_segments)
+      break;
+  }
+
+  result.num_culled_segments = num_culled.load();
+
+  return result.segments.size();
+}
+
+} // namespace detail
+
+//==============================================================================
+template <typename S>
+FCL_EXPORT
+std::size_t collideTrajectory(
+    const CollisionGeometry<S>* o1,
+    const aligned_vector<Transform3<S>>& waypoints1,
+    const CollisionGeometry<S>* o2,
+    const aligned_vector<Transform3<S>>& waypoints2,
+    const TrajectoryCollisionRequest<S>& request,
+    TrajectoryCollisionResult<S>& result)
+{
+  const std::size_t n1 = waypoints1.size();
+  const std::size_t n2 = waypoints2.size();
+  if(n1 == 0 || n2 == 0 || (n1 != n2 && n1 != 1 && n2 != 1))
+  {
+    std::cerr << "Warning: trajectories of " << n1 << " and " << n2
+              << " waypoints do not match." << std::endl;
+    result.clear();
+    return 0;
+  }
+
+  const std::size_t num_segments = std::max(n1, n2) - 1;
+  const CCDMotionType motion_type = request.ccd_request.ccd_motion_type;
+
+  auto segment_motions = [&](std::size_t i,
+                             MotionBasePtr<S>& motion1,
+                             MotionBasePtr<S>& motion2)
+  {
+    // A static object keeps its only waypoint during every segment
+    const std::size_t i1 = (n1 == 1) ? 0 : i;
+    const std::size_t i2 = (n2 == 1) ? 0 : i;
+    motion1 = getMotionBase(
+          waypoints1[i1], waypoints1[(n1 == 1) ? 0 : i1 + 1], motion_type);
+    motion2 = getMotionBase(
+          waypoints2[i2], waypoints2[(n2 == 1) ? 0 : i2 + 1], motion_type);
+  };
+
+  return detail::collideTrajectory(
+        o1, o2, num_segments, segment_motions, request, result);
+}
+
+//==============================================================================
+template <typename S>
+FCL_EXPORT
+std::size_t collideTrajectory(
+    const CollisionGeometry<S>* o1,
+    const std::vector<MotionBasePtr<S>>& motions1,
+    const CollisionGeometry<S>* o2,
+    const std::vector<MotionBasePtr<S>>& motions2,
+    const TrajectoryCollisionRequest<S>& request,
+    TrajectoryCollisionResult<S>& result)
+{
+  if(motions1.size() != motions2.size())
+  {
+    std::cerr << "Warning: trajectories of " << motions1.size() << " and "
+              << motions2.size() << " segments do not match." << std::endl;
+    result.clear();
+    return 0;
+  }
+
+  auto segment_motions = [&](std::size_t i,
+                             MotionBasePtr<S>& motion1,
+                             MotionBasePtr<S>& motion2)
+  {
+    motion1 = motions1[i];
+    motion2 = motions2[i];
+  };
+
+  return detail::collideTrajectory(
+        o1, o2, motions1.size(), segment_motions, request, result);
+}
+
+} // namespace fcl
+
+#endif
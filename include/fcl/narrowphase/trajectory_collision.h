@@ -0,0 +1,86 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @author Jia Pan */
+
+#ifndef FCL_TRAJECTORY_COLLISION_H
+#define FCL_TRAJECTORY_COLLISION_H
+
+#include <vector>
+
+#include "fcl/narrowphase/continuous_collision.h"
+#include "fcl/narrowphase/trajectory_collision_request.h"
+#include "fcl/narrowphase/trajectory_collision_result.h"
+
+namespace fcl
+{
+
+/// @brief collision checking between two objects moving along piecewise
+/// trajectories. Segment i moves object 1 from waypoints1[i] to
+/// waypoints1[i + 1] (and object 2 likewise), using the motion type of
+/// request.ccd_request. Both trajectories must have the same number of
+/// waypoints, except that a single waypoint keeps the object static.
+/// Segments whose swept AABBs do not overlap are skipped, the remaining ones
+/// are checked with continuousCollide(), in parallel when
+/// request.num_threads != 1. Returns the number of colliding segments
+/// reported in result.
+template <typename S>
+FCL_EXPORT
+std::size_t collideTrajectory(
+    const CollisionGeometry<S>* o1,
+    const aligned_vector<Transform3<S>>& waypoints1,
+    const CollisionGeometry<S>* o2,
+    const aligned_vector<Transform3<S>>& waypoints2,
+    const TrajectoryCollisionRequest<S>& request,
+    TrajectoryCollisionResult<S>& result);
+
+/// @brief collision checking between two objects moving along piecewise
+/// trajectories, given by one motion per segment. Both objects must have the
+/// same number of segments.
+template <typename S>
+FCL_EXPORT
+std::size_t collideTrajectory(
+    const CollisionGeometry<S>* o1,
+    const std::vector<MotionBasePtr<S>>& motions1,
+    const CollisionGeometry<S>* o2,
+    const std::vector<MotionBasePtr<S>>& motions2,
+    const TrajectoryCollisionRequest<S>& request,
+    TrajectoryCollisionResult<S>& result);
+
+} // namespace fcl
+
+#include "fcl/narrowphase/trajectory_collision-inl.h"
+
+#endif
@@ -0,0 +1,80 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @author Jia Pan */
+
+#ifndef FCL_TRAJECTORYCOLLISIONRESULT_H
+#define FCL_TRAJECTORYCOLLISIONRESULT_H
+
+#include <cstddef>
+#include <vector>
+
+#include "fcl/common/types.h"
+
+namespace fcl
+{
+
+/// @brief trajectory collision result
+template <typename S>
+struct FCL_EXPORT TrajectoryCollisionResult
+{
+  /// @brief colliding segments in increasing order. Segment i goes from
+  /// waypoint i to waypoint i + 1
+  std::vector<std::size_t> segments;
+
+  /// @brief time of contact in [0, 1] within each colliding segment
+  std::vector<S> times_of_contact;
+
+  /// @brief number of segments whose swept AABBs do not overlap, which were
+  /// ruled out without a narrow phase test
+  std::size_t num_culled_segments;
+
+  TrajectoryCollisionResult();
+
+  /// @brief whether any segment collides
+  bool isCollision() const;
+
+  /// @brief clear the result for a new query
+  void clear();
+};
+
+using TrajectoryCollisionResultf = TrajectoryCollisionResult<float>;
+using TrajectoryCollisionResultd = TrajectoryCollisionResult<double>;
+
+} // namespace fcl
+
+#include "fcl/narrowphase/trajectory_collision_result-inl.h"
+
+#endif
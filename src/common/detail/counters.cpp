@@ -0,0 +1,314 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @author Jia Pan */
+
+#include "fcl/common/detail/counters.h"
+
+// The initial-exec model turns the thread-local lookup into a plain load
+// relative to the thread pointer instead of a call into the dynamic loader.
+#if defined(__GNUC__) && defined(__ELF__)
+  #define FCL_COUNTERS_TLS_MODEL __attribute__((tls_model("initial-exec")))
+#else
+  #define FCL_COUNTERS_TLS_MODEL
+#endif
+
+namespace fcl {
+namespace detail {
+
+namespace {
+
+const std::uint64_t calibration_ticks = Counters::ticks();
+const std::chrono::steady_clock::time_point calibration_time
+    = std::chrono::steady_clock::now();
+
+} // namespace
+
+std::atomic<bool> Counters::enabled_(false);
+std::atomic<Counters::Block*> Counters::blocks_(nullptr);
+
+//==============================================================================
+CountersSnapshot::CountersSnapshot()
+  : ticks_per_second(1e9)
+{
+  counts.fill(0);
+  timer_calls.fill(0);
+  timer_ticks.fill(0);
+}
+
+//==============================================================================
+std::uint64_t CountersSnapshot::count(Counter id) const
+{
+  return counts[static_cast<std::size_t>(id)];
+}
+
+//==============================================================================
+std::uint64_t CountersSnapshot::calls(Timer id) const
+{
+  return timer_calls[static_cast<std::size_t>(id)];
+}
+
+//==============================================================================
+double CountersSnapshot::seconds(Timer id) const
+{
+  return timer_ticks[static_cast<std::size_t>(id)] / ticks_per_second;
+}
+
+//==============================================================================
+CountersSnapshot& CountersSnapshot::operator+=(const CountersSnapshot& other)
+{
+  for(std::size_t i = 0; i < kNumCounters; ++i)
+    counts[i] += other.counts[i];
+
+  // Merged timers are kept in the tick rate of this snapshot.
+  const double scale = ticks_per_second / other.ticks_per_second;
+  for(std::size_t i = 0; i < kNumTimers; ++i)
+  {
+    timer_calls[i] += other.timer_calls[i];
+    timer_ticks[i] += static_cast<std::uint64_t>(other.timer_ticks[i] * scale);
+  }
+
+  return *this;
+}
+
+//==============================================================================
+CountersSnapshot CountersSnapshot::operator-(
+    const CountersSnapshot& earlier) const
+{
+  CountersSnapshot diff(*this);
+  for(std::size_t i = 0; i < kNumCounters; ++i)
+    diff.counts[i] -= earlier.counts[i];
+
+  for(std::size_t i = 0; i < kNumTimers; ++i)
+  {
+    diff.timer_calls[i] -= earlier.timer_calls[i];
+    diff.timer_ticks[i] -= earlier.timer_ticks[i];
+  }
+
+  return diff;
+}
+
+//==============================================================================
+void CountersSnapshot::print(std::ostream& out) const
+{
+  for(std::size_t i = 0; i < kNumCounters; ++i)
+    out << Counters::name(static_cast<Counter>(i)) << ": " << counts[i]
+        << std::endl;
+
+  for(std::size_t i = 0; i < kNumTimers; ++i)
+  {
+    const Timer id = static_cast<Timer>(i);
+    out << Counters::name(id) << ": " << timer_calls[i] << " calls, "
+        << seconds(id) << " s" << std::endl;
+  }
+}
+
+//==============================================================================
+Counters::Block::Block()
+  : in_use(true), next(nullptr)
+{
+  for(auto& count : counts)
+    count.store(0, std::memory_order_relaxed);
+  for(std::size_t i = 0; i < CountersSnapshot::kNumTimers; ++i)
+  {
+    timer_calls[i].store(0, std::memory_order_relaxed);
+    timer_ticks[i].store(0, std::memory_order_relaxed);
+  }
+}
+
+//==============================================================================
+void Counters::Block::addTo(CountersSnapshot& snapshot) const
+{
+  for(std::size_t i = 0; i < CountersSnapshot::kNumCounters; ++i)
+    snapshot.counts[i] += counts[i].load(std::memory_order_relaxed);
+
+  for(std::size_t i = 0; i < CountersSnapshot::kNumTimers; ++i)
+  {
+    snapshot.timer_calls[i] += timer_calls[i].load(std::memory_order_relaxed);
+    snapshot.timer_ticks[i] += timer_ticks[i].load(std::memory_order_relaxed);
+  }
+}
+
+//==============================================================================
+struct Counters::ThreadHandle
+{
+  ThreadHandle() : block(Counters::claimBlock()) {}
+
+  ~ThreadHandle() { Counters::releaseBlock(block); }
+
+  Block* block;
+};
+
+//==============================================================================
+void Counters::enable(bool enable)
+{
+  enabled_.store(enable, std::memory_order_relaxed);
+}
+
+//==============================================================================
+void Counters::addTime(Timer id, std::uint64_t ticks)
+{
+  Block& block = localBlock();
+  const std::size_t i = static_cast<std::size_t>(id);
+  block.timer_calls[i].store(
+        block.timer_calls[i].load(std::memory_order_relaxed) + 1,
+        std::memory_order_relaxed);
+  block.timer_ticks[i].store(
+        block.timer_ticks[i].load(std::memory_order_relaxed) + ticks,
+        std::memory_order_relaxed);
+}
+
+//==============================================================================
+double Counters::ticksPerSecond()
+{
+#if FCL_COUNTERS_HAVE_RDTSC
+  // Calibrate over at least 10 ms since the library was loaded.
+  const std::chrono::duration<double> min_interval(0.01);
+  std::uint64_t now_ticks;
+  std::chrono::duration<double> interval;
+  do
+  {
+    now_ticks = ticks();
+    interval = std::chrono::steady_clock::now() - calibration_time;
+  } while(interval < min_interval);
+
+  return (now_ticks - calibration_ticks) / interval.count();
+#else
+  return 1e9;
+#endif
+}
+
+//==============================================================================
+CountersSnapshot Counters::snapshot()
+{
+  CountersSnapshot snapshot;
+  snapshot.ticks_per_second = ticksPerSecond();
+  for(const Block* block = blocks_.load(std::memory_order_acquire);
+      block != nullptr; block = block->next)
+    block->addTo(snapshot);
+
+  return snapshot;
+}
+
+//==============================================================================
+const char* Counters::name(Counter id)
+{
+  switch(id)
+  {
+  case Counter::BVTests:
+    return "BV tests";
+  case Counter::LeafTests:
+    return "leaf tests";
+  case Counter::GJKIterations:
+    return "GJK iterations";
+  case Counter::EPAFaces:
+    return "EPA faces";
+  case Counter::EPAIterations:
+    return "EPA iterations";
+  case Counter::BroadphasePairsTested:
+    return "broadphase pairs tested";
+  case Counter::BroadphasePairsPassed:
+    return "broadphase pairs passed";
+  default:
+    return "unknown counter";
+  }
+}
+
+//==============================================================================
+const char* Counters::name(Timer id)
+{
+  switch(id)
+  {
+  case Timer::Collide:
+    return "collide";
+  case Timer::Distance:
+    return "distance";
+  case Timer::BroadphaseCollide:
+    return "broadphase collide";
+  case Timer::BroadphaseDistance:
+    return "broadphase distance";
+  default:
+    return "unknown timer";
+  }
+}
+
+//==============================================================================
+Counters::Block& Counters::localBlock()
+{
+  // The plain pointer needs no initialization guard, which keeps the common
+  // path to a single thread-local load.
+  static thread_local Block* block FCL_COUNTERS_TLS_MODEL = nullptr;
+  if(block)
+    return *block;
+
+  static thread_local ThreadHandle handle;
+  block = handle.block;
+  return *block;
+}
+
+//==============================================================================
+Counters::Block* Counters::claimBlock()
+{
+  // Recycle the block of a thread that has exited.
+  for(Block* block = blocks_.load(std::memory_order_acquire);
+      block != nullptr; block = block->next)
+  {
+    bool expected = false;
+    if(!block->in_use.load(std::memory_order_relaxed)
+       && block->in_use.compare_exchange_strong(
+         expected, true, std::memory_order_acquire))
+      return block;
+  }
+
+  // Blocks are never freed, so snapshot() can walk the list without locks.
+  Block* block = new Block;
+  block->next = blocks_.load(std::memory_order_relaxed);
+  while(!blocks_.compare_exchange_weak(
+          block->next, block,
+          std::memory_order_release, std::memory_order_relaxed))
+  {
+  }
+
+  return block;
+}
+
+//==============================================================================
+void Counters::releaseBlock(Block* block)
+{
+  block->in_use.store(false, std::memory_order_release);
+}
+
+} // namespace detail
+} // namespace fcl
@@ -0,0 +1,181 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */ 
+
+#include "fcl/common/detail/parallel.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+namespace fcl {
+namespace detail {
+
+//==============================================================================
+unsigned int resolveNumThreads(unsigned int num_threads)
+{
+  if(num_threads > 0)
+    return num_threads;
+
+  // hardware_concurrency() may return 0 when the value is not computable
+  return std::max(std::thread::hardware_concurrency(), 1u);
+}
+
+namespace {
+
+/// @brief Whether the current thread is running tasks of a parallel region.
+/// Nested regions run inline, so that a worker never waits on the pool it
+/// belongs to.
+thread_local bool in_parallel_region = false;
+
+/// @brief Worker threads that are started once and then reused by every
+/// runParallelTasks() call. The pool serves one region at a time.
+class ThreadPool
+{
+public:
+  ~ThreadPool()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    start_cv_.notify_all();
+    for(auto& thread : threads_)
+      thread.join();
+  }
+
+  /// @brief Run the tasks of one region, or return false without running
+  /// anything if the pool is already serving another region.
+  bool tryRun(unsigned int num_tasks,
+              const std::function<void(unsigned int)>& task)
+  {
+    std::unique_lock<std::mutex> run_lock(run_mutex_, std::try_to_lock);
+    if(!run_lock.owns_lock())
+      return false;
+
+    // The calling thread runs tasks too, so num_tasks - 1 workers suffice.
+    // Only the run_mutex_ owner changes generation_, so it can be read here.
+    while(threads_.size() + 1 < num_tasks)
+      threads_.emplace_back(&ThreadPool::workerLoop, this, generation_);
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      task_ = &task;
+      num_tasks_ = num_tasks;
+      next_task_ = 0;
+      num_active_ = static_cast<unsigned int>(threads_.size());
+      ++generation_;
+    }
+    start_cv_.notify_all();
+
+    runTasks();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_cv_.wait(lock, [this] { return num_active_ == 0; });
+    task_ = nullptr;
+    return true;
+  }
+
+private:
+  void runTasks()
+  {
+    for(unsigned int i = next_task_++; i < num_tasks_; i = next_task_++)
+      (*task_)(i);
+  }
+
+  void workerLoop(std::size_t generation)
+  {
+    in_parallel_region = true;
+    while(true)
+    {
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        start_cv_.wait(lock, [&] { return stop_ || generation_ != generation; });
+        if(stop_)
+          return;
+        generation = generation_;
+      }
+
+      runTasks();
+
+      bool last = false;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        last = (--num_active_ == 0);
+      }
+      if(last)
+        done_cv_.notify_one();
+    }
+  }
+
+  /// @brief Held by the thread that is submitting the current region
+  std::mutex run_mutex_;
+
+  /// @brief Protects the region state shared with the workers
+  std::mutex mutex_;
+  std::condition_variable start_cv_;
+  std::condition_variable done_cv_;
+
+  std::vector<std::thread> threads_;
+  const std::function<void(unsigned int)>* task_ = nullptr;
+  unsigned int num_tasks_ = 0;
+  std::atomic<unsigned int> next_task_{0};
+  unsigned int num_active_ = 0;
+  std::size_t generation_ = 0;
+  bool stop_ = false;
+};
+
+} // namespace
+
+//==============================================================================
+void runParallelTasks(unsigned int num_tasks,
+                      const std::function<void(unsigned int)>& task)
+{
+  if(num_tasks > 1 && !in_parallel_region)
+  {
+    static ThreadPool pool;
+
+    in_parallel_region = true;
+    const bool ran = pool.tryRun(num_tasks, task);
+    in_parallel_region = false;
+    if(ran)
+      return;
+  }
+
+  for(unsigned int i = 0; i < num_tasks; ++i)
+    task(i);
+}
+
+} // namespace detail
+} // namespace fcl
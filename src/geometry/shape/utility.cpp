@@ -71,6 +71,10 @@ void constructBox(const KDOP<double, 18>& bv, Box<double>& box, Transform3<doubl
 template
 void constructBox(const KDOP<double, 24>& bv, Box<double>& box, Transform3<double>& tf);
 
+//==============================================================================
+template
+void constructBox(const FloatOBBRSS<double>& bv, Box<double>& box, Transform3<double>& tf);
+
 //==============================================================================
 template
 void constructBox(const AABB<double>& bv, const Transform3<double>& tf_bv, Box<double>& box, Transform3<double>& tf);
@@ -103,6 +107,10 @@ void constructBox(const KDOP<double, 18>& bv, const Transform3<double>& tf_bv, B
 template
 void constructBox(const KDOP<double, 24>& bv, const Transform3<double>& tf_bv, Box<double>& box, Transform3<double>& tf);
 
+//==============================================================================
+template
+void constructBox(const FloatOBBRSS<double>& bv, const Transform3<double>& tf_bv, Box<double>& box, Transform3<double>& tf);
+
 //==============================================================================
 namespace detail {
 //==============================================================================
@@ -163,6 +171,10 @@ struct ComputeBVImpl<double, RSS<double>, Halfspace<double>>;
 template
 struct ComputeBVImpl<double, OBBRSS<double>, Halfspace<double>>;
 
+//==============================================================================
+template
+struct ComputeBVImpl<double, FloatOBBRSS<double>, Halfspace<double>>;
+
 //==============================================================================
 template
 struct ComputeBVImpl<double, kIOS<double>, Halfspace<double>>;
@@ -195,6 +207,10 @@ struct ComputeBVImpl<double, RSS<double>, Plane<double>>;
 template
 struct ComputeBVImpl<double, OBBRSS<double>, Plane<double>>;
 
+//==============================================================================
+template
+struct ComputeBVImpl<double, FloatOBBRSS<double>, Plane<double>>;
+
 //==============================================================================
 template
 struct ComputeBVImpl<double, kIOS<double>, Plane<double>>;
@@ -160,6 +160,10 @@ struct Fitter<double, kIOS<double>>;
 template
 struct Fitter<double, OBBRSS<double>>;
 
+//==============================================================================
+template
+struct Fitter<double, FloatOBBRSS<double>>;
+
 //==============================================================================
 template
 class ConvertBVImpl<double, AABB<double>, AABB<double>>;
@@ -196,5 +200,41 @@ class ConvertBVImpl<double, OBBRSS<double>, RSS<double>>;
 template
 class ConvertBVImpl<double, AABB<double>, RSS<double>>;
 
+//==============================================================================
+template
+class TransformBVImpl<double, AABB<double>>;
+
+//==============================================================================
+template
+class TransformBVImpl<double, KDOP<double, 16>>;
+
+//==============================================================================
+template
+class TransformBVImpl<double, KDOP<double, 18>>;
+
+//==============================================================================
+template
+class TransformBVImpl<double, KDOP<double, 24>>;
+
+//==============================================================================
+template
+class TransformBVImpl<double, OBB<double>>;
+
+//==============================================================================
+template
+class TransformBVImpl<double, RSS<double>>;
+
+//==============================================================================
+template
+class TransformBVImpl<double, OBBRSS<double>>;
+
+//==============================================================================
+template
+class TransformBVImpl<double, FloatOBBRSS<double>>;
+
+//==============================================================================
+template
+class TransformBVImpl<double, kIOS<double>>;
+
 } // namespace detail
 } // namespace fcl
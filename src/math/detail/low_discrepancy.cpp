@@ -0,0 +1,148 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2013-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @author Jia Pan */
+
+#include "fcl/math/detail/low_discrepancy.h"
+
+#include <cassert>
+
+namespace fcl
+{
+namespace detail
+{
+
+//==============================================================================
+double haltonPoint(std::uint64_t index, std::size_t dim)
+{
+  static const unsigned int primes[kHaltonMaxDimension] = {
+    2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53};
+
+  assert(dim < kHaltonMaxDimension);
+
+  const unsigned int base = primes[dim];
+  const double inv_base = 1.0 / base;
+
+  double result = 0;
+  double factor = inv_base;
+  while(index > 0)
+  {
+    result += (index % base) * factor;
+    index /= base;
+    factor *= inv_base;
+  }
+
+  return result;
+}
+
+namespace {
+
+//==============================================================================
+struct SobolTable
+{
+  std::uint32_t v[kSobolMaxDimension][kSobolBits];
+
+  SobolTable()
+  {
+    // Degree s, coefficients a and initial direction numbers m of the
+    // primitive polynomials of dimensions 2 to kSobolMaxDimension
+    static const unsigned int s[kSobolMaxDimension] = {
+      0, 1, 2, 3, 3, 4, 4, 5, 5, 5};
+    static const unsigned int a[kSobolMaxDimension] = {
+      0, 0, 1, 1, 2, 1, 4, 2, 4, 7};
+    static const unsigned int m[kSobolMaxDimension][5] = {
+      {0, 0, 0, 0, 0},
+      {1, 0, 0, 0, 0},
+      {1, 3, 0, 0, 0},
+      {1, 3, 1, 0, 0},
+      {1, 1, 1, 0, 0},
+      {1, 1, 3, 3, 0},
+      {1, 3, 5, 13, 0},
+      {1, 1, 5, 5, 17},
+      {1, 1, 5, 5, 5},
+      {1, 1, 7, 11, 19}};
+
+    // The first dimension is the van der Corput sequence in base 2
+    for(std::size_t k = 0; k < kSobolBits; ++k)
+      v[0][k] = std::uint32_t(1) << (kSobolBits - 1 - k);
+
+    for(std::size_t d = 1; d < kSobolMaxDimension; ++d)
+    {
+      for(std::size_t k = 0; k < s[d]; ++k)
+        v[d][k] = m[d][k] << (kSobolBits - 1 - k);
+
+      for(std::size_t k = s[d]; k < kSobolBits; ++k)
+      {
+        v[d][k] = v[d][k - s[d]] ^ (v[d][k - s[d]] >> s[d]);
+        for(std::size_t l = 1; l < s[d]; ++l)
+        {
+          if((a[d] >> (s[d] - 1 - l)) & 1u)
+            v[d][k] ^= v[d][k - l];
+        }
+      }
+    }
+  }
+};
+
+} // namespace
+
+//==============================================================================
+const std::uint32_t* sobolDirections(std::size_t dim)
+{
+  static const SobolTable table;
+
+  assert(dim < kSobolMaxDimension);
+
+  return table.v[dim];
+}
+
+//==============================================================================
+std::uint32_t sobolPoint(std::uint64_t index, std::size_t dim)
+{
+  const std::uint32_t* v = sobolDirections(dim);
+
+  std::uint64_t gray = index ^ (index >> 1);
+  std::uint32_t x = 0;
+  for(std::size_t k = 0; k < kSobolBits && gray; ++k, gray >>= 1)
+  {
+    if(gray & 1u)
+      x ^= v[k];
+  }
+
+  return x;
+}
+
+} // namespace detail
+} // namespace fcl
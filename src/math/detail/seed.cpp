@@ -39,7 +39,8 @@
 
 #include <chrono>
 #include <mutex>
-#include <random>
+
+#include "fcl/math/detail/xoshiro256.h"
 
 namespace fcl
 {
@@ -49,62 +50,80 @@ namespace detail
 //==============================================================================
 bool Seed::isFirstSeedGenerated()
 {
-  return getInstance().firstSeedGenerated;
+  return getInstance().firstSeedGenerated.load(std::memory_order_acquire);
 }
 
 //==============================================================================
 uint_fast32_t Seed::getUserSetSeed()
 {
-  return getInstance().userSetSeed;
+  return getInstance().userSetSeed.load(std::memory_order_relaxed);
 }
 
 //==============================================================================
 void Seed::setUserSetSeed(uint_fast32_t seed)
 {
-  getInstance().userSetSeed = seed;
+  getInstance().userSetSeed.store(seed, std::memory_order_relaxed);
 }
 
 //==============================================================================
 uint_fast32_t Seed::getFirstSeed()
 {
-  // Compute the first seed to be used; this function should be called only once
+  Seed& instance = getInstance();
+
+  if (instance.firstSeedGenerated.load(std::memory_order_acquire))
+    return instance.firstSeedValue.load(std::memory_order_relaxed);
+
+  // Compute the first seed to be used; only the first call takes the lock
   static std::mutex fsLock;
   std::unique_lock<std::mutex> slock(fsLock);
 
-  if (getInstance().firstSeedGenerated)
-    return getInstance().firstSeedValue;
+  if (instance.firstSeedGenerated.load(std::memory_order_relaxed))
+    return instance.firstSeedValue.load(std::memory_order_relaxed);
 
-  if (getInstance().userSetSeed != 0)
+  std::uint_fast32_t value = instance.userSetSeed.load(std::memory_order_relaxed);
+  if (value == 0)
   {
-    getInstance().firstSeedValue = getInstance().userSetSeed;
-  }
-  else
-  {
-    getInstance().firstSeedValue
-        = static_cast<std::uint_fast32_t>(
+    value = static_cast<std::uint_fast32_t>(
           std::chrono::duration_cast<std::chrono::microseconds>(
             std::chrono::system_clock::now()
             - std::chrono::system_clock::time_point()).count());
   }
 
-  getInstance().firstSeedGenerated = true;
+  instance.firstSeedValue.store(value, std::memory_order_relaxed);
+  instance.firstSeedGenerated.store(true, std::memory_order_release);
 
-  return getInstance().firstSeedValue;
+  return value;
 }
 
 //==============================================================================
 uint_fast32_t Seed::getNextSeed()
 {
-  static std::mutex rngMutex;
-  std::unique_lock<std::mutex> slock(rngMutex);
-  static std::ranlux24_base sGen;
-  static std::uniform_int_distribution<> sDist(1, 1000000000);
+  return getSeed(
+        getInstance().nextSeedIndex.fetch_add(1, std::memory_order_relaxed));
+}
+
+//==============================================================================
+uint_fast32_t Seed::getSeed(std::uint64_t index)
+{
+  const std::uint64_t hash = splitMix64(splitMix64(getFirstSeed()) + index);
 
-  return sDist(sGen);
+  // Keep the seeds in [1, 2^32), the range std::mt19937 uses
+  const std::uint_fast32_t seed
+      = static_cast<std::uint_fast32_t>((hash ^ (hash >> 32)) & 0xffffffffu);
+
+  return seed == 0 ? 1 : seed;
+}
+
+//==============================================================================
+void Seed::resetSequence()
+{
+  getInstance().nextSeedIndex.store(0, std::memory_order_relaxed);
 }
 
 //==============================================================================
-Seed::Seed() : userSetSeed(0), firstSeedGenerated(false), firstSeedValue(0)
+Seed::Seed()
+  : userSetSeed(0), firstSeedGenerated(false), firstSeedValue(0),
+    nextSeedIndex(0)
 {
   // Do nothing
 }
@@ -112,6 +131,7 @@ Seed::Seed() : userSetSeed(0), firstSeedGenerated(false), firstSeedValue(0)
 //==============================================================================
 Seed& Seed::getInstance()
 {
+  // Thread-safe initialization of function-local statics (C++11)
   static Seed seed;
 
   return seed;
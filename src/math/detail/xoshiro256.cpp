@@ -0,0 +1,101 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2013-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @author Jia Pan */
+
+#include "fcl/math/detail/xoshiro256.h"
+
+namespace fcl
+{
+namespace detail
+{
+
+//==============================================================================
+std::uint64_t splitMix64(std::uint64_t x)
+{
+  std::uint64_t z = x + 0x9e3779b97f4a7c15ULL;
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  return z ^ (z >> 31);
+}
+
+//==============================================================================
+Xoshiro256::Xoshiro256(std::uint64_t seed)
+{
+  setState(seed);
+}
+
+//==============================================================================
+Xoshiro256::Xoshiro256(
+    std::uint64_t seed, std::uint64_t stream, std::uint64_t substream)
+{
+  setState(splitMix64(splitMix64(splitMix64(seed) ^ stream) ^ substream));
+}
+
+//==============================================================================
+void Xoshiro256::jump()
+{
+  static const std::uint64_t jump_polynomial[4] = {
+    0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL,
+    0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL};
+
+  std::uint64_t s[4] = {0, 0, 0, 0};
+  for(int i = 0; i < 4; ++i)
+  {
+    for(int b = 0; b < 64; ++b)
+    {
+      if(jump_polynomial[i] & (std::uint64_t(1) << b))
+      {
+        for(int k = 0; k < 4; ++k)
+          s[k] ^= state_[k];
+      }
+      (*this)();
+    }
+  }
+
+  for(int k = 0; k < 4; ++k)
+    state_[k] = s[k];
+}
+
+//==============================================================================
+void Xoshiro256::setState(std::uint64_t seed)
+{
+  // SplitMix64 never outputs four zeros in a row, the only invalid state
+  for(int k = 0; k < 4; ++k)
+    state_[k] = splitMix64(seed + k * 0x9e3779b97f4a7c15ULL);
+}
+
+} // namespace detail
+} // namespace fcl
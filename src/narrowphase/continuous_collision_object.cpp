@@ -43,4 +43,8 @@ namespace fcl
 template
 class ContinuousCollisionObject<double>;
 
+template
+AABB<double> computeSweptAABB(
+    const AABB<double>& aabb_local, const MotionBase<double>& motion);
+
 } // namespace fcl
@@ -0,0 +1,99 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/** @author Jia Pan */
+
+#include "fcl/narrowphase/detail/query_statistics_recorder.h"
+
+// See src/common/detail/counters.cpp.
+#if defined(__GNUC__) && defined(__ELF__)
+  #define FCL_QUERY_STATISTICS_TLS_MODEL __attribute__((tls_model("initial-exec")))
+#else
+  #define FCL_QUERY_STATISTICS_TLS_MODEL
+#endif
+
+namespace fcl
+{
+
+namespace detail
+{
+
+//==============================================================================
+QueryStatisticsRecorder::QueryStatisticsRecorder(QueryStatistics* statistics)
+  : statistics_(statistics), outer_(nullptr)
+{
+  if(!statistics_)
+    return;
+
+  outer_ = activeSlot();
+  activeSlot() = &local_;
+  start_ = std::chrono::steady_clock::now();
+}
+
+//==============================================================================
+QueryStatisticsRecorder::~QueryStatisticsRecorder()
+{
+  if(!statistics_)
+    return;
+
+  activeSlot() = outer_;
+  local_.num_queries += 1;
+
+  // The time of an inner query is already part of the time of the outer one.
+  if(outer_)
+    *outer_ += local_;
+
+  local_.time_seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start_).count();
+  *statistics_ += local_;
+}
+
+//==============================================================================
+QueryStatistics* QueryStatisticsRecorder::active()
+{
+  return activeSlot();
+}
+
+//==============================================================================
+QueryStatistics*& QueryStatisticsRecorder::activeSlot()
+{
+  static thread_local QueryStatistics* active FCL_QUERY_STATISTICS_TLS_MODEL
+      = nullptr;
+  return active;
+}
+
+} // namespace detail
+} // namespace fcl
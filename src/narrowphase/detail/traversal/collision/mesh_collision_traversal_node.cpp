@@ -103,5 +103,20 @@ bool initialize(
     const CollisionRequest<double>& request,
     CollisionResult<double>& result);
 
+//==============================================================================
+template
+class MeshCollisionTraversalNodeFloatOBBRSS<double>;
+
+//==============================================================================
+template
+bool initialize(
+    MeshCollisionTraversalNodeFloatOBBRSS<double>& node,
+    const BVHModel<FloatOBBRSS<double>>& model1,
+    const Transform3<double>& tf1,
+    const BVHModel<FloatOBBRSS<double>>& model2,
+    const Transform3<double>& tf2,
+    const CollisionRequest<double>& request,
+    CollisionResult<double>& result);
+
 } // namespace detail
 } // namespace fcl
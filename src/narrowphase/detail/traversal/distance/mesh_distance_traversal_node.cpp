@@ -88,5 +88,20 @@ bool initialize(
     const DistanceRequest<double>& request,
     DistanceResult<double>& result);
 
+//==============================================================================
+template
+class MeshDistanceTraversalNodeFloatOBBRSS<double>;
+
+//==============================================================================
+template
+bool initialize(
+    MeshDistanceTraversalNodeFloatOBBRSS<double>& node,
+    const BVHModel<FloatOBBRSS<double>>& model1,
+    const Transform3<double>& tf1,
+    const BVHModel<FloatOBBRSS<double>>& model2,
+    const Transform3<double>& tf2,
+    const DistanceRequest<double>& request,
+    DistanceResult<double>& result);
+
 } // namespace detail
 } // namespace fcl
@@ -67,6 +67,10 @@ void distanceRecurse(DistanceTraversalNodeBase<double>* node, int b1, int b2, BV
 template
 void distanceQueueRecurse(DistanceTraversalNodeBase<double>* node, int b1, int b2, BVHFrontList* front_list, int qsize);
 
+//==============================================================================
+template
+void distanceBestFirst(DistanceTraversalNodeBase<double>* node, int b1, int b2);
+
 //==============================================================================
 template
 void propagateBVHFrontListCollisionRecurse(CollisionTraversalNodeBase<double>* node, BVHFrontList* front_list);
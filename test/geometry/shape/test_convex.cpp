@@ -264,6 +264,62 @@ class Cube : public Polytope<S> {
   }
 };
 
+// A polytope approximating a sphere of radius `scale`, built from `stacks`
+// stacks of `slices` quads (triangles at the poles). It has enough vertices
+// for support queries to climb the vertex adjacency.
+template <typename S>
+class Ball : public Polytope<S> {
+ public:
+  Ball(S scale, int stacks, int slices)
+    : Polytope<S>(scale), stacks_(stacks), slices_(slices) {
+    const S pi = constants<S>::pi();
+    this->add_vertex(Vector3<S>(0, 0, scale));   // North pole
+    this->add_vertex(Vector3<S>(0, 0, -scale));  // South pole
+    for (int i = 1; i < stacks; ++i) {
+      const S theta = pi * i / stacks;
+      for (int j = 0; j < slices; ++j) {
+        const S phi = 2 * pi * j / slices;
+        this->add_vertex(scale * Vector3<S>(std::sin(theta) * std::cos(phi),
+                                            std::sin(theta) * std::sin(phi),
+                                            std::cos(theta)));
+      }
+    }
+
+    // Index of the j-th vertex of the i-th ring (1 <= i < stacks).
+    auto ring = [slices](int i, int j) {
+      return 2 + (i - 1) * slices + (j % slices);
+    };
+    for (int j = 0; j < slices; ++j) {
+      this->add_face({0, ring(1, j), ring(1, j + 1)});
+      for (int i = 1; i + 1 < stacks; ++i) {
+        this->add_face({ring(i, j), ring(i + 1, j), ring(i + 1, j + 1),
+                        ring(i, j + 1)});
+      }
+      this->add_face({1, ring(stacks - 1, j + 1), ring(stacks - 1, j)});
+    }
+
+    this->confirm_data();
+  }
+
+  // Polytope properties
+  int face_count() const final { return stacks_ * slices_; }
+  int vertex_count() const final { return 2 + (stacks_ - 1) * slices_; }
+  virtual S volume() const final {
+    throw std::logic_error("Not implemented yet");
+  }
+  virtual Vector3<S> com() const final { return Vector3<S>::Zero(); }
+  virtual Matrix3<S> principal_inertia_tensor() const {
+    throw std::logic_error("Not implemented yet");
+  };
+  std::string description() const final {
+    return "Ball with scale: " + std::to_string(this->scale());
+  }
+
+ private:
+  int stacks_{0};
+  int slices_{0};
+};
+
 void testConvexConstruction() {
   Cube<double> cube{1};
   // Set the cube at some other location to make sure that the interior point
@@ -280,6 +336,36 @@ void testConvexConstruction() {
   EXPECT_TRUE(CompareMatrices(convex.getInteriorPoint(), p_WB));
 }
 
+// Confirms that the support vertex found for many directions, and from every
+// starting vertex, is as far along the direction as any other vertex.
+template <typename S>
+void testFindExtremeVertex(const Polytope<S>& polytope) {
+  const Convex<S> convex = polytope.MakeConvex();
+  const std::vector<Vector3<S>>& vertices = convex.getVertices();
+  const int num_vertices = static_cast<int>(vertices.size());
+
+  // Directions spread over the sphere (a Fibonacci lattice).
+  const int num_directions = 200;
+  const S golden_angle = constants<S>::pi() * (3 - std::sqrt(S(5)));
+  for (int k = 0; k < num_directions; ++k) {
+    const S z = 1 - 2 * (k + S(0.5)) / num_directions;
+    const S r = std::sqrt(1 - z * z);
+    const Vector3<S> dir(r * std::cos(golden_angle * k),
+                         r * std::sin(golden_angle * k), z);
+
+    S max_dot = -std::numeric_limits<S>::max();
+    for (const auto& vertex : vertices) max_dot = max(max_dot, dir.dot(vertex));
+
+    for (int start = 0; start < num_vertices; start += 7) {
+      const int extreme = convex.findExtremeVertexIndex(dir, start);
+      EXPECT_EQ(dir.dot(vertices[extreme]), max_dot)
+          << polytope.description() << "\n  direction: " << dir.transpose()
+          << "\n  start: " << start;
+    }
+    EXPECT_EQ(dir.dot(convex.findExtremeVertex(dir)), max_dot);
+  }
+}
+
 template <template <typename> class Shape, typename S>
 void testAABBComputation(const Shape<S>& model, const Transform3<S>& X_WS) {
   Shape<S> shape(model);
@@ -513,6 +599,15 @@ GTEST_TEST(ConvexGeometry, CenterOfMass_Tetrahedron) {
   }
 }
 
+GTEST_TEST(ConvexGeometry, FindExtremeVertex) {
+  // Scanned exhaustively
+  testFindExtremeVertex(Cube<double>(1));
+  testFindExtremeVertex(EquilateralTetrahedron<double>(2));
+  // Searched by climbing the vertex adjacency
+  testFindExtremeVertex(Ball<double>(1.5, 12, 24));
+  testFindExtremeVertex(Ball<float>(1.5, 12, 24));
+}
+
 // TODO(SeanCurtis-TRI): Add Tetrahedron inertia unit test.
 
 // TODO(SeanCurtis-TRI): Extend the moment of inertia test.
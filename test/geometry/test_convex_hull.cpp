@@ -0,0 +1,253 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @author Jia Pan */
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "fcl/geometry/convex_hull.h"
+#include "fcl/geometry/geometric_shape_to_BVH_model.h"
+#include "fcl/math/bv/OBBRSS.h"
+
+using namespace fcl;
+
+//==============================================================================
+// Returns the largest signed distance of the points to the faces of a convex;
+// non-positive when the convex contains all of them.
+template <typename S>
+S maxOutsideDistance(const Convex<S>& convex,
+                     const std::vector<Vector3<S>>& points)
+{
+  const auto& vertices = convex.getVertices();
+  const auto& faces = convex.getFaces();
+  S max_distance = -std::numeric_limits<S>::max();
+  for(int i = 0, index = 0; i < convex.getFaceCount(); ++i)
+  {
+    const Vector3<S>& a = vertices[faces[index + 1]];
+    const Vector3<S>& b = vertices[faces[index + 2]];
+    const Vector3<S>& c = vertices[faces[index + 3]];
+    const Vector3<S> normal = (b - a).cross(c - a).normalized();
+    for(const auto& p : points)
+      max_distance = std::max(max_distance, normal.dot(p - a));
+    index += faces[index] + 1;
+  }
+  return max_distance;
+}
+
+//==============================================================================
+template <typename S>
+std::vector<Vector3<S>> spherePoints(int n, unsigned int seed)
+{
+  std::mt19937 rng(seed);
+  std::normal_distribution<S> normal;
+  std::vector<Vector3<S>> points;
+  for(int i = 0; i < n; ++i)
+    points.push_back(Vector3<S>(normal(rng), normal(rng), normal(rng)).normalized());
+  return points;
+}
+
+//==============================================================================
+template <typename S>
+void test_convex_hull_cube()
+{
+  // The corners of a unit cube, with points inside and on its faces
+  std::vector<Vector3<S>> points;
+  for(int i = 0; i < 8; ++i)
+    points.push_back(Vector3<S>(i & 1, (i >> 1) & 1, (i >> 2) & 1));
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<S> uniform(0, 1);
+  for(int i = 0; i < 200; ++i)
+  {
+    Vector3<S> p(uniform(rng), uniform(rng), uniform(rng));
+    if(i % 2)
+      p[i % 3] = S((i / 3) % 2);
+    points.push_back(p);
+  }
+
+  const auto convex = convexHull(points);
+  ASSERT_TRUE(convex != nullptr);
+  EXPECT_EQ(convex->getVertices().size(), 8u);
+  EXPECT_EQ(convex->getFaceCount(), 12);
+  EXPECT_NEAR(convex->computeVolume(), 1, 1e-6);
+  EXPECT_LE(maxOutsideDistance(*convex, points), 1e-6);
+}
+
+//==============================================================================
+template <typename S>
+void test_convex_hull_sphere()
+{
+  const std::vector<Vector3<S>> points = spherePoints<S>(2000, 1);
+
+  // Every point is a vertex of the hull, which is closed
+  const auto convex = convexHull(points);
+  ASSERT_TRUE(convex != nullptr);
+  EXPECT_EQ(convex->getVertices().size(), points.size());
+  EXPECT_EQ(convex->getFaceCount(), 2 * static_cast<int>(points.size()) - 4);
+  EXPECT_LE(maxOutsideDistance(*convex, points), 1e-6);
+
+  // Points within the tolerance are left out
+  const S tolerance = 0.01;
+  const auto simplified = convexHull(points, ConvexHullOptions<S>(tolerance));
+  ASSERT_TRUE(simplified != nullptr);
+  EXPECT_LT(simplified->getVertices().size(), points.size() / 2);
+  EXPECT_LE(maxOutsideDistance(*simplified, points), tolerance);
+
+  // Capped number of vertices
+  const auto capped = convexHull(points, ConvexHullOptions<S>(0, 40));
+  ASSERT_TRUE(capped != nullptr);
+  EXPECT_LE(capped->getVertices().size(), 40u);
+  EXPECT_GT(capped->computeVolume(), 0.8 * simplified->computeVolume());
+}
+
+//==============================================================================
+template <typename S>
+void test_convex_hull_threads()
+{
+  const std::vector<Vector3<S>> points = spherePoints<S>(20000, 2);
+
+  const auto serial = convexHull(points, ConvexHullOptions<S>(0, 0, 1));
+  const auto parallel = convexHull(points, ConvexHullOptions<S>(0, 0, 4));
+  ASSERT_TRUE(serial != nullptr);
+  ASSERT_TRUE(parallel != nullptr);
+  EXPECT_EQ(serial->getFaces(), parallel->getFaces());
+  EXPECT_EQ(serial->getVertices(), parallel->getVertices());
+}
+
+//==============================================================================
+template <typename S>
+void test_convex_hull_degenerate()
+{
+  // Coplanar points give a two-sided polygon
+  std::vector<Vector3<S>> points;
+  for(int i = 0; i < 10; ++i)
+    for(int j = 0; j < 10; ++j)
+      points.push_back(Vector3<S>(i, j, 0.5 * i));
+
+  const auto polygon = convexHull(points);
+  ASSERT_TRUE(polygon != nullptr);
+  EXPECT_EQ(polygon->getVertices().size(), 4u);
+  EXPECT_EQ(polygon->getFaceCount(), 2);
+
+  // Collinear points have no hull
+  points.clear();
+  for(int i = 0; i < 10; ++i)
+    points.push_back(Vector3<S>(i, 2 * i, 3 * i));
+  EXPECT_TRUE(convexHull(points) == nullptr);
+}
+
+//==============================================================================
+template <typename BV>
+void test_convex_decomposition()
+{
+  using S = typename BV::S;
+
+  // An L shape made of two boxes
+  BVHModel<BV> model;
+  generateBVHModel(model, Box<S>(2, 1, 1),
+                   Transform3<S>(Translation3<S>(Vector3<S>(1, 0.5, 0.5))),
+                   FinalizeModel::DONT);
+  generateBVHModel(model, Box<S>(1, 1, 1),
+                   Transform3<S>(Translation3<S>(Vector3<S>(0.5, 1.5, 0.5))),
+                   FinalizeModel::DO);
+  const std::vector<Vector3<S>> mesh_vertices(
+        model.vertices, model.vertices + model.num_vertices);
+
+  // A loose tolerance keeps the hull of the whole mesh
+  auto pieces = convexDecomposition(
+        model, ConvexDecompositionOptions<S>(1));
+  GTEST_ASSERT_EQ(pieces.size(), 1u);
+  EXPECT_NEAR(pieces[0]->computeVolume(), 3.5, 1e-6);
+
+  // With a tight one, no piece fills the notch of the L
+  pieces = convexDecomposition(model, ConvexDecompositionOptions<S>(1e-6));
+  EXPECT_GT(pieces.size(), 1u);
+  const std::vector<Vector3<S>> notch(1, Vector3<S>(1.5, 1.5, 0.5));
+  for(const auto& piece : pieces)
+    EXPECT_GT(maxOutsideDistance(*piece, notch), 0.1);
+
+  // Every vertex of the mesh is in some piece
+  for(const auto& v : mesh_vertices)
+  {
+    S min_distance = std::numeric_limits<S>::max();
+    for(const auto& piece : pieces)
+      min_distance = std::min(
+            min_distance,
+            maxOutsideDistance(*piece, std::vector<Vector3<S>>(1, v)));
+    EXPECT_LE(min_distance, 1e-6);
+  }
+
+  // The number of pieces can be capped
+  pieces = convexDecomposition(model, ConvexDecompositionOptions<S>(1e-6, 2));
+  EXPECT_EQ(pieces.size(), 2u);
+}
+
+//==============================================================================
+GTEST_TEST(FCL_CONVEX_HULL, cube)
+{
+  test_convex_hull_cube<double>();
+}
+
+//==============================================================================
+GTEST_TEST(FCL_CONVEX_HULL, sphere)
+{
+  test_convex_hull_sphere<double>();
+}
+
+//==============================================================================
+GTEST_TEST(FCL_CONVEX_HULL, threads)
+{
+  test_convex_hull_threads<double>();
+}
+
+//==============================================================================
+GTEST_TEST(FCL_CONVEX_HULL, degenerate)
+{
+  test_convex_hull_degenerate<double>();
+}
+
+//==============================================================================
+GTEST_TEST(FCL_CONVEX_HULL, decomposition)
+{
+  test_convex_decomposition<OBBRSS<double>>();
+}
+
+//==============================================================================
+int main(int argc, char* argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
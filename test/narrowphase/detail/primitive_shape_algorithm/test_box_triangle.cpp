@@ -0,0 +1,224 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @author Jia Pan */
+
+// Tests the separating axis box-triangle collision test.
+
+#include "fcl/narrowphase/detail/primitive_shape_algorithm/box_triangle-inl.h"
+
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "eigen_matrix_compare.h"
+#include "fcl/narrowphase/detail/gjk_solver_indep.h"
+#include "fcl/narrowphase/detail/gjk_solver_libccd.h"
+
+namespace fcl {
+namespace detail {
+namespace {
+
+template <typename S>
+Transform3<S> randomPose(std::mt19937& rng, S range) {
+  std::uniform_real_distribution<S> position(-range, range);
+  std::uniform_real_distribution<S> angle(-constants<S>::pi(),
+                                          constants<S>::pi());
+  Transform3<S> X = Transform3<S>::Identity();
+  X.linear() = (AngleAxis<S>(angle(rng), Vector3<S>::UnitZ())
+      * AngleAxis<S>(angle(rng), Vector3<S>::UnitY())
+      * AngleAxis<S>(angle(rng), Vector3<S>::UnitX())).toRotationMatrix();
+  X.translation() << position(rng), position(rng), position(rng);
+  return X;
+}
+
+template <typename S>
+bool intersect(const Box<S>& box, const Transform3<S>& tf,
+               const Vector3<S>& P1, const Vector3<S>& P2,
+               const Vector3<S>& P3) {
+  return boxTriangleIntersect<S>(box, tf, P1, P2, P3, nullptr, nullptr,
+                                 nullptr);
+}
+
+// Hand-computed configurations with the box at the origin.
+template <typename S>
+void AnalyticConfigurations() {
+  const S eps = 16 * constants<S>::eps();
+  const Box<S> box(S(2), S(2), S(2));
+  const Transform3<S> tf = Transform3<S>::Identity();
+  Vector3<S> contact;
+  Vector3<S> normal;
+  S depth;
+
+  // Large horizontal triangle 0.25 below the top face: face contact.
+  Vector3<S> P1(-5, -5, S(0.75));
+  Vector3<S> P2(5, -5, S(0.75));
+  Vector3<S> P3(0, 5, S(0.75));
+  EXPECT_TRUE(boxTriangleIntersect(box, tf, P1, P2, P3, &contact, &depth,
+                                   &normal));
+  EXPECT_NEAR(depth, S(0.25), eps);
+  EXPECT_TRUE(CompareMatrices(normal, Vector3<S>(0, 0, 1), eps));
+  EXPECT_NEAR(contact(2), S(0.875), eps);
+  EXPECT_LE(contact.template head<2>().cwiseAbs().maxCoeff(), S(1) + eps);
+
+  // The same triangle lifted clear of the box.
+  P1(2) = P2(2) = P3(2) = S(1.1);
+  EXPECT_FALSE(intersect(box, tf, P1, P2, P3));
+
+  // A triangle whose vertex pokes 0.1 into the +x face.
+  P1 << S(0.9), S(0.1), S(0.2);
+  P2 << 3, 1, 0;
+  P3 << 3, -1, 0;
+  EXPECT_TRUE(boxTriangleIntersect(box, tf, P1, P2, P3, &contact, &depth,
+                                   &normal));
+  EXPECT_NEAR(depth, S(0.1), eps);
+  EXPECT_TRUE(CompareMatrices(normal, Vector3<S>(1, 0, 0), eps));
+  EXPECT_TRUE(CompareMatrices(contact, Vector3<S>(S(0.95), S(0.1), S(0.2)),
+                              eps));
+
+  // A vertical triangle next to a box edge, separated only by an edge-edge
+  // axis: it misses the (1, 1) edge along z.
+  P1 << S(2.1), 0, -1;
+  P2 << 0, S(2.1), -1;
+  P3 << S(1.05), S(1.05), 1;
+  EXPECT_FALSE(intersect(box, tf, P1, P2, P3));
+  P1 << S(1.9), 0, -1;
+  P2 << 0, S(1.9), -1;
+  P3 << S(0.95), S(0.95), 1;
+  EXPECT_TRUE(boxTriangleIntersect(box, tf, P1, P2, P3, &contact, &depth,
+                                   &normal));
+  EXPECT_NEAR(depth, S(0.1) / std::sqrt(S(2)), eps);
+  EXPECT_TRUE(CompareMatrices(
+      normal, Vector3<S>(1, 1, 0) / std::sqrt(S(2)), eps));
+}
+
+// Random poses: the reported penetration depth is the smallest translation
+// that separates the shapes.
+template <typename S>
+void RandomConfigurations() {
+  std::mt19937 rng(11);
+  std::uniform_real_distribution<S> coordinate(-1, 1);
+  const S tol = S(1e-6);
+  const Box<S> box(S(1.2), S(0.7), S(2.1));
+  int num_colliding = 0;
+  for (int i = 0; i < 2000; ++i) {
+    const Transform3<S> tf = randomPose<S>(rng, S(1));
+    const Vector3<S> offset = randomPose<S>(rng, S(1.5)).translation();
+    Vector3<S> P[3];
+    for (auto& p : P)
+      p = offset + Vector3<S>(coordinate(rng), coordinate(rng),
+                              coordinate(rng));
+
+    Vector3<S> contact;
+    Vector3<S> normal;
+    S depth;
+    if (!boxTriangleIntersect(box, tf, P[0], P[1], P[2], &contact, &depth,
+                              &normal))
+      continue;
+
+    ++num_colliding;
+    EXPECT_GE(depth, S(0));
+    EXPECT_NEAR(normal.norm(), S(1), tol);
+
+    // Moving the triangle along the normal by the depth separates it...
+    Vector3<S> shift = normal * (depth + tol);
+    EXPECT_FALSE(intersect(box, tf, Vector3<S>(P[0] + shift),
+                           Vector3<S>(P[1] + shift),
+                           Vector3<S>(P[2] + shift)));
+
+    // ... while no shorter translation does.
+    if (depth > S(2) * tol) {
+      for (int k = 0; k < 20; ++k) {
+        shift = randomPose<S>(rng, S(1)).linear() * Vector3<S>::UnitX()
+            * (depth - tol);
+        EXPECT_TRUE(intersect(box, tf, Vector3<S>(P[0] + shift),
+                              Vector3<S>(P[1] + shift),
+                              Vector3<S>(P[2] + shift)));
+      }
+    }
+  }
+  EXPECT_GT(num_colliding, 100);
+}
+
+// Both solvers dispatch box-triangle queries to the kernel above.
+template <typename S, typename Solver>
+void SolverDispatch() {
+  const S eps = 16 * constants<S>::eps();
+  const Box<S> box(S(2), S(2), S(2));
+  const Transform3<S> tf = Transform3<S>::Identity();
+  Transform3<S> tf_triangle = Transform3<S>::Identity();
+  tf_triangle.translation() << 0, 0, S(0.75);
+  const Vector3<S> P1(-5, -5, 0);
+  const Vector3<S> P2(5, -5, 0);
+  const Vector3<S> P3(0, 5, 0);
+
+  Solver solver;
+  Vector3<S> contact;
+  Vector3<S> normal;
+  S depth;
+  EXPECT_TRUE(solver.shapeTriangleIntersect(box, tf, P1, P2, P3, tf_triangle,
+                                            &contact, &depth, &normal));
+  EXPECT_NEAR(depth, S(0.25), eps);
+  EXPECT_TRUE(CompareMatrices(normal, Vector3<S>(0, 0, 1), eps));
+
+  const Vector3<S> lift(0, 0, S(1.5));
+  EXPECT_FALSE(solver.shapeTriangleIntersect(
+      box, tf, Vector3<S>(P1 + lift), Vector3<S>(P2 + lift),
+      Vector3<S>(P3 + lift), nullptr, nullptr, nullptr));
+}
+
+GTEST_TEST(BoxTrianglePrimitiveTest, AnalyticConfigurations) {
+  AnalyticConfigurations<float>();
+  AnalyticConfigurations<double>();
+}
+
+GTEST_TEST(BoxTrianglePrimitiveTest, RandomConfigurations) {
+  RandomConfigurations<double>();
+}
+
+GTEST_TEST(BoxTrianglePrimitiveTest, SolverDispatch) {
+  SolverDispatch<double, GJKSolver_libccd<double>>();
+  SolverDispatch<double, GJKSolver_indep<double>>();
+}
+
+}  // namespace
+}  // namespace detail
+}  // namespace fcl
+
+//==============================================================================
+int main(int argc, char *argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
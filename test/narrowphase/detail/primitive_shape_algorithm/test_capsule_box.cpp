@@ -0,0 +1,270 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @author Jia Pan */
+
+// Tests the custom capsule-box tests: distance and collision.
+
+#include "fcl/narrowphase/detail/primitive_shape_algorithm/capsule_box-inl.h"
+
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "eigen_matrix_compare.h"
+#include "fcl/geometry/shape/box.h"
+#include "fcl/geometry/shape/capsule.h"
+#include "fcl/narrowphase/detail/gjk_solver_indep.h"
+#include "fcl/narrowphase/detail/gjk_solver_libccd.h"
+
+namespace fcl {
+namespace detail {
+namespace {
+
+// Reference segment-box distance: the squared distance is convex in the
+// segment parameter, so a ternary search converges to the minimum.
+template <typename S>
+S referenceSegmentBoxDistance(const Vector3<S>& size, const Vector3<S>& p0,
+                              const Vector3<S>& p1) {
+  auto distance = [&](S t) {
+    const Vector3<S> p = p0 + t * (p1 - p0);
+    Vector3<S> n;
+    nearestPointInBox(size, p, &n);
+    return (p - n).norm();
+  };
+  S lo = 0;
+  S hi = 1;
+  for (int i = 0; i < 200; ++i) {
+    const S m1 = lo + (hi - lo) / 3;
+    const S m2 = hi - (hi - lo) / 3;
+    if (distance(m1) < distance(m2))
+      hi = m2;
+    else
+      lo = m1;
+  }
+  return distance((lo + hi) / 2);
+}
+
+template <typename S>
+Transform3<S> randomPose(std::mt19937& rng, S range) {
+  std::uniform_real_distribution<S> position(-range, range);
+  std::uniform_real_distribution<S> angle(-constants<S>::pi(),
+                                          constants<S>::pi());
+  Transform3<S> X = Transform3<S>::Identity();
+  X.linear() = (AngleAxis<S>(angle(rng), Vector3<S>::UnitZ())
+      * AngleAxis<S>(angle(rng), Vector3<S>::UnitY())
+      * AngleAxis<S>(angle(rng), Vector3<S>::UnitX())).toRotationMatrix();
+  X.translation() << position(rng), position(rng), position(rng);
+  return X;
+}
+
+// Hand-computed configurations with the box at the origin of F.
+template <typename S>
+void AnalyticConfigurations() {
+  const S eps = 16 * constants<S>::eps();
+  const Box<S> box(S(2), S(4), S(6));
+  const Capsule<S> capsule(S(0.5), S(3));
+  const Transform3<S> X_FB = Transform3<S>::Identity();
+
+  // Capsule lying along x above the +z face, separated by 0.25.
+  Transform3<S> X_FC = Transform3<S>::Identity();
+  X_FC.linear() = AngleAxis<S>(constants<S>::pi() / 2, Vector3<S>::UnitY())
+                      .toRotationMatrix();
+  X_FC.translation() << 0, 0, S(3.75);
+  S distance;
+  Vector3<S> p_FCb, p_FBc;
+  EXPECT_TRUE(capsuleBoxDistance(capsule, X_FC, box, X_FB, &distance, &p_FCb,
+                                 &p_FBc));
+  EXPECT_NEAR(distance, S(0.25), eps);
+  EXPECT_NEAR(p_FCb(2), S(3.25), eps);
+  EXPECT_NEAR(p_FBc(2), S(3), eps);
+  EXPECT_LE(std::abs(p_FBc(0)), S(1) + eps);
+  std::vector<ContactPoint<S>> contacts;
+  EXPECT_FALSE(capsuleBoxIntersect(capsule, X_FC, box, X_FB, &contacts));
+  EXPECT_TRUE(contacts.empty());
+
+  // Same capsule, sunk so that its core segment is 0.25 above the face.
+  X_FC.translation() << 0, 0, S(3.25);
+  EXPECT_FALSE(capsuleBoxDistance(capsule, X_FC, box, X_FB, &distance,
+                                  &p_FCb, &p_FBc));
+  EXPECT_EQ(distance, S(-1));
+  EXPECT_TRUE(capsuleBoxIntersect(capsule, X_FC, box, X_FB, &contacts));
+  GTEST_ASSERT_EQ(contacts.size(), 1u);
+  EXPECT_NEAR(contacts[0].penetration_depth, S(0.25), eps);
+  EXPECT_TRUE(CompareMatrices(contacts[0].normal, Vector3<S>(0, 0, -1), eps));
+  EXPECT_NEAR(contacts[0].pos(2), S(2.875), eps);
+
+  // Vertical capsule whose core segment pokes 0.5 into the +z face; the
+  // segment itself penetrates, so the depth is that of the segment plus r.
+  contacts.clear();
+  X_FC.setIdentity();
+  X_FC.translation() << S(0.2), S(-0.3), S(4);
+  EXPECT_TRUE(capsuleBoxIntersect(capsule, X_FC, box, X_FB, &contacts));
+  GTEST_ASSERT_EQ(contacts.size(), 1u);
+  EXPECT_NEAR(contacts[0].penetration_depth, S(1), eps);
+  EXPECT_TRUE(CompareMatrices(contacts[0].normal, Vector3<S>(0, 0, -1), eps));
+
+  // Capsule entirely inside the box, nearest to the -x face.
+  contacts.clear();
+  X_FC.setIdentity();
+  X_FC.translation() << S(-0.7), 0, 0;
+  EXPECT_TRUE(capsuleBoxIntersect(capsule, X_FC, box, X_FB, &contacts));
+  GTEST_ASSERT_EQ(contacts.size(), 1u);
+  EXPECT_NEAR(contacts[0].penetration_depth, S(0.8), eps);
+  EXPECT_TRUE(CompareMatrices(contacts[0].normal, Vector3<S>(1, 0, 0), eps));
+}
+
+// Random poses: the distance matches a reference search, and the reported
+// penetration depth is the smallest translation that separates the shapes.
+template <typename S>
+void RandomConfigurations() {
+  std::mt19937 rng(7);
+  const S tol = S(1e-4);
+  const Box<S> box(S(1.2), S(0.7), S(2.1));
+  const Capsule<S> capsule(S(0.3), S(1.6));
+  std::vector<ContactPoint<S>>* no_contacts = nullptr;
+  int num_colliding = 0;
+  int num_separated = 0;
+  for (int i = 0; i < 2000; ++i) {
+    const Transform3<S> X_FB = randomPose<S>(rng, S(1));
+    const Transform3<S> X_FC = randomPose<S>(rng, S(2));
+
+    const Transform3<S> X_BC = X_FB.inverse() * X_FC;
+    const Vector3<S> p0 = X_BC * Vector3<S>(0, 0, -capsule.lz / 2);
+    const Vector3<S> p1 = X_BC * Vector3<S>(0, 0, capsule.lz / 2);
+    const S expected =
+        referenceSegmentBoxDistance(box.side, p0, p1) - capsule.radius;
+
+    S distance;
+    Vector3<S> p_FCb, p_FBc;
+    const bool separated = capsuleBoxDistance(capsule, X_FC, box, X_FB,
+                                              &distance, &p_FCb, &p_FBc);
+    std::vector<ContactPoint<S>> contacts;
+    const bool colliding =
+        capsuleBoxIntersect(capsule, X_FC, box, X_FB, &contacts);
+    EXPECT_NE(separated, colliding);
+
+    if (separated) {
+      ++num_separated;
+      EXPECT_NEAR(distance, expected, tol);
+      EXPECT_NEAR((p_FCb - p_FBc).norm(), distance, tol);
+      continue;
+    }
+
+    ++num_colliding;
+    EXPECT_LE(expected, tol);
+    GTEST_ASSERT_EQ(contacts.size(), 1u);
+    const ContactPoint<S>& contact = contacts[0];
+    EXPECT_NEAR(contact.normal.norm(), S(1), tol);
+
+    // Moving the capsule back along the normal by the depth separates it...
+    Transform3<S> X_FC_moved = X_FC;
+    X_FC_moved.translation() -=
+        contact.normal * (contact.penetration_depth + S(2) * tol);
+    EXPECT_FALSE(capsuleBoxIntersect(capsule, X_FC_moved, box, X_FB, no_contacts));
+
+    // ... while no shorter translation does.
+    if (contact.penetration_depth > S(4) * tol) {
+      for (int k = 0; k < 20; ++k) {
+        const Vector3<S> dir =
+            randomPose<S>(rng, S(1)).linear() * Vector3<S>::UnitX();
+        X_FC_moved = X_FC;
+        X_FC_moved.translation() +=
+            dir * (contact.penetration_depth - S(2) * tol);
+        EXPECT_TRUE(
+            capsuleBoxIntersect(capsule, X_FC_moved, box, X_FB, no_contacts));
+      }
+    }
+  }
+  EXPECT_GT(num_colliding, 100);
+  EXPECT_GT(num_separated, 100);
+}
+
+// Both solvers dispatch the pair, in either order, to the kernels above.
+template <typename S, typename Solver>
+void SolverDispatch() {
+  const S eps = 16 * constants<S>::eps();
+  const Box<S> box(S(2), S(4), S(6));
+  const Capsule<S> capsule(S(0.5), S(3));
+  const Transform3<S> X_FB = Transform3<S>::Identity();
+  Transform3<S> X_FC = Transform3<S>::Identity();
+  X_FC.translation() << 0, 0, S(4.75);
+
+  Solver solver;
+  std::vector<ContactPoint<S>> contacts;
+  EXPECT_TRUE(solver.shapeIntersect(capsule, X_FC, box, X_FB, &contacts));
+  GTEST_ASSERT_EQ(contacts.size(), 1u);
+  EXPECT_NEAR(contacts[0].penetration_depth, S(0.25), eps);
+  EXPECT_TRUE(CompareMatrices(contacts[0].normal, Vector3<S>(0, 0, -1), eps));
+
+  contacts.clear();
+  EXPECT_TRUE(solver.shapeIntersect(box, X_FB, capsule, X_FC, &contacts));
+  GTEST_ASSERT_EQ(contacts.size(), 1u);
+  EXPECT_NEAR(contacts[0].penetration_depth, S(0.25), eps);
+  EXPECT_TRUE(CompareMatrices(contacts[0].normal, Vector3<S>(0, 0, 1), eps));
+
+  X_FC.translation() << 0, 0, S(5.5);
+  S distance;
+  Vector3<S> p1, p2;
+  EXPECT_TRUE(solver.shapeDistance(box, X_FB, capsule, X_FC, &distance, &p1,
+                                   &p2));
+  EXPECT_NEAR(distance, S(0.5), eps);
+  EXPECT_NEAR(p1(2), S(3), eps);
+  EXPECT_NEAR(p2(2), S(3.5), eps);
+}
+
+GTEST_TEST(CapsuleBoxPrimitiveTest, AnalyticConfigurations) {
+  AnalyticConfigurations<float>();
+  AnalyticConfigurations<double>();
+}
+
+GTEST_TEST(CapsuleBoxPrimitiveTest, RandomConfigurations) {
+  RandomConfigurations<double>();
+}
+
+GTEST_TEST(CapsuleBoxPrimitiveTest, SolverDispatch) {
+  SolverDispatch<double, GJKSolver_libccd<double>>();
+  SolverDispatch<double, GJKSolver_indep<double>>();
+}
+
+}  // namespace
+}  // namespace detail
+}  // namespace fcl
+
+//==============================================================================
+int main(int argc, char *argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
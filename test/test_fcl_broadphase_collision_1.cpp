@@ -45,6 +45,7 @@
 #include "fcl/broadphase/broadphase_interval_tree.h"
 #include "fcl/broadphase/broadphase_dynamic_AABB_tree.h"
 #include "fcl/broadphase/broadphase_dynamic_AABB_tree_array.h"
+#include "fcl/broadphase/broadphase_hash_grid.h"
 #include "fcl/broadphase/detail/sparse_hash_table.h"
 #include "fcl/broadphase/detail/spatial_hash.h"
 #include "fcl/geometry/geometric_shape_to_BVH_model.h"
@@ -58,6 +59,9 @@
 
 #include <iostream>
 #include <iomanip>
+#include <mutex>
+#include <set>
+#include <thread>
 
 using namespace fcl;
 
@@ -70,6 +74,16 @@ void broad_phase_duplicate_check_test(S env_scale, std::size_t env_size, bool ve
 template <typename S>
 void broad_phase_update_collision_test(S env_scale, std::size_t env_size, std::size_t query_size, std::size_t num_max_contacts = 1, bool exhaustive = false, bool use_mesh = false);
 
+/// @brief test that the hash grid reports the same pairs as the brute force
+/// manager, whatever the number of threads used to rebuild it
+template <typename S>
+void broad_phase_hash_grid_test(S env_scale, std::size_t env_size);
+
+/// @brief test the parallel manager-vs-manager collision of the dynamic AABB
+/// tree managers against their serial traversal
+template <typename S>
+void broad_phase_parallel_manager_collision_test(S env_scale, std::size_t env_size, std::size_t query_size);
+
 #if USE_GOOGLEHASH
 template<typename U, typename V>
 struct GoogleSparseHashTable : public google::sparse_hash_map<U, V, std::tr1::hash<size_t>, std::equal_to<size_t> > {};
@@ -167,6 +181,26 @@ GTEST_TEST(FCL_BROADPHASE, test_core_mesh_bf_broad_phase_update_collision_mesh_e
 #endif
 }
 
+/// check the multi-level hash grid against the brute force manager
+GTEST_TEST(FCL_BROADPHASE, test_core_bf_broad_phase_hash_grid)
+{
+#ifdef NDEBUG
+  broad_phase_hash_grid_test<double>(2000, 2000);
+#else
+  broad_phase_hash_grid_test<double>(2000, 300);
+#endif
+}
+
+/// check the parallel collision between two managers
+GTEST_TEST(FCL_BROADPHASE, test_core_bf_broad_phase_parallel_manager_collision)
+{
+#ifdef NDEBUG
+  broad_phase_parallel_manager_collision_test<double>(2000, 2000, 200);
+#else
+  broad_phase_parallel_manager_collision_test<double>(2000, 300, 50);
+#endif
+}
+
 //==============================================================================
 template <typename S>
 struct CollisionDataForUniquenessChecking
@@ -223,6 +257,7 @@ void broad_phase_duplicate_check_test(S env_scale, std::size_t env_size, bool ve
 #endif
   managers.push_back(new DynamicAABBTreeCollisionManager<S>());
   managers.push_back(new DynamicAABBTreeCollisionManager_Array<S>());
+  managers.push_back(new HashGridCollisionManager<S>(cell_size, 4, 2));
 
   {
     DynamicAABBTreeCollisionManager<S>* m = new DynamicAABBTreeCollisionManager<S>();
@@ -383,6 +418,7 @@ void broad_phase_update_collision_test(S env_scale, std::size_t env_size, std::s
 #endif
   managers.push_back(new DynamicAABBTreeCollisionManager<S>());
   managers.push_back(new DynamicAABBTreeCollisionManager_Array<S>());
+  managers.push_back(new HashGridCollisionManager<S>(cell_size, 4, 2));
 
   {
     DynamicAABBTreeCollisionManager<S>* m = new DynamicAABBTreeCollisionManager<S>();
@@ -579,6 +615,211 @@ void broad_phase_update_collision_test(S env_scale, std::size_t env_size, std::s
   std::cout << std::endl;
 }
 
+//==============================================================================
+template <typename S>
+bool collisionFunctionForPairRecording(
+    CollisionObject<S>* o1, CollisionObject<S>* o2, void* cdata_)
+{
+  auto* pairs = static_cast<std::set<std::pair<CollisionObject<S>*, CollisionObject<S>*>>*>(cdata_);
+
+  EXPECT_TRUE(pairs->emplace(std::min(o1, o2), std::max(o1, o2)).second);
+
+  return false;
+}
+
+//==============================================================================
+template <typename S>
+void broad_phase_hash_grid_test(S env_scale, std::size_t env_size)
+{
+  using PairSet = std::set<std::pair<CollisionObject<S>*, CollisionObject<S>*>>;
+
+  std::vector<CollisionObject<S>*> env;
+  test::generateEnvironments(env, env_scale, env_size);
+
+  // A few objects larger than the coarsest cells, kept out of the grid
+  for(std::size_t i = 0; i < 3; ++i)
+  {
+    env.push_back(new CollisionObject<S>(
+                    std::make_shared<Box<S>>(env_scale, env_scale, env_scale),
+                    Transform3<S>(Translation3<S>(Vector3<S>(S(i) * env_scale / 2, 0, 0)))));
+  }
+
+  NaiveCollisionManager<S> naive;
+  HashGridCollisionManager<S> grid_1(10, 3, 1);
+  HashGridCollisionManager<S> grid_4(10, 3, 4);
+
+  std::vector<BroadPhaseCollisionManager<S>*> managers = {&naive, &grid_1, &grid_4};
+  for(auto* manager : managers)
+  {
+    manager->registerObjects(env);
+    manager->setup();
+  }
+
+  EXPECT_EQ(grid_1.getNumOversizedObjects(), 3u);
+
+  S extents[] = {-env_scale, env_scale, -env_scale, env_scale, -env_scale, env_scale};
+  aligned_vector<Transform3<S>> transforms;
+  test::generateRandomTransforms(extents, transforms, env.size());
+
+  for(int iteration = 0; iteration < 2; ++iteration)
+  {
+    std::vector<PairSet> pairs(managers.size());
+    for(std::size_t i = 0; i < managers.size(); ++i)
+      managers[i]->collide(&pairs[i], collisionFunctionForPairRecording<S>);
+
+    EXPECT_FALSE(pairs[0].empty());
+    EXPECT_TRUE(pairs[1] == pairs[0]);
+    EXPECT_TRUE(pairs[2] == pairs[0]);
+
+    for(std::size_t i = 0; i < env.size(); i += 97)
+    {
+      PairSet expected, result;
+      for(auto* obj : env)
+      {
+        if(obj->getAABB().overlap(env[i]->getAABB()))
+          expected.emplace(std::min(obj, env[i]), std::max(obj, env[i]));
+      }
+      grid_4.collide(env[i], &result, collisionFunctionForPairRecording<S>);
+      EXPECT_TRUE(result == expected);
+    }
+
+    // Move everything and rebuild
+    for(std::size_t i = 0; i < env.size(); ++i)
+    {
+      env[i]->setTransform(transforms[i]);
+      env[i]->computeAABB();
+    }
+    for(auto* manager : managers)
+      manager->update();
+  }
+
+  // Removed objects must disappear from the queries before the next update
+  for(std::size_t i = 0; i < env.size(); i += 3)
+  {
+    for(auto* manager : managers)
+      manager->unregisterObject(env[i]);
+  }
+  EXPECT_EQ(grid_4.size(), naive.size());
+
+  for(int iteration = 0; iteration < 2; ++iteration)
+  {
+    std::vector<PairSet> pairs(managers.size());
+    for(std::size_t i = 0; i < managers.size(); ++i)
+      managers[i]->collide(&pairs[i], collisionFunctionForPairRecording<S>);
+
+    EXPECT_TRUE(pairs[1] == pairs[0]);
+    EXPECT_TRUE(pairs[2] == pairs[0]);
+
+    for(auto* manager : managers)
+      manager->update();
+  }
+
+  for(auto* obj : env)
+    delete obj;
+}
+
+//==============================================================================
+template <typename S>
+struct PairSequenceData
+{
+  std::mutex mutex;
+  std::vector<std::pair<CollisionObject<S>*, CollisionObject<S>*>> pairs;
+  std::set<std::thread::id> threads;
+  std::size_t max_pairs = std::numeric_limits<std::size_t>::max();
+};
+
+//==============================================================================
+template <typename S>
+bool collisionFunctionForPairSequence(
+    CollisionObject<S>* o1, CollisionObject<S>* o2, void* cdata_)
+{
+  auto* cdata = static_cast<PairSequenceData<S>*>(cdata_);
+
+  std::lock_guard<std::mutex> lock(cdata->mutex);
+  cdata->pairs.emplace_back(o1, o2);
+  cdata->threads.insert(std::this_thread::get_id());
+  return cdata->pairs.size() >= cdata->max_pairs;
+}
+
+//==============================================================================
+template <typename S, typename Manager>
+void checkParallelManagerCollision(
+    const std::vector<CollisionObject<S>*>& query,
+    const std::vector<CollisionObject<S>*>& env)
+{
+  const unsigned int num_threads = 4;
+
+  Manager query_manager;
+  query_manager.registerObjects(query);
+  query_manager.setup();
+
+  Manager env_manager;
+  env_manager.registerObjects(env);
+  env_manager.setup();
+
+  PairSequenceData<S> serial;
+  query_manager.collide(&env_manager, &serial, collisionFunctionForPairSequence<S>);
+  EXPECT_FALSE(serial.pairs.empty());
+
+  // Deterministic mode reproduces the serial sequence
+  PairSequenceData<S> deterministic;
+  query_manager.collide(&env_manager, &deterministic, collisionFunctionForPairSequence<S>,
+                        BroadPhaseParallelOptions(num_threads, true));
+  EXPECT_TRUE(deterministic.pairs == serial.pairs);
+  EXPECT_TRUE(deterministic.threads == serial.threads);
+
+  // With a single thread, deterministic mode calls back from the calling thread
+  PairSequenceData<S> single;
+  query_manager.collide(&env_manager, &single, collisionFunctionForPairSequence<S>,
+                        BroadPhaseParallelOptions(1, true));
+  EXPECT_TRUE(single.pairs == serial.pairs);
+  EXPECT_TRUE(single.threads == std::set<std::thread::id>({std::this_thread::get_id()}));
+
+  // Concurrent mode reports the same pairs in any order
+  PairSequenceData<S> concurrent;
+  query_manager.collide(&env_manager, &concurrent, collisionFunctionForPairSequence<S>,
+                        BroadPhaseParallelOptions(num_threads, false));
+  std::vector<std::pair<CollisionObject<S>*, CollisionObject<S>*>> sorted = serial.pairs;
+  std::sort(sorted.begin(), sorted.end());
+  std::sort(concurrent.pairs.begin(), concurrent.pairs.end());
+  EXPECT_TRUE(concurrent.pairs == sorted);
+
+  // Early exit reaches all the workers
+  const std::size_t max_pairs = (serial.pairs.size() + 1) / 2;
+
+  PairSequenceData<S> deterministic_stop;
+  deterministic_stop.max_pairs = max_pairs;
+  query_manager.collide(&env_manager, &deterministic_stop, collisionFunctionForPairSequence<S>,
+                        BroadPhaseParallelOptions(num_threads, true));
+  EXPECT_EQ(deterministic_stop.pairs.size(), max_pairs);
+
+  PairSequenceData<S> concurrent_stop;
+  concurrent_stop.max_pairs = max_pairs;
+  query_manager.collide(&env_manager, &concurrent_stop, collisionFunctionForPairSequence<S>,
+                        BroadPhaseParallelOptions(num_threads, false));
+  EXPECT_GE(concurrent_stop.pairs.size(), max_pairs);
+  EXPECT_LE(concurrent_stop.pairs.size(), max_pairs + num_threads - 1);
+}
+
+//==============================================================================
+template <typename S>
+void broad_phase_parallel_manager_collision_test(S env_scale, std::size_t env_size, std::size_t query_size)
+{
+  std::vector<CollisionObject<S>*> env;
+  test::generateEnvironments(env, env_scale, env_size);
+
+  std::vector<CollisionObject<S>*> query;
+  test::generateEnvironments(query, env_scale, query_size);
+
+  checkParallelManagerCollision<S, DynamicAABBTreeCollisionManager<S>>(query, env);
+  checkParallelManagerCollision<S, DynamicAABBTreeCollisionManager_Array<S>>(query, env);
+
+  for(auto* obj : env)
+    delete obj;
+  for(auto* obj : query)
+    delete obj;
+}
+
 //==============================================================================
 int main(int argc, char* argv[])
 {
@@ -45,6 +45,7 @@
 #include "fcl/broadphase/broadphase_interval_tree.h"
 #include "fcl/broadphase/broadphase_dynamic_AABB_tree.h"
 #include "fcl/broadphase/broadphase_dynamic_AABB_tree_array.h"
+#include "fcl/broadphase/broadphase_hash_grid.h"
 #include "fcl/broadphase/detail/sparse_hash_table.h"
 #include "fcl/broadphase/detail/spatial_hash.h"
 #include "fcl/geometry/geometric_shape_to_BVH_model.h"
@@ -65,6 +66,11 @@ using namespace fcl;
 template <typename S>
 void broad_phase_collision_test(S env_scale, std::size_t env_size, std::size_t query_size, std::size_t num_max_contacts = 1, bool exhaustive = false, bool use_mesh = false);
 
+/// @brief test that batched queries give the same results as one query at a
+/// time
+template <typename S>
+void broad_phase_collide_many_test(S env_scale, std::size_t env_size, std::size_t query_size, std::size_t num_max_contacts);
+
 #if USE_GOOGLEHASH
 template<typename U, typename V>
 struct GoogleSparseHashTable : public google::sparse_hash_map<U, V, std::tr1::hash<size_t>, std::equal_to<size_t> > {};
@@ -117,6 +123,18 @@ GTEST_TEST(FCL_BROADPHASE, test_core_bf_broad_phase_collision_empty)
 #endif
 }
 
+/// check batched broad phase collision queries
+GTEST_TEST(FCL_BROADPHASE, test_core_bf_broad_phase_collide_many)
+{
+#ifdef NDEBUG
+  broad_phase_collide_many_test<double>(2000, 1000, 1000, 1);
+  broad_phase_collide_many_test<double>(2000, 1000, 1000, 10);
+#else
+  broad_phase_collide_many_test<double>(2000, 100, 100, 1);
+  broad_phase_collide_many_test<double>(2000, 100, 100, 10);
+#endif
+}
+
 /// check broad phase collision and self collision, only return collision or not
 GTEST_TEST(FCL_BROADPHASE, test_core_bf_broad_phase_collision_binary)
 {
@@ -220,6 +238,7 @@ void broad_phase_collision_test(S env_scale, std::size_t env_size, std::size_t q
   managers.push_back(new DynamicAABBTreeCollisionManager<S>());
 
   managers.push_back(new DynamicAABBTreeCollisionManager_Array<S>());
+  managers.push_back(new HashGridCollisionManager<S>(cell_size, 4, 2));
 
   {
     DynamicAABBTreeCollisionManager<S>* m = new DynamicAABBTreeCollisionManager<S>();
@@ -377,6 +396,67 @@ void broad_phase_collision_test(S env_scale, std::size_t env_size, std::size_t q
 
 }
 
+//==============================================================================
+template <typename S>
+void broad_phase_collide_many_test(S env_scale, std::size_t env_size, std::size_t query_size, std::size_t num_max_contacts)
+{
+  std::vector<CollisionObject<S>*> env;
+  test::generateEnvironments(env, env_scale, env_size);
+
+  std::vector<CollisionObject<S>*> query;
+  test::generateEnvironments(query, env_scale, query_size);
+
+  Vector3<S> lower_limit, upper_limit;
+  SpatialHashingCollisionManager<S>::computeBound(env, lower_limit, upper_limit);
+  S cell_size = std::min(std::min((upper_limit[0] - lower_limit[0]) / 20, (upper_limit[1] - lower_limit[1]) / 20), (upper_limit[2] - lower_limit[2])/20);
+
+  std::vector<BroadPhaseCollisionManager<S>*> managers;
+  managers.push_back(new SaPCollisionManager<S>());
+  managers.push_back(new HashGridCollisionManager<S>(cell_size, 4, 2));
+  managers.push_back(new DynamicAABBTreeCollisionManager<S>());
+  managers.push_back(new DynamicAABBTreeCollisionManager_Array<S>());
+
+  for(auto* manager : managers)
+  {
+    manager->registerObjects(env);
+    manager->setup();
+
+    std::vector<test::CollisionData<S>> expected(query.size());
+    for(std::size_t i = 0; i < query.size(); ++i)
+    {
+      expected[i].request.num_max_contacts = num_max_contacts;
+      manager->collide(query[i], &expected[i], test::defaultCollisionFunction);
+    }
+
+    for(unsigned int num_threads : {1u, 4u})
+    {
+      std::vector<test::CollisionData<S>> results(query.size());
+      std::vector<void*> cdata(query.size());
+      for(std::size_t i = 0; i < query.size(); ++i)
+      {
+        results[i].request.num_max_contacts = num_max_contacts;
+        cdata[i] = &results[i];
+      }
+
+      manager->collideMany(query, cdata, test::defaultCollisionFunction,
+                           BroadPhaseParallelOptions(num_threads));
+
+      for(std::size_t i = 0; i < query.size(); ++i)
+      {
+        EXPECT_EQ(results[i].result.numContacts(), expected[i].result.numContacts());
+        EXPECT_EQ(results[i].done, expected[i].done);
+      }
+    }
+
+    delete manager;
+  }
+
+  for(auto* obj : env)
+    delete obj;
+  for(auto* obj : query)
+    delete obj;
+}
+
 //==============================================================================
 int main(int argc, char* argv[])
 {
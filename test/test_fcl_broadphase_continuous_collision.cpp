@@ -0,0 +1,248 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @author Jia Pan */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include <memory>
+
+#include "fcl/broadphase/broadphase_dynamic_AABB_tree_continuous.h"
+#include "fcl/geometry/shape/sphere.h"
+#include "fcl/math/motion/translation_motion.h"
+#include "fcl/narrowphase/continuous_collision.h"
+
+using namespace fcl;
+
+//==============================================================================
+template <typename S>
+using ObjectPair = std::pair<ContinuousCollisionObject<S>*, ContinuousCollisionObject<S>*>;
+
+//==============================================================================
+template <typename S>
+ObjectPair<S> makePair(ContinuousCollisionObject<S>* o1, ContinuousCollisionObject<S>* o2)
+{
+  return (o1 < o2) ? ObjectPair<S>(o1, o2) : ObjectPair<S>(o2, o1);
+}
+
+//==============================================================================
+template <typename S>
+bool collectPair(ContinuousCollisionObject<S>* o1, ContinuousCollisionObject<S>* o2, void* cdata)
+{
+  static_cast<std::vector<ObjectPair<S>>*>(cdata)->push_back(makePair(o1, o2));
+  return false;
+}
+
+//==============================================================================
+template <typename S>
+struct EarliestFirstData
+{
+  std::vector<ObjectPair<S>> pairs;
+  std::vector<S> times;
+  std::size_t max_pairs = std::numeric_limits<std::size_t>::max();
+};
+
+//==============================================================================
+template <typename S>
+bool collectResult(ContinuousCollisionObject<S>* o1, ContinuousCollisionObject<S>* o2,
+                   const ContinuousCollisionResult<S>& result, void* cdata)
+{
+  auto* data = static_cast<EarliestFirstData<S>*>(cdata);
+  data->pairs.push_back(makePair(o1, o2));
+  data->times.push_back(result.time_of_contact);
+  return data->pairs.size() >= data->max_pairs;
+}
+
+//==============================================================================
+/// @brief Spheres on a grid, every other one moving by a random offset
+template <typename S>
+std::vector<std::unique_ptr<ContinuousCollisionObject<S>>> generateMovingSpheres(
+    std::size_t n, unsigned int seed)
+{
+  std::srand(seed);
+  auto random = [](S lo, S hi) { return lo + (hi - lo) * std::rand() / RAND_MAX; };
+
+  std::vector<std::unique_ptr<ContinuousCollisionObject<S>>> objs;
+  for(std::size_t i = 0; i < n; ++i)
+  {
+    auto sphere = std::make_shared<Sphere<S>>(random(0.2, 0.5));
+    const Vector3<S> start(random(-10, 10), random(-10, 10), random(-10, 10));
+    const Vector3<S> end = (i % 2) ? start : Vector3<S>(start + Vector3<S>(random(-4, 4), random(-4, 4), random(-4, 4)));
+    auto motion = std::make_shared<TranslationMotion<S>>(Matrix3<S>::Identity(), start, end);
+    objs.emplace_back(new ContinuousCollisionObject<S>(sphere, motion));
+  }
+
+  return objs;
+}
+
+//==============================================================================
+template <typename S>
+void test_dynamic_AABB_tree_continuous_collide()
+{
+  auto objs = generateMovingSpheres<S>(200, 1);
+  std::vector<ContinuousCollisionObject<S>*> ptrs;
+  for(auto& obj : objs)
+    ptrs.push_back(obj.get());
+
+  DynamicAABBTreeContinuousCollisionManager<S> manager;
+  manager.registerObjects(ptrs);
+  manager.setup();
+  EXPECT_EQ(manager.size(), ptrs.size());
+
+  // Self collision reports exactly the pairs with overlapping swept AABBs
+  std::vector<ObjectPair<S>> pairs;
+  manager.collide(&pairs, collectPair<S>);
+
+  std::vector<ObjectPair<S>> expected;
+  for(std::size_t i = 0; i < ptrs.size(); ++i)
+  {
+    for(std::size_t j = i + 1; j < ptrs.size(); ++j)
+    {
+      if(ptrs[i]->getAABB().overlap(ptrs[j]->getAABB()))
+        expected.push_back(makePair(ptrs[i], ptrs[j]));
+    }
+  }
+
+  std::sort(pairs.begin(), pairs.end());
+  std::sort(expected.begin(), expected.end());
+  EXPECT_TRUE(pairs == expected);
+  EXPECT_FALSE(expected.empty());
+
+  // The same pairs, split over two managers
+  DynamicAABBTreeContinuousCollisionManager<S> manager1, manager2;
+  for(std::size_t i = 0; i < ptrs.size(); ++i)
+    ((i < ptrs.size() / 2) ? manager1 : manager2).registerObject(ptrs[i]);
+  manager1.setup();
+  manager2.setup();
+
+  std::vector<ObjectPair<S>> cross_pairs;
+  manager1.collide(&manager2, &cross_pairs, collectPair<S>);
+
+  std::vector<ObjectPair<S>> cross_expected;
+  for(const auto& pair : expected)
+  {
+    const bool first1 = std::find(ptrs.begin(), ptrs.begin() + ptrs.size() / 2, pair.first) != ptrs.begin() + ptrs.size() / 2;
+    const bool second1 = std::find(ptrs.begin(), ptrs.begin() + ptrs.size() / 2, pair.second) != ptrs.begin() + ptrs.size() / 2;
+    if(first1 != second1)
+      cross_expected.push_back(pair);
+  }
+
+  std::sort(cross_pairs.begin(), cross_pairs.end());
+  EXPECT_TRUE(cross_pairs == cross_expected);
+}
+
+//==============================================================================
+template <typename S>
+void test_dynamic_AABB_tree_continuous_earliest_first(unsigned int num_threads)
+{
+  auto objs = generateMovingSpheres<S>(200, 2);
+  std::vector<ContinuousCollisionObject<S>*> ptrs;
+  for(auto& obj : objs)
+    ptrs.push_back(obj.get());
+
+  DynamicAABBTreeContinuousCollisionManager<S> manager;
+  manager.registerObjects(ptrs);
+  manager.setup();
+
+  ContinuousCollisionRequest<S> request(10, 1e-4, CCDM_TRANS, GST_LIBCCD,
+                                        CCDC_RAY_SHOOTING);
+  BroadPhaseParallelOptions options(num_threads);
+
+  EarliestFirstData<S> data;
+  manager.collideEarliestFirst(request, &data, collectResult<S>, options);
+
+  // All the pairs in contact, by increasing time of contact
+  std::size_t num_contacts = 0;
+  for(std::size_t i = 0; i < ptrs.size(); ++i)
+  {
+    for(std::size_t j = i + 1; j < ptrs.size(); ++j)
+    {
+      ContinuousCollisionResult<S> result;
+      collide(ptrs[i], ptrs[j], request, result);
+      if(result.is_collide)
+        ++num_contacts;
+    }
+  }
+
+  EXPECT_EQ(data.pairs.size(), num_contacts);
+  EXPECT_GT(num_contacts, 1u);
+  EXPECT_TRUE(std::is_sorted(data.times.begin(), data.times.end()));
+
+  for(std::size_t i = 0; i < data.pairs.size(); ++i)
+  {
+    ContinuousCollisionResult<S> result;
+    collide(data.pairs[i].first, data.pairs[i].second, request, result);
+    EXPECT_TRUE(result.is_collide);
+    // The manager may query the pair in the other order
+    EXPECT_NEAR(result.time_of_contact, data.times[i], 1e-3);
+
+    // The entry time of the swept AABBs bounds the time of contact
+    EXPECT_LE(detail::computeSweptAABBEntryTime(*data.pairs[i].first, *data.pairs[i].second),
+              data.times[i] + request.toc_err);
+  }
+
+  // Stopping after the first contact gives the earliest one
+  EarliestFirstData<S> first;
+  first.max_pairs = 1;
+  manager.collideEarliestFirst(request, &first, collectResult<S>, options);
+  EXPECT_EQ(first.pairs.size(), 1u);
+  if(!first.pairs.empty())
+  {
+    EXPECT_TRUE(first.pairs[0] == data.pairs[0]);
+  }
+}
+
+//==============================================================================
+GTEST_TEST(FCL_BROADPHASE_CONTINUOUS_COLLISION, dynamic_AABB_tree_collide)
+{
+  test_dynamic_AABB_tree_continuous_collide<double>();
+}
+
+//==============================================================================
+GTEST_TEST(FCL_BROADPHASE_CONTINUOUS_COLLISION, dynamic_AABB_tree_earliest_first)
+{
+  test_dynamic_AABB_tree_continuous_earliest_first<double>(1);
+  test_dynamic_AABB_tree_continuous_earliest_first<double>(4);
+}
+
+//==============================================================================
+int main(int argc, char* argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -45,6 +45,7 @@
 #include "fcl/broadphase/broadphase_interval_tree.h"
 #include "fcl/broadphase/broadphase_dynamic_AABB_tree.h"
 #include "fcl/broadphase/broadphase_dynamic_AABB_tree_array.h"
+#include "fcl/broadphase/broadphase_hash_grid.h"
 #include "fcl/broadphase/detail/sparse_hash_table.h"
 #include "fcl/broadphase/detail/spatial_hash.h"
 #include "fcl/geometry/geometric_shape_to_BVH_model.h"
@@ -58,6 +59,8 @@
 
 #include <iostream>
 #include <iomanip>
+#include <set>
+#include <thread>
 
 using namespace fcl;
 
@@ -77,6 +80,16 @@ void broad_phase_distance_test(S env_scale, std::size_t env_size, std::size_t qu
 template <typename S>
 void broad_phase_self_distance_test(S env_scale, std::size_t env_size, bool use_mesh = false);
 
+/// @brief test that concurrent self distance queries on the same manager do not
+/// interfere with each other through the tested pair set
+template <typename S>
+void broad_phase_concurrent_self_distance_test(S env_scale, std::size_t env_size);
+
+/// @brief test that batched distance queries give the same results as one
+/// query at a time
+template <typename S>
+void broad_phase_distance_many_test(S env_scale, std::size_t env_size, std::size_t query_size);
+
 template <typename S>
 S getDELTA() { return 0.01; }
 
@@ -124,6 +137,55 @@ GTEST_TEST(FCL_BROADPHASE, test_core_bf_broad_phase_self_distance)
 #endif
 }
 
+/// check broad phase self distance from several threads at once
+GTEST_TEST(FCL_BROADPHASE, test_core_bf_broad_phase_concurrent_self_distance)
+{
+#ifdef NDEBUG
+  broad_phase_concurrent_self_distance_test<double>(200, 1000);
+#else
+  broad_phase_concurrent_self_distance_test<double>(200, 100);
+#endif
+}
+
+/// check the set used to skip the pairs already tested by a query
+/// check batched broad phase distance queries
+GTEST_TEST(FCL_BROADPHASE, test_core_bf_broad_phase_distance_many)
+{
+#ifdef NDEBUG
+  broad_phase_distance_many_test<double>(200, 1000, 200);
+#else
+  broad_phase_distance_many_test<double>(200, 100, 20);
+#endif
+}
+
+GTEST_TEST(FCL_BROADPHASE, test_pointer_pair_set)
+{
+  std::vector<int> values(1000);
+  detail::PointerPairSet<int> pairs;
+
+  EXPECT_TRUE(pairs.empty());
+  for(int k = 0; k < 2; ++k)
+  {
+    for(size_t i = 0; i + 1 < values.size(); ++i)
+    {
+      EXPECT_TRUE(pairs.insert(&values[i], &values[i + 1]));
+      EXPECT_FALSE(pairs.insert(&values[i + 1], &values[i]));
+    }
+    EXPECT_EQ(pairs.size(), values.size() - 1);
+
+    for(size_t i = 0; i + 1 < values.size(); ++i)
+    {
+      EXPECT_TRUE(pairs.contains(&values[i + 1], &values[i]));
+      EXPECT_FALSE(pairs.contains(&values[i], &values[i]));
+    }
+
+    // The set can be reused after being cleared
+    pairs.clear();
+    EXPECT_TRUE(pairs.empty());
+    EXPECT_FALSE(pairs.contains(&values[0], &values[1]));
+  }
+}
+
 /// check broad phase distance
 GTEST_TEST(FCL_BROADPHASE, test_core_mesh_bf_broad_phase_distance_mesh)
 {
@@ -316,6 +378,76 @@ void generateSelfDistanceEnvironmentsMesh(std::vector<CollisionObject<S>*>& env,
   }
 }
 
+template <typename S>
+struct PairRecordData
+{
+  std::set<std::pair<CollisionObject<S>*, CollisionObject<S>*>> pairs;
+  bool duplicated = false;
+  test::DistanceData<S> distance_data;
+};
+
+template <typename S>
+bool recordDistanceFunction(CollisionObject<S>* o1, CollisionObject<S>* o2, void* cdata_, S& dist)
+{
+  auto* cdata = static_cast<PairRecordData<S>*>(cdata_);
+  if(!cdata->pairs.insert(std::make_pair(std::min(o1, o2), std::max(o1, o2))).second)
+    cdata->duplicated = true;
+
+  return test::defaultDistanceFunction(o1, o2, &cdata->distance_data, dist);
+}
+
+template <typename S>
+void broad_phase_concurrent_self_distance_test(S env_scale, std::size_t env_size)
+{
+  std::vector<CollisionObject<S>*> env;
+  generateSelfDistanceEnvironments(env, env_scale, env_size);
+
+  std::vector<BroadPhaseCollisionManager<S>*> managers;
+  managers.push_back(new SaPCollisionManager<S>());
+  managers.push_back(new IntervalTreeCollisionManager<S>());
+
+  Vector3<S> lower_limit, upper_limit;
+  SpatialHashingCollisionManager<S>::computeBound(env, lower_limit, upper_limit);
+  S cell_size = std::min(std::min((upper_limit[0] - lower_limit[0]) / 5, (upper_limit[1] - lower_limit[1]) / 5), (upper_limit[2] - lower_limit[2]) / 5);
+  managers.push_back(new SpatialHashingCollisionManager<S>(cell_size, lower_limit, upper_limit));
+
+  for(auto manager : managers)
+  {
+    manager->registerObjects(env);
+    manager->setup();
+
+    PairRecordData<S> serial_data;
+    manager->distance(&serial_data, recordDistanceFunction);
+    EXPECT_FALSE(serial_data.duplicated);
+
+    const int num_threads = 4;
+    std::vector<PairRecordData<S>> data(num_threads);
+    std::vector<std::thread> threads;
+    for(int i = 0; i < num_threads; ++i)
+    {
+      threads.emplace_back([manager, &data, i]()
+      {
+        manager->distance(&data[i], recordDistanceFunction);
+      });
+    }
+    for(auto& thread : threads)
+      thread.join();
+
+    for(const auto& d : data)
+    {
+      EXPECT_FALSE(d.duplicated);
+      EXPECT_TRUE(d.pairs == serial_data.pairs);
+      EXPECT_EQ(d.distance_data.result.min_distance,
+                serial_data.distance_data.result.min_distance);
+    }
+  }
+
+  for(auto manager : managers)
+    delete manager;
+  for(auto obj : env)
+    delete obj;
+}
+
 template <typename S>
 void broad_phase_self_distance_test(S env_scale, std::size_t env_size, bool use_mesh)
 {
@@ -346,6 +478,7 @@ void broad_phase_self_distance_test(S env_scale, std::size_t env_size, bool use_
 #endif
   managers.push_back(new DynamicAABBTreeCollisionManager<S>());
   managers.push_back(new DynamicAABBTreeCollisionManager_Array<S>());
+  managers.push_back(new HashGridCollisionManager<S>(cell_size, 4, 2));
 
   {
     DynamicAABBTreeCollisionManager<S>* m = new DynamicAABBTreeCollisionManager<S>();
@@ -489,6 +622,7 @@ void broad_phase_distance_test(S env_scale, std::size_t env_size, std::size_t qu
 #endif
   managers.push_back(new DynamicAABBTreeCollisionManager<S>());
   managers.push_back(new DynamicAABBTreeCollisionManager_Array<S>());
+  managers.push_back(new HashGridCollisionManager<S>(cell_size, 4, 2));
 
   {
     DynamicAABBTreeCollisionManager<S>* m = new DynamicAABBTreeCollisionManager<S>();
@@ -582,6 +716,56 @@ void broad_phase_distance_test(S env_scale, std::size_t env_size, std::size_t qu
   std::cout << std::endl;
 }
 
+//==============================================================================
+template <typename S>
+void broad_phase_distance_many_test(S env_scale, std::size_t env_size, std::size_t query_size)
+{
+  std::vector<CollisionObject<S>*> env;
+  test::generateEnvironments(env, env_scale, env_size);
+
+  std::vector<CollisionObject<S>*> query;
+  test::generateEnvironments(query, env_scale, query_size);
+
+  std::vector<BroadPhaseCollisionManager<S>*> managers;
+  managers.push_back(new NaiveCollisionManager<S>());
+  managers.push_back(new DynamicAABBTreeCollisionManager<S>());
+  managers.push_back(new DynamicAABBTreeCollisionManager_Array<S>());
+
+  for(auto* manager : managers)
+  {
+    manager->registerObjects(env);
+    manager->setup();
+
+    std::vector<test::DistanceData<S>> expected(query.size());
+    for(std::size_t i = 0; i < query.size(); ++i)
+      manager->distance(query[i], &expected[i], test::defaultDistanceFunction);
+
+    for(unsigned int num_threads : {1u, 4u})
+    {
+      std::vector<test::DistanceData<S>> results(query.size());
+      std::vector<void*> cdata(query.size());
+      for(std::size_t i = 0; i < query.size(); ++i)
+        cdata[i] = &results[i];
+
+      manager->distanceMany(query, cdata, test::defaultDistanceFunction,
+                            BroadPhaseParallelOptions(num_threads));
+
+      for(std::size_t i = 0; i < query.size(); ++i)
+      {
+        EXPECT_NEAR(results[i].result.min_distance,
+                    expected[i].result.min_distance, 1e-6);
+      }
+    }
+
+    delete manager;
+  }
+
+  for(auto* obj : env)
+    delete obj;
+  for(auto* obj : query)
+    delete obj;
+}
+
 //==============================================================================
 int main(int argc, char* argv[])
 {
@@ -0,0 +1,185 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+
+#include "fcl/broadphase/broadphase_bruteforce.h"
+#include "fcl/broadphase/broadphase_dynamic_AABB_tree.h"
+#include "fcl/broadphase/broadphase_SaP.h"
+#include "fcl/broadphase/broadphase_pair_cache.h"
+#include "fcl/geometry/shape/box.h"
+
+using namespace fcl;
+
+template <typename S>
+struct PairEventCounter
+{
+  int num_begin = 0;
+  int num_persist = 0;
+  int num_end = 0;
+  int num_live_slots = 0;
+};
+
+template <typename S>
+void countPairEvents(BroadPhasePair<S>& pair, BroadPhasePairEvent event, void* cdata)
+{
+  auto* counter = static_cast<PairEventCounter<S>*>(cdata);
+  switch(event)
+  {
+  case BPE_BEGIN:
+    ++counter->num_begin;
+    EXPECT_TRUE(pair.user_data == nullptr);
+    pair.user_data = new int(0);
+    ++counter->num_live_slots;
+    break;
+  case BPE_PERSIST:
+    ++counter->num_persist;
+    EXPECT_TRUE(pair.user_data != nullptr);
+    ++(*static_cast<int*>(pair.user_data));
+    break;
+  case BPE_END:
+    ++counter->num_end;
+    EXPECT_TRUE(pair.user_data != nullptr);
+    delete static_cast<int*>(pair.user_data);
+    --counter->num_live_slots;
+    break;
+  }
+}
+
+template <typename S>
+void test_pair_cache_events(BroadPhaseCollisionManager<S>* manager)
+{
+  // Three unit boxes on the x axis; 0 and 1 overlap, 2 is far away
+  std::vector<std::unique_ptr<CollisionObject<S>>> objs;
+  for(int i = 0; i < 3; ++i)
+  {
+    auto box = std::make_shared<Box<S>>(1, 1, 1);
+    objs.emplace_back(new CollisionObject<S>(box));
+  }
+  objs[0]->setTranslation(Vector3<S>(0, 0, 0));
+  objs[1]->setTranslation(Vector3<S>(0.5, 0, 0));
+  objs[2]->setTranslation(Vector3<S>(5, 0, 0));
+  std::vector<CollisionObject<S>*> raw_objs;
+  for(auto& obj : objs)
+  {
+    obj->computeAABB();
+    raw_objs.push_back(obj.get());
+  }
+  manager->registerObjects(raw_objs);
+  manager->setup();
+
+  BroadPhasePairCache<S> cache(manager);
+  PairEventCounter<S> counter;
+
+  cache.update(&counter, countPairEvents<S>, true);
+  EXPECT_EQ(cache.size(), 1u);
+  EXPECT_EQ(counter.num_begin, 1);
+  EXPECT_EQ(counter.num_persist, 0);
+  EXPECT_EQ(counter.num_end, 0);
+  GTEST_ASSERT_EQ(cache.getBeginPairs().size(), 1u);
+  BroadPhasePair<S>* pair = cache.findPair(objs[1].get(), objs[0].get());
+  ASSERT_TRUE(pair != nullptr);
+  EXPECT_EQ(pair, cache.getBeginPairs()[0]);
+  EXPECT_TRUE(pair->o1 < pair->o2);
+
+  // Nothing moved: no begin or end, one persisting pair
+  cache.update(&counter, countPairEvents<S>, true);
+  EXPECT_EQ(counter.num_begin, 1);
+  EXPECT_EQ(counter.num_persist, 1);
+  EXPECT_EQ(counter.num_end, 0);
+  EXPECT_TRUE(cache.getBeginPairs().empty());
+  EXPECT_TRUE(cache.getEndPairs().empty());
+  EXPECT_EQ(*static_cast<int*>(cache.findPair(objs[0].get(), objs[1].get())->user_data), 1);
+
+  // Move box 2 onto box 1 and box 0 away from box 1
+  objs[0]->setTranslation(Vector3<S>(-5, 0, 0));
+  objs[2]->setTranslation(Vector3<S>(1.2, 0, 0));
+  for(auto& obj : objs)
+    obj->computeAABB();
+  manager->update();
+
+  cache.update(&counter, countPairEvents<S>);
+  EXPECT_EQ(cache.size(), 1u);
+  EXPECT_EQ(counter.num_begin, 2);
+  EXPECT_EQ(counter.num_persist, 1);
+  EXPECT_EQ(counter.num_end, 1);
+  GTEST_ASSERT_EQ(cache.getEndPairs().size(), 1u);
+  EXPECT_TRUE(cache.findPair(objs[0].get(), objs[1].get()) == nullptr);
+  EXPECT_TRUE(cache.findPair(objs[1].get(), objs[2].get()) != nullptr);
+
+  // Removing an object ends its pairs immediately
+  cache.removeObject(objs[2].get(), &counter, countPairEvents<S>);
+  EXPECT_TRUE(cache.empty());
+  EXPECT_EQ(counter.num_end, 2);
+  EXPECT_TRUE(cache.getBeginPairs().empty());
+
+  // The pair is found again by the next update
+  cache.update(&counter, countPairEvents<S>);
+  EXPECT_EQ(counter.num_begin, 3);
+
+  cache.clear(&counter, countPairEvents<S>);
+  EXPECT_TRUE(cache.empty());
+  EXPECT_EQ(counter.num_end, 3);
+  EXPECT_EQ(counter.num_live_slots, 0);
+}
+
+GTEST_TEST(FCL_BROADPHASE_PAIR_CACHE, events_naive)
+{
+  NaiveCollisionManager<double> manager;
+  test_pair_cache_events<double>(&manager);
+}
+
+GTEST_TEST(FCL_BROADPHASE_PAIR_CACHE, events_dynamic_AABB_tree)
+{
+  DynamicAABBTreeCollisionManager<double> manager;
+  test_pair_cache_events<double>(&manager);
+}
+
+GTEST_TEST(FCL_BROADPHASE_PAIR_CACHE, events_SaP)
+{
+  SaPCollisionManager<double> manager;
+  test_pair_cache_events<double>(&manager);
+}
+
+//==============================================================================
+int main(int argc, char* argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
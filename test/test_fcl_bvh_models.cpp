@@ -37,6 +37,7 @@
 #include <gtest/gtest.h>
 
 #include "fcl/config.h"
+#include "fcl/math/bv/utility.h"
 #include "fcl/geometry/bvh/BVH_model.h"
 #include "test_fcl_utility.h"
 #include <iostream>
@@ -221,6 +222,63 @@ GTEST_TEST(FCL_BVH_MODELS, building_bvh_models)
   testBVHModel<KDOP<double, 16> >();
   testBVHModel<KDOP<double, 18> >();
   testBVHModel<KDOP<double, 24> >();
+  testBVHModel<FloatOBBRSS<double>>();
+}
+
+//==============================================================================
+template <typename S>
+void testFloatOBBRSSConservative()
+{
+  S extents[] = {-1000, -1000, -1000, 1000, 1000, 1000};
+  aligned_vector<Transform3<S>> transforms;
+  test::generateRandomTransforms(extents, transforms, 100);
+
+  for (const auto& tf : transforms)
+  {
+    std::vector<Vector3<S>> points(10);
+    for (auto& p : points)
+      p = tf * Vector3<S>(test::rand_interval<S>(-1, 1),
+                          test::rand_interval<S>(-0.1, 0.1),
+                          test::rand_interval<S>(-0.01, 0.01));
+
+    OBBRSS<S> bv;
+    fit(points.data(), static_cast<int>(points.size()), bv);
+    const FloatOBBRSS<S> fbv(bv);
+    const OBB<S> obb = fbv.toOBB();
+    const RSS<S> rss = fbv.toRSS();
+
+    // Whatever the original volume contains, the rounded one contains too
+    for (int i = 0; i < 1000; ++i)
+    {
+      const Vector3<S> p = tf * Vector3<S>(test::rand_interval<S>(-1.1, 1.1),
+                                           test::rand_interval<S>(-0.2, 0.2),
+                                           test::rand_interval<S>(-0.1, 0.1));
+      if (bv.obb.contain(p))
+      {
+        EXPECT_TRUE(obb.contain(p));
+      }
+      if (bv.rss.contain(p))
+      {
+        EXPECT_TRUE(rss.contain(p));
+      }
+    }
+  }
+}
+
+GTEST_TEST(FCL_BVH_MODELS, float_obbrss_is_conservative)
+{
+  EXPECT_LT(sizeof(FloatOBBRSS<double>), sizeof(OBBRSS<double>));
+
+  testFloatOBBRSSConservative<double>();
+}
+
+//==============================================================================
+GTEST_TEST(FCL_BVH_MODELS, float_obbrss_node_type)
+{
+  EXPECT_EQ(BVHModel<FloatOBBRSS<double>>().getNodeType(), BV_FLOAT_OBBRSS);
+
+  // The node type is appended after the existing ones
+  EXPECT_EQ(BV_FLOAT_OBBRSS, GEOM_OCTREE + 1);
 }
 
 //==============================================================================
@@ -38,6 +38,7 @@
 #include <gtest/gtest.h>
 
 #include "fcl/math/bv/utility.h"
+#include "fcl/geometry/geometric_shape_to_BVH_model.h"
 #include "fcl/narrowphase/collision.h"
 #include "fcl/narrowphase/detail/gjk_solver_indep.h"
 #include "fcl/narrowphase/detail/gjk_solver_libccd.h"
@@ -824,6 +825,30 @@ void test_mesh_mesh()
       EXPECT_TRUE(global_pairs<S>()[j].b1 == global_pairs_now<S>()[j].b1);
       EXPECT_TRUE(global_pairs<S>()[j].b2 == global_pairs_now<S>()[j].b2);
     }
+
+    collide_Test_Oriented<FloatOBBRSS<S>, detail::MeshCollisionTraversalNodeFloatOBBRSS<S>>(transforms[i], p1, t1, p2, t2, detail::SPLIT_METHOD_MEAN, verbose);
+    EXPECT_TRUE(global_pairs<S>().size() == global_pairs_now<S>().size());
+    for(std::size_t j = 0; j < global_pairs<S>().size(); ++j)
+    {
+      EXPECT_TRUE(global_pairs<S>()[j].b1 == global_pairs_now<S>()[j].b1);
+      EXPECT_TRUE(global_pairs<S>()[j].b2 == global_pairs_now<S>()[j].b2);
+    }
+
+    collide_Test_Oriented<FloatOBBRSS<S>, detail::MeshCollisionTraversalNodeFloatOBBRSS<S>>(transforms[i], p1, t1, p2, t2, detail::SPLIT_METHOD_BV_CENTER, verbose);
+    EXPECT_TRUE(global_pairs<S>().size() == global_pairs_now<S>().size());
+    for(std::size_t j = 0; j < global_pairs<S>().size(); ++j)
+    {
+      EXPECT_TRUE(global_pairs<S>()[j].b1 == global_pairs_now<S>()[j].b1);
+      EXPECT_TRUE(global_pairs<S>()[j].b2 == global_pairs_now<S>()[j].b2);
+    }
+
+    test_collide_func<FloatOBBRSS<S>>(transforms[i], p1, t1, p2, t2, detail::SPLIT_METHOD_MEAN);
+    EXPECT_TRUE(global_pairs<S>().size() == global_pairs_now<S>().size());
+    for(std::size_t j = 0; j < global_pairs<S>().size(); ++j)
+    {
+      EXPECT_TRUE(global_pairs<S>()[j].b1 == global_pairs_now<S>()[j].b1);
+      EXPECT_TRUE(global_pairs<S>()[j].b2 == global_pairs_now<S>()[j].b2);
+    }
   }
 }
 
@@ -854,6 +879,145 @@ GTEST_TEST(FCL_COLLISION, mesh_mesh)
   test_mesh_mesh<double>();
 }
 
+template <typename BV, typename TraversalNode, typename Model>
+void test_mesh_shape_leaf_clusters_single(Model& model)
+{
+  using S = typename BV::S;
+
+  Capsule<S> capsule(0.1, 0.4);
+  detail::GJKSolver_libccd<S> solver;
+
+  Transform3<S> tf_mesh = Transform3<S>::Identity();
+  S extents[] = {-1.2, -1.2, -1.2, 1.2, 1.2, 1.2};
+  aligned_vector<Transform3<S>> transforms;
+  test::generateRandomTransforms(extents, transforms, 200);
+
+  for(const auto& tf : transforms)
+  {
+    CollisionRequest<S> request(100, true);
+
+    // Reference: test every triangle on its own.
+    CollisionResult<S> expected;
+    TraversalNode node_single;
+    EXPECT_TRUE(detail::initialize(node_single, model, tf_mesh,
+                                   capsule, tf, &solver, request, expected));
+    node_single.leaf_cluster_size = 1;
+    detail::collide(&node_single);
+
+    // Small subtrees are processed as clusters of triangles.
+    CollisionResult<S> result;
+    TraversalNode node_cluster;
+    EXPECT_TRUE(detail::initialize(node_cluster, model, tf_mesh,
+                                   capsule, tf, &solver, request, result));
+    detail::collide(&node_cluster);
+
+    EXPECT_EQ(expected.isCollision(), result.isCollision());
+    GTEST_ASSERT_EQ(expected.numContacts(), result.numContacts());
+
+    std::vector<Contact<S>> expected_contacts;
+    std::vector<Contact<S>> contacts;
+    expected.getContacts(expected_contacts);
+    result.getContacts(contacts);
+    std::sort(expected_contacts.begin(), expected_contacts.end());
+    std::sort(contacts.begin(), contacts.end());
+    for(std::size_t i = 0; i < contacts.size(); ++i)
+    {
+      EXPECT_EQ(expected_contacts[i].b1, contacts[i].b1);
+      EXPECT_TRUE(expected_contacts[i].pos.isApprox(contacts[i].pos));
+      EXPECT_NEAR(expected_contacts[i].penetration_depth,
+                  contacts[i].penetration_depth, 1e-9);
+    }
+
+    EXPECT_LE(node_cluster.num_leaf_tests, node_single.num_leaf_tests);
+  }
+}
+
+template <typename S>
+void test_mesh_shape_leaf_clusters()
+{
+  Sphere<S> sphere(1);
+
+  BVHModel<OBBRSS<S>> model_obbrss;
+  generateBVHModel(model_obbrss, sphere, Transform3<S>::Identity(), 32, 32);
+  test_mesh_shape_leaf_clusters_single<
+      OBBRSS<S>,
+      detail::MeshShapeCollisionTraversalNodeOBBRSS<
+          Capsule<S>, detail::GJKSolver_libccd<S>>>(
+      static_cast<const BVHModel<OBBRSS<S>>&>(model_obbrss));
+
+  BVHModel<AABB<S>> model_aabb;
+  generateBVHModel(model_aabb, sphere, Transform3<S>::Identity(), 32, 32);
+  test_mesh_shape_leaf_clusters_single<
+      AABB<S>,
+      detail::MeshShapeCollisionTraversalNode<
+          AABB<S>, Capsule<S>, detail::GJKSolver_libccd<S>>>(model_aabb);
+}
+
+GTEST_TEST(FCL_COLLISION, mesh_shape_leaf_clusters)
+{
+  test_mesh_shape_leaf_clusters<double>();
+}
+
+template <typename S>
+void test_query_statistics()
+{
+  auto mesh = std::make_shared<BVHModel<OBBRSS<S>>>();
+  generateBVHModel(*mesh, Sphere<S>(1), Transform3<S>::Identity(), 16, 16);
+  auto box = std::make_shared<Box<S>>(0.5, 0.5, 0.5);
+  auto ellipsoid = std::make_shared<Ellipsoid<S>>(0.3, 0.4, 0.5);
+
+  CollisionObject<S> mesh_object(mesh);
+  CollisionObject<S> box_object(
+      box, Transform3<S>(Translation3<S>(Vector3<S>(0.9, 0, 0))));
+  CollisionObject<S> ellipsoid_object(
+      ellipsoid, Transform3<S>(Translation3<S>(Vector3<S>(0.8, 0.1, 0.2))));
+
+  // Nothing is recorded unless requested.
+  CollisionRequest<S> request;
+  CollisionResult<S> result;
+  collide(&mesh_object, &box_object, request, result);
+  EXPECT_TRUE(result.isCollision());
+  EXPECT_EQ(result.statistics.num_queries, 0u);
+  EXPECT_EQ(result.statistics.num_bv_tests, 0u);
+
+  for(GJKSolverType solver_type : {GST_LIBCCD, GST_INDEP})
+  {
+    request.gjk_solver_type = solver_type;
+    request.enable_statistics = true;
+    request.enable_contact = true;
+    request.num_max_contacts = 100;
+    result.clear();
+
+    collide(&mesh_object, &box_object, request, result);
+    EXPECT_TRUE(result.isCollision());
+    EXPECT_EQ(result.statistics.num_queries, 1u);
+    EXPECT_GT(result.statistics.num_bv_tests, 0u);
+    EXPECT_GT(result.statistics.num_leaf_tests, 0u);
+    EXPECT_GE(result.statistics.time_seconds, 0.0);
+
+    // The statistics of later queries into the same result are added up.
+    const QueryStatistics mesh_statistics = result.statistics;
+    collide(&box_object, &ellipsoid_object, request, result);
+    EXPECT_TRUE(result.isCollision());
+    EXPECT_EQ(result.statistics.num_queries, 2u);
+    EXPECT_EQ(result.statistics.num_bv_tests, mesh_statistics.num_bv_tests);
+
+    // libccd intersects shapes with MPR, which runs inside libccd itself.
+    if(solver_type == GST_INDEP)
+    {
+      EXPECT_GT(result.statistics.num_gjk_iterations,
+                mesh_statistics.num_gjk_iterations);
+      EXPECT_GT(result.statistics.num_epa_iterations,
+                mesh_statistics.num_epa_iterations);
+    }
+  }
+}
+
+GTEST_TEST(FCL_COLLISION, query_statistics)
+{
+  test_query_statistics<double>();
+}
+
 template<typename BV>
 bool collide_Test2(const Transform3<typename BV::S>& tf,
                    const std::vector<Vector3<typename BV::S>>& vertices1, const std::vector<Triangle>& triangles1,
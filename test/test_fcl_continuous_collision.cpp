@@ -0,0 +1,529 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "fcl/geometry/bvh/BVH_model.h"
+#include "fcl/geometry/geometric_shape_to_BVH_model.h"
+#include "fcl/geometry/shape/box.h"
+#include "fcl/geometry/shape/sphere.h"
+#include "fcl/narrowphase/continuous_collision.h"
+#include "fcl/narrowphase/detail/conservative_advancement_func_matrix.h"
+#include "fcl/narrowphase/detail/convexity_based_algorithm/gjk_raycast.h"
+#include "fcl/narrowphase/trajectory_collision.h"
+
+using namespace fcl;
+
+//==============================================================================
+template <typename S>
+S ccdTimeOfContact(const CollisionObject<S>& o1, const Transform3<S>& tf1_end,
+                   const CollisionObject<S>& o2, const Transform3<S>& tf2_end,
+                   CCDMotionType motion_type, CCDSolverType solver_type,
+                   bool& is_collide)
+{
+  ContinuousCollisionRequest<S> request(1000, 1e-4, motion_type, GST_LIBCCD,
+                                        solver_type);
+  ContinuousCollisionResult<S> result;
+  continuousCollide(&o1, tf1_end, &o2, tf2_end, request, result);
+  is_collide = result.is_collide;
+
+  return result.time_of_contact;
+}
+
+//==============================================================================
+template <typename S>
+void test_adaptive_bisection_translation()
+{
+  auto sphere = std::make_shared<Sphere<S>>(1);
+
+  Transform3<S> tf1_beg = Transform3<S>::Identity();
+  tf1_beg.translation() = Vector3<S>(-5, 0, 0);
+  Transform3<S> tf1_end = Transform3<S>::Identity();
+  tf1_end.translation() = Vector3<S>(5, 0, 0);
+
+  CollisionObject<S> o1(sphere, tf1_beg);
+  CollisionObject<S> o2(sphere, Transform3<S>::Identity());
+
+  // The spheres touch when the moving one has travelled 3 of 10 units
+  bool is_collide;
+  S toc = ccdTimeOfContact(o1, tf1_end, o2, Transform3<S>::Identity(),
+                           CCDM_TRANS, CCDC_ADAPTIVE_BISECTION, is_collide);
+  EXPECT_TRUE(is_collide);
+  EXPECT_NEAR(toc, 0.3, 1e-3);
+
+  S naive_toc = ccdTimeOfContact(o1, tf1_end, o2, Transform3<S>::Identity(),
+                                 CCDM_TRANS, CCDC_NAIVE, is_collide);
+  EXPECT_TRUE(is_collide);
+  EXPECT_LE(toc, naive_toc);
+
+  // Passing beside the static sphere
+  CollisionObject<S> o3(sphere, Transform3<S>(Translation3<S>(Vector3<S>(0, 3, 0))));
+  toc = ccdTimeOfContact(o1, tf1_end, o3, o3.getTransform(),
+                         CCDM_TRANS, CCDC_ADAPTIVE_BISECTION, is_collide);
+  EXPECT_FALSE(is_collide);
+  EXPECT_EQ(toc, 1);
+
+  // In contact from the start
+  CollisionObject<S> o4(sphere, Transform3<S>(Translation3<S>(Vector3<S>(-4, 0, 0))));
+  toc = ccdTimeOfContact(o1, tf1_end, o4, o4.getTransform(),
+                         CCDM_TRANS, CCDC_ADAPTIVE_BISECTION, is_collide);
+  EXPECT_TRUE(is_collide);
+  EXPECT_EQ(toc, 0);
+}
+
+//==============================================================================
+template <typename S>
+void test_adaptive_bisection_rotation(CCDMotionType motion_type)
+{
+  // A long bar sweeping a quarter turn about its center hits a small sphere
+  auto bar = std::make_shared<Box<S>>(10, 0.2, 0.2);
+  auto sphere = std::make_shared<Sphere<S>>(0.5);
+
+  Transform3<S> tf1_end = Transform3<S>::Identity();
+  tf1_end.linear() = AngleAxis<S>(constants<S>::pi() / 2, Vector3<S>::UnitZ()).toRotationMatrix();
+
+  CollisionObject<S> o1(bar, Transform3<S>::Identity());
+  CollisionObject<S> o2(sphere, Transform3<S>(Translation3<S>(Vector3<S>(2, 3, 0))));
+
+  bool is_collide;
+  S toc = ccdTimeOfContact(o1, tf1_end, o2, o2.getTransform(),
+                           motion_type, CCDC_ADAPTIVE_BISECTION, is_collide);
+  EXPECT_TRUE(is_collide);
+
+  S naive_toc = ccdTimeOfContact(o1, tf1_end, o2, o2.getTransform(),
+                                 motion_type, CCDC_NAIVE, is_collide);
+  EXPECT_TRUE(is_collide);
+  EXPECT_LE(toc, naive_toc);
+  EXPECT_NEAR(toc, naive_toc, 2e-3);
+}
+
+//==============================================================================
+template <typename BV>
+void test_polynomial_solver_mesh()
+{
+  using S = typename BV::S;
+
+  auto mesh1 = std::make_shared<BVHModel<BV>>();
+  auto mesh2 = std::make_shared<BVHModel<BV>>();
+  generateBVHModel(*mesh1, Box<S>(1, 1, 1), Transform3<S>::Identity());
+  generateBVHModel(*mesh2, Box<S>(2, 2, 2), Transform3<S>::Identity());
+  const std::vector<Vector3<S>> vertices1(
+        mesh1->vertices, mesh1->vertices + mesh1->num_vertices);
+
+  Transform3<S> tf1_beg = Transform3<S>::Identity();
+  tf1_beg.translation() = Vector3<S>(-4, 0, 0);
+  Transform3<S> tf1_end = Transform3<S>::Identity();
+  tf1_end.translation() = Vector3<S>(4, 0, 0);
+
+  // The small box hits the face of the large one after 2.5 of 8 units
+  for(unsigned int num_threads : {1u, 2u})
+  {
+    ContinuousCollisionRequest<S> request(1000, 1e-4, CCDM_TRANS, GST_LIBCCD,
+                                          CCDC_POLYNOMIAL_SOLVER, num_threads);
+    ContinuousCollisionResult<S> result;
+    continuousCollide(mesh1.get(), tf1_beg, tf1_end,
+                      mesh2.get(), Transform3<S>::Identity(), Transform3<S>::Identity(),
+                      request, result);
+    EXPECT_TRUE(result.is_collide);
+    EXPECT_NEAR(result.time_of_contact, 0.3125, 1e-6);
+    EXPECT_NEAR(result.contact_tf1.translation()[0], -1.5, 1e-5);
+  }
+
+  // The query does not modify the models
+  EXPECT_EQ(mesh1->build_state, BVH_BUILD_STATE_PROCESSED);
+  EXPECT_EQ(mesh1->prev_vertices, nullptr);
+  for(int i = 0; i < mesh1->num_vertices; ++i)
+    EXPECT_EQ(mesh1->vertices[i], vertices1[i]);
+
+  // Passing beside the large box
+  Transform3<S> tf1_side_beg = tf1_beg;
+  Transform3<S> tf1_side_end = tf1_end;
+  tf1_side_beg.translation()[1] = 2;
+  tf1_side_end.translation()[1] = 2;
+  ContinuousCollisionRequest<S> request(1000, 1e-4, CCDM_TRANS, GST_LIBCCD,
+                                        CCDC_POLYNOMIAL_SOLVER);
+  ContinuousCollisionResult<S> result;
+  continuousCollide(mesh1.get(), tf1_side_beg, tf1_side_end,
+                    mesh2.get(), Transform3<S>::Identity(), Transform3<S>::Identity(),
+                    request, result);
+  EXPECT_FALSE(result.is_collide);
+  EXPECT_EQ(result.time_of_contact, 1);
+
+  // A model that was just updated deforms from its previous vertices to the
+  // current ones
+  std::vector<Vector3<S>> moved(vertices1);
+  for(auto& v : moved)
+    v += Vector3<S>(-4, 0, 0);
+  mesh1->beginUpdateModel();
+  mesh1->updateSubModel(moved);
+  mesh1->endUpdateModel(true, true);
+  for(auto& v : moved)
+    v += Vector3<S>(8, 0, 0);
+  mesh1->beginUpdateModel();
+  mesh1->updateSubModel(moved);
+  mesh1->endUpdateModel(true, true);
+
+  continuousCollide(mesh1.get(), Transform3<S>::Identity(), Transform3<S>::Identity(),
+                    mesh2.get(), Transform3<S>::Identity(), Transform3<S>::Identity(),
+                    request, result);
+  EXPECT_TRUE(result.is_collide);
+  EXPECT_NEAR(result.time_of_contact, 0.3125, 1e-6);
+}
+
+//==============================================================================
+template <typename S>
+void test_ray_shooting()
+{
+  auto sphere = std::make_shared<Sphere<S>>(1);
+  auto box = std::make_shared<Box<S>>(2, 2, 2);
+
+  Transform3<S> tf1_beg = Transform3<S>::Identity();
+  tf1_beg.translation() = Vector3<S>(-5, 0, 0);
+  Transform3<S> tf1_end = Transform3<S>::Identity();
+  tf1_end.translation() = Vector3<S>(5, 0, 0);
+
+  ContinuousCollisionRequest<S> request(10, 1e-4, CCDM_TRANS, GST_LIBCCD,
+                                        CCDC_RAY_SHOOTING);
+  ContinuousCollisionResult<S> result;
+
+  // Sphere against sphere: contact after 3 of 10 units
+  continuousCollide(sphere.get(), tf1_beg, tf1_end,
+                    sphere.get(), Transform3<S>::Identity(), Transform3<S>::Identity(),
+                    request, result);
+  EXPECT_TRUE(result.is_collide);
+  EXPECT_NEAR(result.time_of_contact, 0.3, 1e-4);
+  EXPECT_LE(result.time_of_contact, 0.3);
+  EXPECT_TRUE(result.contact_point.isApprox(Vector3<S>(-1, 0, 0), 1e-3));
+  EXPECT_TRUE(result.contact_normal.isApprox(Vector3<S>(1, 0, 0), 1e-3));
+  EXPECT_NEAR(result.contact_tf1.translation()[0], -2, 1e-3);
+
+  // Box against a rotated box, both moving; the corner of the second box
+  // points at the face of the first one
+  Transform3<S> tf2_beg = Transform3<S>::Identity();
+  tf2_beg.linear() = AngleAxis<S>(constants<S>::pi() / 4, Vector3<S>::UnitZ()).toRotationMatrix();
+  tf2_beg.translation() = Vector3<S>(2, 0, 0);
+  Transform3<S> tf2_end = tf2_beg;
+  tf2_end.translation() = Vector3<S>(0, 0, 0);
+  continuousCollide(box.get(), tf1_beg, tf1_end,
+                    box.get(), tf2_beg, tf2_end,
+                    request, result);
+  // The gap of 6 - sqrt(2) closes at 12 units per unit time
+  const S expected = (6 - std::sqrt(S(2))) / 12;
+  EXPECT_TRUE(result.is_collide);
+  EXPECT_NEAR(result.time_of_contact, expected, 1e-4);
+  EXPECT_TRUE(result.contact_normal.isApprox(Vector3<S>(1, 0, 0), 1e-3));
+  EXPECT_NEAR(result.contact_point[0], -5 + 10 * expected + 1, 1e-3);
+  EXPECT_NEAR(result.contact_point[1], 0, 1e-3);
+
+  // Passing beside the sphere
+  Transform3<S> tf2 = Transform3<S>::Identity();
+  tf2.translation() = Vector3<S>(0, 3, 0);
+  continuousCollide(sphere.get(), tf1_beg, tf1_end,
+                    sphere.get(), tf2, tf2,
+                    request, result);
+  EXPECT_FALSE(result.is_collide);
+  EXPECT_EQ(result.time_of_contact, 1);
+
+  // Stopping short of the sphere
+  Transform3<S> tf1_short = Transform3<S>::Identity();
+  tf1_short.translation() = Vector3<S>(-2.5, 0, 0);
+  continuousCollide(sphere.get(), tf1_beg, tf1_short,
+                    sphere.get(), Transform3<S>::Identity(), Transform3<S>::Identity(),
+                    request, result);
+  EXPECT_FALSE(result.is_collide);
+
+  // In contact from the start
+  continuousCollide(box.get(), tf1_end, tf1_end,
+                    sphere.get(), tf1_end, tf1_end,
+                    request, result);
+  EXPECT_TRUE(result.is_collide);
+  EXPECT_EQ(result.time_of_contact, 0);
+
+  // Grazing past the sphere: running out of iterations before the ray
+  // reaches the difference is not a contact
+  for(unsigned int max_iterations = 1; max_iterations < 4; ++max_iterations)
+  {
+    S toc;
+    Vector3<S> point, normal;
+    EXPECT_FALSE(detail::gjkRaycast<S>(
+                   *sphere, tf1_beg, Vector3<S>(10, 0, 0),
+                   *sphere, Transform3<S>(Translation3<S>(Vector3<S>(0, 2.001, 0))),
+                   Vector3<S>::Zero(), S(1e-6), max_iterations,
+                   &toc, &point, &normal));
+  }
+}
+
+//==============================================================================
+template <typename S>
+ContinuousCollisionResult<S> conservativeAdvancement(
+    const CollisionObject<S>& o1, const Transform3<S>& tf1_end,
+    const CollisionObject<S>& o2, const Transform3<S>& tf2_end,
+    CCDMotionType motion_type)
+{
+  ContinuousCollisionRequest<S> request(10, 1e-4, motion_type, GST_INDEP,
+                                        CCDC_CONSERVATIVE_ADVANCEMENT);
+  ContinuousCollisionResult<S> result;
+  continuousCollide(&o1, tf1_end, &o2, tf2_end, request, result);
+
+  return result;
+}
+
+//==============================================================================
+template <typename BV>
+void test_conservative_advancement_mesh_shape()
+{
+  using S = typename BV::S;
+
+  auto box = std::make_shared<Box<S>>(1, 1, 1);
+  auto sphere = std::make_shared<Sphere<S>>(1);
+  auto mesh = std::make_shared<BVHModel<BV>>();
+  generateBVHModel(*mesh, *box, Transform3<S>::Identity());
+
+  Transform3<S> tf1_beg = Transform3<S>::Identity();
+  tf1_beg.translation() = Vector3<S>(-5, 0, 0);
+  Transform3<S> tf1_end = Transform3<S>::Identity();
+  tf1_end.translation() = Vector3<S>(5, 0, 0);
+
+  CollisionObject<S> box_obj(box, tf1_beg);
+  CollisionObject<S> mesh_obj(mesh, tf1_beg);
+  CollisionObject<S> sphere_obj(sphere, Transform3<S>::Identity());
+
+  // The box touches the sphere when it has travelled 3.5 of 10 units
+  const auto shape_result = conservativeAdvancement(
+        box_obj, tf1_end, sphere_obj, Transform3<S>::Identity(), CCDM_TRANS);
+  EXPECT_TRUE(shape_result.is_collide);
+  EXPECT_NEAR(shape_result.time_of_contact, 0.35, 1e-3);
+  EXPECT_GT(shape_result.num_iterations, 0u);
+  EXPECT_GE(shape_result.computation_time, 0);
+
+  const auto mesh_result = conservativeAdvancement(
+        mesh_obj, tf1_end, sphere_obj, Transform3<S>::Identity(), CCDM_TRANS);
+  EXPECT_TRUE(mesh_result.is_collide);
+  EXPECT_NEAR(mesh_result.time_of_contact, 0.35, 1e-3);
+  EXPECT_GT(mesh_result.num_iterations, 0u);
+
+  const auto reversed_result = conservativeAdvancement(
+        sphere_obj, Transform3<S>::Identity(), mesh_obj, tf1_end, CCDM_TRANS);
+  EXPECT_TRUE(reversed_result.is_collide);
+  EXPECT_NEAR(reversed_result.time_of_contact, 0.35, 1e-3);
+
+  // The cached guess state of the caller's solver is left untouched
+  detail::GJKSolver_indep<S> solver;
+  solver.enableCachedGuess(true);
+  solver.setCachedGuess(Vector3<S>(0, 0, 1));
+  TranslationMotion<S> motion1(tf1_beg, tf1_end);
+  TranslationMotion<S> motion2(Transform3<S>::Identity(), Transform3<S>::Identity());
+  CollisionRequest<S> collision_request;
+  CollisionResult<S> collision_result;
+  S toc;
+  EXPECT_TRUE((detail::conservativeAdvancement<BV, Sphere<S>, detail::GJKSolver_indep<S>>(
+                *mesh, &motion1, *sphere, &motion2, &solver,
+                collision_request, collision_result, toc)));
+  EXPECT_TRUE(solver.isCachedGuessEnabled());
+  EXPECT_TRUE(solver.getCachedGuess().isApprox(Vector3<S>(0, 0, 1)));
+
+  // A rotating motion, for which CA needs many iterations
+  Transform3<S> tf2_end = Transform3<S>::Identity();
+  tf2_end.linear() = AngleAxis<S>(constants<S>::pi() / 2, Vector3<S>::UnitZ()).toRotationMatrix();
+  auto bar = std::make_shared<Box<S>>(10, 0.2, 0.2);
+  auto bar_mesh = std::make_shared<BVHModel<BV>>();
+  generateBVHModel(*bar_mesh, *bar, Transform3<S>::Identity());
+  CollisionObject<S> bar_obj(bar, Transform3<S>::Identity());
+  CollisionObject<S> bar_mesh_obj(bar_mesh, Transform3<S>::Identity());
+  CollisionObject<S> small_sphere_obj(
+        std::make_shared<Sphere<S>>(0.5),
+        Transform3<S>(Translation3<S>(Vector3<S>(2, 3, 0))));
+
+  const auto bar_result = conservativeAdvancement(
+        bar_obj, tf2_end, small_sphere_obj, small_sphere_obj.getTransform(),
+        CCDM_SCREW);
+  const auto bar_mesh_result = conservativeAdvancement(
+        bar_mesh_obj, tf2_end, small_sphere_obj, small_sphere_obj.getTransform(),
+        CCDM_SCREW);
+  EXPECT_TRUE(bar_result.is_collide);
+  EXPECT_TRUE(bar_mesh_result.is_collide);
+  EXPECT_NEAR(bar_result.time_of_contact, bar_mesh_result.time_of_contact, 1e-3);
+  EXPECT_GT(bar_mesh_result.num_iterations, 1u);
+
+  bool is_collide;
+  const S naive_toc = ccdTimeOfContact(
+        bar_obj, tf2_end, small_sphere_obj, small_sphere_obj.getTransform(),
+        CCDM_SCREW, CCDC_NAIVE, is_collide);
+  EXPECT_LE(bar_result.time_of_contact, naive_toc);
+  EXPECT_NEAR(bar_result.time_of_contact, naive_toc, 2e-3);
+}
+
+//==============================================================================
+template <typename S>
+void test_indep_shape_triangle_distance_world_frame()
+{
+  // A unit box rotated about z and moved to x = 10, and a triangle in the
+  // plane x = 12 given in the world frame
+  Box<S> box(2, 2, 2);
+  Transform3<S> tf = Transform3<S>::Identity();
+  tf.linear() = AngleAxis<S>(constants<S>::pi() / 2, Vector3<S>::UnitZ()).toRotationMatrix();
+  tf.translation() = Vector3<S>(10, 0, 0);
+  const Vector3<S> P1(12, -1, -1);
+  const Vector3<S> P2(12, 1, -1);
+  const Vector3<S> P3(12, 0, 1);
+
+  detail::GJKSolver_indep<S> solver;
+  S dist;
+  Vector3<S> p1, p2;
+  EXPECT_TRUE(solver.shapeTriangleDistance(box, tf, P1, P2, P3, &dist, &p1, &p2));
+  EXPECT_NEAR(dist, 1, 1e-6);
+
+  // Both points are in the world frame: p1 on the face of the box at x = 11,
+  // p2 on the triangle
+  EXPECT_NEAR(p1[0], 11, 1e-6);
+  EXPECT_NEAR(p2[0], 12, 1e-6);
+  EXPECT_NEAR((p1 - p2).norm(), dist, 1e-6);
+  EXPECT_LE(std::abs(p1[1]), 1 + 1e-6);
+  EXPECT_LE(std::abs(p1[2]), 1 + 1e-6);
+}
+
+//==============================================================================
+template <typename S>
+void test_trajectory_collision()
+{
+  auto sphere = std::make_shared<Sphere<S>>(1);
+  sphere->computeLocalAABB();
+
+  // The moving sphere reaches the static one during segment 2, still overlaps
+  // it at the start of segment 3 and is clear of it in the other segments
+  aligned_vector<Transform3<S>> waypoints1;
+  for(int i = 0; i < 6; ++i)
+    waypoints1.push_back(Transform3<S>(Translation3<S>(Vector3<S>(-11 + 4 * i, 0, 0))));
+  aligned_vector<Transform3<S>> waypoints2(1, Transform3<S>::Identity());
+
+  TrajectoryCollisionRequest<S> request(ContinuousCollisionRequest<S>(
+      1000, 1e-4, CCDM_TRANS, GST_LIBCCD, CCDC_ADAPTIVE_BISECTION));
+  TrajectoryCollisionResult<S> result;
+
+  EXPECT_EQ(collideTrajectory(sphere.get(), waypoints1, sphere.get(), waypoints2,
+                              request, result), 1u);
+  EXPECT_TRUE(result.isCollision());
+  EXPECT_EQ(result.segments[0], 2u);
+  EXPECT_NEAR(result.times_of_contact[0], 0.25, 1e-3);
+
+  request.find_all_segments = true;
+  collideTrajectory(sphere.get(), waypoints1, sphere.get(), waypoints2,
+                    request, result);
+  EXPECT_EQ(result.segments, std::vector<std::size_t>({2, 3}));
+  EXPECT_EQ(result.times_of_contact[1], 0);
+  EXPECT_EQ(result.num_culled_segments, 3u);
+
+  // Same trajectory, given by one motion per segment and checked in parallel
+  std::vector<MotionBasePtr<S>> motions1;
+  std::vector<MotionBasePtr<S>> motions2;
+  for(std::size_t i = 0; i + 1 < waypoints1.size(); ++i)
+  {
+    motions1.push_back(getMotionBase(waypoints1[i], waypoints1[i + 1], CCDM_TRANS));
+    motions2.push_back(getMotionBase(waypoints2[0], waypoints2[0], CCDM_TRANS));
+  }
+
+  for(unsigned int num_threads : {1u, 4u})
+  {
+    request.num_threads = num_threads;
+
+    TrajectoryCollisionResult<S> motion_result;
+    collideTrajectory(sphere.get(), motions1, sphere.get(), motions2,
+                      request, motion_result);
+    EXPECT_EQ(motion_result.segments, result.segments);
+    EXPECT_EQ(motion_result.times_of_contact, result.times_of_contact);
+    EXPECT_EQ(motion_result.num_culled_segments, result.num_culled_segments);
+  }
+
+  // Trajectories of different lengths are rejected
+  waypoints2.resize(3, Transform3<S>::Identity());
+  EXPECT_EQ(collideTrajectory(sphere.get(), waypoints1, sphere.get(), waypoints2,
+                              request, result), 0u);
+  EXPECT_FALSE(result.isCollision());
+}
+
+//==============================================================================
+GTEST_TEST(FCL_CONTINUOUS_COLLISION, adaptive_bisection_translation)
+{
+  test_adaptive_bisection_translation<double>();
+}
+
+//==============================================================================
+GTEST_TEST(FCL_CONTINUOUS_COLLISION, adaptive_bisection_rotation)
+{
+  test_adaptive_bisection_rotation<double>(CCDM_LINEAR);
+  test_adaptive_bisection_rotation<double>(CCDM_SCREW);
+}
+
+//==============================================================================
+GTEST_TEST(FCL_CONTINUOUS_COLLISION, polynomial_solver_mesh)
+{
+  test_polynomial_solver_mesh<AABB<double>>();
+  test_polynomial_solver_mesh<OBBRSS<double>>();
+}
+
+//==============================================================================
+GTEST_TEST(FCL_CONTINUOUS_COLLISION, ray_shooting)
+{
+  test_ray_shooting<double>();
+}
+
+//==============================================================================
+GTEST_TEST(FCL_CONTINUOUS_COLLISION, conservative_advancement_mesh_shape)
+{
+  test_conservative_advancement_mesh_shape<AABB<double>>();
+  test_conservative_advancement_mesh_shape<OBBRSS<double>>();
+}
+
+//==============================================================================
+GTEST_TEST(FCL_CONTINUOUS_COLLISION, indep_shape_triangle_distance_world_frame)
+{
+  test_indep_shape_triangle_distance_world_frame<double>();
+}
+
+//==============================================================================
+GTEST_TEST(FCL_CONTINUOUS_COLLISION, trajectory_collision)
+{
+  test_trajectory_collision<double>();
+}
+
+//==============================================================================
+int main(int argc, char* argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
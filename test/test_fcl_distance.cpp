@@ -37,6 +37,7 @@
 
 #include <gtest/gtest.h>
 
+#include "fcl/geometry/geometric_shape_to_BVH_model.h"
 #include "fcl/narrowphase/detail/traversal/collision_node.h"
 #include "test_fcl_utility.h"
 #include "eigen_matrix_compare.h"
@@ -204,6 +205,16 @@ void test_mesh_distance()
     EXPECT_TRUE(fabs(res.distance - res_now.distance) < DELTA<S>());
     EXPECT_TRUE(fabs(res.distance) < DELTA<S>() || (res.distance > 0 && nearlyEqual(res.p1, res_now.p1) && nearlyEqual(res.p2, res_now.p2)));
 
+    distance_Test_Oriented<FloatOBBRSS<S>, detail::MeshDistanceTraversalNodeFloatOBBRSS<S>>(transforms[i], p1, t1, p2, t2, detail::SPLIT_METHOD_MEAN, 2, res_now, verbose);
+
+    EXPECT_TRUE(fabs(res.distance - res_now.distance) < DELTA<S>());
+    EXPECT_TRUE(fabs(res.distance) < DELTA<S>() || (res.distance > 0 && nearlyEqual(res.p1, res_now.p1) && nearlyEqual(res.p2, res_now.p2)));
+
+    distance_Test_Oriented<FloatOBBRSS<S>, detail::MeshDistanceTraversalNodeFloatOBBRSS<S>>(transforms[i], p1, t1, p2, t2, detail::SPLIT_METHOD_MEAN, 20, res_now, verbose);
+
+    EXPECT_TRUE(fabs(res.distance - res_now.distance) < DELTA<S>());
+    EXPECT_TRUE(fabs(res.distance) < DELTA<S>() || (res.distance > 0 && nearlyEqual(res.p1, res_now.p1) && nearlyEqual(res.p2, res_now.p2)));
+
 
 
     distance_Test<RSS<S>>(transforms[i], p1, t1, p2, t2, detail::SPLIT_METHOD_MEAN, 2, res_now, verbose);
@@ -367,6 +378,126 @@ GTEST_TEST(FCL_DISTANCE, NearestPointFromDegenerateSimplex) {
   NearestPointFromDegenerateSimplex<double>();
 }
 
+template <typename S>
+void test_query_statistics()
+{
+  auto mesh = std::make_shared<BVHModel<OBBRSS<S>>>();
+  generateBVHModel(*mesh, Sphere<S>(1), Transform3<S>::Identity(), 16, 16);
+  auto ellipsoid = std::make_shared<Ellipsoid<S>>(0.3, 0.4, 0.5);
+
+  CollisionObject<S> mesh_object(mesh);
+  CollisionObject<S> ellipsoid_object(
+      ellipsoid, Transform3<S>(Translation3<S>(Vector3<S>(1.5, 0.1, 0.2))));
+
+  for(GJKSolverType solver_type : {GST_LIBCCD, GST_INDEP})
+  {
+    DistanceRequest<S> request;
+    request.gjk_solver_type = solver_type;
+    DistanceResult<S> result;
+    distance(&mesh_object, &ellipsoid_object, request, result);
+    EXPECT_EQ(result.statistics.num_queries, 0u);
+    EXPECT_EQ(result.statistics.num_gjk_iterations, 0u);
+
+    request.enable_statistics = true;
+    result.clear();
+    distance(&mesh_object, &ellipsoid_object, request, result);
+    EXPECT_GT(result.min_distance, 0);
+    EXPECT_EQ(result.statistics.num_queries, 1u);
+    EXPECT_GT(result.statistics.num_bv_tests, 0u);
+    EXPECT_GT(result.statistics.num_leaf_tests, 0u);
+    EXPECT_GT(result.statistics.num_gjk_iterations, 0u);
+    EXPECT_EQ(result.statistics.num_epa_iterations, 0u);
+  }
+}
+
+GTEST_TEST(FCL_DISTANCE, query_statistics)
+{
+  test_query_statistics<double>();
+}
+
+template <typename BV>
+void test_approximate_distance()
+{
+  using S = typename BV::S;
+
+  std::vector<Vector3<S>> p1, p2;
+  std::vector<Triangle> t1, t2;
+  test::loadOBJFile(TEST_RESOURCES_DIR"/env.obj", p1, t1);
+  test::loadOBJFile(TEST_RESOURCES_DIR"/rob.obj", p2, t2);
+
+  auto env = std::make_shared<BVHModel<BV>>();
+  env->beginModel();
+  env->addSubModel(p1, t1);
+  env->endModel();
+
+  auto rob = std::make_shared<BVHModel<BV>>();
+  rob->beginModel();
+  rob->addSubModel(p2, t2);
+  rob->endModel();
+
+  auto sphere = std::make_shared<Sphere<S>>(100);
+
+  S extents[] = {-3000, -3000, 0, 3000, 3000, 3000};
+  aligned_vector<Transform3<S>> transforms;
+  test::generateRandomTransforms(extents, transforms, 20);
+
+  CollisionObject<S> env_object(env, transforms.back());
+  for(const auto& tf : transforms)
+  {
+    for(const auto& geometry : {std::shared_ptr<CollisionGeometry<S>>(rob),
+                                std::shared_ptr<CollisionGeometry<S>>(sphere)})
+    {
+      // Mesh-shape distance is only implemented for the oriented volumes
+      if(geometry == sphere && std::is_same<BV, AABB<S>>::value)
+        continue;
+
+      CollisionObject<S> object(geometry, tf);
+
+      // Distance bounds are only defined for separated objects
+      CollisionRequest<S> collision_request;
+      collision_request.gjk_solver_type = GST_INDEP;
+      CollisionResult<S> collision_result;
+      if(collide(&env_object, &object, collision_request, collision_result))
+        continue;
+
+      DistanceRequest<S> request;
+      request.gjk_solver_type = GST_INDEP;
+      DistanceResult<S> exact;
+      distance(&env_object, &object, request, exact);
+      EXPECT_EQ(exact.min_distance_lower_bound, exact.min_distance);
+
+      request.enable_approximate_distance = true;
+      for(S abs_err : {0.0, 1.0, 50.0})
+      {
+        request.abs_err = abs_err;
+        request.rel_err = 0;
+        DistanceResult<S> result;
+        distance(&env_object, &object, request, result);
+        EXPECT_LE(result.min_distance_lower_bound, exact.min_distance + 1e-6);
+        EXPECT_GE(result.min_distance, exact.min_distance - 1e-6);
+        EXPECT_LE(result.min_distance - result.min_distance_lower_bound,
+                  abs_err + 1e-6);
+      }
+
+      request.abs_err = 0;
+      request.rel_err = 0.1;
+      DistanceResult<S> result;
+      distance(&env_object, &object, request, result);
+      EXPECT_LE(result.min_distance_lower_bound, exact.min_distance + 1e-6);
+      EXPECT_GE(result.min_distance, exact.min_distance - 1e-6);
+      EXPECT_LE(result.min_distance,
+                result.min_distance_lower_bound * 1.1 + 1e-6);
+    }
+  }
+}
+
+GTEST_TEST(FCL_DISTANCE, approximate_distance)
+{
+  test_approximate_distance<RSS<double>>();
+  test_approximate_distance<OBBRSS<double>>();
+  test_approximate_distance<AABB<double>>();
+}
+
 template<typename BV, typename TraversalNode>
 void distance_Test_Oriented(const Transform3<typename BV::S>& tf,
                             const std::vector<Vector3<typename BV::S>>& vertices1, const std::vector<Triangle>& triangles1,
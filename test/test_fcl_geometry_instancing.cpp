@@ -0,0 +1,234 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/** @author Jia Pan */
+
+#include <gtest/gtest.h>
+
+#include "fcl/config.h"
+#include "fcl/geometry/bvh/BVH_model.h"
+#include "fcl/narrowphase/collision.h"
+#include "fcl/narrowphase/distance.h"
+#include "test_fcl_utility.h"
+#include "fcl_resources/config.h"
+
+using namespace fcl;
+
+//==============================================================================
+template <typename BV>
+std::shared_ptr<const BVHModel<BV>> loadPrototype(const char* filename)
+{
+  using S = typename BV::S;
+
+  std::vector<Vector3<S>> points;
+  std::vector<Triangle> triangles;
+  test::loadOBJFile(filename, points, triangles);
+
+  auto model = std::make_shared<BVHModel<BV>>();
+  model->beginModel();
+  model->addSubModel(points, triangles);
+  model->endModel();
+
+  return model;
+}
+
+//==============================================================================
+/// Check that queries between instances of shared immutable prototypes agree
+/// with the same queries on OBBRSS models, and leave the prototypes untouched
+template <typename BV>
+void testInstancedMeshes()
+{
+  using S = typename BV::S;
+
+  const auto env = loadPrototype<BV>(TEST_RESOURCES_DIR"/env.obj");
+  const auto rob = loadPrototype<BV>(TEST_RESOURCES_DIR"/rob.obj");
+  const auto env_ref = loadPrototype<OBBRSS<S>>(TEST_RESOURCES_DIR"/env.obj");
+  const auto rob_ref = loadPrototype<OBBRSS<S>>(TEST_RESOURCES_DIR"/rob.obj");
+
+  const std::vector<Vector3<S>> env_vertices(
+      env->vertices, env->vertices + env->num_vertices);
+  std::vector<BV> env_bvs;
+  for(int i = 0; i < env->getNumBVs(); ++i)
+    env_bvs.push_back(env->getBV(i).bv);
+
+  S extents[] = {-3000, -3000, -500, 3000, 3000, 1500};
+  aligned_vector<Transform3<S>> transforms;
+  test::generateRandomTransforms(extents, transforms, 20);
+
+  const Transform3<S> tf_env = transforms.back();
+  CollisionObject<S> env_obj(env, tf_env);
+  CollisionObject<S> env_ref_obj(env_ref, tf_env);
+
+  for(const auto& tf : transforms)
+  {
+    CollisionObject<S> rob_obj(rob, tf);
+    CollisionObject<S> rob_ref_obj(rob_ref, tf);
+    EXPECT_EQ(rob_obj.collisionGeometry(), rob);
+
+    CollisionRequest<S> request(100000, false);
+    CollisionResult<S> expected;
+    CollisionResult<S> result;
+    collide(&env_ref_obj, &rob_ref_obj, request, expected);
+    collide(&env_obj, &rob_obj, request, result);
+    EXPECT_EQ(result.numContacts(), expected.numContacts());
+
+    // Among the axis-aligned volumes only AABB supports distance queries
+    if(expected.isCollision() || !std::is_same<BV, AABB<S>>::value)
+      continue;
+
+    DistanceRequest<S> distance_request;
+    DistanceResult<S> expected_distance;
+    DistanceResult<S> distance_result;
+    distance(&env_ref_obj, &rob_ref_obj, distance_request, expected_distance);
+    distance(&env_obj, &rob_obj, distance_request, distance_result);
+    EXPECT_NEAR(distance_result.min_distance, expected_distance.min_distance,
+                1e-6);
+  }
+
+  for(int i = 0; i < env->num_vertices; ++i)
+    EXPECT_TRUE(env->vertices[i] == env_vertices[i]);
+  for(int i = 0; i < env->getNumBVs(); ++i)
+  {
+    EXPECT_TRUE(env->getBV(i).bv.center() == env_bvs[i].center());
+    EXPECT_EQ(env->getBV(i).bv.size(), env_bvs[i].size());
+  }
+}
+
+//==============================================================================
+template <typename BV, typename Shape>
+void testInstancedMeshShape(const Shape& shape)
+{
+  using S = typename BV::S;
+
+  const auto env = loadPrototype<BV>(TEST_RESOURCES_DIR"/env.obj");
+  const auto env_ref = loadPrototype<OBBRSS<S>>(TEST_RESOURCES_DIR"/env.obj");
+
+  S extents[] = {-3000, -3000, -500, 3000, 3000, 1500};
+  aligned_vector<Transform3<S>> transforms;
+  test::generateRandomTransforms(extents, transforms, 100);
+
+  const Transform3<S> tf_env = transforms.back();
+
+  for(const auto& tf : transforms)
+  {
+    CollisionRequest<S> request(100000, false);
+    request.gjk_solver_type = GST_INDEP;
+    CollisionResult<S> expected;
+    CollisionResult<S> result;
+    CollisionResult<S> swapped;
+    collide(env_ref.get(), tf_env, &shape, tf, request, expected);
+    collide(env.get(), tf_env, &shape, tf, request, result);
+    collide(&shape, tf, env.get(), tf_env, request, swapped);
+    EXPECT_EQ(result.numContacts(), expected.numContacts());
+    EXPECT_EQ(swapped.numContacts(), expected.numContacts());
+  }
+}
+
+//==============================================================================
+GTEST_TEST(FCL_GEOMETRY_INSTANCING, end_model_computes_local_aabb)
+{
+  const auto model = loadPrototype<AABB<double>>(TEST_RESOURCES_DIR"/rob.obj");
+  for(int i = 0; i < model->num_vertices; ++i)
+    EXPECT_TRUE(model->aabb_local.contain(model->vertices[i]));
+  EXPECT_GT(model->aabb_radius, 0);
+
+  // Instances only hold their pose and world AABB
+  Transform3<double> tf = Transform3<double>::Identity();
+  tf.translation() = Vector3<double>(10, 20, 30);
+  CollisionObject<double> obj1(model);
+  CollisionObject<double> obj2(model, tf);
+  EXPECT_EQ(obj1.collisionGeometry(), obj2.collisionGeometry());
+  EXPECT_TRUE(obj1.getAABB().equal(
+      translate(model->aabb_local, Vector3<double>::Zero())));
+  EXPECT_TRUE(obj2.getAABB().equal(translate(model->aabb_local, tf.translation())));
+}
+
+//==============================================================================
+GTEST_TEST(FCL_GEOMETRY_INSTANCING, transform_bv)
+{
+  aligned_vector<Transform3<double>> transforms;
+  double extents[] = {-10, -10, -10, 10, 10, 10};
+  test::generateRandomTransforms(extents, transforms, 100);
+
+  const std::vector<Vector3<double>> points = {
+      Vector3<double>(1, 2, 3), Vector3<double>(-2, 0.5, 1),
+      Vector3<double>(0, -1, -4), Vector3<double>(3, 3, -1)};
+
+  AABB<double> aabb;
+  KDOP<double, 24> kdop;
+  for(const auto& p : points)
+  {
+    aabb += p;
+    kdop += p;
+  }
+
+  for(const auto& tf : transforms)
+  {
+    AABB<double> aabb2;
+    KDOP<double, 24> kdop2;
+    transformBV(aabb, tf, aabb2);
+    transformBV(kdop, tf, kdop2);
+    // Pull the points slightly inside, off the boundary of the volumes
+    for(const auto& p : points)
+    {
+      EXPECT_TRUE(aabb2.contain(tf * (p * (1 - 1e-6))));
+      EXPECT_TRUE(kdop2.inside(tf * (p * (1 - 1e-6))));
+    }
+  }
+}
+
+//==============================================================================
+GTEST_TEST(FCL_GEOMETRY_INSTANCING, mesh_mesh_queries)
+{
+  testInstancedMeshes<AABB<double>>();
+  testInstancedMeshes<KDOP<double, 24>>();
+  testInstancedMeshes<RSS<double>>();
+}
+
+//==============================================================================
+GTEST_TEST(FCL_GEOMETRY_INSTANCING, mesh_shape_queries)
+{
+  testInstancedMeshShape<AABB<double>>(Box<double>(400, 300, 200));
+  testInstancedMeshShape<KDOP<double, 18>>(Sphere<double>(250));
+  testInstancedMeshShape<KDOP<double, 16>>(Capsule<double>(100, 500));
+}
+
+//==============================================================================
+int main(int argc, char* argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -34,11 +34,17 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <thread>
+
 #include <gtest/gtest.h>
 
 #include "fcl/broadphase/detail/morton.h"
 #include "fcl/config.h"
 #include "fcl/math/bv/AABB.h"
+#include "fcl/math/motion/interp_motion.h"
+#include "fcl/math/motion/screw_motion.h"
+#include "fcl/math/motion/spline_motion.h"
+#include "fcl/math/motion/translation_motion.h"
 
 using namespace fcl;
 
@@ -129,6 +135,80 @@ GTEST_TEST(FCL_MATH, morton)
   test_morton<double>();
 }
 
+template <typename S>
+void test_motion_evaluate(const MotionBase<S>& motion)
+{
+  // evaluate() must agree with the legacy integrate()/getCurrentTransform()
+  // pair and must not disturb the cached current transform.
+  motion.integrate(0.25);
+  Transform3<S> cached;
+  motion.getCurrentTransform(cached);
+
+  for(int i = 0; i <= 10; ++i)
+  {
+    S t = i / (S)10;
+    Transform3<S> tf = motion.evaluate(t);
+
+    Transform3<S> current;
+    motion.getCurrentTransform(current);
+    EXPECT_TRUE(current.isApprox(cached));
+
+    motion.integrate(t);
+    motion.getCurrentTransform(current);
+    EXPECT_TRUE(tf.isApprox(current));
+
+    motion.integrate(0.25);
+  }
+
+  // Times outside of [0, 1] are clamped
+  EXPECT_TRUE(motion.evaluate(-1).isApprox(motion.evaluate(0)));
+  EXPECT_TRUE(motion.evaluate(2).isApprox(motion.evaluate(1)));
+
+  // Concurrent evaluation of a shared motion
+  const int num_samples = 1000;
+  std::vector<Transform3<S>> expected(num_samples);
+  for(int i = 0; i < num_samples; ++i)
+    expected[i] = motion.evaluate(i / (S)(num_samples - 1));
+
+  std::vector<int> mismatches(4, 0);
+  std::vector<std::thread> threads;
+  for(int k = 0; k < 4; ++k)
+  {
+    threads.emplace_back([&, k]()
+    {
+      for(int i = 0; i < num_samples; ++i)
+      {
+        int j = (i * (k + 1)) % num_samples;
+        if(!motion.evaluate(j / (S)(num_samples - 1)).isApprox(expected[j]))
+          ++mismatches[k];
+      }
+    });
+  }
+  for(auto& thread : threads)
+    thread.join();
+
+  for(int k = 0; k < 4; ++k)
+    EXPECT_EQ(mismatches[k], 0);
+}
+
+GTEST_TEST(FCL_MATH, motion_evaluate)
+{
+  Transform3<double> tf1 = Transform3<double>::Identity();
+  tf1.translation() = Vector3<double>(1, -2, 0.5);
+  Transform3<double> tf2 = Transform3<double>::Identity();
+  tf2.linear() = AngleAxis<double>(0.7, Vector3<double>(1, 2, 3).normalized()).toRotationMatrix();
+  tf2.translation() = Vector3<double>(-3, 4, 2);
+
+  test_motion_evaluate<double>(TranslationMotion<double>(tf1, tf2));
+  test_motion_evaluate<double>(InterpMotion<double>(tf1, tf2));
+  test_motion_evaluate<double>(ScrewMotion<double>(tf1, tf2));
+  test_motion_evaluate<double>(SplineMotion<double>(
+      Vector3<double>(0, 0, 0), Vector3<double>(1, 0, 0),
+      Vector3<double>(2, 1, 0), Vector3<double>(3, 1, 1),
+      Vector3<double>(0.1, 0, 0), Vector3<double>(0.2, 0.1, 0),
+      Vector3<double>(0.3, 0.1, 0.1), Vector3<double>(0.4, 0.2, 0.1)));
+}
+
 //==============================================================================
 int main(int argc, char* argv[])
 {
@@ -36,9 +36,19 @@
 
 /** @author Jeongseok Lee <jslee02@gmail.com> */
 
+#include <sstream>
+#include <thread>
+#include <vector>
+
 #include <gtest/gtest.h>
 #include "fcl/common/profiler.h"
 
+#if FCL_ENABLE_PROFILING
+#include "fcl/broadphase/broadphase_dynamic_AABB_tree.h"
+#include "fcl/geometry/geometric_shape_to_BVH_model.h"
+#include "fcl/narrowphase/collision.h"
+#endif // FCL_ENABLE_PROFILING
+
 using namespace fcl;
 
 //==============================================================================
@@ -70,6 +80,129 @@ GTEST_TEST(FCL_PROFILER, basic)
   detail::Profiler::Status(std::cout);
 }
 
+//==============================================================================
+GTEST_TEST(FCL_PROFILER, counters_threads)
+{
+  const bool was_enabled = detail::Counters::enabled();
+  detail::Counters::enable();
+
+  const detail::CountersSnapshot before = detail::Counters::snapshot();
+
+  auto count = []()
+  {
+    for(int i = 0; i < 1000; ++i)
+    {
+      detail::ScopedTimer timer(detail::Timer::Collide);
+      detail::Counters::add(detail::Counter::BVTests);
+      detail::Counters::add(detail::Counter::LeafTests, 2);
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for(int i = 0; i < 4; ++i)
+    threads.emplace_back(count);
+  for(auto& thread : threads)
+    thread.join();
+
+  // The blocks of the exited threads are recycled and keep their totals.
+  std::thread(count).join();
+
+  const detail::CountersSnapshot diff = detail::Counters::snapshot() - before;
+  EXPECT_EQ(diff.count(detail::Counter::BVTests), 5000u);
+  EXPECT_EQ(diff.count(detail::Counter::LeafTests), 10000u);
+  EXPECT_EQ(diff.calls(detail::Timer::Collide), 5000u);
+  EXPECT_GE(diff.seconds(detail::Timer::Collide), 0.0);
+
+  // Nothing is counted while counting is off.
+  detail::Counters::enable(false);
+  const detail::CountersSnapshot disabled = detail::Counters::snapshot();
+  count();
+  const detail::CountersSnapshot disabled_diff
+      = detail::Counters::snapshot() - disabled;
+  EXPECT_EQ(disabled_diff.count(detail::Counter::BVTests), 0u);
+  EXPECT_EQ(disabled_diff.calls(detail::Timer::Collide), 0u);
+
+  detail::Counters::enable(was_enabled);
+}
+
+//==============================================================================
+GTEST_TEST(FCL_PROFILER, counters_snapshot_merge)
+{
+  detail::CountersSnapshot a;
+  a.counts[static_cast<std::size_t>(detail::Counter::GJKIterations)] = 10;
+  a.timer_calls[static_cast<std::size_t>(detail::Timer::Distance)] = 1;
+  a.timer_ticks[static_cast<std::size_t>(detail::Timer::Distance)] = 1000;
+  a.ticks_per_second = 1000.0;
+
+  detail::CountersSnapshot b;
+  b.counts[static_cast<std::size_t>(detail::Counter::GJKIterations)] = 5;
+  b.timer_calls[static_cast<std::size_t>(detail::Timer::Distance)] = 2;
+  b.timer_ticks[static_cast<std::size_t>(detail::Timer::Distance)] = 4000;
+  b.ticks_per_second = 2000.0;
+
+  a += b;
+  EXPECT_EQ(a.count(detail::Counter::GJKIterations), 15u);
+  EXPECT_EQ(a.calls(detail::Timer::Distance), 3u);
+  EXPECT_DOUBLE_EQ(a.seconds(detail::Timer::Distance), 3.0);
+
+  std::stringstream ss;
+  a.print(ss);
+  EXPECT_NE(ss.str().find("GJK iterations: 15"), std::string::npos);
+}
+
+#if FCL_ENABLE_PROFILING
+//==============================================================================
+GTEST_TEST(FCL_PROFILER, counters_queries)
+{
+  using S = double;
+
+  auto box = std::make_shared<BVHModel<OBBRSS<S>>>();
+  generateBVHModel(*box, Box<S>(1, 1, 1), Transform3<S>::Identity());
+  auto sphere = std::make_shared<Sphere<S>>(0.5);
+
+  std::vector<CollisionObject<S>*> objects;
+  for(int i = 0; i < 4; ++i)
+  {
+    objects.push_back(new CollisionObject<S>(
+        box, Transform3<S>(Translation3<S>(Vector3<S>(0.8 * i, 0, 0)))));
+  }
+
+  DynamicAABBTreeCollisionManager<S> manager;
+  manager.registerObjects(objects);
+  manager.setup();
+
+  detail::Counters::enable();
+  const detail::CountersSnapshot before = detail::Counters::snapshot();
+
+  int num_pairs = 0;
+  manager.collide(&num_pairs, [](CollisionObject<S>*, CollisionObject<S>*, void* cdata)
+  {
+    ++*static_cast<int*>(cdata);
+    return false;
+  });
+  EXPECT_EQ(num_pairs, 3);
+
+  CollisionObject<S> query(sphere, Transform3<S>(Translation3<S>(Vector3<S>(0.4, 0.4, 0))));
+  CollisionRequest<S> request;
+  CollisionResult<S> result;
+  collide(&query, objects[0], request, result);
+  EXPECT_TRUE(result.isCollision());
+
+  const detail::CountersSnapshot diff = detail::Counters::snapshot() - before;
+  detail::Counters::enable(false);
+
+  EXPECT_GT(diff.count(detail::Counter::BVTests), 0u);
+  EXPECT_GT(diff.count(detail::Counter::LeafTests), 0u);
+  EXPECT_EQ(diff.count(detail::Counter::BroadphasePairsPassed), 3u);
+  EXPECT_GE(diff.count(detail::Counter::BroadphasePairsTested), 3u);
+  EXPECT_EQ(diff.calls(detail::Timer::BroadphaseCollide), 1u);
+  EXPECT_EQ(diff.calls(detail::Timer::Collide), 1u);
+
+  for(auto object : objects)
+    delete object;
+}
+#endif // FCL_ENABLE_PROFILING
+
 //==============================================================================
 int main(int argc, char* argv[])
 {
@@ -0,0 +1,238 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/** @author Jia Pan */
+
+#include <gtest/gtest.h>
+
+#include "fcl/config.h"
+#include "fcl/geometry/bvh/quantized_BVH_model.h"
+#include "fcl/narrowphase/collision.h"
+#include "fcl/narrowphase/distance.h"
+#include "test_fcl_utility.h"
+#include "fcl_resources/config.h"
+
+using namespace fcl;
+
+//==============================================================================
+template <typename S>
+void loadEnvironment(BVHModel<OBBRSS<S>>& model)
+{
+  std::vector<Vector3<S>> points;
+  std::vector<Triangle> triangles;
+  test::loadOBJFile(TEST_RESOURCES_DIR"/env.obj", points, triangles);
+
+  model.beginModel();
+  model.addSubModel(points, triangles);
+  model.endModel();
+}
+
+//==============================================================================
+/// Decode the subtree of node b and check that its volumes contain all the
+/// vertices under it; returns these vertices
+template <typename S, typename Q>
+std::vector<Vector3<S>> checkQuantizedSubtree(
+    const QuantizedBVHModel<S, Q>& model, int b, const AABB<S>& parent_bv)
+{
+  const QuantizedBVNode<S, Q>& node = model.getBV(b);
+  const AABB<S> bv = node.getAABB(parent_bv);
+  EXPECT_TRUE(parent_bv.contain(bv));
+
+  std::vector<Vector3<S>> points;
+  if(node.isLeaf())
+  {
+    const Triangle& t = model.tri_indices[node.primitiveId()];
+    for(int i = 0; i < 3; ++i)
+      points.push_back(model.vertices[t[i]]);
+  }
+  else
+  {
+    points = checkQuantizedSubtree(model, node.leftChild(), bv);
+    const auto right = checkQuantizedSubtree(model, node.rightChild(), bv);
+    points.insert(points.end(), right.begin(), right.end());
+  }
+
+  const OBB<S> obb = node.getOBB(bv);
+  for(const auto& p : points)
+  {
+    EXPECT_TRUE(bv.contain(p));
+    EXPECT_TRUE(obb.contain(p));
+  }
+
+  return points;
+}
+
+//==============================================================================
+template <typename S, typename Q>
+void testQuantizedBVHModelIsConservative()
+{
+  BVHModel<OBBRSS<S>> model;
+  loadEnvironment(model);
+
+  QuantizedBVHModel<S, Q> qmodel;
+  EXPECT_EQ(qmodel.build(model), BVH_OK);
+  EXPECT_EQ(qmodel.getNumBVs(), model.getNumBVs());
+
+  const auto points = checkQuantizedSubtree(qmodel, 0, qmodel.getRootBV());
+  EXPECT_EQ(static_cast<int>(points.size()), 3 * model.num_tris);
+}
+
+//==============================================================================
+template <typename S, typename Q, typename Shape>
+void testQuantizedBVHModelShape(const Shape& shape)
+{
+  auto model = std::make_shared<BVHModel<OBBRSS<S>>>();
+  loadEnvironment(*model);
+
+  auto qmodel = std::make_shared<QuantizedBVHModel<S, Q>>();
+  qmodel->build(*model);
+
+  S extents[] = {-3000, -3000, -500, 3000, 3000, 1500};
+  aligned_vector<Transform3<S>> transforms;
+  test::generateRandomTransforms(extents, transforms, 100);
+
+  const Transform3<S> tf_mesh = transforms.back();
+
+  for(const auto& tf : transforms)
+  {
+    CollisionRequest<S> request(100000, false);
+    request.gjk_solver_type = GST_INDEP;
+    CollisionResult<S> expected;
+    CollisionResult<S> result;
+    collide(model.get(), tf_mesh, &shape, tf, request, expected);
+    collide(qmodel.get(), tf_mesh, &shape, tf, request, result);
+    EXPECT_EQ(result.numContacts(), expected.numContacts());
+
+    // Shape first goes through the same entry
+    CollisionResult<S> swapped;
+    collide(&shape, tf, qmodel.get(), tf_mesh, request, swapped);
+    EXPECT_EQ(swapped.numContacts(), expected.numContacts());
+
+    // Unsigned distance is not defined for penetrating shapes
+    if(expected.isCollision())
+      continue;
+
+    DistanceRequest<S> distance_request;
+    distance_request.gjk_solver_type = GST_INDEP;
+    DistanceResult<S> expected_distance;
+    DistanceResult<S> distance_result;
+    distance(model.get(), tf_mesh, &shape, tf, distance_request, expected_distance);
+    distance(qmodel.get(), tf_mesh, &shape, tf, distance_request, distance_result);
+    EXPECT_NEAR(distance_result.min_distance, expected_distance.min_distance,
+                1e-6);
+  }
+}
+
+//==============================================================================
+GTEST_TEST(FCL_QUANTIZED_BVH_MODEL, node_size)
+{
+  EXPECT_LE(4 * sizeof(QuantizedBVNode16<double>),
+            sizeof(BVNode<OBBRSS<double>>));
+  EXPECT_LE(8 * sizeof(QuantizedBVNode8<double>),
+            sizeof(BVNode<OBBRSS<double>>));
+}
+
+//==============================================================================
+GTEST_TEST(FCL_QUANTIZED_BVH_MODEL, decoded_volumes_are_conservative)
+{
+  testQuantizedBVHModelIsConservative<double, std::uint8_t>();
+  testQuantizedBVHModelIsConservative<double, std::uint16_t>();
+}
+
+//==============================================================================
+GTEST_TEST(FCL_QUANTIZED_BVH_MODEL, shape_queries_match_bvh_model)
+{
+  testQuantizedBVHModelShape<double, std::uint8_t>(Box<double>(400, 300, 200));
+  testQuantizedBVHModelShape<double, std::uint16_t>(Box<double>(400, 300, 200));
+  testQuantizedBVHModelShape<double, std::uint16_t>(Sphere<double>(250));
+  testQuantizedBVHModelShape<double, std::uint16_t>(Capsule<double>(100, 500));
+}
+
+//==============================================================================
+GTEST_TEST(FCL_QUANTIZED_BVH_MODEL, node_types_are_appended)
+{
+  EXPECT_EQ(BV_KDOP24, 8);
+  EXPECT_EQ(GEOM_BOX, 9);
+  EXPECT_EQ(GEOM_OCTREE, 19);
+  EXPECT_EQ(BV_QUANTIZED8, BV_FLOAT_OBBRSS + 1);
+  EXPECT_EQ(BV_QUANTIZED16, BV_QUANTIZED8 + 1);
+  EXPECT_EQ(NODE_COUNT, BV_QUANTIZED16 + 1);
+}
+
+//==============================================================================
+GTEST_TEST(FCL_QUANTIZED_BVH_MODEL, mesh_mesh_is_unsupported)
+{
+  // Mesh-mesh queries with a quantized model have no dispatch entry; make sure
+  // the lookup tables keep reporting them as not supported
+  using Solver = detail::GJKSolver_indep<double>;
+  const auto& collision_table = getCollisionFunctionLookTable<Solver>();
+  const auto& distance_table = getDistanceFunctionLookTable<Solver>();
+
+  for(NODE_TYPE qtype : {BV_QUANTIZED8, BV_QUANTIZED16})
+  {
+    for(NODE_TYPE other : {BV_OBBRSS, BV_FLOAT_OBBRSS, BV_QUANTIZED8,
+                           BV_QUANTIZED16, GEOM_OCTREE})
+    {
+      EXPECT_EQ(collision_table.collision_matrix[qtype][other], nullptr);
+      EXPECT_EQ(collision_table.collision_matrix[other][qtype], nullptr);
+      EXPECT_EQ(distance_table.distance_matrix[qtype][other], nullptr);
+      EXPECT_EQ(distance_table.distance_matrix[other][qtype], nullptr);
+    }
+
+    EXPECT_NE(collision_table.collision_matrix[qtype][GEOM_BOX], nullptr);
+    EXPECT_NE(distance_table.distance_matrix[qtype][GEOM_BOX], nullptr);
+  }
+
+  auto model = std::make_shared<BVHModel<OBBRSS<double>>>();
+  loadEnvironment(*model);
+  auto qmodel = std::make_shared<QuantizedBVHModel<double, std::uint16_t>>();
+  qmodel->build(*model);
+
+  // The models overlap, but the unsupported pair reports no contact
+  CollisionRequest<double> request;
+  request.gjk_solver_type = GST_INDEP;
+  CollisionResult<double> result;
+  EXPECT_EQ(collide(qmodel.get(), Transform3<double>::Identity(), model.get(),
+                    Transform3<double>::Identity(), request, result), 0u);
+  EXPECT_FALSE(result.isCollision());
+}
+
+//==============================================================================
+int main(int argc, char* argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
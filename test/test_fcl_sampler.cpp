@@ -0,0 +1,229 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @author Jia Pan */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "fcl/math/detail/seed.h"
+#include "fcl/math/sampler/sampler_r.h"
+#include "fcl/math/sampler/sampler_se2.h"
+#include "fcl/math/sampler/sampler_se2_disk.h"
+#include "fcl/math/sampler/sampler_se3_euler_ball.h"
+#include "fcl/math/sampler/sampler_se3_quat.h"
+#include "fcl/math/sampler/sampler_se3_quat_ball.h"
+
+using namespace fcl;
+
+//==============================================================================
+template <typename S>
+void test_sample_batch_bounds(SamplingSequenceType type)
+{
+  const std::size_t n = 5000;
+  MatrixX<S> samples;
+
+  SamplerR<S, 4> sampler_r(VectorN<S, 4>(-1, 0, 2, -3), VectorN<S, 4>(1, 1, 3, -2));
+  sampler_r.setSequenceType(type);
+  sampler_r.sampleBatch(n, samples, 2);
+  EXPECT_EQ(samples.rows(), (int)n);
+  EXPECT_EQ(samples.cols(), 4);
+  EXPECT_GE(samples.col(0).minCoeff(), -1);
+  EXPECT_LT(samples.col(0).maxCoeff(), 1);
+  EXPECT_GE(samples.col(3).minCoeff(), -3);
+  EXPECT_LT(samples.col(3).maxCoeff(), -2);
+
+  SamplerSE2<S> sampler_se2(0, 1, -1, 1);
+  sampler_se2.setSequenceType(type);
+  sampler_se2.sampleBatch(n, samples);
+  EXPECT_EQ(samples.cols(), 3);
+  EXPECT_GE(samples.col(0).minCoeff(), 0);
+  EXPECT_LT(samples.col(0).maxCoeff(), 1);
+  EXPECT_GE(samples.col(1).minCoeff(), -1);
+  EXPECT_LT(samples.col(1).maxCoeff(), 1);
+  EXPECT_GE(samples.col(2).minCoeff(), -constants<S>::pi());
+  EXPECT_LT(samples.col(2).maxCoeff(), constants<S>::pi());
+
+  SamplerSE2_disk<S> sampler_disk(1, 2, 0.5, 1.5, 0, 0);
+  sampler_disk.setSequenceType(type);
+  sampler_disk.sampleBatch(n, samples);
+  for(std::size_t i = 0; i < n; ++i)
+  {
+    const S r = Vector2<S>(samples(i, 0) - 1, samples(i, 1) - 2).norm();
+    EXPECT_GE(r, 0.5 - 1e-4);
+    EXPECT_LE(r, 1.5 + 1e-4);
+  }
+
+  SamplerSE3Quat<S> sampler_quat(Vector3<S>(0, 0, 0), Vector3<S>(1, 2, 3));
+  sampler_quat.setSequenceType(type);
+  sampler_quat.sampleBatch(n, samples, 0);
+  EXPECT_EQ(samples.cols(), 7);
+  EXPECT_LT(samples.col(2).maxCoeff(), 3);
+  for(std::size_t i = 0; i < n; ++i)
+    EXPECT_NEAR(samples.row(i).tail(4).norm(), 1, 1e-4);
+
+  SamplerSE3Quat_ball<S> sampler_quat_ball(2);
+  sampler_quat_ball.setSequenceType(type);
+  sampler_quat_ball.sampleBatch(n, samples);
+  for(std::size_t i = 0; i < n; ++i)
+  {
+    EXPECT_LE(samples.row(i).head(3).norm(), 2 + 1e-4);
+    EXPECT_NEAR(samples.row(i).tail(4).norm(), 1, 1e-4);
+  }
+
+  SamplerSE3Euler_ball<S> sampler_euler_ball(2);
+  sampler_euler_ball.setSequenceType(type);
+  sampler_euler_ball.sampleBatch(n, samples);
+  EXPECT_EQ(samples.cols(), 6);
+  EXPECT_LE(samples.rightCols(3).cwiseAbs().maxCoeff(), constants<S>::pi() + 1e-4);
+}
+
+//==============================================================================
+template <typename S>
+void test_sample_batch_deterministic(SamplingSequenceType type)
+{
+  const std::size_t n = 10000;
+
+  SamplerSE3Quat<S> sampler(Vector3<S>(-1, -1, -1), Vector3<S>(1, 1, 1));
+  sampler.setSequenceType(type);
+
+  MatrixX<S> single_thread_1, single_thread_2;
+  sampler.setStreamSeed(42);
+  sampler.sampleBatch(n, single_thread_1, 1);
+  sampler.sampleBatch(n, single_thread_2, 1);
+
+  MatrixX<S> multi_thread_1, multi_thread_2;
+  sampler.setStreamSeed(42);
+  sampler.sampleBatch(n, multi_thread_1, 4);
+  sampler.sampleBatch(n, multi_thread_2, 3);
+
+  EXPECT_TRUE(single_thread_1 == multi_thread_1);
+  EXPECT_TRUE(single_thread_2 == multi_thread_2);
+
+  // Successive batches continue the stream rather than repeating it
+  EXPECT_FALSE(single_thread_1 == single_thread_2);
+}
+
+//==============================================================================
+template <typename S>
+void test_sample_batch_stratified(SamplingSequenceType type)
+{
+  // The first 2^k points of the Sobol and Halton (base 2) sequences put one
+  // point in each interval [i / 2^k, (i + 1) / 2^k) of the first coordinate
+  const std::size_t n = 1024;
+
+  SamplerR<S, 2> sampler(VectorN<S, 2>(0, 0), VectorN<S, 2>(1, 1));
+  sampler.setSequenceType(type);
+
+  MatrixX<S> samples;
+  sampler.sampleBatch(n, samples, 2);
+
+  std::set<int> cells;
+  for(std::size_t i = 0; i < n; ++i)
+    cells.insert(static_cast<int>(samples(i, 0) * n));
+  EXPECT_EQ(cells.size(), n);
+}
+
+//==============================================================================
+GTEST_TEST(FCL_SAMPLER, sample_batch_bounds)
+{
+  test_sample_batch_bounds<double>(SST_RANDOM);
+  test_sample_batch_bounds<double>(SST_HALTON);
+  test_sample_batch_bounds<double>(SST_SOBOL);
+  test_sample_batch_bounds<float>(SST_RANDOM);
+}
+
+//==============================================================================
+GTEST_TEST(FCL_SAMPLER, sample_batch_deterministic)
+{
+  test_sample_batch_deterministic<double>(SST_RANDOM);
+  test_sample_batch_deterministic<double>(SST_SOBOL);
+  test_sample_batch_deterministic<double>(SST_HALTON);
+}
+
+//==============================================================================
+GTEST_TEST(FCL_SAMPLER, sample_batch_stratified)
+{
+  test_sample_batch_stratified<double>(SST_HALTON);
+  test_sample_batch_stratified<double>(SST_SOBOL);
+}
+
+//==============================================================================
+GTEST_TEST(FCL_SAMPLER, seed_sequence_concurrent)
+{
+  const std::size_t num_threads = 8;
+  const std::size_t num_seeds = 1000;
+
+  // Each seed of the sequence is handed out exactly once, whatever the
+  // interleaving of the threads
+  detail::Seed::resetSequence();
+  std::vector<std::vector<std::uint_fast32_t>> seeds(num_threads);
+  std::vector<std::thread> threads;
+  for(std::size_t i = 0; i < num_threads; ++i)
+  {
+    threads.emplace_back([&seeds, i]()
+    {
+      for(std::size_t j = 0; j < num_seeds; ++j)
+        seeds[i].push_back(detail::Seed::getNextSeed());
+    });
+  }
+  for(auto& thread : threads)
+    thread.join();
+
+  std::vector<std::uint_fast32_t> drawn, expected;
+  for(const auto& thread_seeds : seeds)
+    drawn.insert(drawn.end(), thread_seeds.begin(), thread_seeds.end());
+  for(std::size_t i = 0; i < num_threads * num_seeds; ++i)
+    expected.push_back(detail::Seed::getSeed(i));
+  std::sort(drawn.begin(), drawn.end());
+  std::sort(expected.begin(), expected.end());
+  EXPECT_TRUE(drawn == expected);
+
+  // The sequence restarts from the same first seed
+  detail::Seed::resetSequence();
+  EXPECT_EQ(detail::Seed::getNextSeed(), detail::Seed::getSeed(0));
+  EXPECT_EQ(detail::Seed::getNextSeed(), detail::Seed::getSeed(1));
+}
+
+//==============================================================================
+int main(int argc, char* argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,139 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @author Jia Pan */
+
+#include <gtest/gtest.h>
+
+#include "fcl/math/motion/screw_motion.h"
+#include "fcl/math/motion/taylor_model/taylor_matrix.h"
+
+using namespace fcl;
+
+//==============================================================================
+template <typename S>
+void test_taylor_model_bound()
+{
+  std::shared_ptr<TimeInterval<S>> time_interval(new TimeInterval<S>(0, 1));
+
+  // 1 + 2t + [-0.1, 0.1] over [0, 1]
+  TaylorModel<S> tm(1, 2, 0, 0, Interval<S>(-0.1, 0.1), time_interval);
+  const Interval<S> bound = tm.getBound();
+  EXPECT_NEAR(bound[0], 0.9, 1e-12);
+  EXPECT_NEAR(bound[1], 3.1, 1e-12);
+
+  // A constant sine has a zero remainder
+  TaylorModel<S> sin_model(time_interval);
+  sin_model.remainder().setValue(5, 6);
+  generateTaylorModelForSinFunc(sin_model, (S)0, (S)0.5);
+  EXPECT_EQ(sin_model.remainder()[0], 0);
+  EXPECT_EQ(sin_model.remainder()[1], 0);
+  EXPECT_NEAR(sin_model.coeff(0), std::sin(0.5), 1e-12);
+}
+
+//==============================================================================
+template <typename S>
+void test_taylor_vector_dot()
+{
+  std::shared_ptr<TimeInterval<S>> time_interval(new TimeInterval<S>(0, 1));
+
+  TaylorModel<S> x(time_interval), y(time_interval), z(time_interval);
+  generateTaylorModelForSinFunc(x, (S)1.3, (S)0.2);
+  generateTaylorModelForCosFunc(y, (S)-0.7, (S)0.4);
+  generateTaylorModelForLinearFunc(z, (S)0.5, (S)-2);
+  TVector3<S> v(x, y, z);
+  Vector3<S> w(0.3, -1.5, 2);
+
+  const TaylorModel<S> dot = v.dot(w);
+  const TaylorModel<S> expected = x * w[0] + y * w[1] + z * w[2];
+  for(std::size_t k = 0; k < 4; ++k)
+    EXPECT_NEAR(dot.coeff(k), expected.coeff(k), 1e-12);
+  EXPECT_NEAR(dot.remainder()[0], expected.remainder()[0], 1e-12);
+  EXPECT_NEAR(dot.remainder()[1], expected.remainder()[1], 1e-12);
+}
+
+//==============================================================================
+template <typename S>
+void test_screw_motion_taylor_model()
+{
+  Transform3<S> tf1 = Transform3<S>::Identity();
+  tf1.translation() = Vector3<S>(-1, 0.5, 0);
+  Transform3<S> tf2 = Transform3<S>::Identity();
+  tf2.linear() = AngleAxis<S>(1.2, Vector3<S>(0.3, 0.5, 1).normalized()).toRotationMatrix();
+  tf2.translation() = Vector3<S>(1, 2, 3);
+  ScrewMotion<S> motion(tf1, tf2);
+
+  TMatrix3<S> R;
+  TVector3<S> T;
+  motion.getTaylorModel(R, T);
+
+  // The bound of the point trajectory contains every point of the trajectory
+  const Vector3<S> p(0.5, -0.25, 1);
+  const IVector3<S> bound = (R * p + T).getTightBound();
+  for(int i = 0; i <= 20; ++i)
+  {
+    const Vector3<S> q = motion.evaluate(i / (S)20) * p;
+    for(int j = 0; j < 3; ++j)
+    {
+      EXPECT_LE(bound[j][0], q[j] + 1e-9);
+      EXPECT_GE(bound[j][1], q[j] - 1e-9);
+    }
+  }
+}
+
+//==============================================================================
+GTEST_TEST(FCL_TAYLOR_MODEL, bound)
+{
+  test_taylor_model_bound<double>();
+}
+
+//==============================================================================
+GTEST_TEST(FCL_TAYLOR_MODEL, vector_dot)
+{
+  test_taylor_vector_dot<double>();
+}
+
+//==============================================================================
+GTEST_TEST(FCL_TAYLOR_MODEL, screw_motion)
+{
+  test_screw_motion_taylor_model<double>();
+}
+
+//==============================================================================
+int main(int argc, char* argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
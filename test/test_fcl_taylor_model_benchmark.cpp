@@ -0,0 +1,216 @@
+/*
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2011-2014, Willow Garage, Inc.
+ *  Copyright (c) 2014-2016, Open Source Robotics Foundation
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @author Jia Pan */
+
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "fcl/math/detail/taylor_kernels.h"
+#include "fcl/math/motion/screw_motion.h"
+#include "fcl/math/motion/taylor_model/taylor_matrix.h"
+#include "test_fcl_utility.h"
+
+using namespace fcl;
+
+//==============================================================================
+/// @brief Random Taylor models and intervals for the kernel comparisons and
+/// timings. Interval endpoints take both signs so that all the cases of the
+/// interval products are exercised.
+template <typename S>
+struct KernelData
+{
+  std::vector<S> coeffs; // 4 per model
+  std::vector<S> intervals; // 2 per interval
+  TimeInterval<S> time_interval;
+
+  explicit KernelData(std::size_t n) : time_interval(0, 1)
+  {
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<S> coeff(-2, 2);
+    coeffs.resize(4 * n);
+    intervals.resize(2 * n);
+    for(std::size_t i = 0; i < n; ++i)
+    {
+      for(std::size_t k = 0; k < 4; ++k)
+        coeffs[4 * i + k] = coeff(rng);
+      S a = coeff(rng), b = coeff(rng);
+      if(a > b) std::swap(a, b);
+      intervals[2 * i] = a;
+      intervals[2 * i + 1] = b;
+    }
+  }
+
+  std::size_t size() const { return intervals.size() / 2; }
+};
+
+//==============================================================================
+/// @brief The core of TaylorModel::operator *=, followed by the bound of the
+/// product, for consecutive pairs of models. Returns a checksum of the bounds
+template <typename Kernels, typename S>
+S multiplyAndBound(const KernelData<S>& data, int repeats)
+{
+  const TimeInterval<S>& t = data.time_interval;
+  const std::size_t n = data.size();
+  S checksum = 0;
+  for(int r = 0; r < repeats; ++r)
+  {
+    for(std::size_t i = 0; i < n; ++i)
+    {
+      const std::size_t j = (i + 1) % n;
+      S c[4], high[3], remainder[2], product[2], bound[2];
+      Kernels::multiply(&data.coeffs[4 * i], &data.coeffs[4 * j], c, high);
+      Kernels::intervalDot3(t.t4_.i_, t.t5_.i_, t.t6_.i_, high, remainder);
+      Kernels::intervalMultiply(&data.intervals[2 * i], &data.intervals[2 * j], product);
+      Kernels::intervalDot3(t.t_.i_, t.t2_.i_, t.t3_.i_, c + 1, bound);
+      Kernels::intervalScale(product, c[0], product);
+      checksum += bound[1] - bound[0] + remainder[1] - remainder[0] + product[1];
+    }
+  }
+  return checksum;
+}
+
+//==============================================================================
+template <typename Kernels, typename S>
+void computeKernels(const KernelData<S>& data, std::size_t i,
+                    S* c, S* high, S* interval_product, S* interval_scale,
+                    S* dot)
+{
+  const TimeInterval<S>& t = data.time_interval;
+  const std::size_t j = (i + 1) % data.size();
+  Kernels::multiply(&data.coeffs[4 * i], &data.coeffs[4 * j], c, high);
+  Kernels::intervalMultiply(&data.intervals[2 * i], &data.intervals[2 * j], interval_product);
+  Kernels::intervalScale(&data.intervals[2 * i], data.coeffs[4 * j], interval_scale);
+  Kernels::intervalDot3(t.t_.i_, t.t2_.i_, t.t3_.i_, &data.coeffs[4 * i + 1], dot);
+}
+
+//==============================================================================
+GTEST_TEST(FCL_TAYLOR_MODEL_BENCHMARK, packed_kernels_match_scalar)
+{
+#if FCL_TAYLOR_KERNELS_SSE2
+  KernelData<double> data(1000);
+  for(std::size_t i = 0; i < data.size(); ++i)
+  {
+    double c[4], high[3], product[2], scale[2], dot[2];
+    double c_ref[4], high_ref[3], product_ref[2], scale_ref[2], dot_ref[2];
+    computeKernels<detail::SSE2TaylorKernels>(data, i, c, high, product, scale, dot);
+    computeKernels<detail::ScalarTaylorKernels<double>>(data, i, c_ref, high_ref, product_ref, scale_ref, dot_ref);
+
+    for(int k = 0; k < 4; ++k)
+      EXPECT_NEAR(c[k], c_ref[k], 1e-12);
+    for(int k = 0; k < 3; ++k)
+      EXPECT_NEAR(high[k], high_ref[k], 1e-12);
+    for(int k = 0; k < 2; ++k)
+    {
+      EXPECT_EQ(product[k], product_ref[k]);
+      EXPECT_EQ(scale[k], scale_ref[k]);
+      EXPECT_NEAR(dot[k], dot_ref[k], 1e-12);
+    }
+  }
+#endif
+}
+
+//==============================================================================
+GTEST_TEST(FCL_TAYLOR_MODEL_BENCHMARK, timing)
+{
+  const KernelData<double> data(1024);
+  const int repeats = 500;
+
+  test::Timer timer;
+  timer.start();
+  const double scalar_checksum
+      = multiplyAndBound<detail::ScalarTaylorKernels<double>>(data, repeats);
+  timer.stop();
+  const double scalar_time = timer.getElapsedTimeInMilliSec();
+  std::cout << "Taylor model product and bound, scalar: "
+            << scalar_time << " ms" << std::endl;
+
+#if FCL_TAYLOR_KERNELS_SSE2
+  timer.start();
+  const double packed_checksum
+      = multiplyAndBound<detail::SSE2TaylorKernels>(data, repeats);
+  timer.stop();
+  const double packed_time = timer.getElapsedTimeInMilliSec();
+  std::cout << "Taylor model product and bound, SSE2: "
+            << packed_time << " ms" << std::endl;
+  EXPECT_NEAR(packed_checksum, scalar_checksum,
+              1e-9 * std::abs(scalar_checksum));
+#endif
+
+  // Swept bound of a box under random screw motions, the use of the Taylor
+  // models by ContinuousCollisionObject
+  std::mt19937 rng(7);
+  std::uniform_real_distribution<double> uniform(-1, 1);
+  std::vector<ScrewMotion<double>> motions;
+  for(int i = 0; i < 1000; ++i)
+  {
+    Transform3<double> tf1 = Transform3<double>::Identity();
+    Transform3<double> tf2 = Transform3<double>::Identity();
+    tf1.translation() = Vector3<double>(uniform(rng), uniform(rng), uniform(rng));
+    tf2.translation() = Vector3<double>(uniform(rng), uniform(rng), uniform(rng));
+    const Vector3<double> axis = Vector3<double>(uniform(rng), uniform(rng), uniform(rng)).normalized();
+    tf2.linear() = AngleAxis<double>(3 * uniform(rng), axis).toRotationMatrix();
+    motions.emplace_back(tf1, tf2);
+  }
+
+  double width = 0;
+  timer.start();
+  for(const auto& motion : motions)
+  {
+    TMatrix3<double> R;
+    TVector3<double> T;
+    motion.getTaylorModel(R, T);
+    for(int corner = 0; corner < 8; ++corner)
+    {
+      const Vector3<double> p(corner & 1 ? 0.5 : -0.5,
+                              corner & 2 ? 0.5 : -0.5,
+                              corner & 4 ? 0.5 : -0.5);
+      const IVector3<double> bound = (R * p + T).getBound();
+      width += bound[0].diameter() + bound[1].diameter() + bound[2].diameter();
+    }
+  }
+  timer.stop();
+  std::cout << "Screw motion swept box bounds: "
+            << timer.getElapsedTimeInMilliSec() << " ms" << std::endl;
+  EXPECT_GT(width, 0);
+}
+
+//==============================================================================
+int main(int argc, char* argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
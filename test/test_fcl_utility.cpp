@@ -174,6 +174,12 @@ std::string getNodeTypeName(NODE_TYPE node_type)
     return std::string("GEOM_TRIANGLE");
   else if (node_type == GEOM_OCTREE)
     return std::string("GEOM_OCTREE");
+  else if (node_type == BV_FLOAT_OBBRSS)
+    return std::string("BV_FLOAT_OBBRSS");
+  else if (node_type == BV_QUANTIZED8)
+    return std::string("BV_QUANTIZED8");
+  else if (node_type == BV_QUANTIZED16)
+    return std::string("BV_QUANTIZED16");
   else
     return std::string("invalid");
 }